@@ -151,4 +151,66 @@
 #define CLCD_D6_PIN                 PIN_13
 #define CLCD_D7_PIN                 PIN_12
 
+/*-------------------------------------------------------*/
+/* Set Character LCD geometry of default instance :-    */
+/* 		         	                                     */
+/* Options : - CLCD_ROWS    : (1U --> 4U)                */
+/*           - CLCD_COLUMNS : (1U --> 20U) (4 rows)      */
+/*                            (1U --> 40U) (1, 2 rows)   */
+/* 	                          		 	                 */
+/*-------------------------------------------------------*/
+#define CLCD_ROWS    		       2U  /* Default : 2U */
+#define CLCD_COLUMNS    		   20U /* Default : 20U */
+
+/*-------------------------------------------------------*/
+/* Set size of asynchronous queue of each CLCD instance  */
+/* in bytes :-                                           */
+/* 		         	                                     */
+/* Options : - 2U, 4U, 8U, ... (power of 2 up to 32768U) */
+/* 	                          		 	                 */
+/*-------------------------------------------------------*/
+#define CLCD_QUEUE_SIZE    		   64U /* Default : 64U */
+
+/*-------------------------------------------------------*/
+/* Set maximum number of bytes sent per CLCD_Service     */
+/* call :-                                               */
+/* 		         	                                     */
+/* Options : - (1U --> CLCD_QUEUE_SIZE)                  */
+/* 	                          		 	                 */
+/*-------------------------------------------------------*/
+#define CLCD_SERVICE_BURST    	   8U /* Default : 8U */
+
+/*-------------------------------------------------------*/
+/* Set CLCD controller instruction execution times in    */
+/* microseconds :-                                       */
+/* 		         	                                     */
+/* Options : - Per controller datasheet (HD44780 at      */
+/*             270 KHz: 37 us and 1520 us)               */
+/* 	                          		 	                 */
+/*-------------------------------------------------------*/
+#define CLCD_INSTRUCTION_EXECUTION_TIME    		40U   /* Default : 40U */
+#define CLCD_LONG_INSTRUCTION_EXECUTION_TIME    1600U /* Default : 1600U */
+
+/*-------------------------------------------------------*/
+/* Select how CLCD driver waits for controller to        */
+/* finish an instruction :-                              */
+/* 		         	                                     */
+/* Options : - CLCD_TIMED_WAIT (RW pin tied to ground,   */
+/*             worst case execution times are waited)    */
+/*           - CLCD_BUSY_FLAG_POLLING (RW pin driven by  */
+/*             driver, busy flag is read back and        */
+/*             execution times above become a timeout)   */
+/* 	                          		 	                 */
+/*-------------------------------------------------------*/
+#define CLCD_WAIT_MODE    		   CLCD_TIMED_WAIT /* Default : CLCD_TIMED_WAIT */
+
+/*-------------------------------------------------------*/
+/* Set maximum number of CLCD instances (default         */
+/* instance of CLCD_Init included) :-                    */
+/* 		         	                                     */
+/* Options : - (1U --> 255U)                             */
+/* 	                          		 	                 */
+/*-------------------------------------------------------*/
+#define CLCD_MAX_INSTANCES    	   2U /* Default : 2U */
+
 #endif /* HAL_CLCD_CONFIG_H_ */
@@ -21,6 +21,37 @@
 /*                                                                                                          */
 /*----------------------------------------------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                           	     NEW DATA TYPES			               	         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* CLCD Instance Descriptor Type (filled by user then registered by CLCD_HandleInit) */
+typedef struct
+{
+	uint8_t dataPort;					/* GPIO_PORT_A --> GPIO_PORT_C */
+	uint8_t ctrlPort;					/* Port of RS, RW and E pins (GPIO_PORT_A --> GPIO_PORT_C) */
+	uint8_t rsPin;						/* GPIO_PIN_0 --> GPIO_PIN_15 (may be shared between panels) */
+	uint8_t rwPin;						/* GPIO_PIN_0 --> GPIO_PIN_15 (used in CLCD_WAIT_BUSY_FLAG mode only) */
+	uint8_t ePin;						/* GPIO_PIN_0 --> GPIO_PIN_15 (own pin of each panel) */
+	uint8_t dataPins[8];				/* D0..D7 pins (D0..D3 are not used in 4-bit mode) */
+	uint8_t mode;						/* CLCD_FOUR_BIT_MODE or CLCD_EIGHT_BIT_MODE */
+	uint8_t waitMode;					/* CLCD_WAIT_TIMED or CLCD_WAIT_BUSY_FLAG */
+	uint8_t rows;						/* Panel rows (1 --> 4) */
+	uint8_t columns;					/* Panel columns (rows * columns <= 80) */
+	uint8_t instanceId;					/* Set by CLCD_HandleInit, not to be changed by user */
+}CLCD_Handle_t;
+
+/* CLCD Text Box Type (framebuffer rows range that text is laid out in) */
+typedef struct
+{
+	uint8_t firstRow;					/* First row of box (0 --> rows - 1) */
+	uint8_t lastRow;					/* Last row of box (firstRow --> rows - 1) */
+	uint8_t alignment;					/* CLCD_ALIGN_LEFT, CLCD_ALIGN_RIGHT or CLCD_ALIGN_CENTER */
+	uint8_t wrapMode;					/* CLCD_WRAP_CHARACTER or CLCD_WRAP_WORD */
+}CLCD_TextBox_t;
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                           	   INTERFACE MACROS		                             */
@@ -44,9 +75,28 @@
 #define CLCD_DISPLAY_CLEAR_CMD 						    0x01U
 #define CLCD_ENTRY_MODE_CMD						  	    0x06U
 
+/* CLCD Handle Interface Modes */
+#define CLCD_FOUR_BIT_MODE								1U
+#define CLCD_EIGHT_BIT_MODE								2U
+
+/* CLCD Handle Wait Modes */
+#define CLCD_WAIT_TIMED									1U
+#define CLCD_WAIT_BUSY_FLAG								2U
+
 /* CLCD Rows */
 #define CLCD_ROW_0										0U
 #define CLCD_ROW_1										1U
+#define CLCD_ROW_2										2U
+#define CLCD_ROW_3										3U
+
+/* CLCD Text Box Alignments */
+#define CLCD_ALIGN_LEFT									0U
+#define CLCD_ALIGN_RIGHT								1U
+#define CLCD_ALIGN_CENTER								2U
+
+/* CLCD Text Box Wrap Modes */
+#define CLCD_WRAP_CHARACTER								0U
+#define CLCD_WRAP_WORD									1U
 
 /* CLCD Columns */
 #define CLCD_COLUMN_0								    0U
@@ -115,7 +165,8 @@ void CLCD_Init(void);
 /*--------------------------------------------------------------------------------*/
 /* @Return		 : ERROR_STATUS_t                                          		  */
 /*--------------------------------------------------------------------------------*/
-/* @Description	 : Send a command to Character LCD controller	                  */
+/* @Description	 : Queue a command to Character LCD controller (non-blocking,     */
+/*                 sent by CLCD_Service)                                          */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t CLCD_SendCommand(uint8_t Copy_Command);
 
@@ -132,7 +183,8 @@ ERROR_STATUS_t CLCD_SendCommand(uint8_t Copy_Command);
 /*--------------------------------------------------------------------------------*/
 /* @Return		 : ERROR_STATUS_t                                          		  */
 /*--------------------------------------------------------------------------------*/
-/* @Description	 : Write a character on Character CLCD		                      */
+/* @Description	 : Queue a character to be written on Character CLCD              */
+/*                 (non-blocking, sent by CLCD_Service)                           */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t CLCD_WriteCharacter(uint8_t Copy_Character);
 
@@ -375,7 +427,9 @@ void CLCD_SetEntryMode(void);
 /*--------------------------------------------------------------------------------*/
 /* @Return		 : ERROR_STATUS_t                                          		  */
 /*--------------------------------------------------------------------------------*/
-/* @Description	 : Write a string on the Character LCD display      		 	  */
+/* @Description	 : Write a string on the Character LCD display starting at cursor */
+/*                 cell, wrapping to next row at end of each row (see             */
+/*                 CLCD_HandleWriteString)                                        */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t CLCD_WriteString(uint8_t* Copy_pString);
 
@@ -437,15 +491,15 @@ ERROR_STATUS_t CLCD_SetCGRamAddress(uint8_t Copy_Location);
 ERROR_STATUS_t CLCD_WriteCustomCharactersOnCGRam(uint8_t* Copy_pCharacter,uint8_t Copy_Location);
 
 /*--------------------------------------------------------------------------------*/
-/* @Function Name: WriteCustomCharactersOnCGRam      							  */
+/* @Function Name: MoveCursor      							              */
 /*--------------------------------------------------------------------------------*/
 /* @Param(in)	 : uint8_t Copy_RowNumber    				                      */
 /*				   Brief: CLCD row number          						          */
-/*				   Range: (CLCD_ROW_0 --> CLCD_ROW_1)	                          */
+/*				   Range: (CLCD_ROW_0 --> CLCD_ROWS - 1)	                      */
 /*				   -------------------------------------------------------------- */
 /*                 uint8_t Copy_ColumnNumber                                      */
 /*				   Brief: CLCD column number							          */
-/*				   Range: (CLCD_COLUMN_0 --> CLCD_COLUMN_15)	                  */
+/*				   Range: (CLCD_COLUMN_0 --> CLCD_COLUMNS - 1)	                  */
 /*--------------------------------------------------------------------------------*/
 /* @Param(inout) : None                                                	          */
 /*--------------------------------------------------------------------------------*/
@@ -458,4 +512,947 @@ ERROR_STATUS_t CLCD_WriteCustomCharactersOnCGRam(uint8_t* Copy_pCharacter,uint8_
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t CLCD_MoveCursor(uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber);
 
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Service                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Runs asynchronous CLCD engine: clocks queued bytes out to CLCD */
+/*                 controller respecting its instruction execution time           */
+/*                 (CLCD_INSTRUCTION_EXECUTION_TIME per byte,                     */
+/*                 CLCD_LONG_INSTRUCTION_EXECUTION_TIME after clear/home, ended   */
+/*                 early by busy flag with CLCD_BUSY_FLAG_POLLING). Never waits   */
+/*                 for controller: stops once it is busy and resumes on next      */
+/*                 call, sending at most CLCD_SERVICE_BURST bytes per call. Call  */
+/*                 it periodically (e.g. from STK_TimerStart callback or a        */
+/*                 scheduler task). Returns BUSY_FUNC if it is already running in */
+/*                 another context                                                */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_Service(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Flush                                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Blocks until all queued bytes are sent and CLCD controller has */
+/*                 executed last of them. Returns BUSY_FUNC if engine is running  */
+/*                 in a context that the caller preempted                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_Flush(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetQueueDepth                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint16_t* Copy_pQueueDepth                                     */
+/*				   Brief: Pointer to variable that will hold number of bytes      */
+/*				          waiting in CLCD queue                                   */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets number of bytes waiting in CLCD queue to be sent to CLCD  */
+/*                 controller                                                     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_GetQueueDepth(uint16_t* Copy_pQueueDepth);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameClear                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Fills CLCD shadow framebuffer with spaces (panel is updated by */
+/*                 CLCD_FrameRefresh)                                             */
+/*--------------------------------------------------------------------------------*/
+void CLCD_FrameClear(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameWriteCharacter                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_RowNumber                                         */
+/*				   Brief: CLCD row number                                         */
+/*				   Range: (0 --> CLCD_ROWS - 1)                                   */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ColumnNumber                                      */
+/*				   Brief: CLCD column number                                      */
+/*				   Range: (0 --> CLCD_COLUMNS - 1)                                */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Character                                         */
+/*				   Brief: Character to be written in framebuffer                  */
+/*				   Range: Any value can be represented in 1 byte                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Writes a character in CLCD shadow framebuffer at passed cell   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_FrameWriteCharacter(uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber , uint8_t Copy_Character);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameWriteString                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_RowNumber                                         */
+/*				   Brief: CLCD row number                                         */
+/*				   Range: (0 --> CLCD_ROWS - 1)                                   */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ColumnNumber                                      */
+/*				   Brief: CLCD column number                                      */
+/*				   Range: (0 --> CLCD_COLUMNS - 1)                                */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pString                                    */
+/*				   Brief: Pointer to null terminated string                       */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Writes a string in CLCD shadow framebuffer starting at passed  */
+/*                 cell. String is truncated at end of row                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_FrameWriteString(uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber , const uint8_t* Copy_pString);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameWriteNumber                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_RowNumber                                         */
+/*				   Brief: CLCD row number                                         */
+/*				   Range: (0 --> CLCD_ROWS - 1)                                   */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ColumnNumber                                      */
+/*				   Brief: CLCD column number                                      */
+/*				   Range: (0 --> CLCD_COLUMNS - 1)                                */
+/*				   -------------------------------------------------------------- */
+/*                 sint32_t Copy_Number                                           */
+/*				   Brief: Number (could be positive or negative) to be written    */
+/*				   Range: Any sint32_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Writes an integer number in CLCD shadow framebuffer starting   */
+/*                 at passed cell. Number is truncated at end of row              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_FrameWriteNumber(uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber , sint32_t Copy_Number);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameWriteText                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_TextBox_t* Copy_pTextBox                            */
+/*				   Brief: Pointer to text box (rows range, alignment and wrap     */
+/*				          mode) that text is laid out in                          */
+/*				   Range: Any pointer to CLCD_TextBox_t within instance geometry  */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pText                                      */
+/*				   Brief: Pointer to null terminated text ('\n' starts a new      */
+/*				          line)                                                   */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Lays text out in shadow framebuffer rows of passed text box:   */
+/*                 text is broken into lines at box width (by words or            */
+/*                 characters), each line is aligned and remaining box rows are   */
+/*                 blanked. If text needs more lines than box has, box is         */
+/*                 scrolled so that its last lines are shown (panel is updated by */
+/*                 CLCD_FrameRefresh)                                             */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_FrameWriteText(const CLCD_TextBox_t* Copy_pTextBox , const uint8_t* Copy_pText);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameAppendText                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_TextBox_t* Copy_pTextBox                            */
+/*				   Brief: Pointer to text box (rows range, alignment and wrap     */
+/*				          mode) that text is laid out in                          */
+/*				   Range: Any pointer to CLCD_TextBox_t within instance geometry  */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pText                                      */
+/*				   Brief: Pointer to null terminated text ('\n' starts a new      */
+/*				          line)                                                   */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Scrolls rows of passed text box up by one row for each line of */
+/*                 text then writes that line in last row of box (scrolling       */
+/*                 region), so that box keeps showing latest lines like a         */
+/*                 terminal (panel is updated by CLCD_FrameRefresh)               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_FrameAppendText(const CLCD_TextBox_t* Copy_pTextBox , const uint8_t* Copy_pText);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameRefresh                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Compares CLCD shadow framebuffer with last image sent to panel */
+/*                 and queues only changed character runs, each preceded by a     */
+/*                 DDRAM address instruction unless cursor is already there       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_FrameRefresh(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameInvalidate                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Forgets last image sent to panel so that next                  */
+/*                 CLCD_FrameRefresh redraws every cell (use after writing panel  */
+/*                 through direct CLCD functions)                                 */
+/*--------------------------------------------------------------------------------*/
+void CLCD_FrameInvalidate(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ReadDDRam                                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Address                                           */
+/*				   Brief: DDRAM address of first character to be read             */
+/*				   Range: (0x00 --> 0x7F)                                         */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Length                                            */
+/*				   Brief: Number of characters to be read                         */
+/*				   Range: (1 --> 0x80 - Copy_Address)                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pData                                            */
+/*				   Brief: Pointer to array that will hold read characters         */
+/*				   Range: Any pointer to array of Copy_Length bytes               */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Flushes CLCD queue then reads characters back from controller  */
+/*                 DDRAM (e.g. to verify panel contents) and restores address     */
+/*                 counter to its previous DDRAM position. Requires               */
+/*                 CLCD_BUSY_FLAG_POLLING (returns RT_NOK otherwise) and returns  */
+/*                 BUSY_FUNC if engine is running in a context that the caller    */
+/*                 preempted                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_ReadDDRam(uint8_t Copy_Address , uint8_t* Copy_pData , uint8_t Copy_Length);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: RequestGlyph                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const uint8_t* Copy_pGlyph                                     */
+/*				   Brief: Pointer to 8 pattern rows of custom character (5 low    */
+/*				          bits of each row are used)                              */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pSlot                                            */
+/*				   Brief: Pointer to variable that will hold character code of    */
+/*				          glyph (CGRAM slot) to be written on CLCD                */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Returns CGRAM slot holding passed glyph. If glyph is not       */
+/*                 loaded, it is queued to a free slot or to least recently used  */
+/*                 slot whose character is not shown in framebuffer or last sent  */
+/*                 frame, then cursor is returned to its DDRAM address (first     */
+/*                 cell if it is unknown). Returns RT_NOK if every slot holds a   */
+/*                 glyph shown on screen (glyphs written on panel without         */
+/*                 framebuffer are protected by recent use only), BUSY_FUNC if    */
+/*                 queue can not take whole load                                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_RequestGlyph(const uint8_t* Copy_pGlyph , uint8_t* Copy_pSlot);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetGlyphStatistics                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pHits                                           */
+/*				   Brief: Pointer to variable that will hold number of requests   */
+/*				          found in cache                                          */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pMisses                                         */
+/*				   Brief: Pointer to variable that will hold number of requests   */
+/*				          not found in cache                                      */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets hit and miss counters of CLCD glyph cache                 */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_GetGlyphStatistics(uint32_t* Copy_pHits , uint32_t* Copy_pMisses);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ResetGlyphCache                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Forgets glyphs loaded in CLCD CGRAM and clears hit and miss    */
+/*                 counters                                                       */
+/*--------------------------------------------------------------------------------*/
+void CLCD_ResetGlyphCache(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleInit                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : CLCD_Handle_t* Copy_pHandle                                    */
+/*				   Brief: Pointer to CLCD instance descriptor filled with pin     */
+/*				          map, geometry and modes (instanceId is set by function) */
+/*				   Range: Any pointer to CLCD_Handle_t                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Registers a CLCD instance in instances pool (or re-initializes */
+/*                 an already registered one), sets up its pins and sends         */
+/*                 initialization sequence to its controller. Panels may share    */
+/*                 data, RS and RW pins as long as each has its own E pin. Call   */
+/*                 it before servicing starts                                     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleInit(CLCD_Handle_t* Copy_pHandle);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleSendCommand                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Command                                           */
+/*				   Brief: Command to be sent to CLCD controller                   */
+/*				   Range: Same commands as CLCD_SendCommand                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Queue a command to controller of passed CLCD instance (non-    */
+/*                 blocking, sent by CLCD_HandleService or CLCD_ServiceAll)       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleSendCommand(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_Command);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleWriteCharacter                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Character                                         */
+/*				   Brief: Character to be written on CLCD display                 */
+/*				   Range: Any value can be represented in 1 byte                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Queue a character to be written on passed CLCD instance (non-  */
+/*                 blocking)                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleWriteCharacter(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_Character);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleWriteString                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t* Copy_pString                                          */
+/*				   Brief: Pointer to first character of null terminated string to */
+/*				          be written on CLCD                                      */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Write a string on passed CLCD instance starting at cursor      */
+/*                 cell. Once end of a row is reached (or '\n' is met), string    */
+/*                 continues at first cell of next row following instance         */
+/*                 geometry, and last row wraps to first row. A DDRAM address     */
+/*                 instruction is queued only where controller address counter   */
+/*                 does not already continue at that cell                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleWriteString(const CLCD_Handle_t* Copy_pHandle , uint8_t* Copy_pString);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleWriteNumber                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 sint32_t Copy_Number                                           */
+/*				   Brief: Number (could be positive or negative) to be written on */
+/*				          CLCD                                                    */
+/*				   Range: Any sint32_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Write an integer number (could be positive or negative) on     */
+/*                 passed CLCD instance. Stops at first digit that can not be     */
+/*                 queued and returns its status (BUSY_FUNC if queue is full      */
+/*                 while engine is running in preempted context)                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleWriteNumber(const CLCD_Handle_t* Copy_pHandle , sint32_t Copy_Number);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleSetCGRamAddress                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Location                                          */
+/*				   Brief: CGRAM location to be pointed to                         */
+/*				   Range: (0 --> 7)                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Force controller of passed CLCD instance to point to a CGRAM   */
+/*                 address                                                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleSetCGRamAddress(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_Location);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleWriteCustomCharactersOnCGRam                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t* Copy_pCharacter                                       */
+/*				   Brief: Pointer to 8 pattern rows of custom character           */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Location                                          */
+/*				   Brief: CGRAM location in which character will be stored        */
+/*				   Range: (0 --> 7)                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Add custom character to CGRAM of passed CLCD instance          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleWriteCustomCharactersOnCGRam(const CLCD_Handle_t* Copy_pHandle , uint8_t* Copy_pCharacter , uint8_t Copy_Location);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleMoveCursor                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_RowNumber                                         */
+/*				   Brief: CLCD row number                                         */
+/*				   Range: (0 --> rows - 1)                                        */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ColumnNumber                                      */
+/*				   Brief: CLCD column number                                      */
+/*				   Range: (0 --> columns - 1)                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Put the cursor at a specific cell of passed CLCD instance (row */
+/*                 DDRAM offsets follow instance geometry). Nothing is queued if  */
+/*                 cursor is already at that cell                                 */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleMoveCursor(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleService                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Runs asynchronous CLCD engine for passed instance only (see    */
+/*                 CLCD_Service). Returns BUSY_FUNC if engine is already running  */
+/*                 in another context                                             */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleService(const CLCD_Handle_t* Copy_pHandle);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ServiceAll                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Runs asynchronous CLCD engine over every registered instance,  */
+/*                 giving each a burst of up to CLCD_SERVICE_BURST bytes. Panel   */
+/*                 executing a long instruction is skipped so that refreshes of   */
+/*                 panels sharing the data bus are interleaved instead of         */
+/*                 serialized. Call it periodically (e.g. from a scheduler task)  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_ServiceAll(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFlush                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Blocks until all bytes queued for passed instance are sent and */
+/*                 its controller has executed last of them. Returns BUSY_FUNC if */
+/*                 engine is running in a context that the caller preempted       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFlush(const CLCD_Handle_t* Copy_pHandle);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleGetQueueDepth                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint16_t* Copy_pQueueDepth                                     */
+/*				   Brief: Pointer to variable that will hold number of bytes      */
+/*				          waiting in instance queue                               */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets number of bytes waiting in queue of passed CLCD instance  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleGetQueueDepth(const CLCD_Handle_t* Copy_pHandle , uint16_t* Copy_pQueueDepth);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameClear                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Fills shadow framebuffer of passed CLCD instance with spaces   */
+/*                 (panel is updated by CLCD_HandleFrameRefresh)                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameClear(const CLCD_Handle_t* Copy_pHandle);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameWriteCharacter                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_RowNumber                                         */
+/*				   Brief: CLCD row number                                         */
+/*				   Range: (0 --> rows - 1)                                        */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ColumnNumber                                      */
+/*				   Brief: CLCD column number                                      */
+/*				   Range: (0 --> columns - 1)                                     */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Character                                         */
+/*				   Brief: Character to be written in framebuffer                  */
+/*				   Range: Any value can be represented in 1 byte                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Writes a character in shadow framebuffer of passed CLCD        */
+/*                 instance at passed cell                                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameWriteCharacter(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber , uint8_t Copy_Character);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameWriteString                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_RowNumber                                         */
+/*				   Brief: CLCD row number                                         */
+/*				   Range: (0 --> rows - 1)                                        */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ColumnNumber                                      */
+/*				   Brief: CLCD column number                                      */
+/*				   Range: (0 --> columns - 1)                                     */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pString                                    */
+/*				   Brief: Pointer to null terminated string                       */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Writes a string in shadow framebuffer of passed CLCD instance  */
+/*                 starting at passed cell. String is truncated at end of row     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameWriteString(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber , const uint8_t* Copy_pString);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameWriteNumber                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_RowNumber                                         */
+/*				   Brief: CLCD row number                                         */
+/*				   Range: (0 --> rows - 1)                                        */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ColumnNumber                                      */
+/*				   Brief: CLCD column number                                      */
+/*				   Range: (0 --> columns - 1)                                     */
+/*				   -------------------------------------------------------------- */
+/*                 sint32_t Copy_Number                                           */
+/*				   Brief: Number (could be positive or negative) to be written    */
+/*				   Range: Any sint32_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Writes an integer number in shadow framebuffer of passed CLCD  */
+/*                 instance starting at passed cell. Number is truncated at end   */
+/*                 of row                                                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameWriteNumber(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber , sint32_t Copy_Number);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameWriteText                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 const CLCD_TextBox_t* Copy_pTextBox                            */
+/*				   Brief: Pointer to text box (rows range, alignment and wrap     */
+/*				          mode) that text is laid out in                          */
+/*				   Range: Any pointer to CLCD_TextBox_t within instance geometry  */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pText                                      */
+/*				   Brief: Pointer to null terminated text ('\n' starts a new      */
+/*				          line)                                                   */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Lays text out in shadow framebuffer rows of passed text box:   */
+/*                 text is broken into lines at box width (by words or            */
+/*                 characters), each line is aligned and remaining box rows are   */
+/*                 blanked. If text needs more lines than box has, box is         */
+/*                 scrolled so that its last lines are shown (panel is updated by */
+/*                 CLCD_HandleFrameRefresh)                                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameWriteText(const CLCD_Handle_t* Copy_pHandle , const CLCD_TextBox_t* Copy_pTextBox , const uint8_t* Copy_pText);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameAppendText                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 const CLCD_TextBox_t* Copy_pTextBox                            */
+/*				   Brief: Pointer to text box (rows range, alignment and wrap     */
+/*				          mode) that text is laid out in                          */
+/*				   Range: Any pointer to CLCD_TextBox_t within instance geometry  */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pText                                      */
+/*				   Brief: Pointer to null terminated text ('\n' starts a new      */
+/*				          line)                                                   */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Scrolls rows of passed text box up by one row for each line of */
+/*                 text then writes that line in last row of box (scrolling       */
+/*                 region), so that box keeps showing latest lines like a         */
+/*                 terminal (panel is updated by CLCD_HandleFrameRefresh)         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameAppendText(const CLCD_Handle_t* Copy_pHandle , const CLCD_TextBox_t* Copy_pTextBox , const uint8_t* Copy_pText);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameRefresh                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Compares shadow framebuffer of passed CLCD instance with last  */
+/*                 image sent to its panel and queues only changed character      */
+/*                 runs, each preceded by a DDRAM address instruction unless      */
+/*                 tracked address counter is already there (also across rows     */
+/*                 that follow each other in DDRAM)                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameRefresh(const CLCD_Handle_t* Copy_pHandle);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameInvalidate                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Forgets last image sent to panel of passed CLCD instance so    */
+/*                 that next CLCD_HandleFrameRefresh redraws every cell           */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameInvalidate(const CLCD_Handle_t* Copy_pHandle);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleReadDDRam                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Address                                           */
+/*				   Brief: DDRAM address of first character to be read             */
+/*				   Range: (0x00 --> 0x7F)                                         */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Length                                            */
+/*				   Brief: Number of characters to be read                         */
+/*				   Range: (1 --> 0x80 - Copy_Address)                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pData                                            */
+/*				   Brief: Pointer to array that will hold read characters         */
+/*				   Range: Any pointer to array of Copy_Length bytes               */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Flushes queue of passed CLCD instance then reads characters    */
+/*                 back from its controller DDRAM and restores address counter to */
+/*                 its previous DDRAM position. Requires CLCD_WAIT_BUSY_FLAG wait */
+/*                 mode (returns RT_NOK otherwise) and returns BUSY_FUNC if       */
+/*                 engine is running in a context that the caller preempted       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleReadDDRam(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_Address , uint8_t* Copy_pData , uint8_t Copy_Length);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleRequestGlyph                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pGlyph                                     */
+/*				   Brief: Pointer to 8 pattern rows of custom character (5 low    */
+/*				          bits of each row are used)                              */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pSlot                                            */
+/*				   Brief: Pointer to variable that will hold character code of    */
+/*				          glyph (CGRAM slot) to be written on CLCD                */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Returns CGRAM slot of passed CLCD instance holding passed      */
+/*                 glyph. If glyph is not loaded, it is queued to a free slot or  */
+/*                 to least recently used slot whose character is not shown in    */
+/*                 framebuffer or last sent frame, then cursor is returned to its */
+/*                 DDRAM address (first cell if it is unknown). Returns RT_NOK if */
+/*                 every slot holds a glyph shown on screen, BUSY_FUNC if queue   */
+/*                 can not take whole load                                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleRequestGlyph(const CLCD_Handle_t* Copy_pHandle , const uint8_t* Copy_pGlyph , uint8_t* Copy_pSlot);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleGetGlyphStatistics                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pHits                                           */
+/*				   Brief: Pointer to variable that will hold number of requests   */
+/*				          found in cache                                          */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pMisses                                         */
+/*				   Brief: Pointer to variable that will hold number of requests   */
+/*				          not found in cache                                      */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets hit and miss counters of glyph cache of passed CLCD       */
+/*                 instance                                                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleGetGlyphStatistics(const CLCD_Handle_t* Copy_pHandle , uint32_t* Copy_pHits , uint32_t* Copy_pMisses);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleResetGlyphCache                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Forgets glyphs loaded in CGRAM of passed CLCD instance and     */
+/*                 clears its hit and miss counters                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleResetGlyphCache(const CLCD_Handle_t* Copy_pHandle);
+
 #endif /* HAL_CLCD_INTERFACE_H_ */
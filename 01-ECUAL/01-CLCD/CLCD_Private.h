@@ -21,6 +21,131 @@
 #ifndef HAL_CLCD_PRIVATE_H_
 #define HAL_CLCD_PRIVATE_H_
 
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Define CLCD Register Select Values */
+#define CLCD_INSTRUCTION_REGISTER	0U
+#define CLCD_DATA_REGISTER			1U
+
+/* Define CLCD Queue Entry Fields (byte in bits [7:0], register select in bit 8) */
+#define CLCD_QUEUE_BYTE_MASK		0x00FFU
+#define CLCD_QUEUE_RS_BIT			8U
+
+/* Define Instructions With Long Execution Time (clear display and return home) */
+#define CLCD_CLEAR_DISPLAY_INSTRUCTION	0x01U
+#define CLCD_RETURN_HOME_INSTRUCTION	0x02U
+#define CLCD_RETURN_HOME_MASK			0xFEU
+
+/* Define Set DDRAM And CGRAM Address Instructions */
+#define CLCD_SET_DDRAM_ADDRESS_INSTRUCTION	0x80U
+#define CLCD_SET_CGRAM_ADDRESS_INSTRUCTION	0x40U
+
+/* Define Instructions That Change Direction or Position of Address Counter (entry mode and cursor shift) */
+#define CLCD_ENTRY_MODE_INSTRUCTION		0x04U
+#define CLCD_ENTRY_MODE_MASK			0xFCU
+#define CLCD_ENTRY_MODE_INCREMENT_BIT	1U
+#define CLCD_CURSOR_SHIFT_INSTRUCTION	0x10U
+#define CLCD_CURSOR_SHIFT_MASK			0xF8U
+
+/* Define DDRAM Lines of Controller in 2-Line Mode (40 characters each) */
+#define CLCD_SECOND_LINE_ADDRESS		0x40U
+#define CLCD_DDRAM_LINE_LENGTH			40U
+
+/* Define DDRAM Address of First Cell of a Row (4-row panels continue rows 0 and 1 after last column) */
+#define CLCD_ROW_DDRAM_ADDRESS(Row,Columns)		((((Row) & 1U) * CLCD_SECOND_LINE_ADDRESS) + (((Row) >> 1) * (Columns)))
+
+/* Define Address Counter Value After Writing a Character (end of each line continues at start of the other line) */
+#define CLCD_NEXT_DDRAM_ADDRESS(Address)		(((Address) == (CLCD_DDRAM_LINE_LENGTH - 1U)) ? CLCD_SECOND_LINE_ADDRESS : \
+												 (((Address) == (CLCD_SECOND_LINE_ADDRESS + CLCD_DDRAM_LINE_LENGTH - 1U)) ? 0U : ((Address) + 1U)))
+
+/* Define Maximum Geometry of CLCD Controller (80 characters of DDRAM on up to 4 rows) */
+#define CLCD_MAX_ROWS					4U
+#define CLCD_MAX_CELLS					80U
+
+/* Define CGRAM Geometry (8 glyphs of 8 rows, 5 pixels each; character codes 8 --> 15 mirror 0 --> 7) */
+#define CLCD_CGRAM_SLOTS				8U
+#define CLCD_CGRAM_SLOT_SHIFT			3U
+#define CLCD_GLYPH_ROWS					8U
+#define CLCD_GLYPH_ROW_MASK				0x1FU
+#define CLCD_GLYPH_CODES				16U
+
+/* Define Queue Bytes of One Glyph Load (CGRAM address, glyph rows and DDRAM address back) */
+#define CLCD_GLYPH_LOAD_BYTES			(CLCD_GLYPH_ROWS + 2U)
+
+/* Define Blank Framebuffer Cell */
+#define CLCD_BLANK_CHARACTER			' '
+
+/* Define BSRR Word That Drives One Pin to Selected Bit of Passed Value (set bit or reset bit of pin) */
+#define CLCD_PIN_BSRR(Value,Bit,Pin)		((((Value) >> (Bit)) & 1U) ? (1UL << (Pin)) : (1UL << ((Pin) + 16U)))
+
+/* Define BSRR Words That Drive One Pin High and Low */
+#define CLCD_PIN_SET_BSRR(Pin)			(1UL << (Pin))
+#define CLCD_PIN_RESET_BSRR(Pin)		(1UL << ((Pin) + 16U))
+
+/* Define Busy Flag and Address Counter Fields of Byte Read From Instruction Register */
+#define CLCD_BUSY_FLAG_BIT				7U
+#define CLCD_ADDRESS_COUNTER_MASK		0x7FU
+
+/* Define Size of CLCD Controller DDRAM Address Space */
+#define CLCD_DDRAM_ADDRESS_SPACE		0x80U
+
+/* Define CLCD Data Bus Directions */
+#define CLCD_BUS_WRITE					0U
+#define CLCD_BUS_READ					1U
+
+/* Define Width of E Pin Pulse and Nibble Setup Time in Microseconds */
+#define CLCD_ENABLE_PULSE_WIDTH		1U
+
+/* Define Power On Delay of CLCD Controller in Milliseconds */
+#define CLCD_POWER_ON_DELAY			40U
+
+/* Critical section macros are Cortex-M3 specific, a host build (05-TEST) defines its own before this header */
+#ifndef CLCD_ENTER_CRITICAL_SECTION
+
+/* Save PRIMASK then mask configurable interrupts (queues are shared with CLCD engine context) */
+#define CLCD_ENTER_CRITICAL_SECTION(Copy_PrimaskState)		__asm volatile("MRS %0, PRIMASK\n\tCPSID I" : "=r"(Copy_PrimaskState) : : "memory")
+
+/* Restore PRIMASK saved by CLCD_ENTER_CRITICAL_SECTION */
+#define CLCD_EXIT_CRITICAL_SECTION(Copy_PrimaskState)		__asm volatile("MSR PRIMASK, %0" : : "r"(Copy_PrimaskState) : "memory")
+
+#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                PRIVATE DATA TYPES                                 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* CLCD Instance Type (Element of instances pool, owned by a registered CLCD_Handle_t) */
+typedef struct
+{
+	const CLCD_Handle_t* pHandle;					/* Descriptor that registered instance */
+	uint32_t HighPinsMap[16];						/* BSRR word of D4..D7 pins for each nibble */
+	uint32_t LowPinsMap[16];						/* BSRR word of D0..D3 pins for each nibble (8-bit mode) */
+	volatile uint16_t Queue[CLCD_QUEUE_SIZE];		/* Queued bytes with their register select bit */
+	volatile uint16_t QueueHead;					/* Index of next byte to be sent */
+	volatile uint16_t QueueTail;					/* Index of next free queue slot */
+	volatile uint16_t QueueCount;					/* Number of queued bytes */
+	uint8_t  BusyFlagReadable;						/* Flag that indicates busy flag can be read back */
+	SERV_Timeout_t ControllerBusyTimeout;			/* Expires when controller finishes last instruction */
+	uint8_t  FrameBuffer[CLCD_MAX_CELLS];			/* Shadow framebuffer (row * columns + column) */
+	uint8_t  SentFrame[CLCD_MAX_CELLS];			/* Image last sent to panel */
+	uint8_t  SentFrameValid;						/* Flag that indicates SentFrame matches panel */
+	uint8_t  CursorAddress;							/* DDRAM address counter after last queued byte */
+	uint8_t  CursorValid;							/* Flag that indicates CursorAddress is known */
+	uint8_t  EntryDecrement;						/* Flag that indicates entry mode decrements address counter */
+	uint8_t  GlyphCache[CLCD_CGRAM_SLOTS][CLCD_GLYPH_ROWS];	/* Bitmap loaded in each CGRAM slot */
+	uint8_t  GlyphValid;							/* Bit per CGRAM slot that holds a cached glyph */
+	uint32_t GlyphLastUse[CLCD_CGRAM_SLOTS];		/* Use counter value of last request of each slot */
+	uint32_t GlyphUseCounter;						/* Incremented on each served glyph request */
+	uint32_t GlyphHits;								/* Requests found in cache */
+	uint32_t GlyphMisses;							/* Requests that needed a glyph load */
+}CLCD_Instance_t;
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                             CONFIGURATION OPTIONS VALUES		                     */
@@ -28,8 +153,12 @@
 /*-----------------------------------------------------------------------------------*/
 
 /* CLCD Operation Modes */
-#define FOUR_BIT_MODE		    1U
-#define EIGHT_BIT_MODE 		    2U
+#define FOUR_BIT_MODE		    CLCD_FOUR_BIT_MODE
+#define EIGHT_BIT_MODE 		    CLCD_EIGHT_BIT_MODE
+
+/* CLCD Wait Modes */
+#define CLCD_TIMED_WAIT		    CLCD_WAIT_TIMED
+#define CLCD_BUSY_FLAG_POLLING	CLCD_WAIT_BUSY_FLAG
 
 /* CLCD CTRL & Data Port Values */
 #define PORT_A                  0U
@@ -15,12 +15,13 @@
 #include "BIT_MATH.h"
 #include "STD_ERRORS.h"
 #include "SERVICE_FUNCTIONS.h"
+#include "FORMAT_FUNCTIONS.h"
 
 #include "GPIO_Interface.h"
 
-#include "CLCD_Private.h"
 #include "CLCD_Config.h"
 #include "CLCD_Interface.h"
+#include "CLCD_Private.h"
 
 /*----------------------------------------------------------------------------------------------------------*/
 /*                                                                                                          */
@@ -34,6 +35,44 @@
 /*					                            				   |___/                                    */
 /*----------------------------------------------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            PRIVATE FUNCTIONS PROTOTYPES                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static ERROR_STATUS_t CLCD_GetInstance(const CLCD_Handle_t* Copy_pHandle , CLCD_Instance_t** Copy_ppInstance);
+static ERROR_STATUS_t CLCD_ClaimEngine(void);
+static ERROR_STATUS_t CLCD_ServiceInstance(CLCD_Instance_t* Copy_pInstance);
+static ERROR_STATUS_t CLCD_FlushInstance(CLCD_Instance_t* Copy_pInstance);
+static ERROR_STATUS_t CLCD_QueuePush(CLCD_Instance_t* Copy_pInstance , uint8_t Copy_Byte , uint8_t Copy_RegisterSelect);
+static ERROR_STATUS_t CLCD_QueueReserve(CLCD_Instance_t* Copy_pInstance , uint16_t Copy_Count);
+static void CLCD_WriteBus(CLCD_Instance_t* Copy_pInstance , uint8_t Copy_Byte , uint8_t Copy_RegisterSelect);
+static uint8_t CLCD_ReadBus(CLCD_Instance_t* Copy_pInstance , uint8_t Copy_RegisterSelect);
+static void CLCD_SetBusDirection(CLCD_Instance_t* Copy_pInstance , uint8_t Copy_Direction);
+static uint8_t CLCD_IsControllerBusy(CLCD_Instance_t* Copy_pInstance);
+static void CLCD_TrackCursor(CLCD_Instance_t* Copy_pInstance , uint8_t Copy_Byte , uint8_t Copy_RegisterSelect);
+static ERROR_STATUS_t CLCD_GetCursorCell(const CLCD_Instance_t* Copy_pInstance , uint8_t* Copy_pRowNumber , uint8_t* Copy_pColumnNumber);
+static uint8_t CLCD_GetLineBreak(const uint8_t* Copy_pText , uint8_t Copy_Width , uint8_t Copy_WrapMode , uint8_t* Copy_pNextLine);
+static void CLCD_FrameWriteLine(CLCD_Instance_t* Copy_pInstance , uint8_t Copy_RowNumber , const uint8_t* Copy_pLine , uint8_t Copy_Length , uint8_t Copy_Alignment);
+static void CLCD_FrameScrollUp(CLCD_Instance_t* Copy_pInstance , uint8_t Copy_FirstRow , uint8_t Copy_LastRow);
+static uint8_t CLCD_FindGlyph(const CLCD_Instance_t* Copy_pInstance , const uint8_t* Copy_pGlyph);
+static uint8_t CLCD_GetGlyphVictim(const CLCD_Instance_t* Copy_pInstance);
+static uint8_t CLCD_IsGlyphOnScreen(const CLCD_Instance_t* Copy_pInstance , uint8_t Copy_Slot);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS		                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static CLCD_Instance_t Global_Instances[CLCD_MAX_INSTANCES];	/* Instances pool (queues, pin maps and framebuffers) */
+static uint8_t  Global_InstancesCount = 0;					/* Number of registered instances */
+static volatile uint8_t  Global_ServiceBusy = 0;			/* Flag that indicates CLCD engine (shared data bus) is in use */
+static CLCD_Instance_t* Global_pReadingInstance = NULL;		/* Instance whose data pins are turned to input (NULL if bus is written) */
+
+static CLCD_Handle_t Global_DefaultHandle = {CLCD_DATA_PORT , CLCD_CTRL_PINS_PORT , CLCD_RS_PIN , CLCD_RW_PIN , CLCD_E_PIN ,
+											 {CLCD_D0_PIN , CLCD_D1_PIN , CLCD_D2_PIN , CLCD_D3_PIN , CLCD_D4_PIN , CLCD_D5_PIN , CLCD_D6_PIN , CLCD_D7_PIN} ,
+											 CLCD_MODE , CLCD_WAIT_MODE , CLCD_ROWS , CLCD_COLUMNS , 0};	/* Instance described by CLCD_Config.h */
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                             FUNCTIONS IMPLEMENTATIONS		                     */
@@ -55,69 +94,8 @@
 /*--------------------------------------------------------------------------------*/
 void CLCD_Init(void)
 {
-	/* Set the direction of control pins */
-	GPIO_SetPinMode(CLCD_CTRL_PINS_PORT,CLCD_E_PIN,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
-	GPIO_SetPinMode(CLCD_CTRL_PINS_PORT,CLCD_RS_PIN,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
-
-	/* Check Selected CLCD Mode */
-	#if CLCD_MODE == FOUR_BIT_MODE
-
-		/* Set the direction of data pins */
-		GPIO_SetPinMode(CLCD_DATA_PORT,CLCD_D4_PIN,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
-		GPIO_SetPinMode(CLCD_DATA_PORT,CLCD_D5_PIN,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
-		GPIO_SetPinMode(CLCD_DATA_PORT,CLCD_D6_PIN,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
-		GPIO_SetPinMode(CLCD_DATA_PORT,CLCD_D7_PIN,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
-
-		/* Delay for 40 ms */
-		SERV_Delay_ms(40);
-
-		/* Set up CLCD on the 4-bit mode */
-		CLCD_SetFourBitMode();
-
-	#elif CLCD_MODE == EIGHT_BIT_MODE
-
-		/* Set the direction of data pins */
-		GPIO_SetPinMode(CLCD_DATA_PORT,CLCD_D0_PIN,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
-		GPIO_SetPinMode(CLCD_DATA_PORT,CLCD_D1_PIN,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
-		GPIO_SetPinMode(CLCD_DATA_PORT,CLCD_D2_PIN,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
-		GPIO_SetPinMode(CLCD_DATA_PORT,CLCD_D3_PIN,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
-		GPIO_SetPinMode(CLCD_DATA_PORT,CLCD_D4_PIN,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
-		GPIO_SetPinMode(CLCD_DATA_PORT,CLCD_D5_PIN,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
-		GPIO_SetPinMode(CLCD_DATA_PORT,CLCD_D6_PIN,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
-		GPIO_SetPinMode(CLCD_DATA_PORT,CLCD_D7_PIN,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
-
-		/* Delay for 40 ms */
-		SERV_Delay_ms(40);
-
-		/* Set up CLCD on the 8-bit mode */
-		CLCD_SetEightBitMode();
-
-	#else
-
-		#error "Wrong CLCD Mode Configuration"
-
-	#endif
-
-	/* Delay for 1 ms */
-	SERV_Delay_ms(1);
-
-	/* Display on CLCD and turn off cursor */
-	CLCD_DisplayOnCursorOff();
-
-	/* Delay for 1 ms */
-	SERV_Delay_ms(1);
-
-	/* Clear CLCD */
-	CLCD_ClearDisplay();
-
-	/* Delay for 3 ms */
-	SERV_Delay_ms(3);
-
-	/* Setting up CLCD on entry mode */
-	CLCD_SetEntryMode();
-
-	/* Delay for 1 ms */
-	SERV_Delay_ms(1);
+	/* Apply on default instance */
+	CLCD_HandleInit(&Global_DefaultHandle);
 }
 
 /*--------------------------------------------------------------------------------*/
@@ -148,144 +126,13 @@ void CLCD_Init(void)
 /*--------------------------------------------------------------------------------*/
 /* @Return		 : ERROR_STATUS_t                                          		  */
 /*--------------------------------------------------------------------------------*/
-/* @Description	 : Send a command to Character LCD controller	                  */
+/* @Description	 : Queue a command to Character LCD controller (non-blocking,     */
+/*                 sent by CLCD_Service)                                          */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t CLCD_SendCommand(uint8_t Copy_Command)
 {
-	/* Local Variables Definitions */
-	ERROR_STATUS_t Local_Status = RT_OK ;
-	uint8_t Local_Bit0 , Local_Bit1 , Local_Bit2 , Local_Bit3 , Local_Bit4 , Local_Bit5 , Local_Bit6 , Local_Bit7;
-
-	/* Check if passed command is valid or not */
-	if(Copy_Command == CLCD_FUNCTION_SET_EIGHT_BIT_MODE_CMD || Copy_Command == CLCD_FUNCTION_SET_FOUR_BIT_MODE_CMD  ||
-       Copy_Command == CLCD_DISPLAY_ON_CURSOR_OFF_CMD   	|| Copy_Command == CLCD_DISPLAY_OFF_CURSOR_OFF_CMD    	||
-       Copy_Command == CLCD_DISPLAY_ON_CURSOR_ON_CMD   	    || Copy_Command == CLCD_DISPLAY_OFF_CURSOR_ON_CMD    	||
-	   Copy_Command == CLCD_BLINK_CURSOR_CMD				|| Copy_Command == CLCD_SHIFT_LEFT_CURSOR_CMD			||
-	   Copy_Command == CLCD_SHIFT_RIGHT_CURSOR_CMD			|| Copy_Command == CLCD_SHIFT_LEFT_DISPLAY_CMD			||
-       Copy_Command == CLCD_SHIFT_RIGHT_DISPLAY_CMD		    || Copy_Command == CLCD_BEGIN_AT_FIRST_LINE_CMD		    ||
-       Copy_Command == CLCD_BEGIN_AT_SECOND_LINE_CMD		|| Copy_Command == CLCD_DISPLAY_CLEAR_CMD 				||
-       Copy_Command == CLCD_ENTRY_MODE_CMD)
-	{
-		/* Set RS to LOW to tell CLCD to receive a command */
-		GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_RS_PIN , GPIO_PIN_LOW);
-
-		/* Delay for 1 ms */
-		SERV_Delay_ms(1);
-
-		/* Set E to LOW tell CLCD to stop reading the command */
-		GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_E_PIN , GPIO_PIN_LOW);
-
-		/* Delay for 1 ms */
-		SERV_Delay_ms(1);
-
-		/* Check Selected CLCD Mode */
-		#if CLCD_MODE == FOUR_BIT_MODE
-
-			/* Get command most significant bits */
-			Local_Bit7 = GET_BIT(Copy_Command,7);
-			Local_Bit6 = GET_BIT(Copy_Command,6);
-			Local_Bit5 = GET_BIT(Copy_Command,5);
-			Local_Bit4 = GET_BIT(Copy_Command,4);
-
-			/* Set E to HIGH tell CLCD to start reading the command */
-			GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_E_PIN , GPIO_PIN_HIGH);
-
-			/* Delay for 1 ms */
-			SERV_Delay_ms(1);
-
-			/* Set command most significant bits on CLCD data port */
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D7_PIN,Local_Bit7);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D6_PIN,Local_Bit6);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D5_PIN,Local_Bit5);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D4_PIN,Local_Bit4);
-
-			/* Delay for 1 ms */
-			SERV_Delay_ms(1);
-
-			/* Set E to LOW tell CLCD to stop reading the command */
-			GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_E_PIN , GPIO_PIN_LOW);
-
-			/* Delay for 1 ms */
-			SERV_Delay_ms(1);
-
-			/* Get command least significant bits */
-			Local_Bit3 = GET_BIT(Copy_Command,3);
-			Local_Bit2 = GET_BIT(Copy_Command,2);
-			Local_Bit1 = GET_BIT(Copy_Command,1);
-			Local_Bit0 = GET_BIT(Copy_Command,0);
-
-			/* Set E to HIGH tell CLCD to start reading the command */
-			GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_E_PIN , GPIO_PIN_HIGH);
-
-			/* Delay for 1 ms */
-			SERV_Delay_ms(1);
-
-			/* Set command least significant bits on CLCD data port */
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D7_PIN,Local_Bit3);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D6_PIN,Local_Bit2);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D5_PIN,Local_Bit1);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D4_PIN,Local_Bit0);
-
-			/* Delay for 1 ms */
-			SERV_Delay_ms(1);
-
-			/* Clear E to tell CLCD to stop reading the command */
-			GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_E_PIN , GPIO_PIN_LOW);
-
-			/* Delay for 2 ms */
-			SERV_Delay_ms(2);
-
-		#elif CLCD_MODE == EIGHT_BIT_MODE
-
-			/* Get command bits */
-			Local_Bit7 = GET_BIT(Copy_Command,7);
-			Local_Bit6 = GET_BIT(Copy_Command,6);
-			Local_Bit5 = GET_BIT(Copy_Command,5);
-			Local_Bit4 = GET_BIT(Copy_Command,4);
-			Local_Bit3 = GET_BIT(Copy_Command,3);
-			Local_Bit2 = GET_BIT(Copy_Command,2);
-			Local_Bit1 = GET_BIT(Copy_Command,1);
-			Local_Bit0 = GET_BIT(Copy_Command,0);
-
-			/* Set E to HIGH tell CLCD to start reading the command */
-			GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_E_PIN , GPIO_PIN_HIGH);
-
-			/* Delay for 1 ms */
-			SERV_Delay_ms(1);
-
-			/* Set command bits on CLCD data port */
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D7_PIN,Local_Bit7);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D6_PIN,Local_Bit6);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D5_PIN,Local_Bit5);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D4_PIN,Local_Bit4);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D3_PIN,Local_Bit3);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D2_PIN,Local_Bit2);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D1_PIN,Local_Bit1);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D0_PIN,Local_Bit0);
-
-			/* Delay for 1 ms */
-			SERV_Delay_ms(1);
-
-			/* Set E to LOW tell CLCD to stop reading the command */
-			GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_E_PIN , GPIO_PIN_LOW);
-
-			/* Delay for 2 ms */
-			SERV_Delay_ms(2);
-
-		#else
-
-			#error "Wrong CLCD Mode Configuration"
-
-		#endif
-
-	}
-	else
-	{
-		/* Function is not behaving as expected */
-		Local_Status = RT_NOK;
-	}
-
-	return Local_Status;
+	/* Apply on default instance */
+	return CLCD_HandleSendCommand(&Global_DefaultHandle , Copy_Command);
 }
 
 /*--------------------------------------------------------------------------------*/
@@ -301,136 +148,13 @@ ERROR_STATUS_t CLCD_SendCommand(uint8_t Copy_Command)
 /*--------------------------------------------------------------------------------*/
 /* @Return		 : ERROR_STATUS_t                                          		  */
 /*--------------------------------------------------------------------------------*/
-/* @Description	 : Write a character on Character CLCD		                      */
+/* @Description	 : Queue a character to be written on Character CLCD              */
+/*                 (non-blocking, sent by CLCD_Service)                           */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t CLCD_WriteCharacter(uint8_t Copy_Character)
 {
-	/* Local Variables Definitions */
-	ERROR_STATUS_t Local_Status = RT_OK ;
-	uint8_t Local_Bit0 , Local_Bit1 , Local_Bit2 , Local_Bit3 , Local_Bit4 , Local_Bit5 , Local_Bit6 , Local_Bit7;
-
-	/* Check if passed command is valid or not */
-	if(Copy_Character >= 0 && Copy_Character <= 255)
-	{
-		/* Set RS to HIGH to tell CLCD to receive character */
-		GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_RS_PIN , GPIO_PIN_HIGH);
-
-		/* Delay for 1 ms */
-		SERV_Delay_ms(1);
-
-		/* Set E to LOW tell CLCD to stop reading the character */
-		GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_E_PIN , GPIO_PIN_LOW);
-
-		/* Delay for 1 ms */
-		SERV_Delay_ms(1);
-
-		/* Check Selected CLCD Mode */
-		#if CLCD_MODE == FOUR_BIT_MODE
-
-			/* Get character most significant bits */
-			Local_Bit7 = GET_BIT(Copy_Character,7);
-			Local_Bit6 = GET_BIT(Copy_Character,6);
-			Local_Bit5 = GET_BIT(Copy_Character,5);
-			Local_Bit4 = GET_BIT(Copy_Character,4);
-
-			/* Set E to HIGH tell CLCD to start reading the character */
-			GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_E_PIN , GPIO_PIN_HIGH);
-
-			/* Delay for 1 ms */
-			SERV_Delay_ms(1);
-
-			/* Set character most significant bits on CLCD data port */
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D7_PIN,Local_Bit7);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D6_PIN,Local_Bit6);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D5_PIN,Local_Bit5);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D4_PIN,Local_Bit4);
-
-			/* Delay for 1 ms */
-			SERV_Delay_ms(1);
-
-			/* Set E to LOW tell CLCD to stop reading the character */
-			GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_E_PIN , GPIO_PIN_LOW);
-
-			/* Delay for 1 ms */
-			SERV_Delay_ms(1);
-
-			/* Get character least significant bits */
-			Local_Bit7 = GET_BIT(Copy_Character,3);
-			Local_Bit6 = GET_BIT(Copy_Character,2);
-			Local_Bit5 = GET_BIT(Copy_Character,1);
-			Local_Bit4 = GET_BIT(Copy_Character,0);
-
-			/* Set E to HIGH tell CLCD to start reading the character */
-			GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_E_PIN , GPIO_PIN_HIGH);
-
-			/* Delay for 1 ms */
-			SERV_Delay_ms(1);
-
-			/* Set character least significant bits on CLCD data port */
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D7_PIN,Local_Bit7);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D6_PIN,Local_Bit6);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D5_PIN,Local_Bit5);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D4_PIN,Local_Bit4);
-
-			/* Delay for 1 ms */
-			SERV_Delay_ms(1);
-
-			/* Clear E to tell CLCD to stop reading the character */
-			GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_E_PIN , GPIO_PIN_LOW);
-
-			/* Delay for 2 ms */
-			SERV_Delay_ms(2);
-
-		#elif CLCD_MODE == EIGHT_BIT_MODE
-
-			/* Get character bits */
-			Local_Bit7 = GET_BIT(Copy_Character,7);
-			Local_Bit6 = GET_BIT(Copy_Character,6);
-			Local_Bit5 = GET_BIT(Copy_Character,5);
-			Local_Bit4 = GET_BIT(Copy_Character,4);
-			Local_Bit3 = GET_BIT(Copy_Character,3);
-			Local_Bit2 = GET_BIT(Copy_Character,2);
-			Local_Bit1 = GET_BIT(Copy_Character,1);
-			Local_Bit0 = GET_BIT(Copy_Character,0);
-
-			/* Set E to HIGH tell CLCD to start reading the character */
-			GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_E_PIN , GPIO_PIN_HIGH);
-
-			/* Delay for 1 ms */
-			SERV_Delay_ms(1);
-
-			/* Set character bits on CLCD data port */
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D7_PIN,Local_Bit7);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D6_PIN,Local_Bit6);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D5_PIN,Local_Bit5);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D4_PIN,Local_Bit4);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D3_PIN,Local_Bit3);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D2_PIN,Local_Bit2);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D1_PIN,Local_Bit1);
-			GPIO_SetPinVal(CLCD_DATA_PORT,CLCD_D0_PIN,Local_Bit0);
-
-			/* Delay for 1 ms */
-			SERV_Delay_ms(1);
-
-			/* Set E to LOW tell CLCD to stop reading the character */
-			GPIO_SetPinVal(CLCD_CTRL_PINS_PORT , CLCD_E_PIN , GPIO_PIN_LOW);
-
-			/* Delay for 2 ms */
-			SERV_Delay_ms(2);
-
-		#else
-
-			#error "Wrong CLCD Mode Configuration"
-
-		#endif
-	}
-	else
-	{
-		/* Function is not behaving as expected */
-		Local_Status = RT_NOK;
-	}
-
-	return Local_Status;
+	/* Apply on default instance */
+	return CLCD_HandleWriteCharacter(&Global_DefaultHandle , Copy_Character);
 }
 
 /*--------------------------------------------------------------------------------*/
@@ -717,41 +441,14 @@ void CLCD_SetEntryMode(void)
 /*--------------------------------------------------------------------------------*/
 /* @Return		 : ERROR_STATUS_t                                          		  */
 /*--------------------------------------------------------------------------------*/
-/* @Description	 : Write a string on the Character LCD display      		 	  */
+/* @Description	 : Write a string on the Character LCD display starting at cursor */
+/*                 cell, wrapping to next row at end of each row (see             */
+/*                 CLCD_HandleWriteString)                                        */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t CLCD_WriteString(uint8_t* Copy_pString)
 {
-	/* Local Variables Definitions */
-	ERROR_STATUS_t Local_Status = RT_OK ;
-	uint32_t Local_CharacterCounter = 0 ;
-
-	/* Check if passed pointer is NULL pointer or not */
-	if(Copy_pString != NULL)
-	{
-		/* Write the passed string on the CLCD display */
-		while(Copy_pString[Local_CharacterCounter] != '\0')
-		{
-			/* Write a character */
-			CLCD_WriteCharacter(Copy_pString[Local_CharacterCounter]);
-
-			/* Increment the character counter */
-			Local_CharacterCounter++;
-
-			/* Check if the character counter reached 16 or not */
-			if(Local_CharacterCounter == 20)
-			{
-				/* Force CLCD cursor to begin at second line */
-				CLCD_BeginAtSecondLine();
-			}
-		}
-	}
-	else
-	{
-		/* Passed pointer is NULL pointer */
-		Local_Status = NULL_POINTER;
-	}
-
-	return Local_Status;
+	/* Apply on default instance */
+	return CLCD_HandleWriteString(&Global_DefaultHandle , Copy_pString);
 }
 
 /*--------------------------------------------------------------------------------*/
@@ -773,66 +470,8 @@ ERROR_STATUS_t CLCD_WriteString(uint8_t* Copy_pString)
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t CLCD_WriteNumber(sint32_t Copy_Number)
 {
-	/* Local Variables Definitions */
-	ERROR_STATUS_t Local_Status = RT_OK;
-	sint32_t Local_NumberCopy = Copy_Number;
-	uint8_t  Local_DigitCounter = 0;
-	uint8_t  Local_DigitIndex;
-	uint8_t  Local_NumDigits[10];
-
-	/* Check if passed number is within valid range or not */
-	if(Copy_Number >= -2147483648 && Copy_Number <= 2147483647)
-	{
-		/* Check if passed number is equal to 0 or not */
-		if(Copy_Number != 0)
-		{
-			/* Check if number is positive or not */
-			if(Copy_Number < 0)
-			{
-				/* Write Negative Sign on CLCD */
-				CLCD_WriteCharacter('-');
-
-				/* Multiply Number by -1 to start processing then writing it on CLCD */
-				Copy_Number *= -1;
-
-				/* Multiply Number Copy by -1 */
-				Local_NumberCopy *= -1;
-			}
-
-			/* Count number of digits for the passed integer */
-			while(Local_NumberCopy != 0)
-			{
-				Local_NumberCopy = Local_NumberCopy / 10;
-				Local_DigitCounter++;
-			}
-
-			/* Separate number's digits then organizing them into a char array */
-			for(Local_DigitIndex = Local_DigitCounter ; Local_DigitIndex > 0 ; Local_DigitIndex--)
-			{
-				Local_NumDigits[Local_DigitIndex-1] = ((Copy_Number % 10) + '0');
-				Copy_Number = Copy_Number / 10;
-			}
-
-			/* Write the passed number on the CLCD display */
-			for(Local_DigitIndex = 0 ; Local_DigitIndex < Local_DigitCounter ; Local_DigitIndex++)
-			{
-				CLCD_WriteCharacter(Local_NumDigits[Local_DigitIndex]);
-				SERV_Delay_ms(3);
-			}
-		}
-		else
-		{
-			/* Write '0' on CLCD */
-			CLCD_WriteCharacter('0');
-		}
-	}
-	else
-	{
-		/* Function is not behaving as expected */
-		Local_Status = RT_NOK;
-	}
-
-	return Local_Status;
+	/* Apply on default instance */
+	return CLCD_HandleWriteNumber(&Global_DefaultHandle , Copy_Number);
 }
 
 /*--------------------------------------------------------------------------------*/
@@ -852,21 +491,8 @@ ERROR_STATUS_t CLCD_WriteNumber(sint32_t Copy_Number)
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t CLCD_SetCGRamAddress(uint8_t Copy_Location)
 {
-	/* Local Variables Definitions */
-	ERROR_STATUS_t Local_Status = RT_OK;
-
-	if(Copy_Location < 8)
-	{
-		/* Order CLCD to point to desired location on CGRAM */
-		CLCD_SendCommand(64 + (Copy_Location * 8));
-	}
-	else
-	{
-		/* Function is not behaving as expected */
-		Local_Status = RT_NOK;
-	}
-
-	return Local_Status;
+	/* Apply on default instance */
+	return CLCD_HandleSetCGRamAddress(&Global_DefaultHandle , Copy_Location);
 }
 
 /*--------------------------------------------------------------------------------*/
@@ -890,42 +516,20 @@ ERROR_STATUS_t CLCD_SetCGRamAddress(uint8_t Copy_Location)
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t CLCD_WriteCustomCharactersOnCGRam(uint8_t* Copy_pCharacter,uint8_t Copy_Location)
 {
-	/* Local Variable Definitions */
-	ERROR_STATUS_t Local_Status = RT_OK;
-	uint32_t Local_CharacterPatternCounter;
-
-	/* Check if passed pointer is NULL pointer or not */
-	if(Copy_pCharacter != NULL)
-	{
-		/* Access CGRAM location in which custom character will be written */
-		CLCD_SetCGRamAddress(Copy_Location);
-
-		/* Write custom character to selected CGRAM location through traversing over its patterns and writing it */
-		for(Local_CharacterPatternCounter = 0 ; Local_CharacterPatternCounter < 8 ; Local_CharacterPatternCounter++)
-		{
-			/* Write each pattern of custom character to selected CGRAM location */
-			CLCD_WriteCharacter(Copy_pCharacter[Local_CharacterPatternCounter]);
-		}
-	}
-	else
-	{
-		/* Passed pointer is NULL pointer */
-		Local_Status = NULL_POINTER;
-	}
-
-	return Local_Status;
+	/* Apply on default instance */
+	return CLCD_HandleWriteCustomCharactersOnCGRam(&Global_DefaultHandle , Copy_pCharacter , Copy_Location);
 }
 
 /*--------------------------------------------------------------------------------*/
-/* @Function Name: WriteCustomCharactersOnCGRam      							  */
+/* @Function Name: MoveCursor      							              */
 /*--------------------------------------------------------------------------------*/
 /* @Param(in)	 : uint8_t Copy_RowNumber    				                      */
 /*				   Brief: CLCD row number          						          */
-/*				   Range: (CLCD_ROW_0 --> CLCD_ROW_1)	                          */
+/*				   Range: (CLCD_ROW_0 --> CLCD_ROWS - 1)	                      */
 /*				   -------------------------------------------------------------- */
 /*                 uint8_t Copy_ColumnNumber                                      */
 /*				   Brief: CLCD column number							          */
-/*				   Range: (CLCD_COLUMN_0 --> CLCD_COLUMN_15)	                  */
+/*				   Range: (CLCD_COLUMN_0 --> CLCD_COLUMNS - 1)	                  */
 /*--------------------------------------------------------------------------------*/
 /* @Param(inout) : None                                                	          */
 /*--------------------------------------------------------------------------------*/
@@ -938,37 +542,3023 @@ ERROR_STATUS_t CLCD_WriteCustomCharactersOnCGRam(uint8_t* Copy_pCharacter,uint8_
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t CLCD_MoveCursor(uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber)
 {
-	/* Local Variables Definitions */
-	ERROR_STATUS_t Local_Status = RT_OK ;
+	/* Apply on default instance */
+	return CLCD_HandleMoveCursor(&Global_DefaultHandle , Copy_RowNumber , Copy_ColumnNumber);
+}
 
-	/* Check if passed column number is within valid range or not */
-	if((Copy_ColumnNumber >= 0) && (Copy_ColumnNumber <= 19))
-	{
-		switch(Copy_RowNumber)
-		{
-			case 0:
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Service                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Runs asynchronous CLCD engine: clocks queued bytes out to CLCD */
+/*                 controller respecting its instruction execution time           */
+/*                 (CLCD_INSTRUCTION_EXECUTION_TIME per byte,                     */
+/*                 CLCD_LONG_INSTRUCTION_EXECUTION_TIME after clear/home, ended   */
+/*                 early by busy flag with CLCD_BUSY_FLAG_POLLING). Never waits   */
+/*                 for controller: stops once it is busy and resumes on next      */
+/*                 call, sending at most CLCD_SERVICE_BURST bytes per call. Call  */
+/*                 it periodically (e.g. from STK_TimerStart callback or a        */
+/*                 scheduler task). Returns BUSY_FUNC if it is already running in */
+/*                 another context                                                */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_Service(void)
+{
+	/* Apply on default instance */
+	return CLCD_HandleService(&Global_DefaultHandle);
+}
 
-				/* Move the cursor to desired cell number on row 0 */
-				CLCD_SendCommand(Copy_ColumnNumber+0x80);
-				break;
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Flush                                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Blocks until all queued bytes are sent and CLCD controller has */
+/*                 executed last of them. Returns BUSY_FUNC if engine is running  */
+/*                 in a context that the caller preempted                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_Flush(void)
+{
+	/* Apply on default instance */
+	return CLCD_HandleFlush(&Global_DefaultHandle);
+}
 
-			case 1:
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetQueueDepth                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint16_t* Copy_pQueueDepth                                     */
+/*				   Brief: Pointer to variable that will hold number of bytes      */
+/*				          waiting in CLCD queue                                   */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets number of bytes waiting in CLCD queue to be sent to CLCD  */
+/*                 controller                                                     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_GetQueueDepth(uint16_t* Copy_pQueueDepth)
+{
+	/* Apply on default instance */
+	return CLCD_HandleGetQueueDepth(&Global_DefaultHandle , Copy_pQueueDepth);
+}
 
-				/* Move the cursor to desired cell number on row 1 */
-				CLCD_SendCommand(Copy_ColumnNumber+0xC0);
-				break;
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameClear                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Fills CLCD shadow framebuffer with spaces (panel is updated by */
+/*                 CLCD_FrameRefresh)                                             */
+/*--------------------------------------------------------------------------------*/
+void CLCD_FrameClear(void)
+{
+	/* Apply on default instance */
+	CLCD_HandleFrameClear(&Global_DefaultHandle);
+}
 
-			default:
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameWriteCharacter                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_RowNumber                                         */
+/*				   Brief: CLCD row number                                         */
+/*				   Range: (0 --> CLCD_ROWS - 1)                                   */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ColumnNumber                                      */
+/*				   Brief: CLCD column number                                      */
+/*				   Range: (0 --> CLCD_COLUMNS - 1)                                */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Character                                         */
+/*				   Brief: Character to be written in framebuffer                  */
+/*				   Range: Any value can be represented in 1 byte                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Writes a character in CLCD shadow framebuffer at passed cell   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_FrameWriteCharacter(uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber , uint8_t Copy_Character)
+{
+	/* Apply on default instance */
+	return CLCD_HandleFrameWriteCharacter(&Global_DefaultHandle , Copy_RowNumber , Copy_ColumnNumber , Copy_Character);
+}
 
-				/* Function is not behaving as expected */
-				Local_Status = RT_NOK;
-		}
-	}
-	else
-	{
-		/* Function is not behaving as expected */
-		Local_Status = RT_NOK;
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameWriteString                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_RowNumber                                         */
+/*				   Brief: CLCD row number                                         */
+/*				   Range: (0 --> CLCD_ROWS - 1)                                   */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ColumnNumber                                      */
+/*				   Brief: CLCD column number                                      */
+/*				   Range: (0 --> CLCD_COLUMNS - 1)                                */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pString                                    */
+/*				   Brief: Pointer to null terminated string                       */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Writes a string in CLCD shadow framebuffer starting at passed  */
+/*                 cell. String is truncated at end of row                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_FrameWriteString(uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber , const uint8_t* Copy_pString)
+{
+	/* Apply on default instance */
+	return CLCD_HandleFrameWriteString(&Global_DefaultHandle , Copy_RowNumber , Copy_ColumnNumber , Copy_pString);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameWriteNumber                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_RowNumber                                         */
+/*				   Brief: CLCD row number                                         */
+/*				   Range: (0 --> CLCD_ROWS - 1)                                   */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ColumnNumber                                      */
+/*				   Brief: CLCD column number                                      */
+/*				   Range: (0 --> CLCD_COLUMNS - 1)                                */
+/*				   -------------------------------------------------------------- */
+/*                 sint32_t Copy_Number                                           */
+/*				   Brief: Number (could be positive or negative) to be written    */
+/*				   Range: Any sint32_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Writes an integer number in CLCD shadow framebuffer starting   */
+/*                 at passed cell. Number is truncated at end of row              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_FrameWriteNumber(uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber , sint32_t Copy_Number)
+{
+	/* Apply on default instance */
+	return CLCD_HandleFrameWriteNumber(&Global_DefaultHandle , Copy_RowNumber , Copy_ColumnNumber , Copy_Number);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameWriteText                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_TextBox_t* Copy_pTextBox                            */
+/*				   Brief: Pointer to text box (rows range, alignment and wrap     */
+/*				          mode) that text is laid out in                          */
+/*				   Range: Any pointer to CLCD_TextBox_t within instance geometry  */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pText                                      */
+/*				   Brief: Pointer to null terminated text ('\n' starts a new      */
+/*				          line)                                                   */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Lays text out in shadow framebuffer rows of passed text box:   */
+/*                 text is broken into lines at box width (by words or            */
+/*                 characters), each line is aligned and remaining box rows are   */
+/*                 blanked. If text needs more lines than box has, box is         */
+/*                 scrolled so that its last lines are shown (panel is updated by */
+/*                 CLCD_FrameRefresh)                                             */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_FrameWriteText(const CLCD_TextBox_t* Copy_pTextBox , const uint8_t* Copy_pText)
+{
+	/* Call instance based version on default instance */
+	return CLCD_HandleFrameWriteText(&Global_DefaultHandle , Copy_pTextBox , Copy_pText);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameAppendText                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_TextBox_t* Copy_pTextBox                            */
+/*				   Brief: Pointer to text box (rows range, alignment and wrap     */
+/*				          mode) that text is laid out in                          */
+/*				   Range: Any pointer to CLCD_TextBox_t within instance geometry  */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pText                                      */
+/*				   Brief: Pointer to null terminated text ('\n' starts a new      */
+/*				          line)                                                   */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Scrolls rows of passed text box up by one row for each line of */
+/*                 text then writes that line in last row of box (scrolling       */
+/*                 region), so that box keeps showing latest lines like a         */
+/*                 terminal (panel is updated by CLCD_FrameRefresh)               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_FrameAppendText(const CLCD_TextBox_t* Copy_pTextBox , const uint8_t* Copy_pText)
+{
+	/* Call instance based version on default instance */
+	return CLCD_HandleFrameAppendText(&Global_DefaultHandle , Copy_pTextBox , Copy_pText);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameRefresh                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Compares CLCD shadow framebuffer with last image sent to panel */
+/*                 and queues only changed character runs, each preceded by a     */
+/*                 DDRAM address instruction unless cursor is already there       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_FrameRefresh(void)
+{
+	/* Apply on default instance */
+	return CLCD_HandleFrameRefresh(&Global_DefaultHandle);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameInvalidate                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Forgets last image sent to panel so that next                  */
+/*                 CLCD_FrameRefresh redraws every cell (use after writing panel  */
+/*                 through direct CLCD functions)                                 */
+/*--------------------------------------------------------------------------------*/
+void CLCD_FrameInvalidate(void)
+{
+	/* Apply on default instance */
+	CLCD_HandleFrameInvalidate(&Global_DefaultHandle);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ReadDDRam                                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Address                                           */
+/*				   Brief: DDRAM address of first character to be read             */
+/*				   Range: (0x00 --> 0x7F)                                         */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Length                                            */
+/*				   Brief: Number of characters to be read                         */
+/*				   Range: (1 --> 0x80 - Copy_Address)                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pData                                            */
+/*				   Brief: Pointer to array that will hold read characters         */
+/*				   Range: Any pointer to array of Copy_Length bytes               */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Flushes CLCD queue then reads characters back from controller  */
+/*                 DDRAM (e.g. to verify panel contents) and restores address     */
+/*                 counter to its previous DDRAM position. Requires               */
+/*                 CLCD_BUSY_FLAG_POLLING (returns RT_NOK otherwise) and returns  */
+/*                 BUSY_FUNC if engine is running in a context that the caller    */
+/*                 preempted                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_ReadDDRam(uint8_t Copy_Address , uint8_t* Copy_pData , uint8_t Copy_Length)
+{
+	/* Apply on default instance */
+	return CLCD_HandleReadDDRam(&Global_DefaultHandle , Copy_Address , Copy_pData , Copy_Length);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: RequestGlyph                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const uint8_t* Copy_pGlyph                                     */
+/*				   Brief: Pointer to 8 pattern rows of custom character (5 low    */
+/*				          bits of each row are used)                              */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pSlot                                            */
+/*				   Brief: Pointer to variable that will hold character code of    */
+/*				          glyph (CGRAM slot) to be written on CLCD                */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Returns CGRAM slot holding passed glyph. If glyph is not       */
+/*                 loaded, it is queued to a free slot or to least recently used  */
+/*                 slot whose character is not shown in framebuffer or last sent  */
+/*                 frame, then cursor is returned to its DDRAM address. Returns   */
+/*                 RT_NOK if every slot holds a glyph shown on screen (glyphs     */
+/*                 written on panel without framebuffer are protected by recent   */
+/*                 use only)                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_RequestGlyph(const uint8_t* Copy_pGlyph , uint8_t* Copy_pSlot)
+{
+	/* Call instance based version on default instance */
+	return CLCD_HandleRequestGlyph(&Global_DefaultHandle , Copy_pGlyph , Copy_pSlot);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetGlyphStatistics                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pHits                                           */
+/*				   Brief: Pointer to variable that will hold number of requests   */
+/*				          found in cache                                          */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pMisses                                         */
+/*				   Brief: Pointer to variable that will hold number of requests   */
+/*				          not found in cache                                      */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets hit and miss counters of CLCD glyph cache                 */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_GetGlyphStatistics(uint32_t* Copy_pHits , uint32_t* Copy_pMisses)
+{
+	/* Call instance based version on default instance */
+	return CLCD_HandleGetGlyphStatistics(&Global_DefaultHandle , Copy_pHits , Copy_pMisses);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ResetGlyphCache                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Forgets glyphs loaded in CLCD CGRAM and clears hit and miss    */
+/*                 counters                                                       */
+/*--------------------------------------------------------------------------------*/
+void CLCD_ResetGlyphCache(void)
+{
+	/* Call instance based version on default instance */
+	CLCD_HandleResetGlyphCache(&Global_DefaultHandle);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleInit                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : CLCD_Handle_t* Copy_pHandle                                    */
+/*				   Brief: Pointer to CLCD instance descriptor filled with pin     */
+/*				          map, geometry and modes (instanceId is set by function) */
+/*				   Range: Any pointer to CLCD_Handle_t                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Registers a CLCD instance in instances pool (or re-initializes */
+/*                 an already registered one), sets up its pins and sends         */
+/*                 initialization sequence to its controller. Panels may share    */
+/*                 data, RS and RW pins as long as each has its own E pin. Call   */
+/*                 it before servicing starts                                     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleInit(CLCD_Handle_t* Copy_pHandle)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance = NULL;
+	uint8_t  Local_FirstDataPin;
+	uint8_t  Local_Counter;
+	uint8_t  Local_Bit;
+	uint32_t Local_HighPinsBSRR;
+	uint32_t Local_LowPinsBSRR;
+
+	/* Check if passed pointer is NULL pointer or not */
+	if(Copy_pHandle != NULL)
+	{
+		/* Check if passed pin map, modes and geometry are valid or not */
+		if(Copy_pHandle->dataPort <= GPIO_PORT_C && Copy_pHandle->ctrlPort <= GPIO_PORT_C &&
+		   Copy_pHandle->rsPin <= GPIO_PIN_15 && Copy_pHandle->rwPin <= GPIO_PIN_15 && Copy_pHandle->ePin <= GPIO_PIN_15 &&
+		   (Copy_pHandle->mode == CLCD_FOUR_BIT_MODE || Copy_pHandle->mode == CLCD_EIGHT_BIT_MODE) &&
+		   (Copy_pHandle->waitMode == CLCD_WAIT_TIMED || Copy_pHandle->waitMode == CLCD_WAIT_BUSY_FLAG) &&
+		   Copy_pHandle->rows != 0 && Copy_pHandle->rows <= CLCD_MAX_ROWS && Copy_pHandle->columns != 0 && Copy_pHandle->columns <= CLCD_DDRAM_LINE_LENGTH &&
+		   ((uint16_t)Copy_pHandle->rows * Copy_pHandle->columns) <= CLCD_MAX_CELLS)
+		{
+			/* Check if used data pins are valid or not (D0..D3 are used in 8-bit mode only) */
+			Local_FirstDataPin = (Copy_pHandle->mode == CLCD_FOUR_BIT_MODE) ? 4U : 0U;
+			for(Local_Counter = Local_FirstDataPin ; Local_Counter < 8U ; Local_Counter++)
+			{
+				if(Copy_pHandle->dataPins[Local_Counter] > GPIO_PIN_15)
+				{
+					/* Function is not behaving as expected */
+					Local_Status = RT_NOK;
+				}
+			}
+
+			/* Reuse slot of an already registered handle or take a new one */
+			if(Local_Status == RT_OK)
+			{
+				if(Copy_pHandle->instanceId < Global_InstancesCount && Global_Instances[Copy_pHandle->instanceId].pHandle == Copy_pHandle)
+				{
+					Local_pInstance = &Global_Instances[Copy_pHandle->instanceId];
+				}
+				else if(Global_InstancesCount < CLCD_MAX_INSTANCES)
+				{
+					Local_pInstance = &Global_Instances[Global_InstancesCount];
+					Local_pInstance->pHandle = Copy_pHandle;
+					Copy_pHandle->instanceId = Global_InstancesCount;
+					Global_InstancesCount++;
+				}
+				else
+				{
+					/* Instances pool is full */
+					Local_Status = RT_NOK;
+				}
+			}
+
+			/* Check if instance slot is taken or not */
+			if(Local_Status == RT_OK)
+			{
+				/* Reset instance state */
+				Local_pInstance->QueueHead = 0;
+				Local_pInstance->QueueTail = 0;
+				Local_pInstance->QueueCount = 0;
+				Local_pInstance->BusyFlagReadable = 0;
+				Local_pInstance->SentFrameValid = 0;
+				Local_pInstance->CursorValid = 0;
+				Local_pInstance->EntryDecrement = 0;
+				Local_pInstance->GlyphValid = 0;
+				Local_pInstance->GlyphHits = 0;
+				Local_pInstance->GlyphMisses = 0;
+				SERV_StartTimeout_us(&Local_pInstance->ControllerBusyTimeout , 0);
+
+				/* Precompute BSRR word of each nibble for D4..D7 and D0..D3 pins */
+				for(Local_Counter = 0 ; Local_Counter < 16U ; Local_Counter++)
+				{
+					Local_HighPinsBSRR = 0;
+					Local_LowPinsBSRR = 0;
+					for(Local_Bit = 0 ; Local_Bit < 4U ; Local_Bit++)
+					{
+						Local_HighPinsBSRR |= CLCD_PIN_BSRR(Local_Counter,Local_Bit,Copy_pHandle->dataPins[Local_Bit + 4U]);
+						if(Copy_pHandle->mode == CLCD_EIGHT_BIT_MODE)
+						{
+							Local_LowPinsBSRR |= CLCD_PIN_BSRR(Local_Counter,Local_Bit,Copy_pHandle->dataPins[Local_Bit]);
+						}
+					}
+					Local_pInstance->HighPinsMap[Local_Counter] = Local_HighPinsBSRR;
+					Local_pInstance->LowPinsMap[Local_Counter] = Local_LowPinsBSRR;
+				}
+
+				/* Take shared data bus back if another instance left it in read direction */
+				if(Global_pReadingInstance != NULL)
+				{
+					CLCD_SetBusDirection(Global_pReadingInstance , CLCD_BUS_WRITE);
+				}
+
+				/* Set the direction of control pins */
+				GPIO_SetPinMode(Copy_pHandle->ctrlPort,Copy_pHandle->ePin,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
+				GPIO_SetPinMode(Copy_pHandle->ctrlPort,Copy_pHandle->rsPin,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
+
+				/* Drive RW pin low (write direction) if controller will be read */
+				if(Copy_pHandle->waitMode == CLCD_WAIT_BUSY_FLAG)
+				{
+					GPIO_SetPinMode(Copy_pHandle->ctrlPort,Copy_pHandle->rwPin,GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
+					GPIO_SetPinVal(Copy_pHandle->ctrlPort,Copy_pHandle->rwPin,GPIO_PIN_LOW);
+				}
+
+				/* Set the direction of data pins */
+				for(Local_Counter = Local_FirstDataPin ; Local_Counter < 8U ; Local_Counter++)
+				{
+					GPIO_SetPinMode(Copy_pHandle->dataPort,Copy_pHandle->dataPins[Local_Counter],GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL);
+				}
+
+				/* Wait for CLCD controller power on */
+				SERV_Delay_ms(CLCD_POWER_ON_DELAY);
+
+				/* Set up CLCD interface mode */
+				if(Copy_pHandle->mode == CLCD_FOUR_BIT_MODE)
+				{
+					CLCD_QueuePush(Local_pInstance , CLCD_FUNCTION_SET_FOUR_BIT_MODE_CMD , CLCD_INSTRUCTION_REGISTER);
+				}
+				else
+				{
+					CLCD_QueuePush(Local_pInstance , CLCD_FUNCTION_SET_EIGHT_BIT_MODE_CMD , CLCD_INSTRUCTION_REGISTER);
+				}
+
+				/* Display on CLCD and turn off cursor, clear CLCD then set up entry mode */
+				CLCD_QueuePush(Local_pInstance , CLCD_DISPLAY_ON_CURSOR_OFF_CMD , CLCD_INSTRUCTION_REGISTER);
+				CLCD_QueuePush(Local_pInstance , CLCD_DISPLAY_CLEAR_CMD , CLCD_INSTRUCTION_REGISTER);
+				CLCD_QueuePush(Local_pInstance , CLCD_ENTRY_MODE_CMD , CLCD_INSTRUCTION_REGISTER);
+
+				/* Send initialization sequence before returning */
+				Local_Status = CLCD_FlushInstance(Local_pInstance);
+
+				/* Interface mode is set up, busy flag can be read back from now on */
+				if(Copy_pHandle->waitMode == CLCD_WAIT_BUSY_FLAG)
+				{
+					Local_pInstance->BusyFlagReadable = 1;
+				}
+
+				/* Start with a blank framebuffer that is not sent yet */
+				for(Local_Counter = 0 ; Local_Counter < CLCD_MAX_CELLS ; Local_Counter++)
+				{
+					Local_pInstance->FrameBuffer[Local_Counter] = CLCD_BLANK_CHARACTER;
+				}
+			}
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Set function status as null pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleSendCommand                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Command                                           */
+/*				   Brief: Command to be sent to CLCD controller                   */
+/*				   Range: Same commands as CLCD_SendCommand                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Queue a command to controller of passed CLCD instance (non-    */
+/*                 blocking, sent by CLCD_HandleService or CLCD_ServiceAll)       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleSendCommand(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_Command)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Check if passed command is valid or not */
+		if(Copy_Command == CLCD_FUNCTION_SET_EIGHT_BIT_MODE_CMD || Copy_Command == CLCD_FUNCTION_SET_FOUR_BIT_MODE_CMD  ||
+		   Copy_Command == CLCD_DISPLAY_ON_CURSOR_OFF_CMD   	|| Copy_Command == CLCD_DISPLAY_OFF_CURSOR_OFF_CMD    	||
+		   Copy_Command == CLCD_DISPLAY_ON_CURSOR_ON_CMD   	    || Copy_Command == CLCD_DISPLAY_OFF_CURSOR_ON_CMD    	||
+		   Copy_Command == CLCD_BLINK_CURSOR_CMD				|| Copy_Command == CLCD_SHIFT_LEFT_CURSOR_CMD			||
+		   Copy_Command == CLCD_SHIFT_RIGHT_CURSOR_CMD			|| Copy_Command == CLCD_SHIFT_LEFT_DISPLAY_CMD			||
+		   Copy_Command == CLCD_SHIFT_RIGHT_DISPLAY_CMD		    || Copy_Command == CLCD_BEGIN_AT_FIRST_LINE_CMD		    ||
+		   Copy_Command == CLCD_BEGIN_AT_SECOND_LINE_CMD		|| Copy_Command == CLCD_DISPLAY_CLEAR_CMD 				||
+		   Copy_Command == CLCD_ENTRY_MODE_CMD)
+		{
+			/* Queue command to CLCD instruction register */
+			Local_Status = CLCD_QueuePush(Local_pInstance , Copy_Command , CLCD_INSTRUCTION_REGISTER);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleWriteCharacter                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Character                                         */
+/*				   Brief: Character to be written on CLCD display                 */
+/*				   Range: Any value can be represented in 1 byte                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Queue a character to be written on passed CLCD instance (non-  */
+/*                 blocking)                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleWriteCharacter(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_Character)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Queue character to CLCD data register */
+		Local_Status = CLCD_QueuePush(Local_pInstance , Copy_Character , CLCD_DATA_REGISTER);
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleWriteString                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t* Copy_pString                                          */
+/*				   Brief: Pointer to first character of null terminated string to */
+/*				          be written on CLCD                                      */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Write a string on passed CLCD instance starting at cursor      */
+/*                 cell. Once end of a row is reached (or '\n' is met), string    */
+/*                 continues at first cell of next row following instance         */
+/*                 geometry, and last row wraps to first row. A DDRAM address     */
+/*                 instruction is queued only where controller address counter   */
+/*                 does not already continue at that cell                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleWriteString(const CLCD_Handle_t* Copy_pHandle , uint8_t* Copy_pString)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+	uint8_t Local_Row;
+	uint8_t Local_Column;
+	uint8_t Local_RowAddress;
+	uint8_t Local_Wrapped = 0;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Check if passed pointer is NULL pointer or not */
+		if(Copy_pString != NULL)
+		{
+			/* Start from cursor cell (string is assumed to start at first cell if cursor position is unknown) */
+			if(CLCD_GetCursorCell(Local_pInstance , &Local_Row , &Local_Column) != RT_OK)
+			{
+				Local_Row = 0;
+				Local_Column = 0;
+			}
+
+			/* Write the passed string on the CLCD display */
+			while(*Copy_pString != '\0' && Local_Status == RT_OK)
+			{
+				/* New line character ends current row (unless row is just wrapped), other characters are written */
+				if(*Copy_pString == '\n')
+				{
+					Local_Column = (Local_Wrapped == 1) ? 0U : Local_pInstance->pHandle->columns;
+				}
+				else
+				{
+					Local_Status = CLCD_QueuePush(Local_pInstance , *Copy_pString , CLCD_DATA_REGISTER);
+					Local_Column++;
+				}
+				Local_Wrapped = 0;
+
+				/* Check if the end of a row is reached or not */
+				if(Local_Column == Local_pInstance->pHandle->columns && Local_Status == RT_OK)
+				{
+					/* Continue at first cell of next row (last row wraps to first row) */
+					Local_Row = ((Local_Row + 1U) == Local_pInstance->pHandle->rows) ? 0U : (Local_Row + 1U);
+					Local_Column = 0;
+					Local_Wrapped = 1;
+					Local_RowAddress = CLCD_ROW_DDRAM_ADDRESS(Local_Row,Local_pInstance->pHandle->columns);
+
+					/* Move cursor only if address counter did not already reach that cell (e.g. 40x2 row 0 to 1 or 20x4 row 3 to 0) */
+					if(Local_pInstance->CursorValid == 0 || Local_pInstance->CursorAddress != Local_RowAddress)
+					{
+						Local_Status = CLCD_QueuePush(Local_pInstance , CLCD_SET_DDRAM_ADDRESS_INSTRUCTION | Local_RowAddress , CLCD_INSTRUCTION_REGISTER);
+					}
+				}
+
+				/* Go to next character */
+				Copy_pString++;
+			}
+		}
+		else
+		{
+			/* Passed pointer is NULL pointer */
+			Local_Status = NULL_POINTER;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleWriteNumber                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 sint32_t Copy_Number                                           */
+/*				   Brief: Number (could be positive or negative) to be written on */
+/*				          CLCD                                                    */
+/*				   Range: Any sint32_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Write an integer number (could be positive or negative) on     */
+/*                 passed CLCD instance. Stops at first digit that can not be     */
+/*                 queued and returns its status (BUSY_FUNC if queue is full      */
+/*                 while engine is running in preempted context)                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleWriteNumber(const CLCD_Handle_t* Copy_pHandle , sint32_t Copy_Number)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+	uint8_t  Local_NumberString[FMT_DECIMAL_BUFFER_SIZE];		/* Sign, digits and null terminator */
+	uint8_t  Local_Length;
+	uint8_t  Local_Index;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Convert number to characters (sign included) */
+		FMT_Signed(Copy_Number , Local_NumberString , &Local_Length);
+
+		/* Write the passed number on the CLCD display */
+		for(Local_Index = 0 ; Local_Index < Local_Length && Local_Status == RT_OK ; Local_Index++)
+		{
+			Local_Status = CLCD_QueuePush(Local_pInstance , Local_NumberString[Local_Index] , CLCD_DATA_REGISTER);
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleSetCGRamAddress                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Location                                          */
+/*				   Brief: CGRAM location to be pointed to                         */
+/*				   Range: (0 --> 7)                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Force controller of passed CLCD instance to point to a CGRAM   */
+/*                 address                                                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleSetCGRamAddress(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_Location)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Check if passed location is valid or not */
+		if(Copy_Location < 8)
+		{
+			/* Order CLCD to point to desired location on CGRAM */
+			Local_Status = CLCD_QueuePush(Local_pInstance , CLCD_SET_CGRAM_ADDRESS_INSTRUCTION + (Copy_Location * 8) , CLCD_INSTRUCTION_REGISTER);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleWriteCustomCharactersOnCGRam                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t* Copy_pCharacter                                       */
+/*				   Brief: Pointer to 8 pattern rows of custom character           */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Location                                          */
+/*				   Brief: CGRAM location in which character will be stored        */
+/*				   Range: (0 --> 7)                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Add custom character to CGRAM of passed CLCD instance          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleWriteCustomCharactersOnCGRam(const CLCD_Handle_t* Copy_pHandle , uint8_t* Copy_pCharacter , uint8_t Copy_Location)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+	uint32_t Local_CharacterPatternCounter;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Check if passed pointer is NULL pointer or not */
+		if(Copy_pCharacter != NULL)
+		{
+			/* Access CGRAM location in which custom character will be written */
+			Local_Status = CLCD_HandleSetCGRamAddress(Copy_pHandle , Copy_Location);
+
+			/* Location no longer holds a glyph known by glyph cache */
+			if(Local_Status == RT_OK)
+			{
+				CLEAR_BIT(Local_pInstance->GlyphValid,Copy_Location);
+			}
+
+			/* Write custom character to selected CGRAM location through traversing over its patterns and writing it */
+			for(Local_CharacterPatternCounter = 0 ; Local_CharacterPatternCounter < 8 && Local_Status == RT_OK ; Local_CharacterPatternCounter++)
+			{
+				/* Write each pattern of custom character to selected CGRAM location */
+				Local_Status = CLCD_QueuePush(Local_pInstance , Copy_pCharacter[Local_CharacterPatternCounter] , CLCD_DATA_REGISTER);
+			}
+		}
+		else
+		{
+			/* Passed pointer is NULL pointer */
+			Local_Status = NULL_POINTER;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleMoveCursor                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_RowNumber                                         */
+/*				   Brief: CLCD row number                                         */
+/*				   Range: (0 --> rows - 1)                                        */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ColumnNumber                                      */
+/*				   Brief: CLCD column number                                      */
+/*				   Range: (0 --> columns - 1)                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Put the cursor at a specific cell of passed CLCD instance (row */
+/*                 DDRAM offsets follow instance geometry). Nothing is queued if  */
+/*                 cursor is already at that cell                                 */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleMoveCursor(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+	uint8_t Local_Address;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Check if passed cell is within instance geometry or not */
+		if(Copy_RowNumber < Local_pInstance->pHandle->rows && Copy_ColumnNumber < Local_pInstance->pHandle->columns)
+		{
+			/* Move the cursor to desired cell unless it is already there */
+			Local_Address = CLCD_ROW_DDRAM_ADDRESS(Copy_RowNumber,Local_pInstance->pHandle->columns) + Copy_ColumnNumber;
+			if(Local_pInstance->CursorValid == 0 || Local_pInstance->CursorAddress != Local_Address)
+			{
+				Local_Status = CLCD_QueuePush(Local_pInstance , CLCD_SET_DDRAM_ADDRESS_INSTRUCTION | Local_Address , CLCD_INSTRUCTION_REGISTER);
+			}
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleService                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Runs asynchronous CLCD engine for passed instance only (see    */
+/*                 CLCD_Service). Returns BUSY_FUNC if engine is already running  */
+/*                 in another context                                             */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleService(const CLCD_Handle_t* Copy_pHandle)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Send queued bytes of instance */
+		Local_Status = CLCD_ServiceInstance(Local_pInstance);
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ServiceAll                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Runs asynchronous CLCD engine over every registered instance,  */
+/*                 giving each a burst of up to CLCD_SERVICE_BURST bytes. Panel   */
+/*                 executing a long instruction is skipped so that refreshes of   */
+/*                 panels sharing the data bus are interleaved instead of         */
+/*                 serialized. Call it periodically (e.g. from a scheduler task)  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_ServiceAll(void)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t Local_Counter;
+
+	/* Service registered instances one after another */
+	for(Local_Counter = 0 ; Local_Counter < Global_InstancesCount && Local_Status == RT_OK ; Local_Counter++)
+	{
+		Local_Status = CLCD_ServiceInstance(&Global_Instances[Local_Counter]);
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFlush                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Blocks until all bytes queued for passed instance are sent and */
+/*                 its controller has executed last of them. Returns BUSY_FUNC if */
+/*                 engine is running in a context that the caller preempted       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFlush(const CLCD_Handle_t* Copy_pHandle)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Drain instance queue */
+		Local_Status = CLCD_FlushInstance(Local_pInstance);
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleGetQueueDepth                                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint16_t* Copy_pQueueDepth                                     */
+/*				   Brief: Pointer to variable that will hold number of bytes      */
+/*				          waiting in instance queue                               */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets number of bytes waiting in queue of passed CLCD instance  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleGetQueueDepth(const CLCD_Handle_t* Copy_pHandle , uint16_t* Copy_pQueueDepth)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Check if passed pointer is NULL pointer or not */
+		if(Copy_pQueueDepth != NULL)
+		{
+			/* Return number of queued bytes */
+			*Copy_pQueueDepth = Local_pInstance->QueueCount;
+		}
+		else
+		{
+			/* Passed pointer is NULL pointer */
+			Local_Status = NULL_POINTER;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameClear                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Fills shadow framebuffer of passed CLCD instance with spaces   */
+/*                 (panel is updated by CLCD_HandleFrameRefresh)                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameClear(const CLCD_Handle_t* Copy_pHandle)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+	uint8_t Local_Cell;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Fill framebuffer with blank cells */
+		for(Local_Cell = 0 ; Local_Cell < CLCD_MAX_CELLS ; Local_Cell++)
+		{
+			Local_pInstance->FrameBuffer[Local_Cell] = CLCD_BLANK_CHARACTER;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameWriteCharacter                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_RowNumber                                         */
+/*				   Brief: CLCD row number                                         */
+/*				   Range: (0 --> rows - 1)                                        */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ColumnNumber                                      */
+/*				   Brief: CLCD column number                                      */
+/*				   Range: (0 --> columns - 1)                                     */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Character                                         */
+/*				   Brief: Character to be written in framebuffer                  */
+/*				   Range: Any value can be represented in 1 byte                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Writes a character in shadow framebuffer of passed CLCD        */
+/*                 instance at passed cell                                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameWriteCharacter(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber , uint8_t Copy_Character)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Check if passed cell is within instance geometry or not */
+		if(Copy_RowNumber < Local_pInstance->pHandle->rows && Copy_ColumnNumber < Local_pInstance->pHandle->columns)
+		{
+			/* Write character in framebuffer */
+			Local_pInstance->FrameBuffer[(Copy_RowNumber * Local_pInstance->pHandle->columns) + Copy_ColumnNumber] = Copy_Character;
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameWriteString                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_RowNumber                                         */
+/*				   Brief: CLCD row number                                         */
+/*				   Range: (0 --> rows - 1)                                        */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ColumnNumber                                      */
+/*				   Brief: CLCD column number                                      */
+/*				   Range: (0 --> columns - 1)                                     */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pString                                    */
+/*				   Brief: Pointer to null terminated string                       */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Writes a string in shadow framebuffer of passed CLCD instance  */
+/*                 starting at passed cell. String is truncated at end of row     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameWriteString(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber , const uint8_t* Copy_pString)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Check if passed pointer is NULL pointer or not */
+		if(Copy_pString != NULL)
+		{
+			/* Check if passed cell is within instance geometry or not */
+			if(Copy_RowNumber < Local_pInstance->pHandle->rows && Copy_ColumnNumber < Local_pInstance->pHandle->columns)
+			{
+				/* Copy string characters until its end or end of row */
+				while(*Copy_pString != '\0' && Copy_ColumnNumber < Local_pInstance->pHandle->columns)
+				{
+					Local_pInstance->FrameBuffer[(Copy_RowNumber * Local_pInstance->pHandle->columns) + Copy_ColumnNumber] = *Copy_pString;
+					Copy_ColumnNumber++;
+					Copy_pString++;
+				}
+			}
+			else
+			{
+				/* Function is not behaving as expected */
+				Local_Status = RT_NOK;
+			}
+		}
+		else
+		{
+			/* Passed pointer is NULL pointer */
+			Local_Status = NULL_POINTER;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameWriteNumber                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_RowNumber                                         */
+/*				   Brief: CLCD row number                                         */
+/*				   Range: (0 --> rows - 1)                                        */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ColumnNumber                                      */
+/*				   Brief: CLCD column number                                      */
+/*				   Range: (0 --> columns - 1)                                     */
+/*				   -------------------------------------------------------------- */
+/*                 sint32_t Copy_Number                                           */
+/*				   Brief: Number (could be positive or negative) to be written    */
+/*				   Range: Any sint32_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Writes an integer number in shadow framebuffer of passed CLCD  */
+/*                 instance starting at passed cell. Number is truncated at end   */
+/*                 of row                                                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameWriteNumber(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_RowNumber , uint8_t Copy_ColumnNumber , sint32_t Copy_Number)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t  Local_NumberString[FMT_DECIMAL_BUFFER_SIZE];		/* Sign, digits and null terminator */
+
+	/* Convert number to characters (sign included) */
+	FMT_Signed(Copy_Number , Local_NumberString , NULL);
+
+	/* Write number string in framebuffer */
+	Local_Status = CLCD_HandleFrameWriteString(Copy_pHandle , Copy_RowNumber , Copy_ColumnNumber , Local_NumberString);
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameWriteText                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 const CLCD_TextBox_t* Copy_pTextBox                            */
+/*				   Brief: Pointer to text box (rows range, alignment and wrap     */
+/*				          mode) that text is laid out in                          */
+/*				   Range: Any pointer to CLCD_TextBox_t within instance geometry  */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pText                                      */
+/*				   Brief: Pointer to null terminated text ('\n' starts a new      */
+/*				          line)                                                   */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Lays text out in shadow framebuffer rows of passed text box:   */
+/*                 text is broken into lines at box width (by words or            */
+/*                 characters), each line is aligned and remaining box rows are   */
+/*                 blanked. If text needs more lines than box has, box is         */
+/*                 scrolled so that its last lines are shown (panel is updated by */
+/*                 CLCD_HandleFrameRefresh)                                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameWriteText(const CLCD_Handle_t* Copy_pHandle , const CLCD_TextBox_t* Copy_pTextBox , const uint8_t* Copy_pText)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+	const uint8_t* Local_pLine;
+	uint16_t Local_LinesCount = 0;
+	uint16_t Local_SkippedLines = 0;
+	uint8_t  Local_Length;
+	uint8_t  Local_NextLine;
+	uint8_t  Local_Row;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Check if passed pointers are NULL pointers or not */
+		if(Copy_pTextBox != NULL && Copy_pText != NULL)
+		{
+			/* Check if passed text box is within instance geometry or not */
+			if(Copy_pTextBox->firstRow <= Copy_pTextBox->lastRow && Copy_pTextBox->lastRow < Local_pInstance->pHandle->rows &&
+			   Copy_pTextBox->alignment <= CLCD_ALIGN_CENTER && Copy_pTextBox->wrapMode <= CLCD_WRAP_WORD)
+			{
+				/* Count lines of text */
+				for(Local_pLine = Copy_pText ; *Local_pLine != '\0' ; Local_pLine += Local_NextLine)
+				{
+					CLCD_GetLineBreak(Local_pLine , Local_pInstance->pHandle->columns , Copy_pTextBox->wrapMode , &Local_NextLine);
+					Local_LinesCount++;
+				}
+
+				/* Scroll box to last lines of text if text does not fit in it */
+				if(Local_LinesCount > (uint16_t)(Copy_pTextBox->lastRow - Copy_pTextBox->firstRow + 1U))
+				{
+					Local_SkippedLines = Local_LinesCount - (Copy_pTextBox->lastRow - Copy_pTextBox->firstRow + 1U);
+				}
+
+				/* Write shown lines in box rows */
+				Local_Row = Copy_pTextBox->firstRow;
+				for(Local_pLine = Copy_pText ; *Local_pLine != '\0' ; Local_pLine += Local_NextLine)
+				{
+					Local_Length = CLCD_GetLineBreak(Local_pLine , Local_pInstance->pHandle->columns , Copy_pTextBox->wrapMode , &Local_NextLine);
+					if(Local_SkippedLines != 0)
+					{
+						Local_SkippedLines--;
+					}
+					else
+					{
+						CLCD_FrameWriteLine(Local_pInstance , Local_Row , Local_pLine , Local_Length , Copy_pTextBox->alignment);
+						Local_Row++;
+					}
+				}
+
+				/* Blank remaining box rows */
+				for( ; Local_Row <= Copy_pTextBox->lastRow ; Local_Row++)
+				{
+					CLCD_FrameWriteLine(Local_pInstance , Local_Row , Copy_pText , 0 , CLCD_ALIGN_LEFT);
+				}
+			}
+			else
+			{
+				/* Function is not behaving as expected */
+				Local_Status = RT_NOK;
+			}
+		}
+		else
+		{
+			/* Passed pointer is NULL pointer */
+			Local_Status = NULL_POINTER;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameAppendText                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 const CLCD_TextBox_t* Copy_pTextBox                            */
+/*				   Brief: Pointer to text box (rows range, alignment and wrap     */
+/*				          mode) that text is laid out in                          */
+/*				   Range: Any pointer to CLCD_TextBox_t within instance geometry  */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pText                                      */
+/*				   Brief: Pointer to null terminated text ('\n' starts a new      */
+/*				          line)                                                   */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Scrolls rows of passed text box up by one row for each line of */
+/*                 text then writes that line in last row of box (scrolling       */
+/*                 region), so that box keeps showing latest lines like a         */
+/*                 terminal (panel is updated by CLCD_HandleFrameRefresh)         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameAppendText(const CLCD_Handle_t* Copy_pHandle , const CLCD_TextBox_t* Copy_pTextBox , const uint8_t* Copy_pText)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+	uint8_t Local_Length;
+	uint8_t Local_NextLine;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Check if passed pointers are NULL pointers or not */
+		if(Copy_pTextBox != NULL && Copy_pText != NULL)
+		{
+			/* Check if passed text box is within instance geometry or not */
+			if(Copy_pTextBox->firstRow <= Copy_pTextBox->lastRow && Copy_pTextBox->lastRow < Local_pInstance->pHandle->rows &&
+			   Copy_pTextBox->alignment <= CLCD_ALIGN_CENTER && Copy_pTextBox->wrapMode <= CLCD_WRAP_WORD)
+			{
+				/* Scroll box up then write each line of text in its last row */
+				while(*Copy_pText != '\0')
+				{
+					Local_Length = CLCD_GetLineBreak(Copy_pText , Local_pInstance->pHandle->columns , Copy_pTextBox->wrapMode , &Local_NextLine);
+					CLCD_FrameScrollUp(Local_pInstance , Copy_pTextBox->firstRow , Copy_pTextBox->lastRow);
+					CLCD_FrameWriteLine(Local_pInstance , Copy_pTextBox->lastRow , Copy_pText , Local_Length , Copy_pTextBox->alignment);
+					Copy_pText += Local_NextLine;
+				}
+			}
+			else
+			{
+				/* Function is not behaving as expected */
+				Local_Status = RT_NOK;
+			}
+		}
+		else
+		{
+			/* Passed pointer is NULL pointer */
+			Local_Status = NULL_POINTER;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameRefresh                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Compares shadow framebuffer of passed CLCD instance with last  */
+/*                 image sent to its panel and queues only changed character      */
+/*                 runs, each preceded by a DDRAM address instruction unless      */
+/*                 tracked address counter is already there (also across rows     */
+/*                 that follow each other in DDRAM)                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameRefresh(const CLCD_Handle_t* Copy_pHandle)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+	uint8_t Local_Rows;
+	uint8_t Local_Columns;
+	uint8_t Local_Row;
+	uint8_t Local_Column;
+	uint8_t Local_Cell;
+	uint8_t Local_Address;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Get instance geometry */
+		Local_Rows = Local_pInstance->pHandle->rows;
+		Local_Columns = Local_pInstance->pHandle->columns;
+
+		/* Traverse framebuffer cells */
+		for(Local_Row = 0 ; Local_Row < Local_Rows && Local_Status == RT_OK ; Local_Row++)
+		{
+			for(Local_Column = 0 ; Local_Column < Local_Columns && Local_Status == RT_OK ; Local_Column++)
+			{
+				/* Get framebuffer index of cell */
+				Local_Cell = (Local_Row * Local_Columns) + Local_Column;
+
+				/* Check if cell changed since last sent image or not */
+				if(Local_pInstance->SentFrameValid == 0 || Local_pInstance->FrameBuffer[Local_Cell] != Local_pInstance->SentFrame[Local_Cell])
+				{
+					/* Move panel cursor only if address counter is not already at this cell */
+					Local_Address = CLCD_ROW_DDRAM_ADDRESS(Local_Row,Local_Columns) + Local_Column;
+					if(Local_pInstance->CursorValid == 0 || Local_pInstance->CursorAddress != Local_Address)
+					{
+						Local_Status = CLCD_QueuePush(Local_pInstance , CLCD_SET_DDRAM_ADDRESS_INSTRUCTION | Local_Address , CLCD_INSTRUCTION_REGISTER);
+					}
+
+					/* Send changed character (cursor then increments by entry mode) */
+					if(Local_Status == RT_OK)
+					{
+						Local_Status = CLCD_QueuePush(Local_pInstance , Local_pInstance->FrameBuffer[Local_Cell] , CLCD_DATA_REGISTER);
+					}
+
+					/* Record sent character */
+					if(Local_Status == RT_OK)
+					{
+						Local_pInstance->SentFrame[Local_Cell] = Local_pInstance->FrameBuffer[Local_Cell];
+					}
+				}
+			}
+		}
+
+		/* Sent image matches panel only if every changed cell is queued */
+		Local_pInstance->SentFrameValid = (Local_Status == RT_OK);
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleFrameInvalidate                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Forgets last image sent to panel of passed CLCD instance so    */
+/*                 that next CLCD_HandleFrameRefresh redraws every cell           */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleFrameInvalidate(const CLCD_Handle_t* Copy_pHandle)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Force next refresh to redraw every cell */
+		Local_pInstance->SentFrameValid = 0;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleReadDDRam                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Address                                           */
+/*				   Brief: DDRAM address of first character to be read             */
+/*				   Range: (0x00 --> 0x7F)                                         */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Length                                            */
+/*				   Brief: Number of characters to be read                         */
+/*				   Range: (1 --> 0x80 - Copy_Address)                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pData                                            */
+/*				   Brief: Pointer to array that will hold read characters         */
+/*				   Range: Any pointer to array of Copy_Length bytes               */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Flushes queue of passed CLCD instance then reads characters    */
+/*                 back from its controller DDRAM and restores address counter to */
+/*                 its previous DDRAM position. Requires CLCD_WAIT_BUSY_FLAG wait */
+/*                 mode (returns RT_NOK otherwise) and returns BUSY_FUNC if       */
+/*                 engine is running in a context that the caller preempted       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleReadDDRam(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_Address , uint8_t* Copy_pData , uint8_t Copy_Length)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+	uint8_t Local_AddressCounter;
+	uint8_t Local_Counter;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Check if passed pointer is NULL pointer or not */
+		if(Copy_pData != NULL)
+		{
+			/* Check if passed address range is valid or not */
+			if(Copy_Length == 0 || ((uint16_t)Copy_Address + Copy_Length) > CLCD_DDRAM_ADDRESS_SPACE)
+			{
+				/* Set function status as out of range */
+				Local_Status = OUT_OF_RANGE;
+			}
+			/* Check if controller can be read (RW pin driven) or not */
+			else if(Local_pInstance->pHandle->waitMode == CLCD_WAIT_BUSY_FLAG)
+			{
+				/* Send queued bytes so that read back reflects them */
+				Local_Status = CLCD_FlushInstance(Local_pInstance);
+
+				/* Claim CLCD engine */
+				if(Local_Status == RT_OK)
+				{
+					Local_Status = CLCD_ClaimEngine();
+				}
+
+				/* Check if engine is claimed or not */
+				if(Local_Status == RT_OK)
+				{
+					/* Wait for execution of last sent instruction */
+					while(CLCD_IsControllerBusy(Local_pInstance) == 1);
+
+					/* Save current cursor position */
+					Local_AddressCounter = CLCD_ReadBus(Local_pInstance , CLCD_INSTRUCTION_REGISTER) & CLCD_ADDRESS_COUNTER_MASK;
+
+					/* Point address counter to first requested character */
+					CLCD_WriteBus(Local_pInstance , CLCD_SET_DDRAM_ADDRESS_INSTRUCTION | Copy_Address , CLCD_INSTRUCTION_REGISTER);
+					SERV_StartTimeout_us(&Local_pInstance->ControllerBusyTimeout , CLCD_INSTRUCTION_EXECUTION_TIME);
+
+					/* Read requested characters (address counter is incremented by controller) */
+					for(Local_Counter = 0 ; Local_Counter < Copy_Length ; Local_Counter++)
+					{
+						while(CLCD_IsControllerBusy(Local_pInstance) == 1);
+						Copy_pData[Local_Counter] = CLCD_ReadBus(Local_pInstance , CLCD_DATA_REGISTER);
+						SERV_StartTimeout_us(&Local_pInstance->ControllerBusyTimeout , CLCD_INSTRUCTION_EXECUTION_TIME);
+					}
+
+					/* Restore cursor position */
+					while(CLCD_IsControllerBusy(Local_pInstance) == 1);
+					CLCD_WriteBus(Local_pInstance , CLCD_SET_DDRAM_ADDRESS_INSTRUCTION | Local_AddressCounter , CLCD_INSTRUCTION_REGISTER);
+					SERV_StartTimeout_us(&Local_pInstance->ControllerBusyTimeout , CLCD_INSTRUCTION_EXECUTION_TIME);
+
+					/* Release CLCD engine */
+					Global_ServiceBusy = 0;
+				}
+			}
+			else
+			{
+				/* Function is not behaving as expected */
+				Local_Status = RT_NOK;
+			}
+		}
+		else
+		{
+			/* Set function status as null pointer */
+			Local_Status = NULL_POINTER;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleRequestGlyph                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pGlyph                                     */
+/*				   Brief: Pointer to 8 pattern rows of custom character (5 low    */
+/*				          bits of each row are used)                              */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pSlot                                            */
+/*				   Brief: Pointer to variable that will hold character code of    */
+/*				          glyph (CGRAM slot) to be written on CLCD                */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Returns CGRAM slot of passed CLCD instance holding passed      */
+/*                 glyph. If glyph is not loaded, it is queued to a free slot or  */
+/*                 to least recently used slot whose character is not shown in    */
+/*                 framebuffer or last sent frame, then cursor is returned to its */
+/*                 DDRAM address (first cell if it is unknown). Returns RT_NOK if */
+/*                 every slot holds a glyph shown on screen, BUSY_FUNC if queue   */
+/*                 can not take whole load                                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleRequestGlyph(const CLCD_Handle_t* Copy_pHandle , const uint8_t* Copy_pGlyph , uint8_t* Copy_pSlot)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+	uint8_t Local_Slot;
+	uint8_t Local_Row;
+	uint8_t Local_CursorAddress;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Check if passed pointers are NULL pointers or not */
+		if(Copy_pGlyph != NULL && Copy_pSlot != NULL)
+		{
+			/* Look for glyph among loaded slots */
+			Local_Slot = CLCD_FindGlyph(Local_pInstance , Copy_pGlyph);
+
+			/* Check if glyph is already loaded or not */
+			if(Local_Slot < CLCD_CGRAM_SLOTS)
+			{
+				Local_pInstance->GlyphHits++;
+			}
+			else
+			{
+				Local_pInstance->GlyphMisses++;
+
+				/* Take a free slot or least recently used slot that is not on screen */
+				Local_Slot = CLCD_GetGlyphVictim(Local_pInstance);
+				if(Local_Slot < CLCD_CGRAM_SLOTS)
+				{
+					/* Make room for whole load (CGRAM address, glyph rows and DDRAM address) before any byte of it is queued */
+					Local_Status = CLCD_QueueReserve(Local_pInstance , CLCD_GLYPH_LOAD_BYTES);
+					if(Local_Status == RT_OK)
+					{
+						/* Remember DDRAM cursor before address counter is turned to CGRAM (first cell if it is unknown) */
+						Local_CursorAddress = (Local_pInstance->CursorValid == 1) ? Local_pInstance->CursorAddress : 0U;
+
+						/* Slot holds no valid glyph until whole bitmap is queued */
+						CLEAR_BIT(Local_pInstance->GlyphValid,Local_Slot);
+
+						/* Queue glyph rows to its slot */
+						Local_Status = CLCD_QueuePush(Local_pInstance , CLCD_SET_CGRAM_ADDRESS_INSTRUCTION | (Local_Slot << CLCD_CGRAM_SLOT_SHIFT) , CLCD_INSTRUCTION_REGISTER);
+						for(Local_Row = 0 ; Local_Row < CLCD_GLYPH_ROWS && Local_Status == RT_OK ; Local_Row++)
+						{
+							Local_pInstance->GlyphCache[Local_Slot][Local_Row] = Copy_pGlyph[Local_Row] & CLCD_GLYPH_ROW_MASK;
+							Local_Status = CLCD_QueuePush(Local_pInstance , Local_pInstance->GlyphCache[Local_Slot][Local_Row] , CLCD_DATA_REGISTER);
+						}
+
+						/* Always return address counter to DDRAM so that following characters are never written in CGRAM */
+						if(Local_Status == RT_OK)
+						{
+							Local_Status = CLCD_QueuePush(Local_pInstance , CLCD_SET_DDRAM_ADDRESS_INSTRUCTION | Local_CursorAddress , CLCD_INSTRUCTION_REGISTER);
+						}
+
+						/* Record loaded glyph, or forget slot and cursor if load was cut */
+						if(Local_Status == RT_OK)
+						{
+							SET_BIT(Local_pInstance->GlyphValid,Local_Slot);
+						}
+						else
+						{
+							CLEAR_BIT(Local_pInstance->GlyphValid,Local_Slot);
+							Local_pInstance->CursorValid = 0;
+						}
+					}
+				}
+				else
+				{
+					/* Every slot holds a glyph shown on screen */
+					Local_Status = RT_NOK;
+				}
+			}
+
+			/* Mark slot as most recently used then return it */
+			if(Local_Status == RT_OK)
+			{
+				Local_pInstance->GlyphUseCounter++;
+				Local_pInstance->GlyphLastUse[Local_Slot] = Local_pInstance->GlyphUseCounter;
+				*Copy_pSlot = Local_Slot;
+			}
+		}
+		else
+		{
+			/* Passed pointer is NULL pointer */
+			Local_Status = NULL_POINTER;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleGetGlyphStatistics                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pHits                                           */
+/*				   Brief: Pointer to variable that will hold number of requests   */
+/*				          found in cache                                          */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pMisses                                         */
+/*				   Brief: Pointer to variable that will hold number of requests   */
+/*				          not found in cache                                      */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets hit and miss counters of glyph cache of passed CLCD       */
+/*                 instance                                                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleGetGlyphStatistics(const CLCD_Handle_t* Copy_pHandle , uint32_t* Copy_pHits , uint32_t* Copy_pMisses)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Check if passed pointers are NULL pointers or not */
+		if(Copy_pHits != NULL && Copy_pMisses != NULL)
+		{
+			/* Return glyph cache counters */
+			*Copy_pHits = Local_pInstance->GlyphHits;
+			*Copy_pMisses = Local_pInstance->GlyphMisses;
+		}
+		else
+		{
+			/* Passed pointer is NULL pointer */
+			Local_Status = NULL_POINTER;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: HandleResetGlyphCache                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Forgets glyphs loaded in CGRAM of passed CLCD instance and     */
+/*                 clears its hit and miss counters                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t CLCD_HandleResetGlyphCache(const CLCD_Handle_t* Copy_pHandle)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	CLCD_Instance_t* Local_pInstance;
+
+	/* Get instance of passed handle */
+	Local_Status = CLCD_GetInstance(Copy_pHandle , &Local_pInstance);
+
+	/* Check if passed handle is registered or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Forget loaded glyphs and clear counters */
+		Local_pInstance->GlyphValid = 0;
+		Local_pInstance->GlyphHits = 0;
+		Local_pInstance->GlyphMisses = 0;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetInstance                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Handle_t* Copy_pHandle                              */
+/*				   Brief: Pointer to CLCD instance descriptor registered by       */
+/*				          CLCD_HandleInit                                         */
+/*				   Range: Any pointer to registered CLCD_Handle_t                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : CLCD_Instance_t** Copy_ppInstance                              */
+/*				   Brief: Pointer to variable that will hold pointer to instance  */
+/*				          of passed handle                                        */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets instances pool slot owned by passed handle. Returns       */
+/*                 RT_NOK if handle is not registered by CLCD_HandleInit          */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t CLCD_GetInstance(const CLCD_Handle_t* Copy_pHandle , CLCD_Instance_t** Copy_ppInstance)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed handle is NULL pointer or not */
+	if(Copy_pHandle != NULL)
+	{
+		/* Check if handle owns a slot of instances pool or not */
+		if(Copy_pHandle->instanceId < Global_InstancesCount && Global_Instances[Copy_pHandle->instanceId].pHandle == Copy_pHandle)
+		{
+			*Copy_ppInstance = &Global_Instances[Copy_pHandle->instanceId];
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Set function status as null pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ClaimEngine                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Claims CLCD engine (and so shared data bus) for caller         */
+/*                 context. Returns BUSY_FUNC if engine is running in a preempted */
+/*                 context. Engine is released by clearing Global_ServiceBusy     */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t CLCD_ClaimEngine(void)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_PrimaskState;
+
+	/* Test and set engine flag atomically */
+	CLCD_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+	if(Global_ServiceBusy == 0)
+	{
+		Global_ServiceBusy = 1;
+	}
+	else
+	{
+		/* Engine is running in a preempted context */
+		Local_Status = BUSY_FUNC;
+	}
+	CLCD_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ServiceInstance                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : CLCD_Instance_t* Copy_pInstance                                */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Clocks queued bytes of passed instance out to its controller   */
+/*                 respecting instruction execution time (ended early by busy     */
+/*                 flag in CLCD_WAIT_BUSY_FLAG mode). Never waits for controller: */
+/*                 stops once it is busy and resumes on next call, sending at     */
+/*                 most CLCD_SERVICE_BURST bytes per call. Returns BUSY_FUNC if   */
+/*                 engine is already running in another context                   */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t CLCD_ServiceInstance(CLCD_Instance_t* Copy_pInstance)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_PrimaskState;
+	uint16_t Local_Entry;
+	uint8_t Local_Byte;
+	uint8_t Local_BytesSent = 0;
+
+	/* Claim CLCD engine */
+	Local_Status = CLCD_ClaimEngine();
+
+	/* Check if engine is claimed or not */
+	if(Local_Status == RT_OK)
+	{
+		/* Send queued bytes up to burst limit */
+		while(Copy_pInstance->QueueCount != 0 && Local_BytesSent < CLCD_SERVICE_BURST)
+		{
+			/* Check if controller is still executing last instruction or not */
+			if(CLCD_IsControllerBusy(Copy_pInstance) == 1)
+			{
+				/* Remaining bytes are left to next call */
+				break;
+			}
+
+			/* Get next queued byte */
+			Local_Entry = Copy_pInstance->Queue[Copy_pInstance->QueueHead];
+			Local_Byte = (uint8_t)(Local_Entry & CLCD_QUEUE_BYTE_MASK);
+
+			/* Clock byte to CLCD controller */
+			CLCD_WriteBus(Copy_pInstance , Local_Byte , GET_BIT(Local_Entry,CLCD_QUEUE_RS_BIT));
+
+			/* Start execution time of sent byte */
+			if(GET_BIT(Local_Entry,CLCD_QUEUE_RS_BIT) == CLCD_INSTRUCTION_REGISTER &&
+			   (Local_Byte == CLCD_CLEAR_DISPLAY_INSTRUCTION || (Local_Byte & CLCD_RETURN_HOME_MASK) == CLCD_RETURN_HOME_INSTRUCTION))
+			{
+				SERV_StartTimeout_us(&Copy_pInstance->ControllerBusyTimeout , CLCD_LONG_INSTRUCTION_EXECUTION_TIME);
+			}
+			else
+			{
+				SERV_StartTimeout_us(&Copy_pInstance->ControllerBusyTimeout , CLCD_INSTRUCTION_EXECUTION_TIME);
+			}
+
+			/* Remove sent byte from queue */
+			CLCD_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+			Copy_pInstance->QueueHead = (Copy_pInstance->QueueHead + 1U) & (CLCD_QUEUE_SIZE - 1U);
+			Copy_pInstance->QueueCount--;
+			CLCD_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+
+			/* Count sent byte */
+			Local_BytesSent++;
+		}
+
+		/* Release CLCD engine */
+		Global_ServiceBusy = 0;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FlushInstance                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : CLCD_Instance_t* Copy_pInstance                                */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Blocks until all queued bytes of passed instance are sent and  */
+/*                 its controller has executed last of them. Returns BUSY_FUNC if */
+/*                 engine is running in a context that the caller preempted       */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t CLCD_FlushInstance(CLCD_Instance_t* Copy_pInstance)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Service instance until its queue is empty */
+	while(Copy_pInstance->QueueCount != 0 && Local_Status == RT_OK)
+	{
+		Local_Status = CLCD_ServiceInstance(Copy_pInstance);
+	}
+
+	/* Wait for execution of last sent instruction (busy flag read needs engine) */
+	if(Local_Status == RT_OK)
+	{
+		Local_Status = CLCD_ClaimEngine();
+		if(Local_Status == RT_OK)
+		{
+			while(CLCD_IsControllerBusy(Copy_pInstance) == 1);
+			Global_ServiceBusy = 0;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: QueuePush                                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Byte                                              */
+/*				   Brief: Instruction or data byte                                */
+/*				   Range: Any value can be represented in 1 byte                  */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_RegisterSelect                                    */
+/*				   Brief: Destination register of byte                            */
+/*				   Range: CLCD_INSTRUCTION_REGISTER or CLCD_DATA_REGISTER         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : CLCD_Instance_t* Copy_pInstance                                */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Puts a byte in queue of passed instance and follows its effect */
+/*                 on controller address counter. If queue is full, instance is   */
+/*                 serviced in place until a slot is freed. Returns               */
+/*                 BUSY_FUNC if queue is full while engine is running in          */
+/*                 preempted context                                              */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t CLCD_QueuePush(CLCD_Instance_t* Copy_pInstance , uint8_t Copy_Byte , uint8_t Copy_RegisterSelect)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_PrimaskState;
+	uint8_t Local_Queued = 0;
+
+	/* Keep trying until byte is queued or queue can not be drained */
+	while(Local_Queued == 0 && Local_Status == RT_OK)
+	{
+		/* Queue is shared with CLCD engine context */
+		CLCD_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+		/* Check if there is a free slot or not */
+		if(Copy_pInstance->QueueCount < CLCD_QUEUE_SIZE)
+		{
+			/* Put byte with its register select bit at queue tail */
+			Copy_pInstance->Queue[Copy_pInstance->QueueTail] = (uint16_t)Copy_Byte | ((uint16_t)Copy_RegisterSelect << CLCD_QUEUE_RS_BIT);
+			Copy_pInstance->QueueTail = (Copy_pInstance->QueueTail + 1U) & (CLCD_QUEUE_SIZE - 1U);
+			Copy_pInstance->QueueCount++;
+			Local_Queued = 1;
+		}
+
+		/* Leave critical section */
+		CLCD_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+
+		/* Follow address counter of queued byte, or drain queue in place if it is full */
+		if(Local_Queued == 1)
+		{
+			CLCD_TrackCursor(Copy_pInstance , Copy_Byte , Copy_RegisterSelect);
+		}
+		else
+		{
+			Local_Status = CLCD_ServiceInstance(Copy_pInstance);
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: QueueReserve                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint16_t Copy_Count                                            */
+/*				   Brief: Number of bytes about to be queued together             */
+/*				   Range: (1 --> CLCD_QUEUE_SIZE)                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : CLCD_Instance_t* Copy_pInstance                                */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Services passed instance in place until its queue has room for */
+/*                 passed number of bytes. Returns RT_NOK if queue is smaller     */
+/*                 than that, BUSY_FUNC if room can not be made while engine is   */
+/*                 running in preempted context                                   */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t CLCD_QueueReserve(CLCD_Instance_t* Copy_pInstance , uint16_t Copy_Count)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if queue can ever hold passed number of bytes or not */
+	if(Copy_Count <= CLCD_QUEUE_SIZE)
+	{
+		/* Drain queue in place until there is enough room */
+		while((CLCD_QUEUE_SIZE - Copy_pInstance->QueueCount) < Copy_Count && Local_Status == RT_OK)
+		{
+			Local_Status = CLCD_ServiceInstance(Copy_pInstance);
+		}
+	}
+	else
+	{
+		/* Queue is too small */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: WriteBus                                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : CLCD_Instance_t* Copy_pInstance                                */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Byte                                              */
+/*				   Brief: Instruction or data byte                                */
+/*				   Range: Any value can be represented in 1 byte                  */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_RegisterSelect                                    */
+/*				   Brief: Destination register of byte                            */
+/*				   Range: CLCD_INSTRUCTION_REGISTER or CLCD_DATA_REGISTER         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Clocks one byte to controller of passed instance (two nibbles  */
+/*                 in 4-bit mode) through E pin pulses of CLCD_ENABLE_PULSE_WIDTH */
+/*                 us. Each nibble/byte is put on data pins with one BSRR store   */
+/*                 taken from instance pin map tables. Does not wait for          */
+/*                 instruction execution                                          */
+/*--------------------------------------------------------------------------------*/
+static void CLCD_WriteBus(CLCD_Instance_t* Copy_pInstance , uint8_t Copy_Byte , uint8_t Copy_RegisterSelect)
+{
+	/* Local Variables Definitions */
+	const CLCD_Handle_t* Local_pHandle = Copy_pInstance->pHandle;
+	uint32_t Local_RegisterSelectBSRR = CLCD_PIN_BSRR(Copy_RegisterSelect,0,Local_pHandle->rsPin);
+	uint32_t Local_DataBSRR = Copy_pInstance->HighPinsMap[Copy_Byte >> 4];
+
+	/* Take shared data bus back from controller if it was read */
+	if(Global_pReadingInstance != NULL)
+	{
+		CLCD_SetBusDirection(Global_pReadingInstance , CLCD_BUS_WRITE);
+	}
+
+	/* Get BSRR word of whole byte in 8-bit mode (D0..D3 and D4..D7 words touch disjoint pins) */
+	if(Local_pHandle->mode == CLCD_EIGHT_BIT_MODE)
+	{
+		Local_DataBSRR |= Copy_pInstance->LowPinsMap[Copy_Byte & 0x0FU];
+	}
+
+	/* Check if RS pin shares CLCD data port */
+	if(Local_pHandle->ctrlPort == Local_pHandle->dataPort)
+	{
+		/* Select register and set (most significant) bits on CLCD data port in one store */
+		GPIO_SetResetPortPins(Local_pHandle->dataPort , Local_DataBSRR | Local_RegisterSelectBSRR);
+	}
+	else
+	{
+		/* Select instruction or data register */
+		GPIO_SetResetPortPins(Local_pHandle->ctrlPort , Local_RegisterSelectBSRR);
+
+		/* Set (most significant) bits on CLCD data port in one store */
+		GPIO_SetResetPortPins(Local_pHandle->dataPort , Local_DataBSRR);
+	}
+
+	/* Check CLCD Mode */
+	if(Local_pHandle->mode == CLCD_FOUR_BIT_MODE)
+	{
+		/* Pulse E to latch most significant bits */
+		GPIO_SetResetPortPins(Local_pHandle->ctrlPort , CLCD_PIN_SET_BSRR(Local_pHandle->ePin));
+		SERV_Delay_us(CLCD_ENABLE_PULSE_WIDTH);
+		GPIO_SetResetPortPins(Local_pHandle->ctrlPort , CLCD_PIN_RESET_BSRR(Local_pHandle->ePin));
+		SERV_Delay_us(CLCD_ENABLE_PULSE_WIDTH);
+
+		/* Set byte least significant bits on CLCD data port in one store */
+		GPIO_SetResetPortPins(Local_pHandle->dataPort , Copy_pInstance->HighPinsMap[Copy_Byte & 0x0FU]);
+	}
+
+	/* Pulse E to latch (least significant) bits */
+	GPIO_SetResetPortPins(Local_pHandle->ctrlPort , CLCD_PIN_SET_BSRR(Local_pHandle->ePin));
+	SERV_Delay_us(CLCD_ENABLE_PULSE_WIDTH);
+	GPIO_SetResetPortPins(Local_pHandle->ctrlPort , CLCD_PIN_RESET_BSRR(Local_pHandle->ePin));
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ReadBus                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : CLCD_Instance_t* Copy_pInstance                                */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_RegisterSelect                                    */
+/*				   Brief: Source register of byte                                 */
+/*				   Range: CLCD_INSTRUCTION_REGISTER or CLCD_DATA_REGISTER         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : uint8_t (byte read from CLCD controller)                       */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Turns data bus of passed instance to read direction if needed  */
+/*                 then clocks one byte out of its controller (two nibbles in     */
+/*                 4-bit mode). Reading instruction register returns busy flag    */
+/*                 and address counter                                            */
+/*--------------------------------------------------------------------------------*/
+static uint8_t CLCD_ReadBus(CLCD_Instance_t* Copy_pInstance , uint8_t Copy_RegisterSelect)
+{
+	/* Local Variables Definitions */
+	const CLCD_Handle_t* Local_pHandle = Copy_pInstance->pHandle;
+	uint16_t Local_PortValue = 0;
+	uint8_t Local_Byte = 0;
+	uint8_t Local_Bit;
+
+	/* Hand data bus to controller of this instance if needed */
+	if(Global_pReadingInstance != Copy_pInstance)
+	{
+		if(Global_pReadingInstance != NULL)
+		{
+			CLCD_SetBusDirection(Global_pReadingInstance , CLCD_BUS_WRITE);
+		}
+		CLCD_SetBusDirection(Copy_pInstance , CLCD_BUS_READ);
+	}
+
+	/* Select instruction or data register */
+	GPIO_SetResetPortPins(Local_pHandle->ctrlPort , CLCD_PIN_BSRR(Copy_RegisterSelect,0,Local_pHandle->rsPin));
+
+	/* Raise E and wait for controller data output delay */
+	GPIO_SetResetPortPins(Local_pHandle->ctrlPort , CLCD_PIN_SET_BSRR(Local_pHandle->ePin));
+	SERV_Delay_us(CLCD_ENABLE_PULSE_WIDTH);
+
+	/* Check CLCD Mode */
+	if(Local_pHandle->mode == CLCD_FOUR_BIT_MODE)
+	{
+		/* Get byte most significant bits from D4..D7 pins */
+		GPIO_GetPortVal(Local_pHandle->dataPort , &Local_PortValue);
+		for(Local_Bit = 0 ; Local_Bit < 4U ; Local_Bit++)
+		{
+			Local_Byte |= (uint8_t)(GET_BIT(Local_PortValue,Local_pHandle->dataPins[Local_Bit + 4U]) << (Local_Bit + 4U));
+		}
+
+		/* End first read cycle */
+		GPIO_SetResetPortPins(Local_pHandle->ctrlPort , CLCD_PIN_RESET_BSRR(Local_pHandle->ePin));
+		SERV_Delay_us(CLCD_ENABLE_PULSE_WIDTH);
+
+		/* Raise E again for byte least significant bits */
+		GPIO_SetResetPortPins(Local_pHandle->ctrlPort , CLCD_PIN_SET_BSRR(Local_pHandle->ePin));
+		SERV_Delay_us(CLCD_ENABLE_PULSE_WIDTH);
+
+		/* Get byte least significant bits from D4..D7 pins */
+		GPIO_GetPortVal(Local_pHandle->dataPort , &Local_PortValue);
+		for(Local_Bit = 0 ; Local_Bit < 4U ; Local_Bit++)
+		{
+			Local_Byte |= (uint8_t)(GET_BIT(Local_PortValue,Local_pHandle->dataPins[Local_Bit + 4U]) << Local_Bit);
+		}
+	}
+	else
+	{
+		/* Get byte bits from D0..D7 pins */
+		GPIO_GetPortVal(Local_pHandle->dataPort , &Local_PortValue);
+		for(Local_Bit = 0 ; Local_Bit < 8U ; Local_Bit++)
+		{
+			Local_Byte |= (uint8_t)(GET_BIT(Local_PortValue,Local_pHandle->dataPins[Local_Bit]) << Local_Bit);
+		}
+	}
+
+	/* End (last) read cycle */
+	GPIO_SetResetPortPins(Local_pHandle->ctrlPort , CLCD_PIN_RESET_BSRR(Local_pHandle->ePin));
+
+	return Local_Byte;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: SetBusDirection                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : CLCD_Instance_t* Copy_pInstance                                */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Direction                                         */
+/*				   Brief: Direction of data bus                                   */
+/*				   Range: CLCD_BUS_WRITE or CLCD_BUS_READ                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Switches data pins of passed instance between output and       */
+/*                 floating input and drives its RW pin accordingly. Data pins    */
+/*                 are released before RW goes high and RW goes low before data   */
+/*                 pins are driven so that MCU and controller never drive bus     */
+/*                 together                                                       */
+/*--------------------------------------------------------------------------------*/
+static void CLCD_SetBusDirection(CLCD_Instance_t* Copy_pInstance , uint8_t Copy_Direction)
+{
+	/* Local Variables Definitions */
+	const CLCD_Handle_t* Local_pHandle = Copy_pInstance->pHandle;
+	uint8_t Local_DataPinsMode = GPIO_PIN_OUTPUT_SPEED_2MHZ_PUSHPULL;
+	uint8_t Local_Counter = (Local_pHandle->mode == CLCD_FOUR_BIT_MODE) ? 4U : 0U;
+
+	/* Check requested direction */
+	if(Copy_Direction == CLCD_BUS_READ)
+	{
+		/* Data pins will be released */
+		Local_DataPinsMode = GPIO_PIN_INPUT_FLOATING;
+	}
+	else
+	{
+		/* Controller stops driving data bus */
+		GPIO_SetResetPortPins(Local_pHandle->ctrlPort , CLCD_PIN_RESET_BSRR(Local_pHandle->rwPin));
+	}
+
+	/* Set the direction of used data pins */
+	for( ; Local_Counter < 8U ; Local_Counter++)
+	{
+		GPIO_SetPinMode(Local_pHandle->dataPort,Local_pHandle->dataPins[Local_Counter],Local_DataPinsMode);
+	}
+
+	/* Controller drives data bus once data pins are released */
+	if(Copy_Direction == CLCD_BUS_READ)
+	{
+		GPIO_SetResetPortPins(Local_pHandle->ctrlPort , CLCD_PIN_SET_BSRR(Local_pHandle->rwPin));
+		Global_pReadingInstance = Copy_pInstance;
+	}
+	else
+	{
+		Global_pReadingInstance = NULL;
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: IsControllerBusy                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : CLCD_Instance_t* Copy_pInstance                                */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : uint8_t (1 if controller is busy, 0 otherwise)                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Checks if controller of passed instance is still executing     */
+/*                 last sent instruction. Instruction execution time timeout is   */
+/*                 the upper bound; in CLCD_WAIT_BUSY_FLAG mode the busy flag is  */
+/*                 read back and the timeout is ended as soon as flag is cleared  */
+/*--------------------------------------------------------------------------------*/
+static uint8_t CLCD_IsControllerBusy(CLCD_Instance_t* Copy_pInstance)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_Busy = 0;
+
+	/* Check if instruction execution time is still running or not */
+	if(SERV_IsTimeoutExpired(&Copy_pInstance->ControllerBusyTimeout) == 0)
+	{
+		/* Controller is assumed busy until execution time ends */
+		Local_Busy = 1;
+
+		/* Ask controller itself once its interface mode is set up (busy flag wait mode only) */
+		if(Copy_pInstance->BusyFlagReadable == 1)
+		{
+			Local_Busy = GET_BIT(CLCD_ReadBus(Copy_pInstance , CLCD_INSTRUCTION_REGISTER),CLCD_BUSY_FLAG_BIT);
+
+			/* End execution time early if controller is ready */
+			if(Local_Busy == 0)
+			{
+				SERV_StartTimeout_us(&Copy_pInstance->ControllerBusyTimeout , 0);
+			}
+		}
+	}
+
+	return Local_Busy;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: TrackCursor                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Byte                                              */
+/*				   Brief: Queued instruction or data byte                         */
+/*				   Range: Any value can be represented in 1 byte                  */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_RegisterSelect                                    */
+/*				   Brief: Destination register of byte                            */
+/*				   Range: CLCD_INSTRUCTION_REGISTER or CLCD_DATA_REGISTER         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : CLCD_Instance_t* Copy_pInstance                                */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Follows controller DDRAM address counter as bytes are queued,  */
+/*                 so that cursor position after last queued byte is known        */
+/*                 without reading controller back. Cursor becomes unknown after  */
+/*                 CGRAM access, cursor shift or data write in decrement entry    */
+/*                 mode until next DDRAM address, clear or home instruction       */
+/*--------------------------------------------------------------------------------*/
+static void CLCD_TrackCursor(CLCD_Instance_t* Copy_pInstance , uint8_t Copy_Byte , uint8_t Copy_RegisterSelect)
+{
+	/* Check destination register of byte */
+	if(Copy_RegisterSelect == CLCD_DATA_REGISTER)
+	{
+		/* Address counter follows written character (decrement entry mode is not tracked) */
+		if(Copy_pInstance->EntryDecrement == 0)
+		{
+			Copy_pInstance->CursorAddress = CLCD_NEXT_DDRAM_ADDRESS(Copy_pInstance->CursorAddress);
+		}
+		else
+		{
+			Copy_pInstance->CursorValid = 0;
+		}
+	}
+	else if((Copy_Byte & CLCD_SET_DDRAM_ADDRESS_INSTRUCTION) != 0)
+	{
+		/* Address counter is set to passed DDRAM address */
+		Copy_pInstance->CursorAddress = Copy_Byte & CLCD_ADDRESS_COUNTER_MASK;
+		Copy_pInstance->CursorValid = 1;
+	}
+	else if((Copy_Byte & CLCD_SET_CGRAM_ADDRESS_INSTRUCTION) != 0)
+	{
+		/* Following data bytes are written in CGRAM */
+		Copy_pInstance->CursorValid = 0;
+	}
+	else if(Copy_Byte == CLCD_CLEAR_DISPLAY_INSTRUCTION || (Copy_Byte & CLCD_RETURN_HOME_MASK) == CLCD_RETURN_HOME_INSTRUCTION)
+	{
+		/* Address counter is returned to first cell (clear also sets increment entry mode) */
+		Copy_pInstance->CursorAddress = 0;
+		Copy_pInstance->CursorValid = 1;
+		if(Copy_Byte == CLCD_CLEAR_DISPLAY_INSTRUCTION)
+		{
+			Copy_pInstance->EntryDecrement = 0;
+		}
+	}
+	else if((Copy_Byte & CLCD_CURSOR_SHIFT_MASK) == CLCD_CURSOR_SHIFT_INSTRUCTION)
+	{
+		/* Cursor (not display) shift moves address counter */
+		Copy_pInstance->CursorValid = 0;
+	}
+	else if((Copy_Byte & CLCD_ENTRY_MODE_MASK) == CLCD_ENTRY_MODE_INSTRUCTION)
+	{
+		/* Record address counter direction */
+		Copy_pInstance->EntryDecrement = (GET_BIT(Copy_Byte,CLCD_ENTRY_MODE_INCREMENT_BIT) == 0);
+	}
+	else
+	{
+		/* Display control and function set do not move address counter */
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetCursorCell                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Instance_t* Copy_pInstance                          */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pRowNumber                                       */
+/*				   Brief: Pointer to variable that will hold cursor row           */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t* Copy_pColumnNumber                                    */
+/*				   Brief: Pointer to variable that will hold cursor column        */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Maps tracked DDRAM address of passed instance to its visible   */
+/*                 cell according to instance geometry. Returns RT_NOK if cursor  */
+/*                 is unknown or outside visible cells                            */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t CLCD_GetCursorCell(const CLCD_Instance_t* Copy_pInstance , uint8_t* Copy_pRowNumber , uint8_t* Copy_pColumnNumber)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_NOK;
+	uint8_t Local_Line;
+	uint8_t Local_Offset;
+	uint8_t Local_RowStart;
+	uint8_t Local_Row;
+
+	/* Check if cursor position is known or not */
+	if(Copy_pInstance->CursorValid == 1)
+	{
+		/* Get DDRAM line of cursor and its offset within line */
+		Local_Line = (Copy_pInstance->CursorAddress >= CLCD_SECOND_LINE_ADDRESS) ? 1U : 0U;
+		Local_Offset = Copy_pInstance->CursorAddress - (Local_Line * CLCD_SECOND_LINE_ADDRESS);
+
+		/* Search rows sharing cursor DDRAM line (rows 0, 2 on first line and 1, 3 on second line) */
+		for(Local_Row = Local_Line ; Local_Row < Copy_pInstance->pHandle->rows && Local_Status != RT_OK ; Local_Row += 2U)
+		{
+			Local_RowStart = CLCD_ROW_DDRAM_ADDRESS(Local_Row,Copy_pInstance->pHandle->columns) - (Local_Line * CLCD_SECOND_LINE_ADDRESS);
+			if(Local_Offset >= Local_RowStart && Local_Offset < (Local_RowStart + Copy_pInstance->pHandle->columns))
+			{
+				*Copy_pRowNumber = Local_Row;
+				*Copy_pColumnNumber = Local_Offset - Local_RowStart;
+				Local_Status = RT_OK;
+			}
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetLineBreak                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const uint8_t* Copy_pText                                      */
+/*				   Brief: Pointer to first character of line in null terminated   */
+/*				          text                                                    */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Width                                             */
+/*				   Brief: Number of characters that fit in one line               */
+/*				   Range: (1 --> 40)                                              */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_WrapMode                                          */
+/*				   Brief: How a line longer than width is broken                  */
+/*				   Range: CLCD_WRAP_CHARACTER or CLCD_WRAP_WORD                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pNextLine                                        */
+/*				   Brief: Pointer to variable that will hold offset of next line  */
+/*				          start (breaking space or new line is skipped)           */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : uint8_t (Number of characters shown in line)                   */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Finds end of next line of text. In word wrap mode line is      */
+/*                 broken at last space that fits in width; words longer than     */
+/*                 width are broken at width                                      */
+/*--------------------------------------------------------------------------------*/
+static uint8_t CLCD_GetLineBreak(const uint8_t* Copy_pText , uint8_t Copy_Width , uint8_t Copy_WrapMode , uint8_t* Copy_pNextLine)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_Length = 0;
+	uint8_t Local_Index;
+
+	/* Take characters until end of text, new line or line width */
+	while(Local_Length < Copy_Width && Copy_pText[Local_Length] != '\0' && Copy_pText[Local_Length] != '\n')
+	{
+		Local_Length++;
+	}
+
+	/* Next line starts right after shown characters */
+	*Copy_pNextLine = Local_Length;
+
+	/* Check if line is broken because it is longer than width */
+	if(Local_Length == Copy_Width && Copy_pText[Local_Length] != '\0' && Copy_pText[Local_Length] != '\n' && Copy_pText[Local_Length] != ' ')
+	{
+		/* Break line at last space that fits in width (long words are broken at width) */
+		if(Copy_WrapMode == CLCD_WRAP_WORD)
+		{
+			for(Local_Index = Local_Length ; Local_Index > 0 ; Local_Index--)
+			{
+				if(Copy_pText[Local_Index - 1U] == ' ')
+				{
+					Local_Length = Local_Index - 1U;
+					*Copy_pNextLine = Local_Index;
+					break;
+				}
+			}
+		}
+	}
+	else if(Copy_pText[Local_Length] != '\0')
+	{
+		/* Skip new line or space that line is broken at */
+		*Copy_pNextLine = Local_Length + 1U;
+	}
+	else
+	{
+		/* Line ends with text */
+	}
+
+	return Local_Length;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameWriteLine                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_RowNumber                                         */
+/*				   Brief: Framebuffer row                                         */
+/*				   Range: (0 --> rows - 1)                                        */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pLine                                      */
+/*				   Brief: Pointer to first character of line                      */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Length                                            */
+/*				   Brief: Number of line characters                               */
+/*				   Range: (0 --> columns)                                         */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Alignment                                         */
+/*				   Brief: Alignment of line inside row                            */
+/*				   Range: CLCD_ALIGN_LEFT, CLCD_ALIGN_RIGHT or CLCD_ALIGN_CENTER  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : CLCD_Instance_t* Copy_pInstance                                */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Blanks a framebuffer row then writes line characters in it at  */
+/*                 offset given by alignment                                      */
+/*--------------------------------------------------------------------------------*/
+static void CLCD_FrameWriteLine(CLCD_Instance_t* Copy_pInstance , uint8_t Copy_RowNumber , const uint8_t* Copy_pLine , uint8_t Copy_Length , uint8_t Copy_Alignment)
+{
+	/* Local Variables Definitions */
+	uint8_t* Local_pRow = &Copy_pInstance->FrameBuffer[Copy_RowNumber * Copy_pInstance->pHandle->columns];
+	uint8_t  Local_Offset = 0;
+	uint8_t  Local_Column;
+
+	/* Get first column of line according to its alignment */
+	if(Copy_Alignment == CLCD_ALIGN_RIGHT)
+	{
+		Local_Offset = Copy_pInstance->pHandle->columns - Copy_Length;
+	}
+	else if(Copy_Alignment == CLCD_ALIGN_CENTER)
+	{
+		Local_Offset = (Copy_pInstance->pHandle->columns - Copy_Length) >> 1;
+	}
+
+	/* Blank row then copy line characters */
+	for(Local_Column = 0 ; Local_Column < Copy_pInstance->pHandle->columns ; Local_Column++)
+	{
+		Local_pRow[Local_Column] = CLCD_BLANK_CHARACTER;
+	}
+	for(Local_Column = 0 ; Local_Column < Copy_Length ; Local_Column++)
+	{
+		Local_pRow[Local_Offset + Local_Column] = Copy_pLine[Local_Column];
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FrameScrollUp                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_FirstRow                                          */
+/*				   Brief: First row of scrolled region                            */
+/*				   Range: (0 --> Copy_LastRow)                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_LastRow                                           */
+/*				   Brief: Last row of scrolled region                             */
+/*				   Range: (Copy_FirstRow --> rows - 1)                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : CLCD_Instance_t* Copy_pInstance                                */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Moves framebuffer rows of passed region up by one row and      */
+/*                 blanks last row of region                                      */
+/*--------------------------------------------------------------------------------*/
+static void CLCD_FrameScrollUp(CLCD_Instance_t* Copy_pInstance , uint8_t Copy_FirstRow , uint8_t Copy_LastRow)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_Columns = Copy_pInstance->pHandle->columns;
+	uint8_t Local_Cell;
+
+	/* Region rows are consecutive in framebuffer, move each cell one row up */
+	for(Local_Cell = Copy_FirstRow * Local_Columns ; Local_Cell < Copy_LastRow * Local_Columns ; Local_Cell++)
+	{
+		Copy_pInstance->FrameBuffer[Local_Cell] = Copy_pInstance->FrameBuffer[Local_Cell + Local_Columns];
+	}
+
+	/* Blank last row of region */
+	for( ; Local_Cell < (Copy_LastRow + 1U) * Local_Columns ; Local_Cell++)
+	{
+		Copy_pInstance->FrameBuffer[Local_Cell] = CLCD_BLANK_CHARACTER;
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FindGlyph                                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Instance_t* Copy_pInstance                          */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*				   -------------------------------------------------------------- */
+/*                 const uint8_t* Copy_pGlyph                                     */
+/*				   Brief: Pointer to 8 pattern rows of custom character           */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : uint8_t (Slot holding glyph or CLCD_CGRAM_SLOTS if not loaded) */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Searches loaded CGRAM slots of passed instance for a glyph     */
+/*                 with same bitmap                                               */
+/*--------------------------------------------------------------------------------*/
+static uint8_t CLCD_FindGlyph(const CLCD_Instance_t* Copy_pInstance , const uint8_t* Copy_pGlyph)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_Slot;
+	uint8_t Local_Row;
+
+	/* Compare passed bitmap with bitmap of each loaded slot */
+	for(Local_Slot = 0 ; Local_Slot < CLCD_CGRAM_SLOTS ; Local_Slot++)
+	{
+		if(GET_BIT(Copy_pInstance->GlyphValid,Local_Slot) == 1)
+		{
+			/* Count matching rows */
+			Local_Row = 0;
+			while(Local_Row < CLCD_GLYPH_ROWS && Copy_pInstance->GlyphCache[Local_Slot][Local_Row] == (Copy_pGlyph[Local_Row] & CLCD_GLYPH_ROW_MASK))
+			{
+				Local_Row++;
+			}
+
+			/* Stop at first slot whose rows all match */
+			if(Local_Row == CLCD_GLYPH_ROWS)
+			{
+				break;
+			}
+		}
+	}
+
+	return Local_Slot;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetGlyphVictim                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Instance_t* Copy_pInstance                          */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : uint8_t (Slot to be loaded or CLCD_CGRAM_SLOTS if none)        */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Chooses CGRAM slot for a new glyph: a free slot if any,        */
+/*                 otherwise least recently used slot whose character is not      */
+/*                 shown on screen                                                */
+/*--------------------------------------------------------------------------------*/
+static uint8_t CLCD_GetGlyphVictim(const CLCD_Instance_t* Copy_pInstance)
+{
+	/* Local Variables Definitions */
+	uint8_t  Local_Victim = CLCD_CGRAM_SLOTS;
+	uint8_t  Local_Slot;
+	uint32_t Local_Age;
+	uint32_t Local_VictimAge = 0;
+
+	/* Traverse CGRAM slots */
+	for(Local_Slot = 0 ; Local_Slot < CLCD_CGRAM_SLOTS ; Local_Slot++)
+	{
+		/* Free slot is taken at once */
+		if(GET_BIT(Copy_pInstance->GlyphValid,Local_Slot) == 0)
+		{
+			Local_Victim = Local_Slot;
+			break;
+		}
+
+		/* Keep oldest slot that is not shown on screen (age survives use counter wrap-around) */
+		Local_Age = Copy_pInstance->GlyphUseCounter - Copy_pInstance->GlyphLastUse[Local_Slot];
+		if((Local_Victim == CLCD_CGRAM_SLOTS || Local_Age > Local_VictimAge) && CLCD_IsGlyphOnScreen(Copy_pInstance , Local_Slot) == 0)
+		{
+			Local_Victim = Local_Slot;
+			Local_VictimAge = Local_Age;
+		}
+	}
+
+	return Local_Victim;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: IsGlyphOnScreen                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const CLCD_Instance_t* Copy_pInstance                          */
+/*				   Brief: Pointer to CLCD instance                                */
+/*				   Range: Any registered instance of instances pool               */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Slot                                              */
+/*				   Brief: CGRAM slot                                              */
+/*				   Range: (0 --> 7)                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : uint8_t (1 if slot character is shown, 0 otherwise)            */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Checks if character code of passed CGRAM slot (or its mirror   */
+/*                 code slot + 8) is in framebuffer or in last frame sent to      */
+/*                 panel                                                          */
+/*--------------------------------------------------------------------------------*/
+static uint8_t CLCD_IsGlyphOnScreen(const CLCD_Instance_t* Copy_pInstance , uint8_t Copy_Slot)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_OnScreen = 0;
+	uint8_t Local_Cells = Copy_pInstance->pHandle->rows * Copy_pInstance->pHandle->columns;
+	uint8_t Local_Cell;
+
+	/* Search framebuffer and last sent frame (if it matches panel) for slot character codes */
+	for(Local_Cell = 0 ; Local_Cell < Local_Cells && Local_OnScreen == 0 ; Local_Cell++)
+	{
+		if((Copy_pInstance->FrameBuffer[Local_Cell] < CLCD_GLYPH_CODES && (Copy_pInstance->FrameBuffer[Local_Cell] & (CLCD_CGRAM_SLOTS - 1U)) == Copy_Slot) ||
+		   (Copy_pInstance->SentFrameValid == 1 && Copy_pInstance->SentFrame[Local_Cell] < CLCD_GLYPH_CODES && (Copy_pInstance->SentFrame[Local_Cell] & (CLCD_CGRAM_SLOTS - 1U)) == Copy_Slot))
+		{
+			Local_OnScreen = 1;
+		}
 	}
 
-	return Local_Status ;
+	return Local_OnScreen;
 }
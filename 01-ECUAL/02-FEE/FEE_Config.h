@@ -0,0 +1,54 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*      			SWC          : FEE  			            */
+/*     			    Description	 : FEE Config                   */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*----------------------------------------------------------------------------------------------------------*/
+/*                                                                                                          */
+/*                     ______  ______  ______     _____             __ _                                    */
+/*                    |  ____||  ____||  ____|   / ____|           / _(_)                                   */
+/*                    | |__   | |__   | |__     | |     ___  _ __ | |_ _  __ _                              */
+/*                    |  __|  |  __|  |  __|    | |    / _ \| '_ \|  _| |/ _` |                             */
+/*                    | |     | |____ | |____   | |___| (_) | | | | | | | (_| |                             */
+/*                    |_|     |______||______|   \_____\___/|_| |_|_| |_|\__, |                             */
+/*                                                                       __/  |                             */
+/*                                                                       |___/                              */
+/*                                                                                                          */
+/*----------------------------------------------------------------------------------------------------------*/
+
+#ifndef HAL_FEE_CONFIG_H_
+#define HAL_FEE_CONFIG_H_
+
+/*-------------------------------------------------------*/
+/* Set first flash page of the key-value store area:     */
+/*                                                       */
+/* Options	: - (FPEC_PAGE_0 --> FPEC_PAGE_126)          */
+/*                                                       */
+/* Note     : Area must be out of the application image  */
+/*-------------------------------------------------------*/
+#define FEE_FIRST_PAGE  FPEC_PAGE_124  /* Default: FPEC_PAGE_124 */
+
+/*-------------------------------------------------------*/
+/* Set number of flash pages of the key-value store area */
+/* (erase cycles are spread evenly over all of them):    */
+/*                                                       */
+/* Options	: - (2 --> 128 - FEE_FIRST_PAGE)             */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define FEE_PAGES_NUMBER  4U  /* Default: 4U */
+
+/*-------------------------------------------------------*/
+/* Set number of keys of the key-value store (size of    */
+/* the RAM index):                                       */
+/*                                                       */
+/* Options	: - (1 --> 126)                              */
+/*                                                       */
+/* Note     : Live records of all keys must fit in one   */
+/*            page beside a new record                   */
+/*-------------------------------------------------------*/
+#define FEE_MAX_KEYS  32U  /* Default: 32U */
+
+#endif /* HAL_FEE_CONFIG_H_ */
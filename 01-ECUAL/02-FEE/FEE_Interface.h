@@ -0,0 +1,113 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*      			SWC          : FEE  			            */
+/*     			    Description	 : FEE Interface                */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*----------------------------------------------------------------------------------------------------------*/
+/*                                                                                                          */
+/*               ______  ______  ______    _____       _             __                                     */
+/*              |  ____||  ____||  ____|  |_   _|     | |           / _|                                    */
+/*              | |__   | |__   | |__       | |  _ __ | |_ ___ _ __| |_ __ _  ___ ___                       */
+/*              |  __|  |  __|  |  __|      | | | '_ \| __/ _ \ '__|  _/ _` |/ __/ _ \                      */
+/*              | |     | |____ | |____    _| |_| | | | ||  __/ |  | || (_| | (_|  __/                      */
+/*              |_|     |______||______|  |_____|_| |_|\__\___|_|  |_| \__,_|\___\___|                      */
+/*                                                                                                          */
+/*----------------------------------------------------------------------------------------------------------*/
+
+#ifndef HAL_FEE_INTERFACE_H_
+#define HAL_FEE_INTERFACE_H_
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                FUNCTIONS PROTOTYPES                               */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Init                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function mounts the key-value store. It finds the newest  */
+/*                 page of the pages ring, replays records of all valid pages     */
+/*                 from oldest to newest to rebuild the RAM index, erases pages   */
+/*                 left half written by a power loss and resumes an interrupted   */
+/*                 garbage collection. On a blank area it opens the first page    */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FEE_Init(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Read                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint16_t Copy_Key                                              */
+/*				   Brief: Key (id) of stored value                                */
+/*				   Range: (0 --> FEE_MAX_KEYS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pValue                                          */
+/*				   Brief: Pointer to variable in which stored value will be       */
+/*				          returned                                                */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gets the last value written to a key from the    */
+/*                 RAM index (no flash access). It returns RT_NOK if the key      */
+/*                 holds no value                                                 */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FEE_Read(uint16_t Copy_Key , uint32_t* Copy_pValue);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Write                                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint16_t Copy_Key                                              */
+/*				   Brief: Key (id) of stored value                                */
+/*				   Range: (0 --> FEE_MAX_KEYS - 1)                                */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_Value                                            */
+/*				   Brief: Value to be stored                                      */
+/*				   Range: Any uint32_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function stores a value of a key by appending a new       */
+/*                 record to the head page. Writing the value the key already     */
+/*                 holds costs no flash write. When the head page is full the     */
+/*                 next page of the ring is opened and the oldest page is garbage */
+/*                 collected                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FEE_Write(uint16_t Copy_Key , uint32_t Copy_Value);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Delete                                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint16_t Copy_Key                                              */
+/*				   Brief: Key (id) of stored value                                */
+/*				   Range: (0 --> FEE_MAX_KEYS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function removes a key by appending a deletion record.    */
+/*                 Deleting a key that holds no value costs no flash write        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FEE_Delete(uint16_t Copy_Key);
+
+#endif /* HAL_FEE_INTERFACE_H_ */
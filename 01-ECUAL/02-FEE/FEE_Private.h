@@ -0,0 +1,73 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*      			SWC          : FEE  			            */
+/*     			    Description	 : FEE Private                  */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*----------------------------------------------------------------------------------------------------------*/
+/*                                                                                                          */
+/*                    ______  ______  ______    _____      _            _                                   */
+/*                   |  ____||  ____||  ____|  |  __ \    (_)          | |                                  */
+/*                   | |__   | |__   | |__     | |__) | __ ___   ____ _| |_ ___                             */
+/*                   |  __|  |  __|  |  __|    |  ___/ '__| \ \ / / _` | __/ _ \                            */
+/*                   | |     | |____ | |____   | |   | |  | |\ V / (_| | ||  __/                            */
+/*                   |_|     |______||______|  |_|   |_|  |_| \_/ \__,_|\__\___|                            */
+/*                                                                                                          */
+/*----------------------------------------------------------------------------------------------------------*/
+
+#ifndef HAL_FEE_PRIVATE_H_
+#define HAL_FEE_PRIVATE_H_
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Define Slot Geometry (a slot is the page header or one record: key, value low, value high, CRC) */
+#define FEE_SLOT_HALFWORDS				4U
+#define FEE_SLOT_SIZE					8U
+#define FEE_SLOTS_PER_PAGE				(FPEC_PAGE_SIZE / FEE_SLOT_SIZE)
+#define FEE_HEADER_SLOT					0U
+#define FEE_FIRST_RECORD_SLOT			1U
+
+/* Define Page Header Fields (sequence, inverted sequence then magic number written last) */
+#define FEE_HEADER_SEQUENCE				0U
+#define FEE_HEADER_INVERTED_SEQUENCE	1U
+#define FEE_HEADER_MAGIC				2U
+#define FEE_HEADER_LENGTH				3U
+#define FEE_PAGE_MAGIC					0x4645U
+#define FEE_SEQUENCE_HALF_RANGE			0x8000U
+
+/* Define Record Fields */
+#define FEE_RECORD_KEY					0U
+#define FEE_RECORD_VALUE_LOW			1U
+#define FEE_RECORD_VALUE_HIGH			2U
+#define FEE_RECORD_CRC					3U
+#define FEE_RECORD_CRC_LENGTH			3U
+#define FEE_KEY_DELETED_FLAG			0x8000U
+#define FEE_KEY_MASK					0x7FFFU
+#define FEE_DELETED_VALUE				0xFFFFFFFFUL
+
+/* Define Erased Flash Halfword */
+#define FEE_ERASED_HALFWORD				0xFFFFU
+
+/* Define CRC-16/CCITT Parameters */
+#define FEE_CRC16_POLYNOMIAL			0x1021U
+#define FEE_CRC16_INITIAL				0xFFFFU
+#define FEE_CRC16_TOP_BIT				15U
+
+/* Define Flash Address of a Slot of a Page in the Pages Ring */
+#define FEE_SLOT_POINTER(Page,Slot)		((volatile uint16_t*)(FPEC_FLASH_FIRST_ADDRESS + \
+											((uint32_t)(FEE_FIRST_PAGE + (Page)) * FPEC_PAGE_SIZE) + \
+											((uint32_t)(Slot) * FEE_SLOT_SIZE)))
+
+/* Define Next Page in the Pages Ring */
+#define FEE_NEXT_PAGE(Page)				((uint8_t)(((Page) + 1U) % FEE_PAGES_NUMBER))
+
+/* Check if Sequence Number A is Newer Than B (wrap around safe) */
+#define FEE_IS_NEWER_SEQUENCE(A,B)		(((A) != (B)) && ((uint16_t)((A) - (B)) < FEE_SEQUENCE_HALF_RANGE))
+
+#endif /* HAL_FEE_PRIVATE_H_ */
@@ -0,0 +1,818 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*      			SWC          : FEE  			            */
+/*     			    Description	 : FEE Program                  */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*----------------------------------------------------------------------------------------------------------*/
+/*                                                                                                          */
+/*               ______  ______  ______    _____                                                            */
+/*              |  ____||  ____||  ____|  |  __ \                                                           */
+/*              | |__   | |__   | |__     | |__) | __ ___   __ _ _ __ __ _ _ __ ___                         */
+/*              |  __|  |  __|  |  __|    |  ___/ '__/ _ \ / _` | '__/ _` | '_ ` _ \                        */
+/*              | |     | |____ | |____   | |   | | | (_) | (_| | | | (_| | | | | | |                       */
+/*              |_|     |______||______|  |_|   |_|  \___/ \__, |_|  \__,_|_| |_| |_|                       */
+/*                                                          __/ |                                           */
+/*                                                         |___/                                            */
+/*                                                                                                          */
+/*----------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "FPEC_Interface.h"
+
+#include "FEE_Config.h"
+#include "FEE_Interface.h"
+#include "FEE_Private.h"
+
+/* Live records of all keys must fit in one page beside a new record (garbage collection guarantee) */
+#if (FEE_MAX_KEYS < 1U) || (FEE_MAX_KEYS > (FEE_SLOTS_PER_PAGE - FEE_FIRST_RECORD_SLOT - 1U))
+	#error "Wrong FEE Keys Number Configuration !"
+#endif
+
+#if (FEE_PAGES_NUMBER < 2U) || ((FEE_FIRST_PAGE + FEE_PAGES_NUMBER) > (FPEC_PAGE_127 + 1U))
+	#error "Wrong FEE Pages Number Configuration !"
+#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            PRIVATE FUNCTIONS PROTOTYPES                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static uint16_t FEE_Crc16(const uint16_t* Copy_pData , uint8_t Copy_Length);
+static ERROR_STATUS_t FEE_GetPageSequence(uint8_t Copy_Page , uint16_t* Copy_pSequence);
+static uint8_t FEE_IsSlotErased(uint8_t Copy_Page , uint8_t Copy_Slot);
+static uint8_t FEE_IsPageErased(uint8_t Copy_Page);
+static uint8_t FEE_ReplayPage(uint8_t Copy_Page);
+static ERROR_STATUS_t FEE_OpenPage(uint8_t Copy_Page , uint16_t Copy_Sequence);
+static ERROR_STATUS_t FEE_AppendRecord(uint16_t Copy_KeyField , uint32_t Copy_Value);
+static ERROR_STATUS_t FEE_MoveHead(void);
+static ERROR_STATUS_t FEE_CollectPage(uint8_t Copy_Page);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static uint32_t Global_Values[FEE_MAX_KEYS];			/* RAM index: last value of each key */
+static uint8_t  Global_KeyValid[FEE_MAX_KEYS];			/* RAM index: flag per key that indicates it holds a value */
+static uint8_t  Global_RecordPage[FEE_MAX_KEYS];		/* RAM index: ring page holding last record of each key */
+static uint8_t  Global_HeadPage = 0;					/* Ring page in which records are appended */
+static uint8_t  Global_HeadSlot = 0;					/* Next free slot of head page */
+static uint16_t Global_HeadSequence = 0;				/* Sequence number of head page */
+static uint8_t  Global_Mounted = 0;						/* Flag that indicates store is mounted (FEE_Init succeeded) */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Init                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function mounts the key-value store. It finds the newest  */
+/*                 page of the pages ring, replays records of all valid pages     */
+/*                 from oldest to newest to rebuild the RAM index, erases pages   */
+/*                 left half written by a power loss and resumes an interrupted   */
+/*                 garbage collection. On a blank area it opens the first page    */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FEE_Init(void)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	uint16_t Local_Sequence;							/* Sequence number of current page */
+	uint8_t Local_HeadFound = 0;						/* Flag that indicates a valid page is found */
+	uint8_t Local_Counter;								/* Variable to hold counts of pages and keys */
+	uint8_t Local_Page;									/* Current page of the ring */
+	uint8_t Local_FreeSlot = FEE_FIRST_RECORD_SLOT;		/* First free slot of last replayed page */
+
+	/* Store isn't usable until it is mounted */
+	Global_Mounted = 0;
+
+	/* Clear RAM index */
+	for(Local_Counter = 0 ; Local_Counter < FEE_MAX_KEYS ; Local_Counter++)
+	{
+		Global_KeyValid[Local_Counter] = 0;
+	}
+
+	/* Open a flash session for recovery erases and page opening */
+	Local_Status = FPEC_BeginSession();
+
+	/* Check if flash session is open */
+	if(Local_Status == RT_OK)
+	{
+		/* Find head page (valid page with newest sequence number) */
+		for(Local_Page = 0 ; Local_Page < FEE_PAGES_NUMBER ; Local_Page++)
+		{
+			/* Check if page is valid and newer than found head */
+			if((FEE_GetPageSequence(Local_Page , &Local_Sequence) == RT_OK) &&
+			   ((Local_HeadFound == 0) || FEE_IS_NEWER_SEQUENCE(Local_Sequence , Global_HeadSequence)))
+			{
+				Global_HeadPage = Local_Page;
+				Global_HeadSequence = Local_Sequence;
+				Local_HeadFound = 1;
+			}
+		}
+
+		/* Check if store area holds data */
+		if(Local_HeadFound == 1)
+		{
+			/* Replay pages from oldest (after head) to newest (head) */
+			Local_Page = Global_HeadPage;
+			for(Local_Counter = 0 ; (Local_Counter < FEE_PAGES_NUMBER) && (Local_Status == RT_OK) ; Local_Counter++)
+			{
+				/* Move to next page of the ring */
+				Local_Page = FEE_NEXT_PAGE(Local_Page);
+
+				/* Check if page is valid */
+				if(FEE_GetPageSequence(Local_Page , &Local_Sequence) == RT_OK)
+				{
+					/* Apply page records to RAM index */
+					Local_FreeSlot = FEE_ReplayPage(Local_Page);
+				}
+				else if(FEE_IsPageErased(Local_Page) == 0)
+				{
+					/* Page is left half written (interrupted erase or header write) */
+					Local_Status = FPEC_FlashPageErase(FEE_FIRST_PAGE + Local_Page);
+				}
+				else
+				{
+					/* Page is erased */
+				}
+			}
+
+			/* Head page is replayed last */
+			Global_HeadSlot = Local_FreeSlot;
+
+			/* Check if page ahead of head holds data (garbage collection was interrupted) */
+			if((Local_Status == RT_OK) &&
+			   (FEE_GetPageSequence(FEE_NEXT_PAGE(Global_HeadPage) , &Local_Sequence) == RT_OK))
+			{
+				/* Resume garbage collection */
+				Local_Status = FEE_CollectPage(FEE_NEXT_PAGE(Global_HeadPage));
+			}
+		}
+		else
+		{
+			/* Blank area: make sure no page holds leftovers then open the first page */
+			for(Local_Page = 0 ; (Local_Page < FEE_PAGES_NUMBER) && (Local_Status == RT_OK) ; Local_Page++)
+			{
+				/* Check if page is erased */
+				if(FEE_IsPageErased(Local_Page) == 0)
+				{
+					/* Erase page */
+					Local_Status = FPEC_FlashPageErase(FEE_FIRST_PAGE + Local_Page);
+				}
+			}
+
+			/* Check if area is erased */
+			if(Local_Status == RT_OK)
+			{
+				/* Open the first page */
+				Local_Status = FEE_OpenPage(0 , 0);
+			}
+		}
+
+		/* Close flash session */
+		(void)FPEC_EndSession();
+	}
+
+	/* Check if store is mounted */
+	if(Local_Status == RT_OK)
+	{
+		Global_Mounted = 1;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Read                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint16_t Copy_Key                                              */
+/*				   Brief: Key (id) of stored value                                */
+/*				   Range: (0 --> FEE_MAX_KEYS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pValue                                          */
+/*				   Brief: Pointer to variable in which stored value will be       */
+/*				          returned                                                */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gets the last value written to a key from the    */
+/*                 RAM index (no flash access). It returns RT_NOK if the key      */
+/*                 holds no value                                                 */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FEE_Read(uint16_t Copy_Key , uint32_t* Copy_pValue)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+
+	/* Check if passed pointer is NULL pointer or not */
+	if(Copy_pValue != NULL)
+	{
+		/* Check if store is mounted and key holds a value */
+		if((Global_Mounted == 1) && (Copy_Key < FEE_MAX_KEYS) && (Global_KeyValid[Copy_Key] == 1))
+		{
+			/* Get value from RAM index */
+			*Copy_pValue = Global_Values[Copy_Key];
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Write                                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint16_t Copy_Key                                              */
+/*				   Brief: Key (id) of stored value                                */
+/*				   Range: (0 --> FEE_MAX_KEYS - 1)                                */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_Value                                            */
+/*				   Brief: Value to be stored                                      */
+/*				   Range: Any uint32_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function stores a value of a key by appending a new       */
+/*                 record to the head page. Writing the value the key already     */
+/*                 holds costs no flash write. When the head page is full the     */
+/*                 next page of the ring is opened and the oldest page is garbage */
+/*                 collected                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FEE_Write(uint16_t Copy_Key , uint32_t Copy_Value)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+
+	/* Check if store is mounted and passed key is within its valid range */
+	if((Global_Mounted == 1) && (Copy_Key < FEE_MAX_KEYS))
+	{
+		/* Check if key already holds the value */
+		if((Global_KeyValid[Copy_Key] == 0) || (Global_Values[Copy_Key] != Copy_Value))
+		{
+			/* Open a flash session for the record write */
+			Local_Status = FPEC_BeginSession();
+
+			/* Check if flash session is open */
+			if(Local_Status == RT_OK)
+			{
+				/* Check if head page is full */
+				if(Global_HeadSlot >= FEE_SLOTS_PER_PAGE)
+				{
+					/* Open next page and collect the oldest one */
+					Local_Status = FEE_MoveHead();
+				}
+
+				/* Check if head page has a free slot */
+				if(Local_Status == RT_OK)
+				{
+					/* Append record of the new value */
+					Local_Status = FEE_AppendRecord(Copy_Key , Copy_Value);
+				}
+
+				/* Check if record is written */
+				if(Local_Status == RT_OK)
+				{
+					/* Update RAM index */
+					Global_Values[Copy_Key] = Copy_Value;
+					Global_KeyValid[Copy_Key] = 1;
+					Global_RecordPage[Copy_Key] = Global_HeadPage;
+				}
+
+				/* Close flash session */
+				(void)FPEC_EndSession();
+			}
+		}
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Delete                                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint16_t Copy_Key                                              */
+/*				   Brief: Key (id) of stored value                                */
+/*				   Range: (0 --> FEE_MAX_KEYS - 1)                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function removes a key by appending a deletion record.    */
+/*                 Deleting a key that holds no value costs no flash write        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FEE_Delete(uint16_t Copy_Key)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+
+	/* Check if store is mounted and passed key is within its valid range */
+	if((Global_Mounted == 1) && (Copy_Key < FEE_MAX_KEYS))
+	{
+		/* Check if key holds a value */
+		if(Global_KeyValid[Copy_Key] == 1)
+		{
+			/* Open a flash session for the record write */
+			Local_Status = FPEC_BeginSession();
+
+			/* Check if flash session is open */
+			if(Local_Status == RT_OK)
+			{
+				/* Check if head page is full */
+				if(Global_HeadSlot >= FEE_SLOTS_PER_PAGE)
+				{
+					/* Open next page and collect the oldest one */
+					Local_Status = FEE_MoveHead();
+				}
+
+				/* Check if head page has a free slot */
+				if(Local_Status == RT_OK)
+				{
+					/* Append deletion record */
+					Local_Status = FEE_AppendRecord(Copy_Key | FEE_KEY_DELETED_FLAG , FEE_DELETED_VALUE);
+				}
+
+				/* Check if record is written */
+				if(Local_Status == RT_OK)
+				{
+					/* Update RAM index */
+					Global_KeyValid[Copy_Key] = 0;
+					Global_RecordPage[Copy_Key] = Global_HeadPage;
+				}
+
+				/* Close flash session */
+				(void)FPEC_EndSession();
+			}
+		}
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Crc16                                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const uint16_t* Copy_pData                                     */
+/*				   Brief: Array of halfwords to be checked                        */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Length                                            */
+/*				   Brief: Halfword count in data array                            */
+/*				   Range: Any value can be stored within one byte                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : uint16_t                                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function calculates CRC-16/CCITT (polynomial 0x1021,      */
+/*                 initial 0xFFFF) of an array of halfwords, low byte of each     */
+/*                 halfword first                                                 */
+/*--------------------------------------------------------------------------------*/
+static uint16_t FEE_Crc16(const uint16_t* Copy_pData , uint8_t Copy_Length)
+{
+	/* Local Variables Definitions */
+	uint16_t Local_Crc = FEE_CRC16_INITIAL;				/* Variable to hold running CRC */
+	uint8_t Local_HalfWordCounter;						/* Variable to hold counts of halfwords */
+	uint8_t Local_BitCounter;							/* Variable to hold counts of bits */
+
+	/* Traverse over each halfword */
+	for(Local_HalfWordCounter = 0 ; Local_HalfWordCounter < Copy_Length ; Local_HalfWordCounter++)
+	{
+		/* Feed low byte then high byte (MSB first each) */
+		Local_Crc ^= (uint16_t)((Copy_pData[Local_HalfWordCounter] & 0x00FFU) << 8);
+		for(Local_BitCounter = 0 ; Local_BitCounter < 16U ; Local_BitCounter++)
+		{
+			/* Check if high byte has to be fed (after low byte bits are processed) */
+			if(Local_BitCounter == 8U)
+			{
+				Local_Crc ^= (uint16_t)(Copy_pData[Local_HalfWordCounter] & 0xFF00U);
+			}
+
+			/* Shift CRC then apply polynomial if shifted out bit is set */
+			if(GET_BIT(Local_Crc , FEE_CRC16_TOP_BIT) == 1)
+			{
+				Local_Crc = (uint16_t)((Local_Crc << 1) ^ FEE_CRC16_POLYNOMIAL);
+			}
+			else
+			{
+				Local_Crc = (uint16_t)(Local_Crc << 1);
+			}
+		}
+	}
+
+	return Local_Crc;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetPageSequence                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Page                                              */
+/*				   Brief: Index of page in the pages ring                         */
+/*				   Range: (0 --> FEE_PAGES_NUMBER - 1)                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint16_t* Copy_pSequence                                       */
+/*				   Brief: Pointer to variable in which page sequence number will  */
+/*				          be returned                                             */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function checks page header and gets the sequence number  */
+/*                 of the page. It returns RT_NOK if the page holds no complete   */
+/*                 header                                                         */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t FEE_GetPageSequence(uint8_t Copy_Page , uint16_t* Copy_pSequence)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	volatile uint16_t* Local_pHeader = FEE_SLOT_POINTER(Copy_Page , FEE_HEADER_SLOT);	/* Pointer to page header */
+
+	/* Check if header is complete (magic number is written last) and sequence is consistent */
+	if((Local_pHeader[FEE_HEADER_MAGIC] == FEE_PAGE_MAGIC) &&
+	   (Local_pHeader[FEE_HEADER_SEQUENCE] == (uint16_t)(~Local_pHeader[FEE_HEADER_INVERTED_SEQUENCE])))
+	{
+		/* Get sequence number */
+		*Copy_pSequence = Local_pHeader[FEE_HEADER_SEQUENCE];
+	}
+	else
+	{
+		/* Page is not valid */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: IsSlotErased                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Page                                              */
+/*				   Brief: Index of page in the pages ring                         */
+/*				   Range: (0 --> FEE_PAGES_NUMBER - 1)                            */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_Slot                                              */
+/*				   Brief: Index of slot (header or record) inside the page        */
+/*				   Range: (0 --> FEE_SLOTS_PER_PAGE - 1)                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : uint8_t                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function checks if all halfwords of a slot are erased. It */
+/*                 returns 1 if the slot is erased and 0 otherwise                */
+/*--------------------------------------------------------------------------------*/
+static uint8_t FEE_IsSlotErased(uint8_t Copy_Page , uint8_t Copy_Slot)
+{
+	/* Local Variables Definitions */
+	volatile uint16_t* Local_pSlot = FEE_SLOT_POINTER(Copy_Page , Copy_Slot);	/* Pointer to slot halfwords */
+	uint8_t Local_Erased = 1;							/* Flag that indicates slot is erased */
+	uint8_t Local_HalfWordCounter;						/* Variable to hold counts of halfwords */
+
+	/* Check each halfword of the slot */
+	for(Local_HalfWordCounter = 0 ; Local_HalfWordCounter < FEE_SLOT_HALFWORDS ; Local_HalfWordCounter++)
+	{
+		/* Check if halfword is programmed */
+		if(Local_pSlot[Local_HalfWordCounter] != FEE_ERASED_HALFWORD)
+		{
+			Local_Erased = 0;
+		}
+	}
+
+	return Local_Erased;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: IsPageErased                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Page                                              */
+/*				   Brief: Index of page in the pages ring                         */
+/*				   Range: (0 --> FEE_PAGES_NUMBER - 1)                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : uint8_t                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function checks if all slots of a page are erased. It     */
+/*                 returns 1 if the page is erased and 0 otherwise                */
+/*--------------------------------------------------------------------------------*/
+static uint8_t FEE_IsPageErased(uint8_t Copy_Page)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_Erased = 1;							/* Flag that indicates page is erased */
+	uint8_t Local_Slot = 0;								/* Variable to hold counts of slots */
+
+	/* Check slots until a programmed one is found */
+	while((Local_Erased == 1) && (Local_Slot < FEE_SLOTS_PER_PAGE))
+	{
+		Local_Erased = FEE_IsSlotErased(Copy_Page , Local_Slot);
+		Local_Slot++;
+	}
+
+	return Local_Erased;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ReplayPage                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Page                                              */
+/*				   Brief: Index of page in the pages ring                         */
+/*				   Range: (0 --> FEE_PAGES_NUMBER - 1)                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : uint8_t                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function applies records of a page to the RAM index in    */
+/*                 their written order, records with a wrong CRC (interrupted     */
+/*                 writes) are ignored. It returns index of first free slot of    */
+/*                 the page                                                       */
+/*--------------------------------------------------------------------------------*/
+static uint8_t FEE_ReplayPage(uint8_t Copy_Page)
+{
+	/* Local Variables Definitions */
+	volatile uint16_t* Local_pRecord;					/* Pointer to current record in flash */
+	uint16_t Local_Record[FEE_SLOT_HALFWORDS];			/* Copy of current record */
+	uint16_t Local_Key;									/* Key of current record */
+	uint8_t Local_Slot = FEE_FIRST_RECORD_SLOT;			/* Variable to hold counts of slots */
+	uint8_t Local_HalfWordCounter;						/* Variable to hold counts of halfwords */
+
+	/* Apply records until the first free slot */
+	while((Local_Slot < FEE_SLOTS_PER_PAGE) && (FEE_IsSlotErased(Copy_Page , Local_Slot) == 0))
+	{
+		/* Copy record from flash */
+		Local_pRecord = FEE_SLOT_POINTER(Copy_Page , Local_Slot);
+		for(Local_HalfWordCounter = 0 ; Local_HalfWordCounter < FEE_SLOT_HALFWORDS ; Local_HalfWordCounter++)
+		{
+			Local_Record[Local_HalfWordCounter] = Local_pRecord[Local_HalfWordCounter];
+		}
+
+		/* Get key of record */
+		Local_Key = Local_Record[FEE_RECORD_KEY] & FEE_KEY_MASK;
+
+		/* Check if record is complete and its key is within range */
+		if((Local_Record[FEE_RECORD_CRC] == FEE_Crc16(Local_Record , FEE_RECORD_CRC_LENGTH)) &&
+		   (Local_Key < FEE_MAX_KEYS))
+		{
+			/* Check if record is a deletion record */
+			if((Local_Record[FEE_RECORD_KEY] & FEE_KEY_DELETED_FLAG) != 0)
+			{
+				Global_KeyValid[Local_Key] = 0;
+			}
+			else
+			{
+				Global_Values[Local_Key] = (uint32_t)Local_Record[FEE_RECORD_VALUE_LOW] |
+										   ((uint32_t)Local_Record[FEE_RECORD_VALUE_HIGH] << 16);
+				Global_KeyValid[Local_Key] = 1;
+			}
+
+			/* Last record of the key is in this page */
+			Global_RecordPage[Local_Key] = Copy_Page;
+		}
+
+		/* Move to next slot */
+		Local_Slot++;
+	}
+
+	return Local_Slot;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: OpenPage                                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Page                                              */
+/*				   Brief: Index of page in the pages ring                         */
+/*				   Range: (0 --> FEE_PAGES_NUMBER - 1)                            */
+/*				   -------------------------------------------------------------- */
+/*                 uint16_t Copy_Sequence                                         */
+/*				   Brief: Sequence number of the new head page                    */
+/*				   Range: Any uint16_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function makes a page the head page of the ring. The page */
+/*                 is erased if needed then its header is written with the magic  */
+/*                 number last so a page with a complete header is always a valid */
+/*                 page                                                           */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t FEE_OpenPage(uint8_t Copy_Page , uint16_t Copy_Sequence)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	uint16_t Local_Header[FEE_HEADER_LENGTH];			/* Page header to be written */
+
+	/* Check if page is erased */
+	if(FEE_IsPageErased(Copy_Page) == 0)
+	{
+		/* Erase page */
+		Local_Status = FPEC_FlashPageErase(FEE_FIRST_PAGE + Copy_Page);
+	}
+
+	/* Check if page is ready */
+	if(Local_Status == RT_OK)
+	{
+		/* Write header, magic number is the last halfword so only a complete header is valid */
+		Local_Header[FEE_HEADER_SEQUENCE] = Copy_Sequence;
+		Local_Header[FEE_HEADER_INVERTED_SEQUENCE] = (uint16_t)(~Copy_Sequence);
+		Local_Header[FEE_HEADER_MAGIC] = FEE_PAGE_MAGIC;
+		Local_Status = FPEC_FlashWriteHexRecord((uint32_t)FEE_SLOT_POINTER(Copy_Page , FEE_HEADER_SLOT) , Local_Header , FEE_HEADER_LENGTH);
+	}
+
+	/* Check if page is opened */
+	if(Local_Status == RT_OK)
+	{
+		/* Page is the new head */
+		Global_HeadPage = Copy_Page;
+		Global_HeadSlot = FEE_FIRST_RECORD_SLOT;
+		Global_HeadSequence = Copy_Sequence;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: AppendRecord                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint16_t Copy_KeyField                                         */
+/*				   Brief: Key of the record with FEE_KEY_DELETED_FLAG set for     */
+/*				          deletion records                                        */
+/*				   Range: Any uint16_t value                                      */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_Value                                            */
+/*				   Brief: Value of the record                                     */
+/*				   Range: Any uint32_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function writes one record in the next free slot of the   */
+/*                 head page with its CRC written last. The slot is consumed even */
+/*                 if writing fails so a damaged slot is never written again      */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t FEE_AppendRecord(uint16_t Copy_KeyField , uint32_t Copy_Value)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status;						/* Variable to hold status of the function */
+	uint16_t Local_Record[FEE_SLOT_HALFWORDS];			/* Record to be written */
+
+	/* Build record */
+	Local_Record[FEE_RECORD_KEY] = Copy_KeyField;
+	Local_Record[FEE_RECORD_VALUE_LOW] = (uint16_t)Copy_Value;
+	Local_Record[FEE_RECORD_VALUE_HIGH] = (uint16_t)(Copy_Value >> 16);
+	Local_Record[FEE_RECORD_CRC] = FEE_Crc16(Local_Record , FEE_RECORD_CRC_LENGTH);
+
+	/* Write record in head page free slot, CRC is the last halfword so only a complete record is valid */
+	Local_Status = FPEC_FlashWriteHexRecord((uint32_t)FEE_SLOT_POINTER(Global_HeadPage , Global_HeadSlot) , Local_Record , FEE_SLOT_HALFWORDS);
+
+	/* Slot is consumed even if writing failed */
+	Global_HeadSlot++;
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: MoveHead                                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function opens the next (erased) page of the ring as head */
+/*                 page then garbage collects the page after it if it holds data, */
+/*                 so one erased page is always kept ahead of the head page       */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t FEE_MoveHead(void)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status;						/* Variable to hold status of the function */
+	uint16_t Local_Sequence;							/* Sequence number of page ahead of the new head */
+
+	/* Open next page of the ring */
+	Local_Status = FEE_OpenPage(FEE_NEXT_PAGE(Global_HeadPage) , (uint16_t)(Global_HeadSequence + 1U));
+
+	/* Check if page ahead of the new head holds data (ring is full) */
+	if((Local_Status == RT_OK) &&
+	   (FEE_GetPageSequence(FEE_NEXT_PAGE(Global_HeadPage) , &Local_Sequence) == RT_OK))
+	{
+		/* Collect the oldest page so an erased page is kept ahead of head */
+		Local_Status = FEE_CollectPage(FEE_NEXT_PAGE(Global_HeadPage));
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: CollectPage                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Page                                              */
+/*				   Brief: Index of page in the pages ring                         */
+/*				   Range: (0 --> FEE_PAGES_NUMBER - 1)                            */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function copies the live records whose last version is in */
+/*                 a page to the head page then erases the page. Records are      */
+/*                 copied before erasing so a power loss at any point keeps every */
+/*                 value                                                          */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t FEE_CollectPage(uint8_t Copy_Page)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	uint8_t Local_Key;									/* Variable to hold counts of keys */
+
+	/* Copy live records whose last version is in the page */
+	for(Local_Key = 0 ; (Local_Key < FEE_MAX_KEYS) && (Local_Status == RT_OK) ; Local_Key++)
+	{
+		/* Check if key holds a value in the page */
+		if((Global_KeyValid[Local_Key] == 1) && (Global_RecordPage[Local_Key] == Copy_Page))
+		{
+			/* Copy record to head page (it always fits, FEE_MAX_KEYS is less than slots of a page) */
+			Local_Status = FEE_AppendRecord(Local_Key , Global_Values[Local_Key]);
+			Global_RecordPage[Local_Key] = Global_HeadPage;
+		}
+	}
+
+	/* Check if all live records are copied */
+	if(Local_Status == RT_OK)
+	{
+		/* Erase the page */
+		Local_Status = FPEC_FlashPageErase(FEE_FIRST_PAGE + Copy_Page);
+	}
+
+	return Local_Status;
+}
@@ -0,0 +1,56 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*      			SWC          : FWU  			            */
+/*     			    Description	 : FWU Config                   */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*----------------------------------------------------------------------------------------------------------*/
+/*                                                                                                          */
+/*                  ______  __          __ _    _     _____             __ _                                */
+/*                 |  ____| \ \        / /| |  | |   / ____|           / _(_)                               */
+/*                 | |__     \ \  /\  / / | |  | |  | |     ___  _ __ | |_ _  __ _                          */
+/*                 |  __|     \ \/  \/ /  | |  | |  | |    / _ \| '_ \|  _| |/ _` |                         */
+/*                 | |         \  /\  /   | |__| |  | |___| (_) | | | | | | | (_| |                         */
+/*                 |_|          \/  \/     \____/    \_____\___/|_| |_|_| |_|\__, |                         */
+/*                                                                           __/  |                         */
+/*                                                                           |___/                          */
+/*                                                                                                          */
+/*----------------------------------------------------------------------------------------------------------*/
+
+#ifndef HAL_FWU_CONFIG_H_
+#define HAL_FWU_CONFIG_H_
+
+/*-------------------------------------------------------*/
+/* Set first flash page of firmware slot A and slot B    */
+/* (pages before both slots hold the boot loader):       */
+/*                                                       */
+/* Options	: - (FPEC_PAGE_1 --> FPEC_PAGE_126)          */
+/*                                                       */
+/* Note     : Slots must not overlap each other nor FEE  */
+/*            pages                                      */
+/*-------------------------------------------------------*/
+#define FWU_SLOT_A_FIRST_PAGE  FPEC_PAGE_8   /* Default: FPEC_PAGE_8 */
+#define FWU_SLOT_B_FIRST_PAGE  FPEC_PAGE_62  /* Default: FPEC_PAGE_62 */
+
+/*-------------------------------------------------------*/
+/* Set number of flash pages of each slot (first page    */
+/* holds slot header, image is linked at second page):   */
+/*                                                       */
+/* Options	: - (2 --> 64)                               */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define FWU_SLOT_PAGES  54U  /* Default: 54U */
+
+/*-------------------------------------------------------*/
+/* Enable/Disable accepting an image whose version isn't */
+/* newer than the active image version:                  */
+/*                                                       */
+/* Options	: - ENABLE                                   */
+/* 			  - DISABLE                                  */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define FWU_DOWNGRADE  DISABLE  /* Default: DISABLE */
+
+#endif /* HAL_FWU_CONFIG_H_ */
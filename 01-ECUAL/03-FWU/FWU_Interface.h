@@ -0,0 +1,203 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*      			SWC          : FWU  			            */
+/*     			    Description	 : FWU Interface                */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*----------------------------------------------------------------------------------------------------------*/
+/*                                                                                                          */
+/*           ______  __          __ _    _    _____       _             __                                  */
+/*          |  ____| \ \        / /| |  | |  |_   _|     | |           / _|                                 */
+/*          | |__     \ \  /\  / / | |  | |    | |  _ __ | |_ ___ _ __| |_ __ _  ___ ___                    */
+/*          |  __|     \ \/  \/ /  | |  | |    | | | '_ \| __/ _ \ '__|  _/ _` |/ __/ _ \                   */
+/*          | |         \  /\  /   | |__| |   _| |_| | | | ||  __/ |  | || (_| | (_|  __/                   */
+/*          |_|          \/  \/     \____/   |_____|_| |_|\__\___|_|  |_| \__,_|\___\___|                   */
+/*                                                                                                          */
+/*----------------------------------------------------------------------------------------------------------*/
+
+#ifndef HAL_FWU_INTERFACE_H_
+#define HAL_FWU_INTERFACE_H_
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  INTERFACE MACROS                                 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Firmware Slots */
+#define FWU_SLOT_A					0U
+#define FWU_SLOT_B					1U
+
+/* Largest Image Size a Slot Can Hold in Bytes (slot pages except header page) */
+#define FWU_SLOT_IMAGE_SIZE			((uint32_t)(FWU_SLOT_PAGES - 1U) * FPEC_PAGE_SIZE)
+
+/* CRC-32 Running Value Parameters */
+#define FWU_CRC32_INITIAL			0xFFFFFFFFUL
+#define FWU_CRC32_FINAL_XOR			0xFFFFFFFFUL
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                FUNCTIONS PROTOTYPES                               */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetActiveSlot                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pSlot                                            */
+/*				   Brief: Pointer to variable in which active slot id will be     */
+/*				          returned                                                */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pVersion                                        */
+/*				   Brief: Pointer to variable in which version of active image    */
+/*				          will be returned                                        */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gets the active slot, the slot with a complete   */
+/*                 header and the newest sequence number. It returns RT_NOK if no */
+/*                 slot holds an image                                            */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FWU_GetActiveSlot(uint8_t* Copy_pSlot , uint32_t* Copy_pVersion);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: BeginUpdate                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint32_t Copy_Version                                          */
+/*				   Brief: Version of the new image                                */
+/*				   Range: Any uint32_t value (newer than active image unless      */
+/*				          FWU_DOWNGRADE is ENABLE)                                */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_ImageSize                                        */
+/*				   Brief: Size of the new image in bytes                          */
+/*				   Range: (1 --> FWU_SLOT_IMAGE_SIZE)                             */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_ImageCrc                                         */
+/*				   Brief: CRC-32 (IEEE 802.3) of the new image                    */
+/*				   Range: Any uint32_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function starts streaming a new image into the inactive   */
+/*                 slot. Header page of the inactive slot is erased first so the  */
+/*                 slot stops being bootable until the new image is complete and  */
+/*                 verified                                                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FWU_BeginUpdate(uint32_t Copy_Version , uint32_t Copy_ImageSize , uint32_t Copy_ImageCrc);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: WriteChunk                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const uint8_t* Copy_pData                                      */
+/*				   Brief: Received image bytes                                    */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint16_t Copy_Length                                           */
+/*				   Brief: Number of received bytes                                */
+/*				   Range: Any uint16_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint16_t* Copy_pAccepted                                       */
+/*				   Brief: Pointer to variable in which number of accepted bytes   */
+/*				          will be returned                                        */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function copies received image bytes into the filling     */
+/*                 chunk buffer without programming flash, so it can be called    */
+/*                 from a receive interrupt. A full chunk is handed to            */
+/*                 FWU_Service and filling goes on in the other buffer. If both   */
+/*                 buffers wait for programming it accepts less bytes and returns */
+/*                 BUSY_FUNC                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FWU_WriteChunk(const uint8_t* Copy_pData , uint16_t Copy_Length , uint16_t* Copy_pAccepted);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Service                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function programs the next chunk buffer waiting for       */
+/*                 programming (one flash page), it is called from the main loop  */
+/*                 or a scheduler task while reception goes on in the other       */
+/*                 buffer                                                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FWU_Service(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FinishUpdate                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function checks CRC-32 of the programmed image then       */
+/*                 writes header of the slot with the magic number last, which    */
+/*                 switches the active slot in one halfword write. It returns     */
+/*                 BUSY_FUNC while chunks are still waiting for programming       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FWU_FinishUpdate(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: AbortUpdate                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function drops the running update with its received       */
+/*                 chunks and the page staged in FPEC, the inactive slot stays    */
+/*                 not bootable                                                   */
+/*--------------------------------------------------------------------------------*/
+void FWU_AbortUpdate(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: BootActiveImage                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function boots the newest slot whose image passes its     */
+/*                 CRC-32 check, falling back to the other slot. It masks         */
+/*                 interrupts, stops SysTick, disables and clears every NVIC      */
+/*                 interrupt, relocates the vector table to the image, loads its  */
+/*                 stack pointer, unmasks interrupts as after reset (nothing is   */
+/*                 enabled or pending) then jumps to its reset handler. It        */
+/*                 returns only if no slot holds a valid image                    */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FWU_BootActiveImage(void);
+
+#endif /* HAL_FWU_INTERFACE_H_ */
@@ -0,0 +1,101 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*      			SWC          : FWU  			            */
+/*     			    Description	 : FWU Private                  */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*----------------------------------------------------------------------------------------------------------*/
+/*                                                                                                          */
+/*                 ______  __          __ _    _    _____      _            _                               */
+/*                |  ____| \ \        / /| |  | |  |  __ \    (_)          | |                              */
+/*                | |__     \ \  /\  / / | |  | |  | |__) | __ ___   ____ _| |_ ___                         */
+/*                |  __|     \ \/  \/ /  | |  | |  |  ___/ '__| \ \ / / _` | __/ _ \                        */
+/*                | |         \  /\  /   | |__| |  | |   | |  | |\ V / (_| | ||  __/                        */
+/*                |_|          \/  \/     \____/   |_|   |_|  |_| \_/ \__,_|\__\___|                        */
+/*                                                                                                          */
+/*----------------------------------------------------------------------------------------------------------*/
+
+#ifndef HAL_FWU_PRIVATE_H_
+#define HAL_FWU_PRIVATE_H_
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Define Configuration Options Values */
+#define DISABLE							0U
+#define ENABLE							1U
+
+/* Define Number of Slots and Chunk Buffers */
+#define FWU_SLOTS_NUMBER				2U
+#define FWU_CHUNK_BUFFERS				2U
+
+/* Define Chunk Geometry (one chunk is one flash page) */
+#define FWU_CHUNK_SIZE					FPEC_PAGE_SIZE
+#define FWU_CHUNK_HALFWORDS				(FPEC_PAGE_SIZE / 2U)
+
+/* Define Chunk Buffer States */
+#define FWU_BUFFER_FREE					0U
+#define FWU_BUFFER_READY				1U
+
+/* Define Erased Flash Byte and Halfword */
+#define FWU_ERASED_BYTE					0xFFU
+#define FWU_ERASED_HALFWORD				0xFFFFU
+
+/* Define Slot Header Magic Number and Number of Halfwords Written (magic number is the last one) */
+#define FWU_HEADER_MAGIC				0x4657U
+#define FWU_HEADER_HALFWORDS			9U
+
+/* Define CRC-32 Parameters */
+#define FWU_CRC32_NIBBLE_MASK			0x0FU
+#define FWU_CRC32_NIBBLE_BITS			4U
+
+/* Define First Page, Header and Image Addresses of a Slot */
+#define FWU_SLOT_FIRST_PAGE(Slot)		((uint8_t)(((Slot) == FWU_SLOT_A) ? FWU_SLOT_A_FIRST_PAGE : FWU_SLOT_B_FIRST_PAGE))
+#define FWU_SLOT_HEADER_ADDRESS(Slot)	(FPEC_FLASH_FIRST_ADDRESS + ((uint32_t)FWU_SLOT_FIRST_PAGE(Slot) * FPEC_PAGE_SIZE))
+#define FWU_SLOT_IMAGE_ADDRESS(Slot)	(FWU_SLOT_HEADER_ADDRESS(Slot) + FPEC_PAGE_SIZE)
+
+/* Check if Initial Stack Pointer of an Image Points to SRAM */
+#define FWU_SRAM_ADDRESS_MASK			0x2FFE0000UL
+#define FWU_SRAM_FIRST_ADDRESS			0x20000000UL
+#define FWU_IS_VALID_STACK_POINTER(Value)	(((Value) & FWU_SRAM_ADDRESS_MASK) == FWU_SRAM_FIRST_ADDRESS)
+
+/* Core register macros are Cortex-M3 specific, a host build (05-TEST) defines its own before this header */
+#ifndef FWU_SET_MAIN_STACK_POINTER
+
+/* Mask configurable interrupts (PRIMASK) while interrupts of the boot loader are shut down */
+#define FWU_DISABLE_INTERRUPTS()							__asm volatile("CPSID I" : : : "memory")
+
+/* Unmask configurable interrupts (PRIMASK), image starts with PRIMASK cleared as after reset */
+#define FWU_ENABLE_INTERRUPTS()								__asm volatile("CPSIE I" : : : "memory")
+
+/* Load Main Stack Pointer (MSP) */
+#define FWU_SET_MAIN_STACK_POINTER(Copy_StackPointer)		__asm volatile("MSR MSP, %0" : : "r"(Copy_StackPointer) : "memory")
+
+#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 PRIVATE DATA TYPES                                */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Slot header stored in first page of a slot */
+typedef struct
+{
+	uint32_t Version;							/* Version of the image */
+	uint32_t ImageSize;							/* Size of the image in bytes */
+	uint32_t ImageCrc;							/* CRC-32 of the image */
+	uint32_t Sequence;							/* Update sequence number (newest slot is the active one) */
+	uint16_t Magic;								/* FWU_HEADER_MAGIC, written last so only a complete header is valid */
+	uint16_t Reserved;							/* Not written (keeps header size a multiple of words) */
+}FWU_SlotHeader_t;
+
+/* Reset handler of an image */
+typedef void (*FWU_EntryPoint_t)(void);
+
+#endif /* HAL_FWU_PRIVATE_H_ */
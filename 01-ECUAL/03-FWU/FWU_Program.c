@@ -0,0 +1,768 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*      			SWC          : FWU  			            */
+/*     			    Description	 : FWU Program                  */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*----------------------------------------------------------------------------------------------------------*/
+/*                                                                                                          */
+/*            ______  __          __ _    _    _____                                                        */
+/*           |  ____| \ \        / /| |  | |  |  __ \                                                       */
+/*           | |__     \ \  /\  / / | |  | |  | |__) | __ ___   __ _ _ __ __ _ _ __ ___                     */
+/*           |  __|     \ \/  \/ /  | |  | |  |  ___/ '__/ _ \ / _` | '__/ _` | '_ ` _ \                    */
+/*           | |         \  /\  /   | |__| |  | |   | | | (_) | (_| | | | (_| | | | | | |                   */
+/*           |_|          \/  \/     \____/   |_|   |_|  \___/ \__, |_|  \__,_|_| |_| |_|                   */
+/*                                                              __/ |                                       */
+/*                                                             |___/                                        */
+/*                                                                                                          */
+/*----------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "FPEC_Interface.h"
+#include "NVIC_Interface.h"
+#include "SCB_Interface.h"
+#include "STK_Interface.h"
+
+#include "FWU_Config.h"
+#include "FWU_Interface.h"
+#include "FWU_Private.h"
+
+#if (FWU_SLOT_PAGES < 2U) || ((FWU_SLOT_A_FIRST_PAGE + FWU_SLOT_PAGES) > (FPEC_PAGE_127 + 1U)) || \
+	((FWU_SLOT_B_FIRST_PAGE + FWU_SLOT_PAGES) > (FPEC_PAGE_127 + 1U)) || \
+	(((FWU_SLOT_A_FIRST_PAGE + FWU_SLOT_PAGES) > FWU_SLOT_B_FIRST_PAGE) && ((FWU_SLOT_B_FIRST_PAGE + FWU_SLOT_PAGES) > FWU_SLOT_A_FIRST_PAGE))
+	#error "Wrong FWU Slots Configuration !"
+#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            PRIVATE FUNCTIONS PROTOTYPES                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static ERROR_STATUS_t FWU_GetSlotHeader(uint8_t Copy_Slot , const volatile FWU_SlotHeader_t** Copy_ppHeader);
+static ERROR_STATUS_t FWU_VerifySlot(uint8_t Copy_Slot);
+static uint32_t FWU_Crc32(uint32_t Copy_Crc , const volatile uint8_t* Copy_pData , uint32_t Copy_Size);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static uint16_t Global_ChunkBuffers[FWU_CHUNK_BUFFERS][FWU_CHUNK_HALFWORDS];	/* Ping-pong chunk buffers (one is filled while the other is programmed) */
+static volatile uint8_t Global_BufferState[FWU_CHUNK_BUFFERS];				/* State of each chunk buffer (free or waiting for programming) */
+static uint16_t Global_BufferChunk[FWU_CHUNK_BUFFERS];						/* Chunk number (page of the image) held by each buffer */
+static uint8_t  Global_FillBuffer = 0;						/* Chunk buffer being filled by FWU_WriteChunk */
+static uint16_t Global_FillOffset = 0;						/* Next free byte of the filled chunk buffer */
+static uint8_t  Global_ServiceBuffer = 0;					/* Next chunk buffer to be programmed by FWU_Service */
+static volatile uint8_t Global_UpdateRunning = 0;			/* Flag that indicates an update is running */
+static volatile uint8_t Global_UpdateFailed = 0;			/* Flag that indicates programming of a chunk failed */
+static uint8_t  Global_UpdateSlot = FWU_SLOT_A;			/* Slot receiving the new image */
+static uint32_t Global_UpdateVersion = 0;					/* Version of the new image */
+static uint32_t Global_UpdateSize = 0;						/* Size of the new image in bytes */
+static uint32_t Global_UpdateCrc = 0;						/* CRC-32 of the new image */
+static uint32_t Global_UpdateSequence = 0;					/* Sequence number of the new slot header */
+static uint32_t Global_ReceivedSize = 0;					/* Number of received image bytes */
+static uint16_t Global_ReceivedChunks = 0;					/* Number of chunks handed for programming */
+static volatile uint16_t Global_ProgrammedChunks = 0;		/* Number of programmed chunks */
+
+/* CRC-32 of every nibble value (reflected polynomial 0xEDB88320) */
+static const uint32_t Global_Crc32Nibbles[16] =
+{
+	0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL, 0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+	0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL, 0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetActiveSlot                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pSlot                                            */
+/*				   Brief: Pointer to variable in which active slot id will be     */
+/*				          returned                                                */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pVersion                                        */
+/*				   Brief: Pointer to variable in which version of active image    */
+/*				          will be returned                                        */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gets the active slot, the slot with a complete   */
+/*                 header and the newest sequence number. It returns RT_NOK if no */
+/*                 slot holds an image                                            */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FWU_GetActiveSlot(uint8_t* Copy_pSlot , uint32_t* Copy_pVersion)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_NOK;				/* Variable to hold status of the function */
+	ERROR_STATUS_t Local_HeaderStatus[FWU_SLOTS_NUMBER];	/* Header check status of each slot */
+	const volatile FWU_SlotHeader_t* Local_pHeaders[FWU_SLOTS_NUMBER];	/* Header of each slot */
+	uint8_t Local_Slot;									/* Variable to hold counts of slots */
+	uint8_t Local_Newest = FWU_SLOT_A;					/* Slot with newest complete header */
+	uint8_t Local_Counter;								/* Variable to hold counts of tried slots */
+
+	/* Check if passed pointers are NULL pointers or not */
+	if((Copy_pSlot != NULL) && (Copy_pVersion != NULL))
+	{
+		/* Check header of each slot */
+		for(Local_Slot = 0 ; Local_Slot < FWU_SLOTS_NUMBER ; Local_Slot++)
+		{
+			Local_HeaderStatus[Local_Slot] = FWU_GetSlotHeader(Local_Slot , &Local_pHeaders[Local_Slot]);
+		}
+
+		/* Check if slot B is newer than slot A */
+		if((Local_HeaderStatus[FWU_SLOT_B] == RT_OK) &&
+		   ((Local_HeaderStatus[FWU_SLOT_A] != RT_OK) || (Local_pHeaders[FWU_SLOT_B]->Sequence > Local_pHeaders[FWU_SLOT_A]->Sequence)))
+		{
+			Local_Newest = FWU_SLOT_B;
+		}
+
+		/* Try newest slot then fall back to the other one until an image passes its CRC check */
+		for(Local_Counter = 0 ; (Local_Counter < FWU_SLOTS_NUMBER) && (Local_Status != RT_OK) ; Local_Counter++)
+		{
+			/* Get slot to be tried */
+			Local_Slot = (uint8_t)(Local_Newest ^ Local_Counter);
+
+			/* Check if slot holds a complete and valid image */
+			if((Local_HeaderStatus[Local_Slot] == RT_OK) && (FWU_VerifySlot(Local_Slot) == RT_OK))
+			{
+				*Copy_pSlot = Local_Slot;
+				*Copy_pVersion = Local_pHeaders[Local_Slot]->Version;
+				Local_Status = RT_OK;
+			}
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: BeginUpdate                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint32_t Copy_Version                                          */
+/*				   Brief: Version of the new image                                */
+/*				   Range: Any uint32_t value (newer than active image unless      */
+/*				          FWU_DOWNGRADE is ENABLE)                                */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_ImageSize                                        */
+/*				   Brief: Size of the new image in bytes                          */
+/*				   Range: (1 --> FWU_SLOT_IMAGE_SIZE)                             */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_ImageCrc                                         */
+/*				   Brief: CRC-32 (IEEE 802.3) of the new image                    */
+/*				   Range: Any uint32_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function starts streaming a new image into the inactive   */
+/*                 slot. Header page of the inactive slot is erased first so the  */
+/*                 slot stops being bootable until the new image is complete and  */
+/*                 verified                                                       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FWU_BeginUpdate(uint32_t Copy_Version , uint32_t Copy_ImageSize , uint32_t Copy_ImageCrc)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	const volatile FWU_SlotHeader_t* Local_pActiveHeader;	/* Header of the active slot */
+	uint32_t Local_ActiveVersion;						/* Version of the active image */
+	uint8_t Local_ActiveSlot;							/* Slot of the active image */
+	uint8_t Local_Counter;								/* Variable to hold counts of chunk buffers */
+
+	/* Check if an update is already running */
+	if(Global_UpdateRunning == 0)
+	{
+		/* Check if passed image size is within its valid range */
+		if((Copy_ImageSize > 0) && (Copy_ImageSize <= FWU_SLOT_IMAGE_SIZE))
+		{
+			/* Check if a slot holds an active image */
+			if(FWU_GetActiveSlot(&Local_ActiveSlot , &Local_ActiveVersion) == RT_OK)
+			{
+				/* Get header of the active slot for its sequence number */
+				Local_Status = FWU_GetSlotHeader(Local_ActiveSlot , &Local_pActiveHeader);
+
+				/* Check if header is still complete */
+				if(Local_Status == RT_OK)
+				{
+					/* New image goes to the other slot with a newer sequence number */
+					Global_UpdateSlot = (uint8_t)(Local_ActiveSlot ^ 1U);
+					Global_UpdateSequence = Local_pActiveHeader->Sequence + 1U;
+
+#if FWU_DOWNGRADE == DISABLE
+					/* Check if new image is newer than the active one */
+					if(Copy_Version <= Local_ActiveVersion)
+					{
+						/* Function is not behaving as expected */
+						Local_Status = RT_NOK;
+					}
+#elif FWU_DOWNGRADE != ENABLE
+	#error "Wrong FWU Downgrade Configuration !"
+#endif
+				}
+			}
+			else
+			{
+				/* No active image, first image goes to slot A */
+				Global_UpdateSlot = FWU_SLOT_A;
+				Global_UpdateSequence = 0;
+			}
+
+			/* Check if new image is accepted */
+			if(Local_Status == RT_OK)
+			{
+				/* Open a flash session for the erase */
+				Local_Status = FPEC_BeginSession();
+			}
+
+			/* Check if flash session is open */
+			if(Local_Status == RT_OK)
+			{
+				/* Erase header page so slot is not bootable until the new image is complete */
+				Local_Status = FPEC_FlashPageErase(FWU_SLOT_FIRST_PAGE(Global_UpdateSlot));
+
+				/* Close flash session */
+				(void)FPEC_EndSession();
+			}
+
+			/* Check if slot is ready */
+			if(Local_Status == RT_OK)
+			{
+				/* Reset stream state */
+				for(Local_Counter = 0 ; Local_Counter < FWU_CHUNK_BUFFERS ; Local_Counter++)
+				{
+					Global_BufferState[Local_Counter] = FWU_BUFFER_FREE;
+				}
+				Global_FillBuffer = 0;
+				Global_FillOffset = 0;
+				Global_ServiceBuffer = 0;
+				Global_ReceivedSize = 0;
+				Global_ReceivedChunks = 0;
+				Global_ProgrammedChunks = 0;
+				Global_UpdateVersion = Copy_Version;
+				Global_UpdateSize = Copy_ImageSize;
+				Global_UpdateCrc = Copy_ImageCrc;
+				Global_UpdateFailed = 0;
+				Global_UpdateRunning = 1;
+			}
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* An update is already running */
+		Local_Status = BUSY_FUNC;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: WriteChunk                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const uint8_t* Copy_pData                                      */
+/*				   Brief: Received image bytes                                    */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint16_t Copy_Length                                           */
+/*				   Brief: Number of received bytes                                */
+/*				   Range: Any uint16_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint16_t* Copy_pAccepted                                       */
+/*				   Brief: Pointer to variable in which number of accepted bytes   */
+/*				          will be returned                                        */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function copies received image bytes into the filling     */
+/*                 chunk buffer without programming flash, so it can be called    */
+/*                 from a receive interrupt. A full chunk is handed to            */
+/*                 FWU_Service and filling goes on in the other buffer. If both   */
+/*                 buffers wait for programming it accepts less bytes and returns */
+/*                 BUSY_FUNC                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FWU_WriteChunk(const uint8_t* Copy_pData , uint16_t Copy_Length , uint16_t* Copy_pAccepted)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	uint8_t* Local_pFillBytes;							/* Bytes of the filled chunk buffer */
+	uint16_t Local_Accepted = 0;						/* Number of accepted bytes */
+
+	/* Check if passed pointers are NULL pointers or not */
+	if((Copy_pData != NULL) && (Copy_pAccepted != NULL))
+	{
+		/* Check if an update is running and no chunk failed */
+		if((Global_UpdateRunning == 1) && (Global_UpdateFailed == 0))
+		{
+			/* Copy bytes until all are copied, image is complete or no buffer is free */
+			while((Local_Status == RT_OK) && (Local_Accepted < Copy_Length) && (Global_ReceivedSize < Global_UpdateSize))
+			{
+				/* Check if a new buffer is started while it still waits for programming */
+				if((Global_FillOffset == 0) && (Global_BufferState[Global_FillBuffer] != FWU_BUFFER_FREE))
+				{
+					/* Both buffers wait for programming */
+					Local_Status = BUSY_FUNC;
+				}
+				else
+				{
+					/* Copy byte */
+					Local_pFillBytes = (uint8_t*)Global_ChunkBuffers[Global_FillBuffer];
+					Local_pFillBytes[Global_FillOffset] = Copy_pData[Local_Accepted];
+					Global_FillOffset++;
+					Global_ReceivedSize++;
+					Local_Accepted++;
+
+					/* Check if chunk is full or image is complete */
+					if((Global_FillOffset == FWU_CHUNK_SIZE) || (Global_ReceivedSize == Global_UpdateSize))
+					{
+						/* Pad rest of last chunk with erased bytes (skipped while programming) */
+						while(Global_FillOffset < FWU_CHUNK_SIZE)
+						{
+							Local_pFillBytes[Global_FillOffset] = FWU_ERASED_BYTE;
+							Global_FillOffset++;
+						}
+
+						/* Hand chunk to FWU_Service then fill the other buffer */
+						Global_BufferChunk[Global_FillBuffer] = Global_ReceivedChunks;
+						Global_ReceivedChunks++;
+						Global_BufferState[Global_FillBuffer] = FWU_BUFFER_READY;
+						Global_FillBuffer ^= 1U;
+						Global_FillOffset = 0;
+					}
+				}
+			}
+
+			/* Check if bytes are received beyond image size */
+			if((Local_Status == RT_OK) && (Local_Accepted < Copy_Length))
+			{
+				/* Function is not behaving as expected */
+				Local_Status = RT_NOK;
+			}
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+
+		/* Return number of accepted bytes */
+		*Copy_pAccepted = Local_Accepted;
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Service                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function programs the next chunk buffer waiting for       */
+/*                 programming (one flash page), it is called from the main loop  */
+/*                 or a scheduler task while reception goes on in the other       */
+/*                 buffer                                                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FWU_Service(void)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	uint32_t Local_Address;								/* Flash address of the chunk */
+
+	/* Check if an update is running and next buffer waits for programming */
+	if((Global_UpdateRunning == 1) && (Global_BufferState[Global_ServiceBuffer] == FWU_BUFFER_READY))
+	{
+		/* Check if no chunk failed */
+		if(Global_UpdateFailed == 0)
+		{
+			/* Get flash address of the chunk */
+			Local_Address = FWU_SLOT_IMAGE_ADDRESS(Global_UpdateSlot) + ((uint32_t)Global_BufferChunk[Global_ServiceBuffer] * FWU_CHUNK_SIZE);
+
+			/* Open a flash session for the chunk */
+			Local_Status = FPEC_BeginSession();
+
+			/* Check if flash session is open */
+			if(Local_Status == RT_OK)
+			{
+				/* Program chunk (page is erased only if needed and every halfword is verified) */
+				Local_Status = FPEC_BufferWrite(Local_Address , Global_ChunkBuffers[Global_ServiceBuffer] , FWU_CHUNK_HALFWORDS);
+				if(Local_Status == RT_OK)
+				{
+					Local_Status = FPEC_BufferFlush();
+				}
+
+				/* Close flash session */
+				(void)FPEC_EndSession();
+			}
+
+			/* Check if chunk is programmed */
+			if(Local_Status == RT_OK)
+			{
+				Global_ProgrammedChunks++;
+			}
+			else
+			{
+				/* Update can't be completed */
+				FPEC_BufferDiscard();
+				Global_UpdateFailed = 1;
+			}
+		}
+
+		/* Release buffer for reception */
+		Global_BufferState[Global_ServiceBuffer] = FWU_BUFFER_FREE;
+		Global_ServiceBuffer ^= 1U;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FinishUpdate                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function checks CRC-32 of the programmed image then       */
+/*                 writes header of the slot with the magic number last, which    */
+/*                 switches the active slot in one halfword write. It returns     */
+/*                 BUSY_FUNC while chunks are still waiting for programming       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FWU_FinishUpdate(void)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	FWU_SlotHeader_t Local_Header;						/* Header of the new slot */
+
+	/* Check if an update is running, image is complete and no chunk failed */
+	if((Global_UpdateRunning == 1) && (Global_ReceivedSize == Global_UpdateSize) && (Global_UpdateFailed == 0))
+	{
+		/* Check if all chunks are programmed */
+		if(Global_ProgrammedChunks == Global_ReceivedChunks)
+		{
+			/* Check CRC-32 of programmed image */
+			if((FWU_Crc32(FWU_CRC32_INITIAL , (const volatile uint8_t*)FWU_SLOT_IMAGE_ADDRESS(Global_UpdateSlot) , Global_UpdateSize) ^
+				FWU_CRC32_FINAL_XOR) == Global_UpdateCrc)
+			{
+				/* Write slot header, magic number is the last halfword so the switch is one halfword write */
+				Local_Header.Version = Global_UpdateVersion;
+				Local_Header.ImageSize = Global_UpdateSize;
+				Local_Header.ImageCrc = Global_UpdateCrc;
+				Local_Header.Sequence = Global_UpdateSequence;
+				Local_Header.Magic = FWU_HEADER_MAGIC;
+				Local_Header.Reserved = FWU_ERASED_HALFWORD;
+
+				/* Open a flash session for the header */
+				Local_Status = FPEC_BeginSession();
+
+				/* Check if flash session is open */
+				if(Local_Status == RT_OK)
+				{
+					/* Program the header */
+					Local_Status = FPEC_FlashWriteHexRecord(FWU_SLOT_HEADER_ADDRESS(Global_UpdateSlot) , (uint16_t*)&Local_Header , FWU_HEADER_HALFWORDS);
+
+					/* Close flash session */
+					(void)FPEC_EndSession();
+				}
+			}
+			else
+			{
+				/* Image is corrupted */
+				Local_Status = RT_NOK;
+			}
+
+			/* Update is over */
+			Global_UpdateRunning = 0;
+		}
+		else
+		{
+			/* Chunks still wait for programming */
+			Local_Status = BUSY_FUNC;
+		}
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: AbortUpdate                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function drops the running update with its received       */
+/*                 chunks and the page staged in FPEC, the inactive slot stays    */
+/*                 not bootable                                                   */
+/*--------------------------------------------------------------------------------*/
+void FWU_AbortUpdate(void)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_Counter;								/* Variable to hold counts of chunk buffers */
+
+	/* Drop running update */
+	Global_UpdateRunning = 0;
+
+	/* Drop staged page and received chunks, nothing of them may reach the next update */
+	FPEC_BufferDiscard();
+	for(Local_Counter = 0 ; Local_Counter < FWU_CHUNK_BUFFERS ; Local_Counter++)
+	{
+		Global_BufferState[Local_Counter] = FWU_BUFFER_FREE;
+	}
+	Global_FillBuffer = 0;
+	Global_FillOffset = 0;
+	Global_ServiceBuffer = 0;
+	Global_UpdateFailed = 0;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: BootActiveImage                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function boots the newest slot whose image passes its     */
+/*                 CRC-32 check, falling back to the other slot. It masks         */
+/*                 interrupts, stops SysTick, disables and clears every NVIC      */
+/*                 interrupt, relocates the vector table to the image, loads its  */
+/*                 stack pointer, unmasks interrupts as after reset (nothing is   */
+/*                 enabled or pending) then jumps to its reset handler. It        */
+/*                 returns only if no slot holds a valid image                    */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FWU_BootActiveImage(void)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status;						/* Variable to hold status of the function */
+	FWU_EntryPoint_t Local_EntryPoint;					/* Reset handler of the image */
+	uint32_t Local_ImageAddress;						/* Flash address of the image (its vector table) */
+	uint32_t Local_StackPointer;						/* Initial stack pointer of the image */
+	uint32_t Local_Version;								/* Version of the image */
+	uint8_t Local_Slot;									/* Slot of the image */
+	uint8_t Local_VectorId;								/* Variable to hold counts of NVIC vector interrupts */
+
+	/* Get newest slot whose image passes its CRC check */
+	Local_Status = FWU_GetActiveSlot(&Local_Slot , &Local_Version);
+
+	/* Check if a valid image is found */
+	if(Local_Status == RT_OK)
+	{
+		/* Get vector table of the image */
+		Local_ImageAddress = FWU_SLOT_IMAGE_ADDRESS(Local_Slot);
+		Local_StackPointer = *((volatile uint32_t*)Local_ImageAddress);
+
+		/* Check if initial stack pointer points to SRAM */
+		if(FWU_IS_VALID_STACK_POINTER(Local_StackPointer))
+		{
+			/* Hand the core over as after reset, no interrupt of the boot loader may reach the image vector table */
+			FWU_DISABLE_INTERRUPTS();
+			STK_StopTimer();
+			SCB_ClearSystemPendingFlags();
+			for(Local_VectorId = NVIC_WWDG ; Local_VectorId <= NVIC_DMA2_Channel4_5 ; Local_VectorId++)
+			{
+				(void)NVIC_DisableVectorInterrupt(Local_VectorId);
+				(void)NVIC_ClearVectorInterruptPendingFlag(Local_VectorId);
+			}
+
+			/* Relocate vector table to the image */
+			Local_Status = SCB_ShiftInterruptVectorTable(Local_ImageAddress);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+
+	/* Check if image can be started */
+	if(Local_Status == RT_OK)
+	{
+		/* Load stack pointer of the image, clear PRIMASK as after reset then jump to its reset handler */
+		Local_EntryPoint = (FWU_EntryPoint_t)(*((volatile uint32_t*)(Local_ImageAddress + 4U)));
+		FWU_SET_MAIN_STACK_POINTER(Local_StackPointer);
+		FWU_ENABLE_INTERRUPTS();
+		Local_EntryPoint();
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetSlotHeader                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Slot                                              */
+/*				   Brief: Firmware slot id                                        */
+/*				   Range: (FWU_SLOT_A - FWU_SLOT_B)                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : const volatile FWU_SlotHeader_t** Copy_ppHeader                */
+/*				   Brief: Pointer to variable in which pointer to slot header     */
+/*				          will be returned                                        */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function checks if slot header is complete (magic number  */
+/*                 is written last) and consistent. It returns RT_NOK if slot     */
+/*                 holds no image                                                 */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t FWU_GetSlotHeader(uint8_t Copy_Slot , const volatile FWU_SlotHeader_t** Copy_ppHeader)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	const volatile FWU_SlotHeader_t* Local_pHeader = (const volatile FWU_SlotHeader_t*)FWU_SLOT_HEADER_ADDRESS(Copy_Slot);	/* Header of the slot */
+
+	/* Check if header is complete and image size fits in the slot */
+	if((Local_pHeader->Magic == FWU_HEADER_MAGIC) &&
+	   (Local_pHeader->ImageSize > 0) && (Local_pHeader->ImageSize <= FWU_SLOT_IMAGE_SIZE))
+	{
+		*Copy_ppHeader = Local_pHeader;
+	}
+	else
+	{
+		/* Slot holds no image */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: VerifySlot                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Slot                                              */
+/*				   Brief: Firmware slot id                                        */
+/*				   Range: (FWU_SLOT_A - FWU_SLOT_B)                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function checks CRC-32 of the image of a slot against its */
+/*                 header                                                         */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t FWU_VerifySlot(uint8_t Copy_Slot)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status;						/* Variable to hold status of the function */
+	const volatile FWU_SlotHeader_t* Local_pHeader;	/* Header of the slot */
+
+	/* Get slot header */
+	Local_Status = FWU_GetSlotHeader(Copy_Slot , &Local_pHeader);
+
+	/* Check CRC-32 of the image against its header */
+	if((Local_Status == RT_OK) &&
+	   ((FWU_Crc32(FWU_CRC32_INITIAL , (const volatile uint8_t*)FWU_SLOT_IMAGE_ADDRESS(Copy_Slot) , Local_pHeader->ImageSize) ^
+		 FWU_CRC32_FINAL_XOR) != Local_pHeader->ImageCrc))
+	{
+		/* Image is corrupted */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Crc32                                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint32_t Copy_Crc                                              */
+/*				   Brief: Running CRC of previous bytes                           */
+/*				   Range: FWU_CRC32_INITIAL for first bytes                       */
+/*				   -------------------------------------------------------------- */
+/*                 const volatile uint8_t* Copy_pData                             */
+/*				   Brief: Bytes to be checked                                     */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_Size                                             */
+/*				   Brief: Number of bytes                                         */
+/*				   Range: Any uint32_t value                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : uint32_t                                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function updates a running CRC-32 (IEEE 802.3, reflected  */
+/*                 polynomial 0xEDB88320) with a 16 entries nibble table. Final   */
+/*                 CRC is the running CRC xored with FWU_CRC32_FINAL_XOR          */
+/*--------------------------------------------------------------------------------*/
+static uint32_t FWU_Crc32(uint32_t Copy_Crc , const volatile uint8_t* Copy_pData , uint32_t Copy_Size)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_ByteCounter;							/* Variable to hold counts of bytes */
+
+	/* Traverse over each byte */
+	for(Local_ByteCounter = 0 ; Local_ByteCounter < Copy_Size ; Local_ByteCounter++)
+	{
+		/* Feed byte then process its low and high nibbles */
+		Copy_Crc ^= Copy_pData[Local_ByteCounter];
+		Copy_Crc = (Copy_Crc >> FWU_CRC32_NIBBLE_BITS) ^ Global_Crc32Nibbles[Copy_Crc & FWU_CRC32_NIBBLE_MASK];
+		Copy_Crc = (Copy_Crc >> FWU_CRC32_NIBBLE_BITS) ^ Global_Crc32Nibbles[Copy_Crc & FWU_CRC32_NIBBLE_MASK];
+	}
+
+	return Copy_Crc;
+}
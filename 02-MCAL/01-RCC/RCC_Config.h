@@ -144,6 +144,15 @@
 /*-------------------------------------------------------*/
 #define RCC_PLL_MUL_FACTOR   PLL_MUL_BY_2 /* Default: PLL_MUL_BY_2 */
 
+/*-------------------------------------------------------*/
+/* Set frequency of external HSE clock in Hz :- 	     */
+/*                                                       */
+/* Options: - 4000000UL --> 16000000UL                   */
+/*														 */
+/* Note   : Used only to calculate bus clock frequencies */
+/*-------------------------------------------------------*/
+#define RCC_HSE_FREQUENCY	8000000UL /* Default: 8000000UL */
+
 /*-------------------------------------------------------*/
 /* Select microcontroller clock output (MCO):- 	    	 */
 /*                                                       */
@@ -106,7 +106,8 @@
 /* @Return		 : void                                          				  */
 /*--------------------------------------------------------------------------------*/
 /* @Description	 : Initialize RCC through setting the clock for the system		  */
-/* 				   and its type based on configuration file						  */
+/* 				   and its type based on configuration file, then scales		  */
+/* 				   service delays (SERV_DelayInit) to the new AHB clock		  */
 /*--------------------------------------------------------------------------------*/
 void RCC_Init(void);
 
@@ -160,4 +161,23 @@ ERROR_STATUS_t RCC_EnablePeripheralClk(uint8_t Copy_BusId , uint8_t Copy_Periphe
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t RCC_DisablePeripheralClk(uint8_t Copy_BusId , uint8_t Copy_PeripheralId);
 
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetAHBClockFrequency					                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None				                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pFrequency				                      */
+/*                 Brief: Pointer to return AHB (HCLK) clock frequency in Hz      */
+/*                 Range: Any pointer to uint32_t                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                   			  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Calculates AHB clock frequency (which is also Cortex core and  */
+/* 				   SysTick clock) from the running RCC registers, so it reflects  */
+/* 				   actual system clock switch, PLL and AHB prescaler state		  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t RCC_GetAHBClockFrequency(uint32_t* Copy_pFrequency);
+
 #endif /* RCC_MCAL_INTERFACE_H_ */
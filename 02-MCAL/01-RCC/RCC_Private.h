@@ -60,6 +60,9 @@ typedef struct
 /* Some bit definitions of Clock configuration register (RCC_CFGR) */
 #define CFGR_PLLSRC					   16U 			/* PLL entry clock source */
 #define CFGR_PLLXTPRE 				   17U 			/* HSE divider for PLL entry */
+#define CFGR_SWS					   2U 			/* System clock switch status (2 bits) */
+#define CFGR_HPRE					   4U 			/* AHB prescaler (4 bits) */
+#define CFGR_PLLMUL					   18U 			/* PLL multiplication factor (4 bits) */
 
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
@@ -67,6 +70,17 @@ typedef struct
 /*                                                                                   */
 /*-----------------------------------------------------------------------------------*/
 
+/* Clock Frequency Calculation */
+#define RCC_HSI_FREQUENCY				8000000UL	/* HSI RC oscillator frequency in Hz */
+#define RCC_SWS_FIELD_MASK				0x3U		/* Mask of SWS field after shifting */
+#define RCC_HPRE_FIELD_MASK				0xFU		/* Mask of HPRE field after shifting */
+#define RCC_HPRE_DIVIDED				3U			/* HPRE field bit that indicates SYSCLK is divided */
+#define RCC_HPRE_DIVISION_MASK			0x7U		/* HPRE field bits that select division factor */
+#define RCC_HPRE_SKIPPED_DIVISION		4U			/* First HPRE division code after skipped (/32) factor */
+#define RCC_PLLMUL_FIELD_MASK			0xFU		/* Mask of PLLMUL field after shifting */
+#define RCC_PLLMUL_OFFSET				2U			/* PLLMUL field code 0 means multiply by 2 */
+#define RCC_PLLMUL_MAX					16U			/* Maximum PLL multiplication factor */
+
 /* System Clock Switch Options */
 #define RCC_SW_MASK					     0xFFFFFFFC
 #define RCC_SW_HSI					     0x00000000
@@ -26,6 +26,7 @@
 #include "STD_TYPES.h"
 #include "STD_ERRORS.h"
 #include "BIT_MATH.h"
+#include "SERVICE_FUNCTIONS.h"
 
 #include "RCC_Private.h"
 #include "RCC_Config.h"
@@ -49,10 +50,14 @@
 /* @Return		 : void                                          				  */
 /*--------------------------------------------------------------------------------*/
 /* @Description	 : Initialize RCC through setting the clock for the system		  */
-/* 				   and its type based on configuration file						  */
+/* 				   and its type based on configuration file, then scales		  */
+/* 				   service delays (SERV_DelayInit) to the new AHB clock		  */
 /*--------------------------------------------------------------------------------*/
 void RCC_Init(void)
 {
+	/* Local Variables Definitions */
+	uint32_t Local_AhbFrequency = 0;
+
 	/************************Check which clock is selected to be system's clock************************/
 	/* Clear System Clock Switch Bits */
 	RCC->CFGR &= RCC_SW_MASK;
@@ -465,6 +470,13 @@ void RCC_Init(void)
 
 		#endif
 
+	/************************Scale service delays to new core clock************************/
+	/* Wait until selected clock is used as system clock */
+	while(((RCC->CFGR >> CFGR_SWS) & RCC_SWS_FIELD_MASK) != (RCC->CFGR & ~RCC_SW_MASK));
+
+	/* Get AHB (core) clock frequency then scale delays to it */
+	RCC_GetAHBClockFrequency(&Local_AhbFrequency);
+	SERV_DelayInit(Local_AhbFrequency);
 }
 
 /*--------------------------------------------------------------------------------*/
@@ -590,3 +602,100 @@ ERROR_STATUS_t RCC_DisablePeripheralClk(uint8_t Copy_BusId , uint8_t Copy_Periph
 
 	return Local_Status;
 }
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetAHBClockFrequency					                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None				                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pFrequency				                      */
+/*                 Brief: Pointer to return AHB (HCLK) clock frequency in Hz      */
+/*                 Range: Any pointer to uint32_t                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                   			  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Calculates AHB clock frequency (which is also Cortex core and  */
+/* 				   SysTick clock) from the running RCC registers, so it reflects  */
+/* 				   actual system clock switch, PLL and AHB prescaler state		  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t RCC_GetAHBClockFrequency(uint32_t* Copy_pFrequency)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_SystemClock;
+	uint32_t Local_PllMultiplier;
+	uint32_t Local_AhbPrescaler;
+	uint32_t Local_AhbShift;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pFrequency != NULL)
+	{
+		/* Check which clock is currently used as system clock */
+		switch((RCC->CFGR >> CFGR_SWS) & RCC_SWS_FIELD_MASK)
+		{
+			case RCC_SW_HSE:
+
+				/* System clock is HSE clock */
+				Local_SystemClock = RCC_HSE_FREQUENCY;
+				break;
+
+			case RCC_SW_PLL:
+
+				/* Get PLL entry clock */
+				if(GET_BIT(RCC->CFGR,CFGR_PLLSRC) == 1U)
+				{
+					/* PLL entry is HSE clock (optionally divided by 2) */
+					Local_SystemClock = RCC_HSE_FREQUENCY >> GET_BIT(RCC->CFGR,CFGR_PLLXTPRE);
+				}
+				else
+				{
+					/* PLL entry is HSI clock divided by 2 */
+					Local_SystemClock = RCC_HSI_FREQUENCY >> 1U;
+				}
+
+				/* Get PLL multiplication factor (codes above x16 are also x16) */
+				Local_PllMultiplier = ((RCC->CFGR >> CFGR_PLLMUL) & RCC_PLLMUL_FIELD_MASK) + RCC_PLLMUL_OFFSET;
+				if(Local_PllMultiplier > RCC_PLLMUL_MAX)
+				{
+					Local_PllMultiplier = RCC_PLLMUL_MAX;
+				}
+
+				/* System clock is PLL output clock */
+				Local_SystemClock *= Local_PllMultiplier;
+				break;
+
+			default:
+
+				/* System clock is HSI clock */
+				Local_SystemClock = RCC_HSI_FREQUENCY;
+				break;
+		}
+
+		/* Get AHB prescaler */
+		Local_AhbPrescaler = (RCC->CFGR >> CFGR_HPRE) & RCC_HPRE_FIELD_MASK;
+		Local_AhbShift = 0;
+
+		/* Check if system clock is divided or not */
+		if(GET_BIT(Local_AhbPrescaler,RCC_HPRE_DIVIDED) == 1U)
+		{
+			/* Codes select /2 ,/4 ,/8 ,/16 then /64 ,/128 ,/256 ,/512 (no /32) */
+			Local_AhbShift = (Local_AhbPrescaler & RCC_HPRE_DIVISION_MASK) + 1U;
+			if((Local_AhbPrescaler & RCC_HPRE_DIVISION_MASK) >= RCC_HPRE_SKIPPED_DIVISION)
+			{
+				Local_AhbShift++;
+			}
+		}
+
+		/* Return AHB clock frequency */
+		*Copy_pFrequency = Local_SystemClock >> Local_AhbShift;
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
@@ -137,6 +137,35 @@
 #define GPIO_FULL_HIGH										0xFFFF	/* Set the port value to full high */
 #define GPIO_FULL_LOW										0x0000  /* Set the port value to full low */
 
+/****************Fast Pin Access (Header Only, No Range Checks)****************/
+
+/* Port base addresses (also used by GPIO_Private.h register definitions) */
+#define GPIO_PORTA_BASE_ADDRESS								0x40010800UL
+#define GPIO_PORTB_BASE_ADDRESS								0x40010C00UL
+#define GPIO_PORTC_BASE_ADDRESS								0x40011000UL
+
+/* Port registers (indexed by GPIO_PORT_x) */
+#define GPIO_PORT_BASE_ADDRESS(Copy_Port)					(((Copy_Port) == GPIO_PORT_A) ? GPIO_PORTA_BASE_ADDRESS :		\
+															 ((Copy_Port) == GPIO_PORT_B) ? GPIO_PORTB_BASE_ADDRESS : GPIO_PORTC_BASE_ADDRESS)
+#define GPIO_IDR_REG(Copy_Port)								(*(volatile uint32_t*)(GPIO_PORT_BASE_ADDRESS(Copy_Port) + 0x08UL))
+#define GPIO_ODR_REG(Copy_Port)								(*(volatile uint32_t*)(GPIO_PORT_BASE_ADDRESS(Copy_Port) + 0x0CUL))
+#define GPIO_BSRR_REG(Copy_Port)							(*(volatile uint32_t*)(GPIO_PORT_BASE_ADDRESS(Copy_Port) + 0x10UL))
+#define GPIO_BRR_REG(Copy_Port)								(*(volatile uint32_t*)(GPIO_PORT_BASE_ADDRESS(Copy_Port) + 0x14UL))
+
+/* Fast pin access for bit-banging and hot paths. Pass GPIO_PORT_x / GPIO_PIN_x constants so each macro folds to a   */
+/* single register access at compile time, arguments are not checked (use GPIO_SetPinVal, GPIO_GetPinVal and         */
+/* GPIO_TogglePinVal when port or pin come from run-time data)                                                        */
+#define GPIO_FAST_SET_PIN(Copy_Port,Copy_Pin)				(GPIO_BSRR_REG(Copy_Port) = (1UL << (Copy_Pin)))		/* One BSRR store */
+#define GPIO_FAST_RESET_PIN(Copy_Port,Copy_Pin)				(GPIO_BRR_REG(Copy_Port) = (1UL << (Copy_Pin)))			/* One BRR store */
+#define GPIO_FAST_WRITE_PIN(Copy_Port,Copy_Pin,Copy_Value)	(GPIO_BSRR_REG(Copy_Port) = (1UL << ((Copy_Pin) + (((Copy_Value) == GPIO_PIN_LOW) ? 16U : 0U))))	/* One BSRR store (reset half for GPIO_PIN_LOW) */
+#define GPIO_FAST_GET_PIN(Copy_Port,Copy_Pin)				((uint8_t)((GPIO_IDR_REG(Copy_Port) >> (Copy_Pin)) & 1UL))	/* One IDR load */
+
+/* Toggle is one ODR load then one BRR/BSRR store: other pins of the port are never written, but it is not atomic, */
+/* an update of the same pin (e.g. from an ISR) between load and store is overwritten                              */
+#define GPIO_FAST_TOGGLE_PIN(Copy_Port,Copy_Pin)			((GPIO_ODR_REG(Copy_Port) & (1UL << (Copy_Pin))) ?									\
+															 (GPIO_BRR_REG(Copy_Port) = (1UL << (Copy_Pin))) :									\
+															 (GPIO_BSRR_REG(Copy_Port) = (1UL << (Copy_Pin))))
+
 
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
@@ -340,4 +369,30 @@ ERROR_STATUS_t GPIO_SetPortVal(uint8_t Copy_Port , uint16_t Copy_Value);
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t GPIO_GetPortVal(uint8_t Copy_Port , uint16_t* Copy_pValue);
 
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: SetResetPortPins                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Port                                              */
+/*				   Brief: GPIO port Id on which pins will be set/reset            */
+/*				   Range: (GPIO_PORT_A --> GPIO_PORT_C)                           */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_SetResetMask                                     */
+/*				   Brief: BSRR word, bits [15:0] set and bits [31:16] reset the   */
+/*				          corresponding port pins (set wins if both are           */
+/*				          requested)                                              */
+/*				   Range: (0x00000000 --> 0xFFFFFFFF)                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Sets and resets any group of GPIO port pins with a single      */
+/*                 store to the port bit set/reset register, so all pins change   */
+/*                 on the same bus cycle and other pins of the port are left      */
+/*                 untouched without a read-modify-write                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t GPIO_SetResetPortPins(uint8_t Copy_Port , uint32_t Copy_SetResetMask);
+
 #endif /* GPIO_MCAL_INTERFACE_H_ */
@@ -39,7 +39,7 @@ typedef struct
 	volatile uint32_t LCKR;         /* Port A configuration lock register */
 }GPIOA_t;
 
-#define GPIOA   ((volatile GPIOA_t*)0x40010800)
+#define GPIOA   ((volatile GPIOA_t*)GPIO_PORTA_BASE_ADDRESS)
 
 /* GPIOB */
 typedef struct
@@ -53,7 +53,7 @@ typedef struct
 	volatile uint32_t LCKR;         /* Port B configuration lock register */
 }GPIOB_t;
 
-#define GPIOB   ((volatile GPIOB_t*)0x40010C00)
+#define GPIOB   ((volatile GPIOB_t*)GPIO_PORTB_BASE_ADDRESS)
 
 /* GPIOC */
 typedef struct
@@ -67,7 +67,7 @@ typedef struct
 	volatile uint32_t LCKR;         /* Port C configuration lock register */
 }GPIOC_t;
 
-#define GPIOC   ((volatile GPIOC_t*)0x40011000)
+#define GPIOC   ((volatile GPIOC_t*)GPIO_PORTC_BASE_ADDRESS)
 
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
@@ -592,3 +592,66 @@ ERROR_STATUS_t GPIO_GetPortVal(uint8_t Copy_Port , uint16_t* Copy_pValue)
 
 	return Local_Status;
 }
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: SetResetPortPins                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Port                                              */
+/*				   Brief: GPIO port Id on which pins will be set/reset            */
+/*				   Range: (GPIO_PORT_A --> GPIO_PORT_C)                           */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_SetResetMask                                     */
+/*				   Brief: BSRR word, bits [15:0] set and bits [31:16] reset the   */
+/*				          corresponding port pins (set wins if both are           */
+/*				          requested)                                              */
+/*				   Range: (0x00000000 --> 0xFFFFFFFF)                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Sets and resets any group of GPIO port pins with a single      */
+/*                 store to the port bit set/reset register, so all pins change   */
+/*                 on the same bus cycle and other pins of the port are left      */
+/*                 untouched without a read-modify-write                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t GPIO_SetResetPortPins(uint8_t Copy_Port , uint32_t Copy_SetResetMask)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed port is valid or not */
+	if((Copy_Port >= GPIO_PORT_A && Copy_Port <= GPIO_PORT_C))
+	{
+		/* Check port number */
+		switch(Copy_Port)
+		{
+			case GPIO_PORT_A:
+
+				/* Set/Reset requested pins in one BSRR store */
+				GPIOA->BSRR = Copy_SetResetMask;
+				break;
+
+			case GPIO_PORT_B:
+
+				/* Set/Reset requested pins in one BSRR store */
+				GPIOB->BSRR = Copy_SetResetMask;
+				break;
+
+			case GPIO_PORT_C:
+
+				/* Set/Reset requested pins in one BSRR store */
+				GPIOC->BSRR = Copy_SetResetMask;
+				break;
+		}
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
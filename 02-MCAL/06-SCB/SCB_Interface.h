@@ -34,6 +34,10 @@
 #define SCB_INT_PRIGROUP_G2S8   0b110
 #define SCB_INT_PRIGROUP_G0S16  0b111
 
+/* System Exception Priority Range */
+#define SCB_HIGHEST_PRIORITY	0U
+#define SCB_LOWEST_PRIORITY		15U
+
 
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
@@ -101,4 +105,56 @@ ERROR_STATUS_t SCB_ShiftInterruptVectorTable(uint32_t Copy_VectorTableOffset);
 /*--------------------------------------------------------------------------------*/
 void SCB_PerformSoftReset(void);
 
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: SetPendSVPendingFlag                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Sets PendSV exception pending so that it is taken as soon as   */
+/*                 no higher priority exception is active. Used to defer work     */
+/*                 from interrupts to lowest priority handler                     */
+/*--------------------------------------------------------------------------------*/
+void SCB_SetPendSVPendingFlag(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ClearSystemPendingFlags                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Clears pending state of SysTick and PendSV exceptions, used    */
+/*                 before handing the core over to another image                  */
+/*--------------------------------------------------------------------------------*/
+void SCB_ClearSystemPendingFlags(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: SetPendSVPriority                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Priority                                          */
+/*				   Brief: PendSV exception priority (0 is highest)                */
+/*				   Range: (0 --> 15)                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Sets PendSV exception priority in system handler priority      */
+/*                 register 3 (only upper 4 bits of priority field are            */
+/*                 implemented)                                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t SCB_SetPendSVPriority(uint8_t Copy_Priority);
+
 #endif /* SCB_MCAL_INTERFACE_H_ */
@@ -55,6 +55,14 @@ typedef struct
 /* Some bit definitions of Application interrupt and reset control register (SCB_AIRCR) */
 #define AIRCR_SYSRESETREQ 			2U
 
+/* Some bit definitions of Interrupt control and state register (SCB_ICSR) */
+#define ICSR_PENDSVSET 				28U
+#define ICSR_PENDSVCLR 				27U
+#define ICSR_PENDSTCLR 				25U
+
+/* Some bit definitions of System handler priority register 3 (SCB_SHPR3) */
+#define SHPR3_PRI_14 				20U			/* PendSV implemented priority bits [7:4] of PRI_14 */
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                            		 PRIVATE MACROS					          	     */
@@ -70,4 +78,7 @@ typedef struct
 /* Define Register Key Mask for Application Interrupt and Reset Control Register */
 #define SCB_VECTKEY_MASK				 0x0000FFFFU
 
+/* Define PendSV Priority Field Mask in System Handler Priority Register 3 */
+#define SCB_PENDSV_PRIORITY_MASK		 0xFF00FFFFU
+
 #endif /* SCB_MCAL_PRIVATE_H_ */
@@ -168,3 +168,81 @@ void SCB_PerformSoftReset(void)
 	/* Assign the last value of Local_AIRCR_RegisterClone variable after modification to AIRCR register */
 	SCB->AIRCR = Local_AIRCR_RegisterClone;
 }
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: SetPendSVPendingFlag                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Sets PendSV exception pending so that it is taken as soon as   */
+/*                 no higher priority exception is active. Used to defer work     */
+/*                 from interrupts to lowest priority handler                     */
+/*--------------------------------------------------------------------------------*/
+void SCB_SetPendSVPendingFlag(void)
+{
+	/* Set PendSV exception pending (writing zero to other bits has no effect) */
+	SCB->ICSR = (1UL << ICSR_PENDSVSET);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ClearSystemPendingFlags                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Clears pending state of SysTick and PendSV exceptions, used    */
+/*                 before handing the core over to another image                  */
+/*--------------------------------------------------------------------------------*/
+void SCB_ClearSystemPendingFlags(void)
+{
+	/* Clear SysTick and PendSV pending states (writing zero to other bits has no effect) */
+	SCB->ICSR = (1UL << ICSR_PENDSTCLR) | (1UL << ICSR_PENDSVCLR);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: SetPendSVPriority                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Priority                                          */
+/*				   Brief: PendSV exception priority (0 is highest)                */
+/*				   Range: (0 --> 15)                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Sets PendSV exception priority in system handler priority      */
+/*                 register 3 (only upper 4 bits of priority field are            */
+/*                 implemented)                                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t SCB_SetPendSVPriority(uint8_t Copy_Priority)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed priority is within the valid range */
+	if(Copy_Priority <= SCB_LOWEST_PRIORITY)
+	{
+		/* Clear PendSV priority field then set new priority */
+		SCB->SHPR3 = (SCB->SHPR3 & SCB_PENDSV_PRIORITY_MASK) | ((uint32_t)Copy_Priority << SHPR3_PRI_14);
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
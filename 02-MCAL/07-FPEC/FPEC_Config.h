@@ -21,6 +21,14 @@
 #ifndef FPEC_MCAL_CONFIG_H_
 #define FPEC_MCAL_CONFIG_H_
 
-
+/*-------------------------------------------------------*/
+/* Set depth of asynchronous (interrupt driven) job      */
+/* queue (max number of pending erase/program/verify     */
+/* jobs):                                                */
+/*                                                       */
+/* Options	: - (1 --> 255)                              */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define FPEC_JOB_QUEUE_DEPTH  8U  /* Default: 8U */
 
 #endif /* FPEC_MCAL_CONFIG_H_ */
@@ -21,6 +21,33 @@
 #ifndef FPEC_MCAL_INTERFACE_H_
 #define FPEC_MCAL_INTERFACE_H_
 
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                           	     NEW DATA TYPES			               	         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* FPEC Asynchronous Job Result Type */
+typedef struct
+{
+	uint8_t jobId;						/* Id given to the job by FPEC_SubmitJob */
+	uint8_t jobType;					/* FPEC_JOB_x */
+	ERROR_STATUS_t status;				/* RT_OK or RT_NOK */
+	uint8_t errorFlags;					/* FPEC_JOB_ERROR_x flags that ended the job */
+	uint32_t failAddress;				/* Flash address at which job failed (0 if job succeeded) */
+}FPEC_JobResult_t;
+
+/* FPEC Asynchronous Job Descriptor Type */
+typedef struct
+{
+	uint8_t jobType;					/* FPEC_JOB_PAGE_ERASE, FPEC_JOB_PROGRAM or FPEC_JOB_VERIFY */
+	uint8_t pageNumber;					/* Page to be erased (FPEC_JOB_PAGE_ERASE only) */
+	uint32_t address;					/* First flash address to be programmed or verified (halfword aligned) */
+	const uint16_t* pData;				/* Halfwords to be programmed or compared (must stay valid until job ends) */
+	uint16_t length;					/* Halfword count (1 --> limited to flash size) */
+	void(*notificationFunc)(const FPEC_JobResult_t* Copy_pResult);	/* Called with job result when job ends (NULL if not needed) */
+}FPEC_Job_t;
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                           	    INTERFACE MACROS		                         */
@@ -161,10 +188,24 @@
 #define FPEC_FLASH_FIRST_ADDRESS			   0x08000000U
 #define FPEC_FLASH_LAST_ADDRESS				   0x0801FFFFU
 
+/* Flash Page Size In Bytes */
+#define FPEC_PAGE_SIZE						   1024U
+
 /* Data Option Byte Options */
 #define FPEC_DATA_OPTION_BYTE0				   0U
 #define FPEC_DATA_OPTION_BYTE1                 1U
 
+/* Asynchronous Job Types */
+#define FPEC_JOB_PAGE_ERASE					   0U
+#define FPEC_JOB_PROGRAM					   1U
+#define FPEC_JOB_VERIFY						   2U
+
+/* Asynchronous Job Error Flags (PGERR and WRPRTERR keep their FLASH_SR positions) */
+#define FPEC_JOB_ERROR_NONE					   0x00U
+#define FPEC_JOB_ERROR_VERIFY				   0x01U		/* Read back differs from requested data */
+#define FPEC_JOB_ERROR_PROGRAMMING			   0x04U		/* PGERR: programmed halfword was not erased */
+#define FPEC_JOB_ERROR_WRITE_PROTECTION		   0x10U		/* WRPRTERR: target page is write protected */
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                           	  FUNCTIONS PROTOTYPES		          	             */
@@ -186,6 +227,9 @@
 /*--------------------------------------------------------------------------------*/
 /* @Description	 : This function erases a full page on flash memory based on its  */
 /* 				   passed number									        	  */
+/*                 Returns RT_NOK if erase raises PGERR or WRPRTERR               */
+/*                 Returns BUSY_FUNC while asynchronous jobs are queued           */
+/*                 Returns RT_NOK outside a flash session (FPEC_BeginSession)     */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t FPEC_FlashPageErase(uint8_t Copy_PageNumber);
 
@@ -209,6 +253,8 @@ ERROR_STATUS_t FPEC_FlashPageErase(uint8_t Copy_PageNumber);
 /*--------------------------------------------------------------------------------*/
 /* @Description	 : This function erases a full bank on flash memory based on	  */
 /* 				   passed start page number	and bank size				       	  */
+/*                 Returns BUSY_FUNC while asynchronous jobs are queued           */
+/*                 Returns RT_NOK outside a flash session (FPEC_BeginSession)     */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t FPEC_EraseBankArea(uint8_t Copy_PageNumber , uint32_t Copy_BankSize);
 
@@ -235,7 +281,10 @@ ERROR_STATUS_t FPEC_EraseBankArea(uint8_t Copy_PageNumber , uint32_t Copy_BankSi
 /* @Return		 : ERROR_STATUS_t												  */
 /*--------------------------------------------------------------------------------*/
 /* @Description	 : This function writes a hex record on flash based on its		  */
-/*				   passed address, data and length in halfwords					  */
+/*				   passed address, data and length in halfwords	in one			  */
+/*				   programming session, each halfword is verified by read back	  */
+/*                 Returns BUSY_FUNC while asynchronous jobs are queued           */
+/*                 Returns RT_NOK outside a flash session (FPEC_BeginSession)     */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t FPEC_FlashWriteHexRecord(uint32_t Copy_Address, uint16_t* Copy_pData, uint8_t Copy_Length);
 
@@ -257,6 +306,8 @@ ERROR_STATUS_t FPEC_FlashWriteHexRecord(uint32_t Copy_Address, uint16_t* Copy_pD
 /* @Return		 : ERROR_STATUS_t												  */
 /*--------------------------------------------------------------------------------*/
 /* @Description	 : This function stores a value in selected Data option byte	  */
+/*                 Returns BUSY_FUNC while asynchronous jobs are queued           */
+/*                 Returns RT_NOK outside a flash session (FPEC_BeginSession)     */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t FPEC_WriteDataOptionByte(uint8_t Copy_DataOptionByte, uint8_t Copy_Value);
 
@@ -294,7 +345,202 @@ ERROR_STATUS_t FPEC_GetDataOptionByte(uint8_t Copy_DataOptionByte, uint8_t* Copy
 /* @Return		 : ERROR_STATUS_t                                          		  */
 /*--------------------------------------------------------------------------------*/
 /* @Description	 : This function performs mass erase on flash memory  			  */
+/*                 Returns BUSY_FUNC while asynchronous jobs are queued           */
+/*                 Returns RT_NOK outside a flash session (FPEC_BeginSession)     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_FlashMassErase(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: BufferWrite                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint32_t Copy_Address                                          */
+/*				   Brief: Flash address of the first halfword to be staged        */
+/*				          (halfword aligned)                                      */
+/*				   Range: Limited to flash size (FPEC_FLASH_FIRST_ADDRESS -->     */
+/*				          FPEC_FLASH_LAST_ADDRESS)                                */
+/*				   -------------------------------------------------------------- */
+/*                 const uint16_t* Copy_pData                                     */
+/*				   Brief: Array of halfwords to be staged                         */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint16_t Copy_Length                                           */
+/*				   Brief: Halfword count in data array                            */
+/*				   Range: Limited to flash size                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gathers halfwords writes in a page sized RAM     */
+/*                 staging buffer instead of programming flash directly. When a   */
+/*                 write crosses into another page the staged page is committed   */
+/*                 first (FPEC_BufferFlush) then the new page is loaded into the  */
+/*                 buffer                                                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_BufferWrite(uint32_t Copy_Address, const uint16_t* Copy_pData, uint16_t Copy_Length);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: BufferFlush                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function commits the staged page to flash. The page is    */
+/*                 erased only if a staged halfword cannot be programmed over its */
+/*                 current flash content, halfwords that already match are        */
+/*                 skipped and the rest are programmed in one programming session */
+/*                 with read back verification. On failure the staged page is     */
+/*                 kept so the commit can be retried                              */
+/*                 Returns BUSY_FUNC while asynchronous jobs are queued           */
+/*                 Returns RT_NOK outside a flash session (FPEC_BeginSession)     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_BufferFlush(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: BufferDiscard                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function drops the staged page without writing it to      */
+/*                 flash                                                          */
+/*--------------------------------------------------------------------------------*/
+void FPEC_BufferDiscard(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetWriteStatistics                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pEraseCount                                     */
+/*				   Brief: Pointer to variable in which count of page erases will  */
+/*				          be stored                                               */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pProgramCount                                   */
+/*				   Brief: Pointer to variable in which count of programmed        */
+/*				          halfwords will be stored                                */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pSkipCount                                      */
+/*				   Brief: Pointer to variable in which count of skipped (already  */
+/*				          matching) halfwords will be stored                      */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gets the flash wear statistics counted since     */
+/*                 reset                                                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_GetWriteStatistics(uint32_t* Copy_pEraseCount, uint32_t* Copy_pProgramCount, uint32_t* Copy_pSkipCount);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: SubmitJob                                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const FPEC_Job_t* Copy_pJob                                    */
+/*				   Brief: Pointer to job descriptor (copied into the queue)       */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pJobId                                           */
+/*				   Brief: Pointer to variable in which id of the queued job will  */
+/*				          be stored (reported back in job result)                 */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function appends an erase, program or verify job to the   */
+/*                 asynchronous job queue and returns at once. The job runs in    */
+/*                 the background: each flash operation is started then its end   */
+/*                 of operation (or error) interrupt advances the queue, so FLASH */
+/*                 interrupt must be enabled on NVIC. Job notification function   */
+/*                 is called with job result when it ends (from FLASH IRQ, or     */
+/*                 from the context that finds the queue idle for a job that      */
+/*                 needs no flash operation). Note that CPU still stalls if it    */
+/*                 fetches from flash while an operation is running, so code that */
+/*                 must keep running during erase should execute from RAM.        */
+/*                 Returns BUSY_FUNC if queue is full                             */
+/*                 Returns RT_NOK outside a flash session (FPEC_BeginSession)     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_SubmitJob(const FPEC_Job_t* Copy_pJob, uint8_t* Copy_pJobId);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetJobStatus                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pPendingJobs                                     */
+/*				   Brief: Pointer to variable in which number of queued jobs      */
+/*				          (including the running one) will be stored              */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 FPEC_JobResult_t* Copy_pLastResult                             */
+/*				   Brief: Pointer to variable in which result of last ended job   */
+/*				          will be stored                                          */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gets asynchronous job queue status for callers   */
+/*                 that poll instead of using notification functions              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_GetJobStatus(uint8_t* Copy_pPendingJobs, FPEC_JobResult_t* Copy_pLastResult);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: BeginSession                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function opens a flash session: the flash controller is   */
+/*                 unlocked once (KEYR sequence is written only if it is really   */
+/*                 locked) and stays unlocked for a batch of erase and program    */
+/*                 operations. Flash can only be written inside a session.        */
+/*                 Sessions can be nested (an ECUAL driver may open its own       */
+/*                 session inside an application session), only the outermost one */
+/*                 unlocks and locks the controller                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_BeginSession(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: EndSession                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function closes a flash session opened by                 */
+/*                 FPEC_BeginSession. Closing the outermost session locks the     */
+/*                 flash controller again, if asynchronous jobs are still queued  */
+/*                 the controller is locked as soon as they end. Returns RT_NOK   */
+/*                 if no session is open                                          */
 /*--------------------------------------------------------------------------------*/
-void FPEC_FlashMassErase(void);
+ERROR_STATUS_t FPEC_EndSession(void);
 
 #endif /* FPEC_MCAL_INTERFACE_H_ */
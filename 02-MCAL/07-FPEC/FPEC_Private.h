@@ -82,4 +82,57 @@ typedef struct
 #define FPEC_DATA_OPTION_BYTE0_MASK 		0x0003FC00U
 #define FPEC_DATA_OPTION_BYTE1_MASK 		0x03FC0000U
 
+/* Flash Page Geometry */
+#define FPEC_PAGE_SHIFT						10U
+#define FPEC_PAGE_OFFSET_MASK				0x000003FFU
+#define FPEC_PAGE_HALFWORDS					512U
+
+/* Value of an erased flash halfword */
+#define FPEC_ERASED_HALFWORD				0xFFFFU
+
+/* Flash status register masks */
+#define FPEC_SR_ERRORS_MASK					((1UL << SR_PGERR) | (1UL << SR_WRPRTERR))
+#define FPEC_SR_CLEAR_FLAGS_MASK			((1UL << SR_PGERR) | (1UL << SR_WRPRTERR) | (1UL << SR_EOP))
+
+/* Check if a halfword needs its page to be erased before it can hold the new value,
+ * the FPEC only programs erased halfwords (0xFFFF) except when writing 0x0000 */
+#define FPEC_HALFWORD_NEEDS_ERASE(FLASH_VALUE,NEW_VALUE)	(((FLASH_VALUE) != (NEW_VALUE)) && \
+															 ((FLASH_VALUE) != FPEC_ERASED_HALFWORD) && \
+															 ((NEW_VALUE) != 0x0000U))
+
+/* Max number of nested flash sessions */
+#define FPEC_MAX_SESSION_DEPTH				255U
+
+/* Flash end of operation and error interrupts used to advance asynchronous jobs */
+#define FPEC_JOB_INTERRUPTS_MASK			((1UL << CR_EOPIE) | (1UL << CR_ERRIE))
+
+/* Critical section macros are Cortex-M3 specific, a host build (05-TEST) defines its own before this header */
+#ifndef FPEC_ENTER_CRITICAL_SECTION
+
+/* Save PRIMASK then mask configurable interrupts (job queue is shared with FLASH IRQ) */
+#define FPEC_ENTER_CRITICAL_SECTION(Copy_PrimaskState)		__asm volatile("MRS %0, PRIMASK\n\tCPSID I" : "=r"(Copy_PrimaskState) : : "memory")
+
+/* Restore PRIMASK saved by FPEC_ENTER_CRITICAL_SECTION */
+#define FPEC_EXIT_CRITICAL_SECTION(Copy_PrimaskState)		__asm volatile("MSR PRIMASK, %0" : : "r"(Copy_PrimaskState) : "memory")
+
+#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                              PRIVATE DATA TYPES		       		    		     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* FPEC Asynchronous Job Queue State Type (Jobs ring itself is defined with public job descriptor type) */
+typedef struct
+{
+	uint8_t Head;						/* Index of job currently running */
+	uint8_t Tail;						/* Index of next free job slot */
+	volatile uint8_t Count;				/* Number of queued jobs (including the running one) */
+	volatile uint8_t Owned;				/* Queue is being advanced (by jobs or a blocking function), submitters only enqueue */
+	volatile uint8_t OperationPending;	/* A flash operation of head job is running and its interrupt is awaited */
+	uint8_t NextJobId;					/* Id to be given to next submitted job */
+	uint16_t Progress;					/* Halfwords of head program job already handled */
+}FPEC_JobQueueState_t;
+
 #endif /* FPEC_MCAL_PRIVATE_H_ */
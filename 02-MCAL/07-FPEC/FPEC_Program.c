@@ -31,6 +31,37 @@
 #include "FPEC_Config.h"
 #include "FPEC_Interface.h"
 
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                           PRIVATE FUNCTIONS PROTOTYPES		          	         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static ERROR_STATUS_t FPEC_ProgramSession(uint32_t Copy_Address, const uint16_t* Copy_pData, uint16_t Copy_Length);
+static ERROR_STATUS_t FPEC_ClaimController(void);
+static void FPEC_ReleaseController(void);
+static void FPEC_JobAdvance(void);
+static uint8_t FPEC_JobStartOperation(void);
+static void FPEC_JobComplete(ERROR_STATUS_t Copy_Status, uint8_t Copy_ErrorFlags, uint32_t Copy_FailAddress);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS		                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static uint16_t Global_PageBuffer[FPEC_PAGE_HALFWORDS];		/* RAM staging copy of the buffered flash page */
+static uint8_t  Global_BufferPage = 0;							/* Number of flash page held by the staging buffer */
+static uint8_t  Global_BufferLoaded = 0;						/* Flag that indicates staging buffer holds a flash page */
+static uint8_t  Global_BufferDirty = 0;						/* Flag that indicates staging buffer differs from flash */
+static uint32_t Global_EraseCount = 0;							/* Count of page erases since reset */
+static uint32_t Global_ProgramCount = 0;						/* Count of programmed halfwords since reset */
+static uint32_t Global_SkipCount = 0;							/* Count of skipped (already matching) halfwords since reset */
+static FPEC_Job_t Global_JobQueue[FPEC_JOB_QUEUE_DEPTH];			/* Asynchronous jobs ring */
+static uint8_t Global_JobIds[FPEC_JOB_QUEUE_DEPTH];				/* Ids of queued asynchronous jobs */
+static FPEC_JobQueueState_t Global_JobQueueState = {0};			/* Asynchronous job queue state */
+static FPEC_JobResult_t Global_LastJobResult = {0};				/* Result of last ended asynchronous job */
+static uint8_t Global_SessionDepth = 0;						/* Number of open (nested) flash sessions */
+static uint8_t Global_ControllerUnlocked = 0;					/* Flag that indicates flash controller is unlocked (KEYR sequence written) */
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                             FUNCTIONS IMPLEMENTATIONS		                     */
@@ -52,6 +83,9 @@
 /*--------------------------------------------------------------------------------*/
 /* @Description	 : This function erases a full page on flash memory based on its  */
 /* 				   passed number									        	  */
+/*                 Returns RT_NOK if erase raises PGERR or WRPRTERR               */
+/*                 Returns BUSY_FUNC while asynchronous jobs are queued           */
+/*                 Returns RT_NOK outside a flash session (FPEC_BeginSession)     */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t FPEC_FlashPageErase(uint8_t Copy_PageNumber)
 {
@@ -61,32 +95,49 @@ ERROR_STATUS_t FPEC_FlashPageErase(uint8_t Copy_PageNumber)
 	/* Check if passed page number is within its valid range */
 	if(Copy_PageNumber >= FPEC_PAGE_0 && Copy_PageNumber <= FPEC_PAGE_127)
 	{
-		/* Wait for Busy Flag */
-		while (GET_BIT(FPEC->SR,SR_BSY) == 1);
+		/* Take the flash controller (asynchronous jobs must not be running) */
+		Local_Status = FPEC_ClaimController();
 
-		/* Check if FPEC is locked or not */
-		if (GET_BIT(FPEC->CR,CR_LOCK) == 1)
+		/* Check if flash controller is taken */
+		if(Local_Status == RT_OK)
 		{
-			/* Unlock FPEC */
-			FPEC -> KEYR = FPEC_UNLOCK_KEY1;
-			FPEC -> KEYR = FPEC_UNLOCK_KEY2;
-		}
+			/* Wait for Busy Flag */
+			while (GET_BIT(FPEC->SR,SR_BSY) == 1);
 
-		/* Page Erase Operation */
-		SET_BIT(FPEC->CR,CR_PER);
+			/* Clear flags left by previous operations */
+			FPEC -> SR = FPEC_SR_CLEAR_FLAGS_MASK;
 
-		/* Write page address to be erased */
-		FPEC->AR = (uint32_t)(Copy_PageNumber * 1024) + FPEC_FLASH_FIRST_ADDRESS ;
+			/* Page Erase Operation */
+			SET_BIT(FPEC->CR,CR_PER);
 
-		/* Start operation */
-		SET_BIT(FPEC->CR,CR_STRT);
+			/* Write page address to be erased */
+			FPEC->AR = (uint32_t)(Copy_PageNumber * 1024) + FPEC_FLASH_FIRST_ADDRESS ;
 
-		/* Wait for Busy Flag */
-		while (GET_BIT(FPEC->SR,SR_BSY) == 1);
+			/* Start operation */
+			SET_BIT(FPEC->CR,CR_STRT);
 
-		/* End of Page Erasing Operation */
-		SET_BIT(FPEC->SR,SR_EOP);
-		CLEAR_BIT(FPEC->CR,CR_PER);
+			/* Wait for Busy Flag */
+			while (GET_BIT(FPEC->SR,SR_BSY) == 1);
+
+			/* Check PGERR and WRPRTERR (e.g. write protected page is left as it is) */
+			if((FPEC->SR & FPEC_SR_ERRORS_MASK) != 0)
+			{
+				/* Function is not behaving as expected */
+				Local_Status = RT_NOK;
+			}
+			else
+			{
+				/* Count page erases (flash wear) */
+				Global_EraseCount++;
+			}
+
+			/* End of Page Erasing Operation */
+			FPEC -> SR = FPEC_SR_CLEAR_FLAGS_MASK;
+			CLEAR_BIT(FPEC->CR,CR_PER);
+
+			/* Give back the flash controller */
+			FPEC_ReleaseController();
+		}
 	}
 	else
 	{
@@ -117,6 +168,8 @@ ERROR_STATUS_t FPEC_FlashPageErase(uint8_t Copy_PageNumber)
 /*--------------------------------------------------------------------------------*/
 /* @Description	 : This function erases a full bank on flash memory based on	  */
 /* 				   passed start page number	and bank size				       	  */
+/*                 Returns BUSY_FUNC while asynchronous jobs are queued           */
+/*                 Returns RT_NOK outside a flash session (FPEC_BeginSession)     */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t FPEC_EraseBankArea(uint8_t Copy_PageNumber , uint32_t Copy_BankSize)
 {
@@ -128,11 +181,11 @@ ERROR_STATUS_t FPEC_EraseBankArea(uint8_t Copy_PageNumber , uint32_t Copy_BankSi
 	if((Copy_PageNumber >= FPEC_PAGE_0 && Copy_PageNumber <= FPEC_PAGE_127) &&
 	   (Copy_BankSize >= 0 && Copy_BankSize <= 4294967295))
 	{
-		/* Traverse over each page in the bank then erase it until you reach the bank end */
-		for (Local_PageCounter = 0 ; Local_PageCounter < Copy_BankSize ; Local_PageCounter++)
+		/* Traverse over each page in the bank then erase it until you reach the bank end or an erase fails */
+		for (Local_PageCounter = 0 ; (Local_Status == RT_OK) && (Local_PageCounter < Copy_BankSize) ; Local_PageCounter++)
 		{
 			/* Erase a page in flash memory */
-			FPEC_FlashPageErase((uint8_t)(Local_PageCounter + Copy_PageNumber));
+			Local_Status = FPEC_FlashPageErase((uint8_t)(Local_PageCounter + Copy_PageNumber));
 		}
 	}
 	else
@@ -167,13 +220,15 @@ ERROR_STATUS_t FPEC_EraseBankArea(uint8_t Copy_PageNumber , uint32_t Copy_BankSi
 /* @Return		 : ERROR_STATUS_t												  */
 /*--------------------------------------------------------------------------------*/
 /* @Description	 : This function writes a hex record on flash based on its		  */
-/*				   passed address, data and length in halfwords					  */
+/*				   passed address, data and length in halfwords	in one			  */
+/*				   programming session, each halfword is verified by read back	  */
+/*                 Returns BUSY_FUNC while asynchronous jobs are queued           */
+/*                 Returns RT_NOK outside a flash session (FPEC_BeginSession)     */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t FPEC_FlashWriteHexRecord(uint32_t Copy_Address, uint16_t* Copy_pData, uint8_t Copy_Length)
 {
 	/* Local Variables Definitions */
 	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
-	uint8_t Local_HalfWordCounter;						/* Variable to hold counts of halfwords in data hex record */
 
 	/* Check if passed pointer (array) is NULL pointer or not */
 	if(Copy_pData != NULL)
@@ -182,33 +237,8 @@ ERROR_STATUS_t FPEC_FlashWriteHexRecord(uint32_t Copy_Address, uint16_t* Copy_pD
 		if((Copy_Address >= FPEC_FLASH_FIRST_ADDRESS && Copy_Address <= FPEC_FLASH_LAST_ADDRESS) &&
 		   (Copy_Length >= 0 && Copy_Length <= 255))
 		{
-			/* Wait for Busy Flag */
-			while (GET_BIT(FPEC->SR,SR_BSY) == 1);
-
-			/* Check if FPEC is locked or not */
-			if (GET_BIT(FPEC->CR,CR_LOCK) == 1)
-			{
-				/* Unlock FPEC */
-				FPEC -> KEYR = FPEC_UNLOCK_KEY1;
-				FPEC -> KEYR = FPEC_UNLOCK_KEY2;
-			}
-
-			for (Local_HalfWordCounter = 0; Local_HalfWordCounter < Copy_Length; Local_HalfWordCounter++)
-			{
-				/* Write Flash Programming */
-				SET_BIT(FPEC->CR,CR_PG);
-
-				/* Half word flash programming operation */
-				*((volatile uint16_t*)Copy_Address) = Copy_pData[Local_HalfWordCounter];
-				Copy_Address += 2;
-
-				/* Wait for Busy Flag */
-				while (GET_BIT(FPEC->SR,SR_BSY) == 1);
-
-				/* End of Flash Programming Operation */
-				SET_BIT(FPEC->SR,SR_EOP);
-				CLEAR_BIT(FPEC->CR,CR_PG);
-			}
+			/* Program all halfwords of the record in one programming session with read back */
+			Local_Status = FPEC_ProgramSession(Copy_Address, Copy_pData, (uint16_t)Copy_Length);
 		}
 		else
 		{
@@ -243,6 +273,8 @@ ERROR_STATUS_t FPEC_FlashWriteHexRecord(uint32_t Copy_Address, uint16_t* Copy_pD
 /* @Return		 : ERROR_STATUS_t												  */
 /*--------------------------------------------------------------------------------*/
 /* @Description	 : This function stores a value in selected Data option byte	  */
+/*                 Returns BUSY_FUNC while asynchronous jobs are queued           */
+/*                 Returns RT_NOK outside a flash session (FPEC_BeginSession)     */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t FPEC_WriteDataOptionByte(uint8_t Copy_DataOptionByte, uint8_t Copy_Value)
 {
@@ -253,62 +285,64 @@ ERROR_STATUS_t FPEC_WriteDataOptionByte(uint8_t Copy_DataOptionByte, uint8_t Cop
 	if ((Copy_DataOptionByte == FPEC_DATA_OPTION_BYTE0 || Copy_DataOptionByte == FPEC_DATA_OPTION_BYTE1) &&
 		(Copy_Value >= 0 && Copy_Value <= 255))
 	{
-		/* Wait for Busy Flag */
-		while (GET_BIT(FPEC->SR,SR_BSY) == 1);
+		/* Take the flash controller (asynchronous jobs must not be running) */
+		Local_Status = FPEC_ClaimController();
 
-		/* Check if FPEC is locked or not */
-		if (GET_BIT(FPEC->CR,CR_LOCK) == 1)
+		/* Check if flash controller is taken */
+		if(Local_Status == RT_OK)
 		{
-			/* Unlock FPEC */
-			FPEC -> KEYR = FPEC_UNLOCK_KEY1;
-			FPEC -> KEYR = FPEC_UNLOCK_KEY2;
-		}
+			/* Wait for Busy Flag */
+			while (GET_BIT(FPEC->SR,SR_BSY) == 1);
 
-		/* Unlock Option Bytes Programming */
-		FPEC -> OPTKEYR = FPEC_UNLOCK_KEY1;
-		FPEC -> OPTKEYR = FPEC_UNLOCK_KEY2;
+			/* Unlock Option Bytes Programming */
+			FPEC -> OPTKEYR = FPEC_UNLOCK_KEY1;
+			FPEC -> OPTKEYR = FPEC_UNLOCK_KEY2;
 
-		/* Enable Option Bytes Programming */
-		SET_BIT(FPEC->CR,CR_OPTWRE);
+			/* Enable Option Bytes Programming */
+			SET_BIT(FPEC->CR,CR_OPTWRE);
 
-		/* Erase Option Bytes */
-		SET_BIT(FPEC->CR,CR_OPTER);
-		SET_BIT(FPEC->CR,CR_STRT);
+			/* Erase Option Bytes */
+			SET_BIT(FPEC->CR,CR_OPTER);
+			SET_BIT(FPEC->CR,CR_STRT);
 
-		/* Wait for Busy Flag */
-		while (GET_BIT(FPEC->SR,SR_BSY) == 1);
+			/* Wait for Busy Flag */
+			while (GET_BIT(FPEC->SR,SR_BSY) == 1);
 
-		/* End of Option Bytes Erase Operation */
-		SET_BIT(FPEC->SR,SR_EOP);
-		CLEAR_BIT(FPEC->CR,CR_OPTER);
+			/* End of Option Bytes Erase Operation */
+			SET_BIT(FPEC->SR,SR_EOP);
+			CLEAR_BIT(FPEC->CR,CR_OPTER);
 
-		/* Program Option Bytes */
-		SET_BIT(FPEC->CR,CR_OPTPG);
+			/* Program Option Bytes */
+			SET_BIT(FPEC->CR,CR_OPTPG);
 
-		/* Unlock read protection */
-		*(volatile uint16_t*)(0x1FFFF800) = FPEC_READ_PROTECTION_UNLOCK_KEY;
+			/* Unlock read protection */
+			*(volatile uint16_t*)(0x1FFFF800) = FPEC_READ_PROTECTION_UNLOCK_KEY;
 
-		/* Wait for Busy Flag */
-		while (GET_BIT(FPEC->SR,SR_BSY) == 1);
+			/* Wait for Busy Flag */
+			while (GET_BIT(FPEC->SR,SR_BSY) == 1);
 
-		/* Check passed option byte Id */
-		if(Copy_DataOptionByte == FPEC_DATA_OPTION_BYTE0)
-		{
-			/* Set Data Option Byte0 */
-			FPEC_DATA_OPTION_BYTE0_LOCATION = (uint16_t)Copy_Value;
-		}
-		else
-		{
-			/* Set Data Option Byte1 */
-			FPEC_DATA_OPTION_BYTE1_LOCATION = (uint16_t)Copy_Value;
-		}
+			/* Check passed option byte Id */
+			if(Copy_DataOptionByte == FPEC_DATA_OPTION_BYTE0)
+			{
+				/* Set Data Option Byte0 */
+				FPEC_DATA_OPTION_BYTE0_LOCATION = (uint16_t)Copy_Value;
+			}
+			else
+			{
+				/* Set Data Option Byte1 */
+				FPEC_DATA_OPTION_BYTE1_LOCATION = (uint16_t)Copy_Value;
+			}
 
-		/* Wait for Busy Flag */
-		while (GET_BIT(FPEC->SR,SR_BSY) == 1);
+			/* Wait for Busy Flag */
+			while (GET_BIT(FPEC->SR,SR_BSY) == 1);
 
-		/* End of Option Bytes Programming Operation */
-		SET_BIT(FPEC->SR,SR_EOP);
-		CLEAR_BIT(FPEC->CR,CR_OPTPG);
+			/* End of Option Bytes Programming Operation */
+			SET_BIT(FPEC->SR,SR_EOP);
+			CLEAR_BIT(FPEC->CR,CR_OPTPG);
+
+			/* Give back the flash controller */
+			FPEC_ReleaseController();
+		}
 	}
 	else
 	{
@@ -391,29 +425,1057 @@ ERROR_STATUS_t FPEC_GetDataOptionByte(uint8_t Copy_DataOptionByte, uint8_t* Copy
 /* @Return		 : ERROR_STATUS_t                                          		  */
 /*--------------------------------------------------------------------------------*/
 /* @Description	 : This function performs mass erase on flash memory  			  */
+/*                 Returns BUSY_FUNC while asynchronous jobs are queued           */
+/*                 Returns RT_NOK outside a flash session (FPEC_BeginSession)     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_FlashMassErase(void)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status;						/* Variable to hold status of the function */
+
+	/* Take the flash controller (asynchronous jobs must not be running) */
+	Local_Status = FPEC_ClaimController();
+
+	/* Check if flash controller is taken */
+	if(Local_Status == RT_OK)
+	{
+		/* Wait for Busy Flag */
+		while (GET_BIT(FPEC->SR,SR_BSY) == 1);
+
+		/* Mass Erase Operation */
+		SET_BIT(FPEC->CR,CR_MER);
+
+		/* Start operation */
+		SET_BIT(FPEC->CR,CR_STRT);
+
+		/* Wait for Busy Flag */
+		while (GET_BIT(FPEC->SR,SR_BSY) == 1);
+
+		/* End of Page Erasing Operation */
+		SET_BIT(FPEC->SR,SR_EOP);
+		CLEAR_BIT(FPEC->CR,CR_MER);
+		/* Give back the flash controller */
+		FPEC_ReleaseController();
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: BufferWrite                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint32_t Copy_Address                                          */
+/*				   Brief: Flash address of the first halfword to be staged        */
+/*				          (halfword aligned)                                      */
+/*				   Range: Limited to flash size (FPEC_FLASH_FIRST_ADDRESS -->     */
+/*				          FPEC_FLASH_LAST_ADDRESS)                                */
+/*				   -------------------------------------------------------------- */
+/*                 const uint16_t* Copy_pData                                     */
+/*				   Brief: Array of halfwords to be staged                         */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint16_t Copy_Length                                           */
+/*				   Brief: Halfword count in data array                            */
+/*				   Range: Limited to flash size                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gathers halfwords writes in a page sized RAM     */
+/*                 staging buffer instead of programming flash directly. When a   */
+/*                 write crosses into another page the staged page is committed   */
+/*                 first (FPEC_BufferFlush) then the new page is loaded into the  */
+/*                 buffer                                                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_BufferWrite(uint32_t Copy_Address, const uint16_t* Copy_pData, uint16_t Copy_Length)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	uint16_t Local_HalfWordCounter = 0;					/* Variable to hold counts of staged halfwords */
+	uint16_t Local_PageCounter;							/* Variable to hold counts of halfwords of loaded page */
+	uint16_t Local_Offset;								/* Halfword offset of current address inside its page */
+	uint8_t Local_PageNumber;							/* Number of flash page of current address */
+
+	/* Check if passed pointer (array) is NULL pointer or not */
+	if(Copy_pData != NULL)
+	{
+		/* Check if passed flash address (halfword aligned) and length are within their valid ranges */
+		if((Copy_Address >= FPEC_FLASH_FIRST_ADDRESS && Copy_Address <= FPEC_FLASH_LAST_ADDRESS) &&
+		   (GET_BIT(Copy_Address,0) == 0) && (Copy_Length > 0) &&
+		   ((uint32_t)Copy_Length * 2U <= (FPEC_FLASH_LAST_ADDRESS - Copy_Address + 1U)))
+		{
+			/* Stage halfwords one by one until all are staged or a page commit fails */
+			while((Local_Status == RT_OK) && (Local_HalfWordCounter < Copy_Length))
+			{
+				/* Get page of current address */
+				Local_PageNumber = (uint8_t)((Copy_Address - FPEC_FLASH_FIRST_ADDRESS) >> FPEC_PAGE_SHIFT);
+
+				/* Check if staging buffer holds another page */
+				if((Global_BufferLoaded == 1) && (Local_PageNumber != Global_BufferPage))
+				{
+					/* Commit the staged page before moving to the new one */
+					Local_Status = FPEC_BufferFlush();
+				}
+
+				/* Check if staging buffer is ready for current page */
+				if(Local_Status == RT_OK)
+				{
+					/* Check if staging buffer is empty */
+					if(Global_BufferLoaded == 0)
+					{
+						/* Load current flash content of the page into the staging buffer */
+						for(Local_PageCounter = 0 ; Local_PageCounter < FPEC_PAGE_HALFWORDS ; Local_PageCounter++)
+						{
+							Global_PageBuffer[Local_PageCounter] = ((volatile uint16_t*)(FPEC_FLASH_FIRST_ADDRESS +
+																   ((uint32_t)Local_PageNumber << FPEC_PAGE_SHIFT)))[Local_PageCounter];
+						}
+
+						/* Staging buffer now mirrors the page */
+						Global_BufferPage = Local_PageNumber;
+						Global_BufferLoaded = 1;
+						Global_BufferDirty = 0;
+					}
+
+					/* Get halfword offset inside the page */
+					Local_Offset = (uint16_t)((Copy_Address & FPEC_PAGE_OFFSET_MASK) >> 1);
+
+					/* Check if staged halfword changes */
+					if(Global_PageBuffer[Local_Offset] != Copy_pData[Local_HalfWordCounter])
+					{
+						/* Stage the new halfword value */
+						Global_PageBuffer[Local_Offset] = Copy_pData[Local_HalfWordCounter];
+						Global_BufferDirty = 1;
+					}
+
+					/* Move to next halfword */
+					Copy_Address += 2;
+					Local_HalfWordCounter++;
+				}
+			}
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: BufferFlush                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function commits the staged page to flash. The page is    */
+/*                 erased only if a staged halfword cannot be programmed over its */
+/*                 current flash content, halfwords that already match are        */
+/*                 skipped and the rest are programmed in one programming session */
+/*                 with read back verification. On failure the staged page is     */
+/*                 kept so the commit can be retried                              */
+/*                 Returns BUSY_FUNC while asynchronous jobs are queued           */
+/*                 Returns RT_NOK outside a flash session (FPEC_BeginSession)     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_BufferFlush(void)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	uint32_t Local_PageAddress;							/* Flash address of the staged page */
+	uint16_t Local_HalfWordCounter = 0;					/* Variable to hold counts of halfwords in staged page */
+	uint8_t Local_EraseRequired = 0;					/* Flag that indicates staged page can't be programmed without erase */
+
+	/* Check if staging buffer holds changes that are not written to flash yet */
+	if((Global_BufferLoaded == 1) && (Global_BufferDirty == 1))
+	{
+		/* Get flash address of the staged page */
+		Local_PageAddress = FPEC_FLASH_FIRST_ADDRESS + ((uint32_t)Global_BufferPage << FPEC_PAGE_SHIFT);
+
+		/* Scan the page for any halfword that can't be programmed over its current flash content */
+		while((Local_EraseRequired == 0) && (Local_HalfWordCounter < FPEC_PAGE_HALFWORDS))
+		{
+			/* Check if halfword needs an erase */
+			if(FPEC_HALFWORD_NEEDS_ERASE(((volatile uint16_t*)Local_PageAddress)[Local_HalfWordCounter] ,
+										 Global_PageBuffer[Local_HalfWordCounter]))
+			{
+				/* Page must be erased before programming */
+				Local_EraseRequired = 1;
+			}
+
+			/* Move to next halfword */
+			Local_HalfWordCounter++;
+		}
+
+		/* Check if page erase is required */
+		if(Local_EraseRequired == 1)
+		{
+			/* Erase the page, erased halfwords that are staged as 0xFFFF will be skipped while programming */
+			Local_Status = FPEC_FlashPageErase(Global_BufferPage);
+		}
+
+		/* Check if page is ready for programming */
+		if(Local_Status == RT_OK)
+		{
+			/* Program changed halfwords of the page in one programming session */
+			Local_Status = FPEC_ProgramSession(Local_PageAddress, Global_PageBuffer, FPEC_PAGE_HALFWORDS);
+		}
+	}
+
+	/* Check if staged page is committed (staged page is kept on failure to retry commit) */
+	if(Local_Status == RT_OK)
+	{
+		/* Release the staging buffer */
+		Global_BufferLoaded = 0;
+		Global_BufferDirty = 0;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: BufferDiscard                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function drops the staged page without writing it to      */
+/*                 flash                                                          */
+/*--------------------------------------------------------------------------------*/
+void FPEC_BufferDiscard(void)
+{
+	/* Release the staging buffer without writing it */
+	Global_BufferLoaded = 0;
+	Global_BufferDirty = 0;
+}
+
 /*--------------------------------------------------------------------------------*/
-void FPEC_FlashMassErase(void)
+/* @Function Name: GetWriteStatistics                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pEraseCount                                     */
+/*				   Brief: Pointer to variable in which count of page erases will  */
+/*				          be stored                                               */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pProgramCount                                   */
+/*				   Brief: Pointer to variable in which count of programmed        */
+/*				          halfwords will be stored                                */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t* Copy_pSkipCount                                      */
+/*				   Brief: Pointer to variable in which count of skipped (already  */
+/*				          matching) halfwords will be stored                      */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gets the flash wear statistics counted since     */
+/*                 reset                                                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_GetWriteStatistics(uint32_t* Copy_pEraseCount, uint32_t* Copy_pProgramCount, uint32_t* Copy_pSkipCount)
 {
-	/* Wait for Busy Flag */
-	while (GET_BIT(FPEC->SR,SR_BSY) == 1);
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
 
-	/* Check if FPEC is locked or not */
-	if (GET_BIT(FPEC->CR,CR_LOCK) == 1)
+	/* Check if passed pointers are NULL pointers or not */
+	if((Copy_pEraseCount != NULL) && (Copy_pProgramCount != NULL) && (Copy_pSkipCount != NULL))
+	{
+		/* Get flash wear statistics */
+		*Copy_pEraseCount = Global_EraseCount;
+		*Copy_pProgramCount = Global_ProgramCount;
+		*Copy_pSkipCount = Global_SkipCount;
+	}
+	else
 	{
-		FPEC -> KEYR = FPEC_UNLOCK_KEY1;
-		FPEC -> KEYR = FPEC_UNLOCK_KEY2;
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
 	}
 
-	/* Mass Erase Operation */
-	SET_BIT(FPEC->CR,CR_MER);
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: SubmitJob                                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : const FPEC_Job_t* Copy_pJob                                    */
+/*				   Brief: Pointer to job descriptor (copied into the queue)       */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pJobId                                           */
+/*				   Brief: Pointer to variable in which id of the queued job will  */
+/*				          be stored (reported back in job result)                 */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function appends an erase, program or verify job to the   */
+/*                 asynchronous job queue and returns at once. The job runs in    */
+/*                 the background: each flash operation is started then its end   */
+/*                 of operation (or error) interrupt advances the queue, so FLASH */
+/*                 interrupt must be enabled on NVIC. Job notification function   */
+/*                 is called with job result when it ends (from FLASH IRQ, or     */
+/*                 from the context that finds the queue idle for a job that      */
+/*                 needs no flash operation). Note that CPU still stalls if it    */
+/*                 fetches from flash while an operation is running, so code that */
+/*                 must keep running during erase should execute from RAM.        */
+/*                 Returns BUSY_FUNC if queue is full                             */
+/*                 Returns RT_NOK outside a flash session (FPEC_BeginSession)     */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_SubmitJob(const FPEC_Job_t* Copy_pJob, uint8_t* Copy_pJobId)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	uint8_t Local_StartQueue = 0;						/* Flag that indicates caller found the queue idle and has to start it */
+	uint32_t Local_PrimaskState;						/* Variable to hold PRIMASK state saved by critical section */
+
+	/* Check if passed pointers are NULL pointers or not (data is not needed by erase jobs) */
+	if((Copy_pJob != NULL) && (Copy_pJobId != NULL) &&
+	   ((Copy_pJob->jobType == FPEC_JOB_PAGE_ERASE) || (Copy_pJob->pData != NULL)))
+	{
+		/* Check if passed job fields are within their valid ranges */
+		if(((Copy_pJob->jobType == FPEC_JOB_PAGE_ERASE) &&
+		    (Copy_pJob->pageNumber >= FPEC_PAGE_0 && Copy_pJob->pageNumber <= FPEC_PAGE_127)) ||
+		   (((Copy_pJob->jobType == FPEC_JOB_PROGRAM) || (Copy_pJob->jobType == FPEC_JOB_VERIFY)) &&
+		    (Copy_pJob->address >= FPEC_FLASH_FIRST_ADDRESS && Copy_pJob->address <= FPEC_FLASH_LAST_ADDRESS) &&
+		    (GET_BIT(Copy_pJob->address,0) == 0) && (Copy_pJob->length > 0) &&
+		    ((uint32_t)Copy_pJob->length * 2U <= (FPEC_FLASH_LAST_ADDRESS - Copy_pJob->address + 1U))))
+		{
+			/* Queue is shared with FLASH IRQ */
+			FPEC_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+			/* Check if job is submitted inside a session and there is a free slot in the queue */
+			if(Global_SessionDepth == 0)
+			{
+				/* Flash is locked outside sessions */
+				Local_Status = RT_NOK;
+			}
+			else if(Global_JobQueueState.Count < FPEC_JOB_QUEUE_DEPTH)
+			{
+				/* Copy passed job into tail slot, give it an id and advance tail */
+				Global_JobQueue[Global_JobQueueState.Tail] = *Copy_pJob;
+				Global_JobIds[Global_JobQueueState.Tail] = Global_JobQueueState.NextJobId;
+				*Copy_pJobId = Global_JobQueueState.NextJobId;
+				Global_JobQueueState.NextJobId++;
+				Global_JobQueueState.Tail = (uint8_t)((Global_JobQueueState.Tail + 1U) % FPEC_JOB_QUEUE_DEPTH);
+				Global_JobQueueState.Count++;
+
+				/* Check if queue is idle (nobody is advancing it) */
+				if(Global_JobQueueState.Owned == 0)
+				{
+					/* Caller owns the queue and starts it */
+					Global_JobQueueState.Owned = 1;
+					Local_StartQueue = 1;
+				}
+			}
+			else
+			{
+				/* Queue is full */
+				Local_Status = BUSY_FUNC;
+			}
+
+			/* Leave critical section */
+			FPEC_EXIT_CRITICAL_SECTION(Local_PrimaskState);
 
-	/* Start operation */
-	SET_BIT(FPEC->CR,CR_STRT);
+			/* Start queued jobs if queue was idle */
+			if(Local_StartQueue == 1)
+			{
+				/* Run jobs until first flash operation is started */
+				FPEC_JobAdvance();
+			}
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
 
-	/* Wait for Busy Flag */
-	while (GET_BIT(FPEC->SR,SR_BSY) == 1);
+	return Local_Status;
+}
 
-	/* End of Page Erasing Operation */
-	SET_BIT(FPEC->SR,SR_EOP);
-	CLEAR_BIT(FPEC->CR,CR_MER);
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetJobStatus                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pPendingJobs                                     */
+/*				   Brief: Pointer to variable in which number of queued jobs      */
+/*				          (including the running one) will be stored              */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 FPEC_JobResult_t* Copy_pLastResult                             */
+/*				   Brief: Pointer to variable in which result of last ended job   */
+/*				          will be stored                                          */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gets asynchronous job queue status for callers   */
+/*                 that poll instead of using notification functions              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_GetJobStatus(uint8_t* Copy_pPendingJobs, FPEC_JobResult_t* Copy_pLastResult)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	uint32_t Local_PrimaskState;						/* Variable to hold PRIMASK state saved by critical section */
+
+	/* Check if passed pointers are NULL pointers or not */
+	if((Copy_pPendingJobs != NULL) && (Copy_pLastResult != NULL))
+	{
+		/* Queue status is shared with FLASH IRQ */
+		FPEC_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+		/* Get number of queued jobs and result of last ended job */
+		*Copy_pPendingJobs = Global_JobQueueState.Count;
+		*Copy_pLastResult = Global_LastJobResult;
+
+		/* Leave critical section */
+		FPEC_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: BeginSession                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function opens a flash session: the flash controller is   */
+/*                 unlocked once (KEYR sequence is written only if it is really   */
+/*                 locked) and stays unlocked for a batch of erase and program    */
+/*                 operations. Flash can only be written inside a session.        */
+/*                 Sessions can be nested (an ECUAL driver may open its own       */
+/*                 session inside an application session), only the outermost one */
+/*                 unlocks and locks the controller                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_BeginSession(void)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	uint32_t Local_PrimaskState;						/* Variable to hold PRIMASK state saved by critical section */
+
+	/* Session state is shared with FLASH IRQ */
+	FPEC_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+	/* Check if another nested session can be opened */
+	if(Global_SessionDepth < FPEC_MAX_SESSION_DEPTH)
+	{
+		/* Check if flash controller is known to be locked */
+		if(Global_ControllerUnlocked == 0)
+		{
+			/* Check if FPEC is locked or not (a bootloader may leave it unlocked, writing keys then would lock it up) */
+			if (GET_BIT(FPEC->CR,CR_LOCK) == 1)
+			{
+				/* Unlock FPEC */
+				FPEC -> KEYR = FPEC_UNLOCK_KEY1;
+				FPEC -> KEYR = FPEC_UNLOCK_KEY2;
+			}
+
+			/* Controller stays unlocked until the outermost session is closed */
+			Global_ControllerUnlocked = 1;
+		}
+
+		/* Open the session */
+		Global_SessionDepth++;
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	/* Leave critical section */
+	FPEC_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: EndSession                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function closes a flash session opened by                 */
+/*                 FPEC_BeginSession. Closing the outermost session locks the     */
+/*                 flash controller again, if asynchronous jobs are still queued  */
+/*                 the controller is locked as soon as they end. Returns RT_NOK   */
+/*                 if no session is open                                          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FPEC_EndSession(void)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	uint32_t Local_PrimaskState;						/* Variable to hold PRIMASK state saved by critical section */
+
+	/* Session state is shared with FLASH IRQ */
+	FPEC_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+	/* Check if a session is open */
+	if(Global_SessionDepth > 0)
+	{
+		/* Close the session */
+		Global_SessionDepth--;
+
+		/* Check if outermost session is closed and no asynchronous job is running (else queue locks it when it ends) */
+		if((Global_SessionDepth == 0) && (Global_JobQueueState.Owned == 0))
+		{
+			/* Lock FPEC */
+			SET_BIT(FPEC->CR,CR_LOCK);
+			Global_ControllerUnlocked = 0;
+		}
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	/* Leave critical section */
+	FPEC_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ProgramSession                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint32_t Copy_Address                                          */
+/*				   Brief: Flash address of the first halfword to be programmed    */
+/*				   Range: Limited to flash size (FPEC_FLASH_FIRST_ADDRESS -->     */
+/*				          FPEC_FLASH_LAST_ADDRESS)                                */
+/*				   -------------------------------------------------------------- */
+/*                 const uint16_t* Copy_pData                                     */
+/*				   Brief: Array of halfwords to be programmed                     */
+/*				   Range: None                                                    */
+/*				   -------------------------------------------------------------- */
+/*                 uint16_t Copy_Length                                           */
+/*				   Brief: Halfword count in data array                            */
+/*				   Range: Limited to flash size                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function programs an array of halfwords in one            */
+/*                 programming session (CR_PG is set once). Halfwords that        */
+/*                 already hold their value are skipped and each programmed       */
+/*                 halfword is checked against PGERR, WRPRTERR and read back      */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t FPEC_ProgramSession(uint32_t Copy_Address, const uint16_t* Copy_pData, uint16_t Copy_Length)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	volatile uint16_t* Local_pFlash = (volatile uint16_t*)Copy_Address;	/* Pointer to halfwords in flash */
+	uint16_t Local_HalfWordCounter = 0;					/* Variable to hold counts of halfwords */
+
+	/* Take the flash controller (asynchronous jobs must not be running) */
+	Local_Status = FPEC_ClaimController();
+
+	/* Check if flash controller is taken */
+	if(Local_Status == RT_OK)
+	{
+		/* Wait for Busy Flag */
+		while (GET_BIT(FPEC->SR,SR_BSY) == 1);
+
+		/* Clear flags left by previous operations */
+		FPEC -> SR = FPEC_SR_CLEAR_FLAGS_MASK;
+
+		/* Start Flash Programming Session */
+		SET_BIT(FPEC->CR,CR_PG);
+
+		/* Program halfwords until all are programmed or an error occurs */
+		while((Local_Status == RT_OK) && (Local_HalfWordCounter < Copy_Length))
+		{
+			/* Check if halfword already holds its value */
+			if(Local_pFlash[Local_HalfWordCounter] == Copy_pData[Local_HalfWordCounter])
+			{
+				/* Skip halfword */
+				Global_SkipCount++;
+			}
+			else
+			{
+				/* Half word flash programming operation */
+				Local_pFlash[Local_HalfWordCounter] = Copy_pData[Local_HalfWordCounter];
+
+				/* Wait for Busy Flag */
+				while (GET_BIT(FPEC->SR,SR_BSY) == 1);
+
+				/* Check programming errors then verify halfword by read back */
+				if(((FPEC->SR & FPEC_SR_ERRORS_MASK) != 0) ||
+				   (Local_pFlash[Local_HalfWordCounter] != Copy_pData[Local_HalfWordCounter]))
+				{
+					/* Function is not behaving as expected */
+					Local_Status = RT_NOK;
+				}
+				else
+				{
+					/* Count programmed halfwords */
+					Global_ProgramCount++;
+				}
+			}
+
+			/* Move to next halfword */
+			Local_HalfWordCounter++;
+		}
+
+		/* End of Flash Programming Session */
+		FPEC -> SR = FPEC_SR_CLEAR_FLAGS_MASK;
+		CLEAR_BIT(FPEC->CR,CR_PG);
+
+		/* Give back the flash controller */
+		FPEC_ReleaseController();
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ClaimController                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gives a blocking function exclusive use of the   */
+/*                 flash controller by marking the job queue as owned, jobs       */
+/*                 submitted meanwhile are only queued. Returns RT_NOK outside a  */
+/*                 flash session (FPEC_BeginSession) or BUSY_FUNC if asynchronous */
+/*                 jobs are running                                               */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t FPEC_ClaimController(void)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;				/* Variable to hold status of the function */
+	uint32_t Local_PrimaskState;						/* Variable to hold PRIMASK state saved by critical section */
+
+	/* Queue ownership is shared with FLASH IRQ */
+	FPEC_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+	/* Check if flash is written inside a session */
+	if(Global_SessionDepth > 0)
+	{
+		/* Check if queue is idle (no running jobs) */
+		if(Global_JobQueueState.Owned == 0)
+		{
+			/* Own the queue, jobs submitted from now on are only queued */
+			Global_JobQueueState.Owned = 1;
+		}
+		else
+		{
+			/* Asynchronous jobs are running */
+			Local_Status = BUSY_FUNC;
+		}
+	}
+	else
+	{
+		/* Flash is locked outside sessions */
+		Local_Status = RT_NOK;
+	}
+
+	/* Leave critical section */
+	FPEC_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ReleaseController                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function ends exclusive use of the flash controller taken */
+/*                 by FPEC_ClaimController and starts jobs queued meanwhile       */
+/*--------------------------------------------------------------------------------*/
+static void FPEC_ReleaseController(void)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_JobsQueued;							/* Flag that indicates jobs were submitted while controller was taken */
+	uint32_t Local_PrimaskState;						/* Variable to hold PRIMASK state saved by critical section */
+
+	/* Queue ownership is shared with FLASH IRQ */
+	FPEC_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+	/* Check if jobs were submitted meanwhile */
+	Local_JobsQueued = (Global_JobQueueState.Count > 0) ? 1 : 0;
+
+	/* Check if queue can be released */
+	if(Local_JobsQueued == 0)
+	{
+		/* Release the queue */
+		Global_JobQueueState.Owned = 0;
+	}
+
+	/* Leave critical section */
+	FPEC_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+
+	/* Start jobs queued meanwhile (queue stays owned by caller until they are started) */
+	if(Local_JobsQueued == 1)
+	{
+		/* Run jobs until first flash operation is started */
+		FPEC_JobAdvance();
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: JobAdvance                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function runs queued jobs until a flash operation is      */
+/*                 started (its interrupt resumes the queue) or the queue is      */
+/*                 empty. Jobs that need no flash operation (verify, already      */
+/*                 matching data) end here at once. Only the context that owns    */
+/*                 the queue (first submitter of an idle queue or FLASH IRQ)      */
+/*                 calls it                                                       */
+/*--------------------------------------------------------------------------------*/
+static void FPEC_JobAdvance(void)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_OperationStarted = 0;					/* Flag that indicates a flash operation is running */
+	uint8_t Local_QueueReleased = 0;					/* Flag that indicates queue is empty and released */
+	uint32_t Local_PrimaskState;						/* Variable to hold PRIMASK state saved by critical section */
+
+	/* Run jobs until a flash operation is running or queue is released */
+	while((Local_OperationStarted == 0) && (Local_QueueReleased == 0))
+	{
+		/* Check if there are queued jobs */
+		if(Global_JobQueueState.Count > 0)
+		{
+			/* Start head job operation (or end head job if it needs no flash operation) */
+			Local_OperationStarted = FPEC_JobStartOperation();
+		}
+		else
+		{
+			/* Queue is shared with submitters */
+			FPEC_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+			/* Check again that no job was submitted meanwhile */
+			if(Global_JobQueueState.Count == 0)
+			{
+				/* Disable flash interrupts then release the queue */
+				FPEC->CR &= ~FPEC_JOB_INTERRUPTS_MASK;
+				Global_JobQueueState.Owned = 0;
+				Local_QueueReleased = 1;
+
+				/* Check if outermost session was closed while jobs were running */
+				if(Global_SessionDepth == 0)
+				{
+					/* Lock FPEC */
+					SET_BIT(FPEC->CR,CR_LOCK);
+					Global_ControllerUnlocked = 0;
+				}
+			}
+
+			/* Leave critical section */
+			FPEC_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+		}
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: JobStartOperation                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : uint8_t                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function starts next flash operation of head job (page    */
+/*                 erase or next halfword that differs from flash) with end of    */
+/*                 operation and error interrupts enabled, or ends the job if     */
+/*                 nothing is left to do. Returns 1 if a flash operation is       */
+/*                 started or 0 if head job ended                                 */
+/*--------------------------------------------------------------------------------*/
+static uint8_t FPEC_JobStartOperation(void)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_OperationStarted = 0;					/* Flag that indicates a flash operation is started */
+	const FPEC_Job_t* Local_pJob = &Global_JobQueue[Global_JobQueueState.Head];	/* Pointer to head job */
+	volatile uint16_t* Local_pFlash = (volatile uint16_t*)Local_pJob->address;		/* Pointer to halfwords in flash */
+	uint16_t Local_HalfWordCounter = 0;					/* Variable to hold counts of verified halfwords */
+
+	/* Switch on head job type */
+	switch(Local_pJob->jobType)
+	{
+		case FPEC_JOB_PAGE_ERASE:
+
+			/* Clear flags left by previous operations */
+			FPEC -> SR = FPEC_SR_CLEAR_FLAGS_MASK;
+
+			/* Page Erase Operation */
+			SET_BIT(FPEC->CR,CR_PER);
+
+			/* Write page address to be erased */
+			FPEC->AR = ((uint32_t)Local_pJob->pageNumber << FPEC_PAGE_SHIFT) + FPEC_FLASH_FIRST_ADDRESS;
+
+			/* Enable end of operation and error interrupts then start operation */
+			FPEC->CR |= FPEC_JOB_INTERRUPTS_MASK;
+			Global_JobQueueState.OperationPending = 1;
+			Local_OperationStarted = 1;
+			SET_BIT(FPEC->CR,CR_STRT);
+
+			break;
+
+		case FPEC_JOB_PROGRAM:
+
+			/* Skip halfwords that already hold their value */
+			while((Global_JobQueueState.Progress < Local_pJob->length) &&
+				  (Local_pFlash[Global_JobQueueState.Progress] == Local_pJob->pData[Global_JobQueueState.Progress]))
+			{
+				/* Skip halfword */
+				Global_SkipCount++;
+				Global_JobQueueState.Progress++;
+			}
+
+			/* Check if there is a halfword left to be programmed */
+			if(Global_JobQueueState.Progress < Local_pJob->length)
+			{
+				/* Clear flags left by previous operations */
+				FPEC -> SR = FPEC_SR_CLEAR_FLAGS_MASK;
+
+				/* Enable end of operation and error interrupts then start halfword programming */
+				FPEC->CR |= FPEC_JOB_INTERRUPTS_MASK;
+				SET_BIT(FPEC->CR,CR_PG);
+				Global_JobQueueState.OperationPending = 1;
+				Local_OperationStarted = 1;
+				Local_pFlash[Global_JobQueueState.Progress] = Local_pJob->pData[Global_JobQueueState.Progress];
+			}
+			else
+			{
+				/* All halfwords are programmed */
+				FPEC_JobComplete(RT_OK, FPEC_JOB_ERROR_NONE, 0);
+			}
+
+			break;
+
+		case FPEC_JOB_VERIFY:
+
+			/* Compare halfwords until all are compared or a mismatch is found */
+			while((Local_HalfWordCounter < Local_pJob->length) &&
+				  (Local_pFlash[Local_HalfWordCounter] == Local_pJob->pData[Local_HalfWordCounter]))
+			{
+				/* Move to next halfword */
+				Local_HalfWordCounter++;
+			}
+
+			/* Check if a mismatch is found */
+			if(Local_HalfWordCounter < Local_pJob->length)
+			{
+				/* Flash content differs from passed data */
+				FPEC_JobComplete(RT_NOK, FPEC_JOB_ERROR_VERIFY, Local_pJob->address + ((uint32_t)Local_HalfWordCounter * 2U));
+			}
+			else
+			{
+				/* Flash content matches passed data */
+				FPEC_JobComplete(RT_OK, FPEC_JOB_ERROR_NONE, 0);
+			}
+
+			break;
+
+		default:
+
+			/* Job types are checked on submission, drop unknown job */
+			FPEC_JobComplete(RT_NOK, FPEC_JOB_ERROR_NONE, 0);
+	}
+
+	return Local_OperationStarted;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: JobComplete                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : ERROR_STATUS_t Copy_Status                                     */
+/*				   Brief: Result of head job                                      */
+/*				   Range: RT_OK or RT_NOK                                         */
+/*				   -------------------------------------------------------------- */
+/*                 uint8_t Copy_ErrorFlags                                        */
+/*				   Brief: Error details of head job                               */
+/*				   Range: FPEC_JOB_ERROR_x flags                                  */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_FailAddress                                      */
+/*				   Brief: Flash address at which head job failed                  */
+/*				   Range: 0 if job succeeded                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function records result of head job, removes it from the  */
+/*                 queue then calls its notification function                     */
+/*--------------------------------------------------------------------------------*/
+static void FPEC_JobComplete(ERROR_STATUS_t Copy_Status, uint8_t Copy_ErrorFlags, uint32_t Copy_FailAddress)
+{
+	/* Local Variables Definitions */
+	FPEC_JobResult_t Local_Result;						/* Result of head job */
+	void(*Local_NotificationFunc)(const FPEC_JobResult_t* Copy_pResult);	/* Notification function of head job */
+	uint32_t Local_PrimaskState;						/* Variable to hold PRIMASK state saved by critical section */
+
+	/* Fill head job result */
+	Local_Result.jobId = Global_JobIds[Global_JobQueueState.Head];
+	Local_Result.jobType = Global_JobQueue[Global_JobQueueState.Head].jobType;
+	Local_Result.status = Copy_Status;
+	Local_Result.errorFlags = Copy_ErrorFlags;
+	Local_Result.failAddress = Copy_FailAddress;
+	Local_NotificationFunc = Global_JobQueue[Global_JobQueueState.Head].notificationFunc;
+
+	/* Queue is shared with submitters */
+	FPEC_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+	/* Record result then remove head job from the queue */
+	Global_LastJobResult = Local_Result;
+	Global_JobQueueState.Head = (uint8_t)((Global_JobQueueState.Head + 1U) % FPEC_JOB_QUEUE_DEPTH);
+	Global_JobQueueState.Count--;
+	Global_JobQueueState.Progress = 0;
+
+	/* Leave critical section */
+	FPEC_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+
+	/* Notify job submitter */
+	if(Local_NotificationFunc != NULL)
+	{
+		/* Call job notification function */
+		Local_NotificationFunc(&Local_Result);
+	}
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            	  INTERRUPT HANDLERS		                    	 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/*                                                                                */
+/* @Description	: Flash global interrupt (end of operation / programming error)   */
+/*				                                                                  */
+/*--------------------------------------------------------------------------------*/
+void FLASH_IRQHandler(void)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_StatusFlags = FPEC->SR;				/* Flash status flags that raised the interrupt */
+	const FPEC_Job_t* Local_pJob = &Global_JobQueue[Global_JobQueueState.Head];	/* Pointer to head job */
+	uint32_t Local_Address;								/* Flash address of ended operation */
+
+	/* Clear raised flags then end the operation */
+	FPEC -> SR = FPEC_SR_CLEAR_FLAGS_MASK;
+
+	/* Check if a flash operation of head job ended */
+	if((Global_JobQueueState.OperationPending == 1) && (GET_BIT(Local_StatusFlags,SR_BSY) == 0))
+	{
+		/* End of Page Erasing or Programming Operation */
+		CLEAR_BIT(FPEC->CR,CR_PER);
+		CLEAR_BIT(FPEC->CR,CR_PG);
+		Global_JobQueueState.OperationPending = 0;
+
+		/* Get flash address of ended operation */
+		if(Local_pJob->jobType == FPEC_JOB_PAGE_ERASE)
+		{
+			/* Address of erased page */
+			Local_Address = ((uint32_t)Local_pJob->pageNumber << FPEC_PAGE_SHIFT) + FPEC_FLASH_FIRST_ADDRESS;
+		}
+		else
+		{
+			/* Address of programmed halfword */
+			Local_Address = Local_pJob->address + ((uint32_t)Global_JobQueueState.Progress * 2U);
+		}
+
+		/* Check PGERR and WRPRTERR (job error flags keep their FLASH_SR positions) */
+		if((Local_StatusFlags & FPEC_SR_ERRORS_MASK) != 0)
+		{
+			/* Head job failed */
+			FPEC_JobComplete(RT_NOK, (uint8_t)(Local_StatusFlags & FPEC_SR_ERRORS_MASK), Local_Address);
+		}
+		else if(Local_pJob->jobType == FPEC_JOB_PAGE_ERASE)
+		{
+			/* Count page erases (flash wear) then end head job */
+			Global_EraseCount++;
+			FPEC_JobComplete(RT_OK, FPEC_JOB_ERROR_NONE, 0);
+		}
+		else if(*(volatile uint16_t*)Local_Address != Local_pJob->pData[Global_JobQueueState.Progress])
+		{
+			/* Programmed halfword read back differs */
+			FPEC_JobComplete(RT_NOK, FPEC_JOB_ERROR_VERIFY, Local_Address);
+		}
+		else
+		{
+			/* Count programmed halfwords then move to next halfword */
+			Global_ProgramCount++;
+			Global_JobQueueState.Progress++;
+		}
+
+		/* Start next flash operation */
+		FPEC_JobAdvance();
+	}
 }
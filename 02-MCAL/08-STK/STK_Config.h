@@ -39,4 +39,13 @@
 /*-------------------------------------------------------*/
 #define STK_EXCEPTION_REQUEST  DISABLE  /* Default: DISABLE */
 
+/*-------------------------------------------------------*/
+/* Set number of software timers in the static pool of   */
+/* the timer wheel (run on free-running tick mode):      */
+/*                                                       */
+/* Options	: - (1 --> 65534)                            */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define STK_TIMERS_POOL_SIZE  128U  /* Default: 128U */
+
 #endif /* STK_CONFIG_H_ */
@@ -47,6 +47,11 @@
 #define STK_MIN_VALUE					0x00000001U
 #define STK_MAX_VALUE					0x00FFFFFFU
 
+/* Define Software Timers Values */
+#define STK_TIMER_MAX_PERIODS			0x00FFFFFFU		/* Max delay/period of a software timer in time base periods */
+#define STK_TIMER_ONE_SHOT				0U				/* Reload periods value of a one-shot software timer */
+#define STK_TIMER_NO_DEADLINE			0xFFFFFFFFU		/* Returned by STK_GetPeriodsToNextTimer when no timer is active */
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                           	  FUNCTIONS PROTOTYPES		          	             */
@@ -190,4 +195,170 @@ ERROR_STATUS_t STK_GetElapsedTime(uint32_t* Copy_pElapesdTime);
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t STK_GetRemainingTime(uint32_t* Copy_pRemainingTime);
 
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: StartTickTimer          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint32_t Copy_TicksPerPeriod                                   */
+/* 				   Brief: Number of STK ticks of one time base period (e.g. 1 ms) */
+/*				   Range: (STK_MIN_VALUE + 1 --> STK_MAX_VALUE + 1)				  */
+/*				   -------------------------------------------------------------- */
+/*                 void (*Copy_pCallbackFunction)(void)                           */
+/*				   Brief: Pointer to function called every period (NULL if not    */
+/*						  needed)												  */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Starts SysTick as a free-running time base. Timer is never     */
+/*                 stopped or reloaded by software afterwards, SysTick exception  */
+/*                 counts elapsed periods in a 64-bit counter and drives the      */
+/*                 software timer wheel (emptied here). Other interval functions  */
+/*                 must not be used until STK_StopTimer is called                 */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_StartTickTimer(uint32_t Copy_TicksPerPeriod , void (*Copy_pCallbackFunction)(void));
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetTickCount          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None				                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint64_t* Copy_pTickCount                                      */
+/*				   Brief: Pointer to variable that will hold number of periods    */
+/*				          elapsed since STK_StartTickTimer                        */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets free-running time base period counter (e.g. milliseconds) */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_GetTickCount(uint64_t* Copy_pTickCount);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetTimestamp          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None				                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint64_t* Copy_pTimestamp                                      */
+/*				   Brief: Pointer to variable that will hold STK ticks elapsed    */
+/*				          since STK_StartTickTimer                                */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Combines period counter with VAL register to give a monotonic  */
+/*                 timestamp with one STK tick resolution (13.9 ns at 72 MHz AHB).*/
+/*                 A reload that happened but was not counted yet by SysTick      */
+/*                 exception (caller masks it or runs at higher priority) is      */
+/*                 accounted for, so it is safe from any context                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_GetTimestamp(uint64_t* Copy_pTimestamp);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: TimerStart          					                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint32_t Copy_DelayPeriods                                     */
+/* 				   Brief: Time base periods until first expiry                    */
+/*				   Range: (1 --> STK_TIMER_MAX_PERIODS)			                  */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_ReloadPeriods                                    */
+/* 				   Brief: Periods between later expiries                          */
+/*				   Range: STK_TIMER_ONE_SHOT or (1 --> STK_TIMER_MAX_PERIODS)     */
+/*				   -------------------------------------------------------------- */
+/*                 void (*Copy_pCallbackFunction)(void)                           */
+/*				   Brief: Pointer to function called from SysTick exception on    */
+/*						  every expiry											  */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint16_t* Copy_pTimerId                                        */
+/*				   Brief: Pointer to variable that will hold timer id (valid      */
+/*				          until timer is cancelled or one-shot timer expires)     */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Takes a software timer from the static pool and inserts it in  */
+/*                 the timer wheel in O(1). Free-running tick mode must be        */
+/*                 started (STK_StartTickTimer). Returns BUSY_FUNC if the pool is */
+/*                 exhausted                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_TimerStart(uint32_t Copy_DelayPeriods , uint32_t Copy_ReloadPeriods , void (*Copy_pCallbackFunction)(void) , uint16_t* Copy_pTimerId);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: TimerCancel          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint16_t Copy_TimerId                                          */
+/* 				   Brief: Timer id returned by STK_TimerStart                     */
+/*				   Range: (0 --> STK_TIMERS_POOL_SIZE - 1)			              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Removes an active timer from the wheel in O(1) and gives it    */
+/*                 back to the pool (safe from timer callbacks as well)           */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_TimerCancel(uint16_t Copy_TimerId);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetPeriodsToNextTimer          					              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None				                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pPeriods                                        */
+/*				   Brief: Pointer to variable that will hold number of periods    */
+/*				          that surely pass before next timer expiry               */
+/*				          (STK_TIMER_NO_DEADLINE if no timer is active)           */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets distance to nearest deadline from wheel occupancy so an   */
+/*                 idle loop can decide how long it may sleep. Exact for timers   */
+/*                 due within 64 periods, lower bound for farther ones            */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_GetPeriodsToNextTimer(uint32_t* Copy_pPeriods);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: TicklessIdle          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint32_t Copy_MaxPeriods                                       */
+/* 				   Brief: Most periods the tick may be suppressed for (wake-up    */
+/*				          of a task not driven by the wheel)                      */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pSleptPeriods                                   */
+/*				   Brief: Pointer to variable that will hold number of periods    */
+/*				          counted without a SysTick exception (0 if tick kept     */
+/*				          running)                                                */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Sleeps (WFI) until next interrupt with the free-running tick   */
+/*                 suppressed up to the period of next wheel deadline. Slept      */
+/*                 periods are counted (wheel and tick count) and counter is put  */
+/*                 back in phase on wake-up, so timers still expire on their      */
+/*                 period. Tick runs as usual when next deadline or a pending     */
+/*                 tick is too close. A few ticks are lost each time counter is   */
+/*                 stopped to be reprogrammed, tick callback is not called for    */
+/*                 slept periods                                                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_TicklessIdle(uint32_t Copy_MaxPeriods , uint32_t* Copy_pSleptPeriods);
+
 #endif /* STK_INTERFACE_H_ */
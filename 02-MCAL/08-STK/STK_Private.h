@@ -37,6 +37,9 @@ typedef struct
 
 #define STK  ((volatile STK_t*)0xE000E010)
 
+/* Interrupt control and state register of SCB (only SysTick pending bit is needed by the time base) */
+#define STK_SCB_ICSR  (*((volatile uint32_t*)0xE000ED04))
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                              SOME BITS DEFINITIONS		 	             		 */
@@ -49,6 +52,9 @@ typedef struct
 #define CTRL_CLKSOURCE                          2U  /* Clock source selection */
 #define CTRL_COUNTFLAG                          16U /* Counter flag */
 
+/* Some bits definitions of SCB interrupt control and state register (SCB_ICSR) */
+#define ICSR_PENDSTSET                          26U /* SysTick exception pending */
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                                  PRIVATE MACROS		       		    		     */
@@ -58,10 +64,61 @@ typedef struct
 /* Define Systick Interval Modes */
 #define STK_SINGLE_INTERVAL    0U
 #define STK_PERIODIC_INTERVAL  1U
+#define STK_FREE_RUNNING_TICK  2U
+
+/* Define Timer Wheel Geometry (4 levels of 64 slots cover delays up to 2^24 periods) */
+#define STK_TIMER_WHEEL_LEVELS		4U
+#define STK_TIMER_WHEEL_SLOT_BITS	6U
+#define STK_TIMER_WHEEL_SLOTS		64U
+#define STK_TIMER_WHEEL_SLOT_MASK	0x0000003FU
+
+/* Define Null Timer Link */
+#define STK_TIMER_NONE				0xFFFFU
+
+/* Define Software Timer States */
+#define STK_TIMER_FREE				0U
+#define STK_TIMER_ACTIVE			1U
+
+/* Critical section macros are Cortex-M3 specific, a host build (05-TEST) defines its own before this header */
+#ifndef STK_ENTER_CRITICAL_SECTION
+
+/* Save PRIMASK then mask configurable interrupts (tick counter is shared with SysTick exception) */
+#define STK_ENTER_CRITICAL_SECTION(Copy_PrimaskState)		__asm volatile("MRS %0, PRIMASK\n\tCPSID I" : "=r"(Copy_PrimaskState) : : "memory")
+
+/* Restore PRIMASK saved by STK_ENTER_CRITICAL_SECTION */
+#define STK_EXIT_CRITICAL_SECTION(Copy_PrimaskState)		__asm volatile("MSR PRIMASK, %0" : : "r"(Copy_PrimaskState) : "memory")
+
+#endif
+
+/* Sleep instruction is Cortex-M3 specific as well, a host build (05-TEST) lets tests model the time slept */
+#ifndef STK_WAIT_FOR_INTERRUPT
+
+/* Sleep until an interrupt is pending (wakes up with PRIMASK set too, the interrupt runs once it is restored) */
+#define STK_WAIT_FOR_INTERRUPT()							__asm volatile("WFI" : : : "memory")
+
+#endif
 
 /* Define Systick Clear Value */
 #define STK_CLEAR			   0U
 
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                              PRIVATE DATA TYPES		       		    		     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Software Timer Type (Element of timer wheel static pool, linked by pool indices) */
+typedef struct
+{
+	void(*CallbackFunc)(void);			/* Function called when timer expires */
+	uint32_t Expiry;					/* Absolute expiry time in periods (wraps safely, only differences are used) */
+	uint32_t ReloadPeriods;				/* Period of periodic timer (STK_TIMER_ONE_SHOT for one-shot timer) */
+	uint16_t Next;						/* Next timer in same wheel slot (or in free list) */
+	uint16_t Prev;						/* Previous timer in same wheel slot */
+	uint16_t Slot;						/* Wheel slot holding the timer (level * STK_TIMER_WHEEL_SLOTS + slot) */
+	uint8_t  State;						/* STK_TIMER_FREE or STK_TIMER_ACTIVE */
+}STK_Timer_t;
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                            CONFIGURATION OPTIONS VALUES		       		         */
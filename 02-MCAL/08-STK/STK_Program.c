@@ -32,6 +32,15 @@
 #include "STK_Interface.h"
 #include "STK_Private.h"
 
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                           PRIVATE FUNCTIONS PROTOTYPES		          	         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void STK_TimerLink(uint16_t Copy_TimerId);
+static void STK_TimerUnlink(uint16_t Copy_TimerId);
+static void STK_TimerWheelAdvance(void);
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                            GLOBAL VARIABLES DEFINITIONS		                     */
@@ -40,6 +49,14 @@
 
 static uint8_t Global_IntervalMode;						/* Global variable that holds interval mode whether it's single or periodic */
 static void(*Global_CallbackFunction)(void) = NULL;		/* Global variable that holds pointer to function to be called once STK event is triggered */
+static volatile uint64_t Global_TickCount = 0;			/* Global variable that holds number of periods elapsed in free-running tick mode */
+static uint32_t Global_TickPeriod = 0;					/* Global variable that holds number of STK ticks of one free-running period */
+
+static STK_Timer_t Global_TimerPool[STK_TIMERS_POOL_SIZE];								/* Static pool of software timers */
+static uint16_t Global_TimerWheel[STK_TIMER_WHEEL_LEVELS * STK_TIMER_WHEEL_SLOTS];		/* Head timer of each slot of each wheel level */
+static uint64_t Global_TimerWheelOccupancy[STK_TIMER_WHEEL_LEVELS];						/* Bit per non-empty slot of each wheel level */
+static uint16_t Global_FreeTimersHead = STK_TIMER_NONE;									/* Head of free timers list */
+static uint32_t Global_TimerWheelTime = 0;												/* Number of periods processed by the wheel */
 
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
@@ -297,6 +314,9 @@ ERROR_STATUS_t STK_SetPeriodicInterval(uint32_t Copy_Ticks , void (*Copy_pCallba
 /*--------------------------------------------------------------------------------*/
 void STK_StopTimer(void)
 {
+	/* Leave free-running tick mode (if running) */
+	Global_IntervalMode = STK_SINGLE_INTERVAL;
+
 	/* Disable SysTick Interrupt */
 	CLEAR_BIT(STK->CTRL,CTRL_TICKINT);
 
@@ -382,6 +402,743 @@ ERROR_STATUS_t STK_GetRemainingTime(uint32_t* Copy_pRemainingTime)
 	return Local_Status;
 }
 
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: StartTickTimer          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint32_t Copy_TicksPerPeriod                                   */
+/* 				   Brief: Number of STK ticks of one time base period (e.g. 1 ms) */
+/*				   Range: (STK_MIN_VALUE + 1 --> STK_MAX_VALUE + 1)				  */
+/*				   -------------------------------------------------------------- */
+/*                 void (*Copy_pCallbackFunction)(void)                           */
+/*				   Brief: Pointer to function called every period (NULL if not    */
+/*						  needed)												  */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Starts SysTick as a free-running time base. Timer is never     */
+/*                 stopped or reloaded by software afterwards, SysTick exception  */
+/*                 counts elapsed periods in a 64-bit counter and drives the      */
+/*                 software timer wheel (emptied here). Other interval functions  */
+/*                 must not be used until STK_StopTimer is called                 */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_StartTickTimer(uint32_t Copy_TicksPerPeriod , void (*Copy_pCallbackFunction)(void))
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_Iterator;
+
+	/* Check if passed period is within valid range (SysTick timer resolution) or not */
+	if(Copy_TicksPerPeriod > STK_MIN_VALUE && Copy_TicksPerPeriod <= (STK_MAX_VALUE + 1U))
+	{
+		/* Stop (Disable) SysTick Timer before switching mode */
+		CLEAR_BIT(STK->CTRL,CTRL_ENABLE);
+
+		/* Assign the passed function (may be NULL) as a callback function to be called every period */
+		Global_CallbackFunction = Copy_pCallbackFunction;
+
+		/* Set the interval mode and reset time base */
+		Global_IntervalMode = STK_FREE_RUNNING_TICK;
+		Global_TickPeriod = Copy_TicksPerPeriod;
+		Global_TickCount = 0;
+
+		/* Empty timer wheel and chain all pool timers into the free list */
+		for(Local_Iterator = 0 ; Local_Iterator < (STK_TIMER_WHEEL_LEVELS * STK_TIMER_WHEEL_SLOTS) ; Local_Iterator++)
+		{
+			Global_TimerWheel[Local_Iterator] = STK_TIMER_NONE;
+		}
+		for(Local_Iterator = 0 ; Local_Iterator < STK_TIMER_WHEEL_LEVELS ; Local_Iterator++)
+		{
+			Global_TimerWheelOccupancy[Local_Iterator] = 0;
+		}
+		for(Local_Iterator = 0 ; Local_Iterator < STK_TIMERS_POOL_SIZE ; Local_Iterator++)
+		{
+			Global_TimerPool[Local_Iterator].State = STK_TIMER_FREE;
+			Global_TimerPool[Local_Iterator].Next = (Local_Iterator + 1U < STK_TIMERS_POOL_SIZE) ? (uint16_t)(Local_Iterator + 1U) : STK_TIMER_NONE;
+		}
+		Global_FreeTimersHead = 0;
+		Global_TimerWheelTime = 0;
+
+		/* Set reload value of N-1 to get a multi-shot period of exactly N ticks */
+		STK->LOAD = Copy_TicksPerPeriod - 1U;
+
+		/* Clear Systick Timer Counter and Counter Flag through writing any value in VAL register */
+		STK->VAL = STK_CLEAR;
+
+		/* Enable Systick Interrupt */
+		SET_BIT(STK->CTRL,CTRL_TICKINT);
+
+		/* Start (Enable) Systick Timer */
+		SET_BIT(STK->CTRL,CTRL_ENABLE);
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetTickCount          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None				                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint64_t* Copy_pTickCount                                      */
+/*				   Brief: Pointer to variable that will hold number of periods    */
+/*				          elapsed since STK_StartTickTimer                        */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets free-running time base period counter (e.g. milliseconds) */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_GetTickCount(uint64_t* Copy_pTickCount)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_PrimaskState;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pTickCount != NULL)
+	{
+		/* 64-bit counter is read in two halves, keep SysTick exception out while reading it */
+		STK_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+		/* Read period counter */
+		*Copy_pTickCount = Global_TickCount;
+
+		/* Leave critical section */
+		STK_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetTimestamp          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None				                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint64_t* Copy_pTimestamp                                      */
+/*				   Brief: Pointer to variable that will hold STK ticks elapsed    */
+/*				          since STK_StartTickTimer                                */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Combines period counter with VAL register to give a monotonic  */
+/*                 timestamp with one STK tick resolution (13.9 ns at 72 MHz AHB).*/
+/*                 A reload that happened but was not counted yet by SysTick      */
+/*                 exception (caller masks it or runs at higher priority) is      */
+/*                 accounted for, so it is safe from any context                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_GetTimestamp(uint64_t* Copy_pTimestamp)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_PrimaskState;
+	uint64_t Local_TickCount;
+	uint32_t Local_CurrentValue;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pTimestamp != NULL)
+	{
+		/* Check if time base is running or not */
+		if(Global_IntervalMode == STK_FREE_RUNNING_TICK && Global_TickPeriod != 0)
+		{
+			/* Keep SysTick exception out while sampling counter and VAL together */
+			STK_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+			/* Sample period counter then current value of the timer */
+			Local_TickCount = Global_TickCount;
+			Local_CurrentValue = STK->VAL;
+
+			/* Check if timer has reloaded without SysTick exception having counted it yet */
+			if(GET_BIT(STK_SCB_ICSR,ICSR_PENDSTSET) == 1)
+			{
+				/* Count pending period and re-sample VAL so that it surely belongs to the new period */
+				Local_TickCount++;
+				Local_CurrentValue = STK->VAL;
+			}
+
+			/* Leave critical section */
+			STK_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+
+			/* Timestamp is ticks of whole elapsed periods plus ticks elapsed in current one (timer counts down) */
+			*Copy_pTimestamp = (Local_TickCount * Global_TickPeriod) + ((Global_TickPeriod - 1U) - Local_CurrentValue);
+		}
+		else
+		{
+			/* Time base is not started */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: TimerStart          					                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint32_t Copy_DelayPeriods                                     */
+/* 				   Brief: Time base periods until first expiry                    */
+/*				   Range: (1 --> STK_TIMER_MAX_PERIODS)			                  */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_ReloadPeriods                                    */
+/* 				   Brief: Periods between later expiries                          */
+/*				   Range: STK_TIMER_ONE_SHOT or (1 --> STK_TIMER_MAX_PERIODS)     */
+/*				   -------------------------------------------------------------- */
+/*                 void (*Copy_pCallbackFunction)(void)                           */
+/*				   Brief: Pointer to function called from SysTick exception on    */
+/*						  every expiry											  */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint16_t* Copy_pTimerId                                        */
+/*				   Brief: Pointer to variable that will hold timer id (valid      */
+/*				          until timer is cancelled or one-shot timer expires)     */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Takes a software timer from the static pool and inserts it in  */
+/*                 the timer wheel in O(1). Free-running tick mode must be        */
+/*                 started (STK_StartTickTimer). Returns BUSY_FUNC if the pool is */
+/*                 exhausted                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_TimerStart(uint32_t Copy_DelayPeriods , uint32_t Copy_ReloadPeriods , void (*Copy_pCallbackFunction)(void) , uint16_t* Copy_pTimerId)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_PrimaskState;
+	uint16_t Local_TimerId;
+
+	/* Check if passed pointers are NULL pointers or not */
+	if(Copy_pCallbackFunction != NULL && Copy_pTimerId != NULL)
+	{
+		/* Check if passed delay and reload periods are within wheel range or not */
+		if(Copy_DelayPeriods >= 1U && Copy_DelayPeriods <= STK_TIMER_MAX_PERIODS && Copy_ReloadPeriods <= STK_TIMER_MAX_PERIODS)
+		{
+			/* Check if free-running time base (wheel driver) is running or not */
+			if(Global_IntervalMode == STK_FREE_RUNNING_TICK)
+			{
+				/* Pool and wheel are shared with SysTick exception */
+				STK_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+				/* Check if there is a free timer in the pool or not */
+				if(Global_FreeTimersHead != STK_TIMER_NONE)
+				{
+					/* Pop a timer from the free list */
+					Local_TimerId = Global_FreeTimersHead;
+					Global_FreeTimersHead = Global_TimerPool[Local_TimerId].Next;
+
+					/* Set timer parameters */
+					Global_TimerPool[Local_TimerId].CallbackFunc = Copy_pCallbackFunction;
+					Global_TimerPool[Local_TimerId].Expiry = Global_TimerWheelTime + Copy_DelayPeriods;
+					Global_TimerPool[Local_TimerId].ReloadPeriods = Copy_ReloadPeriods;
+					Global_TimerPool[Local_TimerId].State = STK_TIMER_ACTIVE;
+
+					/* Insert timer in the wheel */
+					STK_TimerLink(Local_TimerId);
+
+					/* Return timer id */
+					*Copy_pTimerId = Local_TimerId;
+				}
+				else
+				{
+					/* Pool is exhausted */
+					Local_Status = BUSY_FUNC;
+				}
+
+				/* Leave critical section */
+				STK_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+			}
+			else
+			{
+				/* Time base is not started */
+				Local_Status = RT_NOK;
+			}
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* One or both of passed pointers is a NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: TimerCancel          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint16_t Copy_TimerId                                          */
+/* 				   Brief: Timer id returned by STK_TimerStart                     */
+/*				   Range: (0 --> STK_TIMERS_POOL_SIZE - 1)			              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Removes an active timer from the wheel in O(1) and gives it    */
+/*                 back to the pool (safe from timer callbacks as well)           */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_TimerCancel(uint16_t Copy_TimerId)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_PrimaskState;
+
+	/* Check if passed timer id is within pool range or not */
+	if(Copy_TimerId < STK_TIMERS_POOL_SIZE)
+	{
+		/* Pool and wheel are shared with SysTick exception */
+		STK_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+		/* Check if timer is active or not */
+		if(Global_TimerPool[Copy_TimerId].State == STK_TIMER_ACTIVE)
+		{
+			/* Remove timer from its wheel slot */
+			STK_TimerUnlink(Copy_TimerId);
+
+			/* Give timer back to the pool */
+			Global_TimerPool[Copy_TimerId].State = STK_TIMER_FREE;
+			Global_TimerPool[Copy_TimerId].Next = Global_FreeTimersHead;
+			Global_FreeTimersHead = Copy_TimerId;
+		}
+		else
+		{
+			/* Timer is not active (already expired one-shot or cancelled) */
+			Local_Status = RT_NOK;
+		}
+
+		/* Leave critical section */
+		STK_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetPeriodsToNextTimer          					              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None				                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pPeriods                                        */
+/*				   Brief: Pointer to variable that will hold number of periods    */
+/*				          that surely pass before next timer expiry               */
+/*				          (STK_TIMER_NO_DEADLINE if no timer is active)           */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets distance to nearest deadline from wheel occupancy so an   */
+/*                 idle loop can decide how long it may sleep. Exact for timers   */
+/*                 due within 64 periods, lower bound for farther ones            */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_GetPeriodsToNextTimer(uint32_t* Copy_pPeriods)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_PrimaskState;
+	uint32_t Local_Level;
+	uint32_t Local_Distance;
+	uint32_t Local_LevelShift;
+	uint32_t Local_CurrentSlot;
+	uint32_t Local_Periods;
+	uint32_t Local_NearestPeriods = STK_TIMER_NO_DEADLINE;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pPeriods != NULL)
+	{
+		/* Wheel is shared with SysTick exception */
+		STK_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+		/* Search every level for its nearest non-empty slot */
+		for(Local_Level = 0 ; Local_Level < STK_TIMER_WHEEL_LEVELS ; Local_Level++)
+		{
+			/* Get current slot of the level */
+			Local_LevelShift = Local_Level * STK_TIMER_WHEEL_SLOT_BITS;
+			Local_CurrentSlot = (Global_TimerWheelTime >> Local_LevelShift) & STK_TIMER_WHEEL_SLOT_MASK;
+
+			/* Scan slots after current one (a full round for upper levels) */
+			for(Local_Distance = 1 ; Local_Distance <= STK_TIMER_WHEEL_SLOTS ; Local_Distance++)
+			{
+				/* Check if slot is occupied or not */
+				if(((Global_TimerWheelOccupancy[Local_Level] >> ((Local_CurrentSlot + Local_Distance) & STK_TIMER_WHEEL_SLOT_MASK)) & 1U) == 1U)
+				{
+					/* Level 0 slot expires exactly at its time, upper level slot can not expire before it is cascaded */
+					Local_Periods = ((((Global_TimerWheelTime >> Local_LevelShift) + Local_Distance) << Local_LevelShift) - Global_TimerWheelTime);
+
+					/* Keep nearest deadline */
+					if(Local_Periods < Local_NearestPeriods)
+					{
+						Local_NearestPeriods = Local_Periods;
+					}
+
+					/* Farther slots of the same level can only be later */
+					break;
+				}
+			}
+		}
+
+		/* Leave critical section */
+		STK_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+
+		/* Return nearest deadline */
+		*Copy_pPeriods = Local_NearestPeriods;
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: TicklessIdle          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint32_t Copy_MaxPeriods                                       */
+/* 				   Brief: Most periods the tick may be suppressed for (wake-up    */
+/*				          of a task not driven by the wheel)                      */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint32_t* Copy_pSleptPeriods                                   */
+/*				   Brief: Pointer to variable that will hold number of periods    */
+/*				          counted without a SysTick exception (0 if tick kept     */
+/*				          running)                                                */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Sleeps (WFI) until next interrupt with the free-running tick   */
+/*                 suppressed up to the period of next wheel deadline. Slept      */
+/*                 periods are counted (wheel and tick count) and counter is put  */
+/*                 back in phase on wake-up, so timers still expire on their      */
+/*                 period. Tick runs as usual when next deadline or a pending     */
+/*                 tick is too close. A few ticks are lost each time counter is   */
+/*                 stopped to be reprogrammed, tick callback is not called for    */
+/*                 slept periods                                                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t STK_TicklessIdle(uint32_t Copy_MaxPeriods , uint32_t* Copy_pSleptPeriods)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_PrimaskState;
+	uint32_t Local_Periods;
+	uint32_t Local_SleepLoad;
+	uint32_t Local_CurrentValue;
+	uint32_t Local_RemainingTicks;
+	uint32_t Local_SleptPeriods = 0;
+	uint32_t Local_Iterator;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pSleptPeriods != NULL)
+	{
+		/* Check if free-running time base is running or not */
+		if(Global_IntervalMode == STK_FREE_RUNNING_TICK && Global_TickPeriod != 0)
+		{
+			/* Counter and wheel must not be touched by SysTick exception meanwhile (wake-up interrupt stays pending) */
+			STK_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+			/* Suppress tick up to nearest deadline, caller limit and periods one counter reload can hold */
+			STK_GetPeriodsToNextTimer(&Local_Periods);
+			if(Local_Periods > Copy_MaxPeriods)
+			{
+				Local_Periods = Copy_MaxPeriods;
+			}
+			if(Local_Periods > (STK_MAX_VALUE + 1U) / Global_TickPeriod)
+			{
+				Local_Periods = (STK_MAX_VALUE + 1U) / Global_TickPeriod;
+			}
+
+			/* Check if at least one whole period can pass without exception and no reload waits to be counted */
+			if(Local_Periods > 1U && GET_BIT(STK_SCB_ICSR,ICSR_PENDSTSET) == 0)
+			{
+				/* Stop counter and take ticks left in current period */
+				CLEAR_BIT(STK->CTRL,CTRL_ENABLE);
+				Local_CurrentValue = STK->VAL;
+
+				/* Stretch current period over following ones, reload of long period lands on a period boundary */
+				Local_SleepLoad = Local_CurrentValue + ((Local_Periods - 1U) * Global_TickPeriod);
+				STK->LOAD = Local_SleepLoad;
+				STK->VAL = STK_CLEAR;
+				SET_BIT(STK->CTRL,CTRL_ENABLE);
+
+				/* Sleep until long period ends or another interrupt wakes up processor */
+				STK_WAIT_FOR_INTERRUPT();
+
+				/* Stop counter to find out how far it went */
+				CLEAR_BIT(STK->CTRL,CTRL_ENABLE);
+				Local_CurrentValue = STK->VAL;
+
+				/* Check if long period ended or not (COUNTFLAG is cleared by any read of CTRL, pending bit is kept) */
+				if(GET_BIT(STK_SCB_ICSR,ICSR_PENDSTSET) == 1)
+				{
+					/* Pending SysTick exception counts last period, counter restarted long period since then */
+					Local_SleptPeriods = Local_Periods - 1U;
+					Local_RemainingTicks = (Global_TickPeriod - 1U) - ((Local_SleepLoad - Local_CurrentValue) % Global_TickPeriod);
+				}
+				else
+				{
+					/* Woken up early: whole periods still ahead in long period were not slept */
+					Local_SleptPeriods = (Local_Periods - 1U) - (Local_CurrentValue / Global_TickPeriod);
+					Local_RemainingTicks = Local_CurrentValue % Global_TickPeriod;
+				}
+
+				/* Zero reload would stop the counter, let current period end one tick late instead */
+				if(Local_RemainingTicks < STK_MIN_VALUE)
+				{
+					Local_RemainingTicks = STK_MIN_VALUE;
+				}
+
+				/* Finish current period in phase with time base then go back to whole periods */
+				STK->LOAD = Local_RemainingTicks;
+				STK->VAL = STK_CLEAR;
+				SET_BIT(STK->CTRL,CTRL_ENABLE);
+				STK->LOAD = Global_TickPeriod - 1U;
+
+				/* Count slept periods, no timer is due within them so wheel only moves on */
+				Global_TickCount += Local_SleptPeriods;
+				for(Local_Iterator = 0 ; Local_Iterator < Local_SleptPeriods ; Local_Iterator++)
+				{
+					STK_TimerWheelAdvance();
+				}
+			}
+			else
+			{
+				/* Next deadline is too close: sleep with tick running */
+				STK_WAIT_FOR_INTERRUPT();
+			}
+
+			/* Leave critical section (wake-up interrupt runs now) */
+			STK_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+
+			/* Return slept periods */
+			*Copy_pSleptPeriods = Local_SleptPeriods;
+		}
+		else
+		{
+			/* Time base is not started */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: TimerLink          					                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint16_t Copy_TimerId                                          */
+/*                 Brief: Pool index of an active timer not linked to any slot    */
+/*                 Range: (0 --> STK_TIMERS_POOL_SIZE - 1)                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                          				  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Pushes timer into the wheel slot matching its expiry distance  */
+/*                 from current wheel time (O(1))                                 */
+/*--------------------------------------------------------------------------------*/
+static void STK_TimerLink(uint16_t Copy_TimerId)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_Distance = Global_TimerPool[Copy_TimerId].Expiry - Global_TimerWheelTime;
+	uint32_t Local_Level = 0;
+	uint32_t Local_Slot;
+	uint16_t Local_SlotIndex;
+
+	/* Find lowest level whose range covers expiry distance */
+	while(Local_Level < (STK_TIMER_WHEEL_LEVELS - 1U) && Local_Distance >= (1UL << ((Local_Level + 1U) * STK_TIMER_WHEEL_SLOT_BITS)))
+	{
+		Local_Level++;
+	}
+
+	/* Slot of the level is taken from expiry time bits of that level */
+	Local_Slot = (Global_TimerPool[Copy_TimerId].Expiry >> (Local_Level * STK_TIMER_WHEEL_SLOT_BITS)) & STK_TIMER_WHEEL_SLOT_MASK;
+	Local_SlotIndex = (uint16_t)((Local_Level * STK_TIMER_WHEEL_SLOTS) + Local_Slot);
+
+	/* Push timer at head of slot list */
+	Global_TimerPool[Copy_TimerId].Slot = Local_SlotIndex;
+	Global_TimerPool[Copy_TimerId].Prev = STK_TIMER_NONE;
+	Global_TimerPool[Copy_TimerId].Next = Global_TimerWheel[Local_SlotIndex];
+	if(Global_TimerWheel[Local_SlotIndex] != STK_TIMER_NONE)
+	{
+		Global_TimerPool[Global_TimerWheel[Local_SlotIndex]].Prev = Copy_TimerId;
+	}
+	Global_TimerWheel[Local_SlotIndex] = Copy_TimerId;
+
+	/* Mark slot as occupied */
+	Global_TimerWheelOccupancy[Local_Level] |= ((uint64_t)1U << Local_Slot);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: TimerUnlink          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint16_t Copy_TimerId                                          */
+/*                 Brief: Pool index of a timer linked to a wheel slot            */
+/*                 Range: (0 --> STK_TIMERS_POOL_SIZE - 1)                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                          				  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Removes timer from its wheel slot (O(1))                       */
+/*--------------------------------------------------------------------------------*/
+static void STK_TimerUnlink(uint16_t Copy_TimerId)
+{
+	/* Local Variables Definitions */
+	STK_Timer_t* Local_pTimer = &Global_TimerPool[Copy_TimerId];
+
+	/* Bypass timer in slot list */
+	if(Local_pTimer->Prev != STK_TIMER_NONE)
+	{
+		Global_TimerPool[Local_pTimer->Prev].Next = Local_pTimer->Next;
+	}
+	else
+	{
+		Global_TimerWheel[Local_pTimer->Slot] = Local_pTimer->Next;
+	}
+	if(Local_pTimer->Next != STK_TIMER_NONE)
+	{
+		Global_TimerPool[Local_pTimer->Next].Prev = Local_pTimer->Prev;
+	}
+
+	/* Mark slot as empty if it was its last timer */
+	if(Global_TimerWheel[Local_pTimer->Slot] == STK_TIMER_NONE)
+	{
+		Global_TimerWheelOccupancy[Local_pTimer->Slot / STK_TIMER_WHEEL_SLOTS] &= ~((uint64_t)1U << (Local_pTimer->Slot & STK_TIMER_WHEEL_SLOT_MASK));
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: TimerWheelAdvance          					                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None				                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                          				  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Advances wheel time by one period, cascades upper levels at    */
+/*                 slot boundaries and fires expired timers. Idle periods cost    */
+/*                 one occupancy bitmap test                                      */
+/*--------------------------------------------------------------------------------*/
+static void STK_TimerWheelAdvance(void)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_PrimaskState;
+	uint32_t Local_Level;
+	uint16_t Local_SlotIndex;
+	uint16_t Local_TimerId;
+	void(*Local_CallbackFunc)(void);
+
+	/* Wheel is shared with higher priority contexts that may start or cancel timers */
+	STK_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+	/* Advance wheel time by one period */
+	Global_TimerWheelTime++;
+
+	/* Cascade upper levels: each level moves its current slot down once lower level completes a round */
+	for(Local_Level = 1 ; Local_Level < STK_TIMER_WHEEL_LEVELS && (Global_TimerWheelTime & ((1UL << (Local_Level * STK_TIMER_WHEEL_SLOT_BITS)) - 1U)) == 0 ; Local_Level++)
+	{
+		/* Get current slot of the level */
+		Local_SlotIndex = (uint16_t)((Local_Level * STK_TIMER_WHEEL_SLOTS) + ((Global_TimerWheelTime >> (Local_Level * STK_TIMER_WHEEL_SLOT_BITS)) & STK_TIMER_WHEEL_SLOT_MASK));
+
+		/* Re-insert every timer of the slot relative to new wheel time (lands in a lower level) */
+		while(Global_TimerWheel[Local_SlotIndex] != STK_TIMER_NONE)
+		{
+			Local_TimerId = Global_TimerWheel[Local_SlotIndex];
+			STK_TimerUnlink(Local_TimerId);
+			STK_TimerLink(Local_TimerId);
+		}
+	}
+
+	/* Fire every timer of current level 0 slot (idle period costs this single test) */
+	Local_SlotIndex = (uint16_t)(Global_TimerWheelTime & STK_TIMER_WHEEL_SLOT_MASK);
+	while(Global_TimerWheel[Local_SlotIndex] != STK_TIMER_NONE)
+	{
+		/* Take expired timer out of the wheel */
+		Local_TimerId = Global_TimerWheel[Local_SlotIndex];
+		STK_TimerUnlink(Local_TimerId);
+		Local_CallbackFunc = Global_TimerPool[Local_TimerId].CallbackFunc;
+
+		/* Check if timer is periodic or one-shot */
+		if(Global_TimerPool[Local_TimerId].ReloadPeriods != STK_TIMER_ONE_SHOT)
+		{
+			/* Re-arm periodic timer from its previous expiry so that period does not drift */
+			Global_TimerPool[Local_TimerId].Expiry += Global_TimerPool[Local_TimerId].ReloadPeriods;
+			STK_TimerLink(Local_TimerId);
+		}
+		else
+		{
+			/* Give one-shot timer back to the pool */
+			Global_TimerPool[Local_TimerId].State = STK_TIMER_FREE;
+			Global_TimerPool[Local_TimerId].Next = Global_FreeTimersHead;
+			Global_FreeTimersHead = Local_TimerId;
+		}
+
+		/* Invoke timer callback outside critical section (it may start or cancel timers) */
+		STK_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+		Local_CallbackFunc();
+		STK_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+	}
+
+	/* Leave critical section */
+	STK_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+}
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                            	  INTERRUPT HANDLERS		                    	 */
@@ -396,20 +1153,32 @@ ERROR_STATUS_t STK_GetRemainingTime(uint32_t* Copy_pRemainingTime)
 void SysTick_Handler(void)
 {
 	/* Check source of SysTick exception handler */
-	if(Global_IntervalMode == STK_SINGLE_INTERVAL)
+	if(Global_IntervalMode == STK_FREE_RUNNING_TICK)
 	{
-		/* Disable SysTick Interrupt */
-		CLEAR_BIT(STK->CTRL,CTRL_TICKINT);
-
-		/* Stop (Disable) SysTick Timer */
-		CLEAR_BIT(STK->CTRL,CTRL_ENABLE);
+		/* Count elapsed period (VAL is never written so that time base does not drift) */
+		Global_TickCount++;
 
-		/* Clear SysTick Timer */
-		STK->LOAD = STK_CLEAR;
+		/* Drive software timer wheel */
+		STK_TimerWheelAdvance();
 	}
+	else
+	{
+		/* Check if interval is a single one */
+		if(Global_IntervalMode == STK_SINGLE_INTERVAL)
+		{
+			/* Disable SysTick Interrupt */
+			CLEAR_BIT(STK->CTRL,CTRL_TICKINT);
 
-	/* Clear Systick Timer Counter Flag through writing any value in VAL register */
-	STK->VAL = STK_CLEAR;
+			/* Stop (Disable) SysTick Timer */
+			CLEAR_BIT(STK->CTRL,CTRL_ENABLE);
+
+			/* Clear SysTick Timer */
+			STK->LOAD = STK_CLEAR;
+		}
+
+		/* Clear Systick Timer Counter Flag through writing any value in VAL register */
+		STK->VAL = STK_CLEAR;
+	}
 
 	/* Check if STK Callback Function is Registered or Not */
 	if(Global_CallbackFunction != NULL)
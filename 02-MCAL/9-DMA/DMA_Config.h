@@ -21,6 +21,33 @@
 #ifndef MCAL_DMA_CONFIG_H_
 #define MCAL_DMA_CONFIG_H_
 
+/*-------------------------------------------------------*/
+/* Set depth of scatter-gather transfer queue of each    */
+/* DMA channel (max number of pending descriptors):      */
+/*                                                       */
+/* Options	: - (1 --> 255)                              */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define DMA_TRANSFER_QUEUE_DEPTH  8U  /* Default: 8U */
 
+/*-------------------------------------------------------*/
+/* Set size in bytes below which DMA_Memcpy/DMA_Memset   */
+/* copy with CPU instead of paying DMA setup cost:       */
+/*                                                       */
+/* Options	: - (0 --> 65535)                            */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define DMA_MEMORY_ENGINE_CPU_THRESHOLD  32U  /* Default: 32U */
+
+/*-------------------------------------------------------*/
+/* Choose priority of DMA_Memcpy/DMA_Memset transfers:   */
+/*                                                       */
+/* Options	: - DMA_CHANNEL_PRIORITY_LOW                 */
+/* 			  - DMA_CHANNEL_PRIORITY_MEDIUM              */
+/* 			  - DMA_CHANNEL_PRIORITY_HIGH                */
+/* 			  - DMA_CHANNEL_PRIORITY_VERY_HIGH           */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define DMA_MEMORY_ENGINE_PRIORITY  DMA_CHANNEL_PRIORITY_LOW  /* Default: DMA_CHANNEL_PRIORITY_LOW */
 
 #endif /* MCAL_DMA_CONFIG_H_ */
@@ -44,6 +44,56 @@ typedef struct
 	uint16_t channelBlockLength;
 }DMA_ChannelConfig_t;
 
+/* DMA Channel Compiled Configuration Type (Packed CCRx image plus block length) */
+typedef struct
+{
+	uint32_t channelControlImage;		/* CCRx image (EN bit excluded) */
+	uint16_t channelBlockLength;		/* CNDTRx value */
+}DMA_ChannelCompiledConfig_t;
+
+/* DMA Stream Statistics Type */
+typedef struct
+{
+	uint32_t blocksDelivered;			/* Number of buffer halves handed to the stream consumer */
+	uint32_t itemsDelivered;            /* Number of data items handed to the stream consumer (throughput) */
+	uint32_t overruns;                  /* Number of times the consumer fell behind and a buffer half was overwritten */
+	uint32_t transferErrors;            /* Number of transfer errors raised while streaming */
+}DMA_StreamStatistics_t;
+
+/* DMA Scatter-Gather Transfer Descriptor Type */
+typedef struct
+{
+	uint32_t* pPeripheralAddress;		/* Peripheral side address (CPAR) */
+	uint32_t* pMemoryAddress;			/* Memory side address (CMAR) */
+	uint16_t length;					/* Number of data items to transfer (1 --> 65535) */
+	uint8_t peripheralSize;				/* DMA_PERIPHERAL_SIZE_x */
+	uint8_t memorySize;					/* DMA_MEMORY_SIZE_x */
+	uint8_t peripheralIncrementModeEnable;	/* DMA_PERIPHERAL_INCREMENT_MODE_x */
+	uint8_t memoryIncrementModeEnable;		/* DMA_MEMORY_INCREMENT_MODE_x */
+}DMA_TransferDescriptor_t;
+
+/* DMA Scatter-Gather Queue Statistics Type */
+typedef struct
+{
+	uint8_t currentDepth;				/* Number of queued descriptors (including the one being transferred) */
+	uint8_t maxDepth;					/* Highest number of queued descriptors seen */
+	uint32_t transfersCompleted;		/* Number of completed queued transfers */
+	uint32_t transferErrors;			/* Number of queued transfers ended by transfer error */
+	uint32_t lastGapLatency;			/* Last gap between two chained transfers (timestamp function units) */
+	uint32_t maxGapLatency;				/* Highest gap between two chained transfers (timestamp function units) */
+}DMA_QueueStatistics_t;
+
+/* DMA Channel Utilization Type */
+typedef struct
+{
+	uint8_t isAllocated;				/* Channel is currently owned through DMA_AllocateChannel */
+	uint8_t ownerRequestId;				/* Request line of current (or last) owner */
+	uint32_t allocations;				/* Number of times channel has been allocated */
+	uint32_t configurations;			/* Number of configuration requests on the channel */
+	uint32_t configurationsSkipped;		/* Number of configuration requests that hit the configuration cache */
+	uint32_t ownedTime;					/* Accumulated ownership time (timestamp function units) */
+}DMA_ChannelUtilization_t;
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                           	    INTERFACE MACROS			                     */
@@ -112,6 +162,69 @@ typedef struct
 #define DMA_TRANSFER_ERROR_INTERRUPT_DISABLE			0U
 #define DMA_TRANSFER_ERROR_INTERRUPT_ENABLE			    1U
 
+/* DMA Compile-Time Channel Configuration Image (Pass option macros above in DMA_ChannelConfig_t fields order, result */
+/* is a constant channelControlImage of DMA_ChannelCompiledConfig_t ready for DMA_ChannelApplyCompiledConfig)        */
+#define DMA_CHANNEL_CONFIG_IMAGE(Copy_TCIE,Copy_HTIE,Copy_TEIE,Copy_DIR,Copy_CIRC,Copy_PINC,Copy_MINC,Copy_PSIZE,Copy_MSIZE,Copy_PL,Copy_MEM2MEM)	\
+		((((uint32_t)(Copy_TCIE)    & 0x1U) << 1U)  |																							\
+		 (((uint32_t)(Copy_HTIE)    & 0x1U) << 2U)  |																							\
+		 (((uint32_t)(Copy_TEIE)    & 0x1U) << 3U)  |																							\
+		 (((uint32_t)(Copy_DIR)     & 0x1U) << 4U)  |																							\
+		 (((uint32_t)(Copy_CIRC)    & 0x1U) << 5U)  |																							\
+		 (((uint32_t)(Copy_PINC)    & 0x1U) << 6U)  |																							\
+		 (((uint32_t)(Copy_MINC)    & 0x1U) << 7U)  |																							\
+		 (((uint32_t)(Copy_PSIZE)   & 0x3U) << 8U)  |																							\
+		 (((uint32_t)(Copy_MSIZE)   & 0x3U) << 10U) |																							\
+		 (((uint32_t)(Copy_PL)      & 0x3U) << 12U) |																							\
+		 (((uint32_t)(Copy_MEM2MEM) & 0x1U) << 14U))
+
+/* DMA Channel Pool Masks (OR them to build pool of channels allowed to run DMA_Memcpy/DMA_Memset jobs) */
+#define DMA_CH1_POOL_MASK								0x01U
+#define DMA_CH2_POOL_MASK								0x02U
+#define DMA_CH3_POOL_MASK								0x04U
+#define DMA_CH4_POOL_MASK								0x08U
+#define DMA_CH5_POOL_MASK								0x10U
+#define DMA_CH6_POOL_MASK								0x20U
+#define DMA_CH7_POOL_MASK								0x40U
+
+/* DMA Peripheral Request Lines (Passed to DMA_AllocateChannel) */
+#define DMA_REQUEST_ADC1                        0U
+#define DMA_REQUEST_SPI1_RX                     1U
+#define DMA_REQUEST_SPI1_TX                     2U
+#define DMA_REQUEST_SPI2_RX                     3U
+#define DMA_REQUEST_SPI2_TX                     4U
+#define DMA_REQUEST_USART1_TX                   5U
+#define DMA_REQUEST_USART1_RX                   6U
+#define DMA_REQUEST_USART2_TX                   7U
+#define DMA_REQUEST_USART2_RX                   8U
+#define DMA_REQUEST_USART3_TX                   9U
+#define DMA_REQUEST_USART3_RX                   10U
+#define DMA_REQUEST_I2C1_TX                     11U
+#define DMA_REQUEST_I2C1_RX                     12U
+#define DMA_REQUEST_I2C2_TX                     13U
+#define DMA_REQUEST_I2C2_RX                     14U
+#define DMA_REQUEST_TIM1_CH1                    15U
+#define DMA_REQUEST_TIM1_CH2                    16U
+#define DMA_REQUEST_TIM1_CH3                    17U
+#define DMA_REQUEST_TIM1_CH4                    18U
+#define DMA_REQUEST_TIM1_TRIG                   19U
+#define DMA_REQUEST_TIM1_COM                    20U
+#define DMA_REQUEST_TIM1_UP                     21U
+#define DMA_REQUEST_TIM2_CH1                    22U
+#define DMA_REQUEST_TIM2_CH2                    23U
+#define DMA_REQUEST_TIM2_CH3                    24U
+#define DMA_REQUEST_TIM2_CH4                    25U
+#define DMA_REQUEST_TIM2_UP                     26U
+#define DMA_REQUEST_TIM3_CH1                    27U
+#define DMA_REQUEST_TIM3_CH3                    28U
+#define DMA_REQUEST_TIM3_CH4                    29U
+#define DMA_REQUEST_TIM3_UP                     30U
+#define DMA_REQUEST_TIM3_TRIG                   31U
+#define DMA_REQUEST_TIM4_CH1                    32U
+#define DMA_REQUEST_TIM4_CH2                    33U
+#define DMA_REQUEST_TIM4_CH3                    34U
+#define DMA_REQUEST_TIM4_UP                     35U
+#define DMA_REQUEST_MEM_TO_MEM                  36U
+
 /* Possible DMA Interrupt Flags */
 #define DMA_GLOBAL_INTERRUPT_FLAG           			0U
 #define DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG			1U
@@ -142,9 +255,60 @@ typedef struct
 /* @Return		 : ERROR_STATUS_t                                          		  */
 /*--------------------------------------------------------------------------------*/
 /* @Description	 : Initializes any DMA channel based on passed channel id         */
+/*                 The whole configuration is validated first then written with   */
+/*                 a single CCRx store (skipped when channel already holds the    */
+/*                 same configuration) plus CNDTRx store                          */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t DMA_ChannelInit(uint8_t Copy_ChannelId ,DMA_ChannelConfig_t* Copy_pChannelConfig);
 
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ChannelConfigCompile          		                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : DMA_ChannelConfig_t* Copy_pChannelConfig			              */
+/* 			       Brief: Pointer to DMA channel configurations                   */
+/* 			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : DMA_ChannelCompiledConfig_t* Copy_pCompiledConfig              */
+/*                 Brief: Pointer to variable that will hold packed CCRx image    */
+/*                        and block length                                        */
+/*                 Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function validates a channel configuration once and packs */
+/*                 it into a CCRx image so that switching a channel between       */
+/*                 several transfer profiles at runtime costs one CCRx store plus */
+/*                 one CNDTRx store (DMA_ChannelApplyCompiledConfig). Output is   */
+/*                 written only if whole configuration is valid                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_ChannelConfigCompile(DMA_ChannelConfig_t* Copy_pChannelConfig , DMA_ChannelCompiledConfig_t* Copy_pCompiledConfig);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ChannelApplyCompiledConfig          		                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/* 			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/* 			       -------------------------------------------------------------- */
+/* 				   DMA_ChannelCompiledConfig_t* Copy_pCompiledConfig			  */
+/* 			       Brief: Pointer to configuration built by                       */
+/*                        DMA_ChannelConfigCompile or DMA_CHANNEL_CONFIG_IMAGE    */
+/* 			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function applies a pre-validated configuration to a       */
+/*                 disabled channel with a single CCRx store plus CNDTRx store    */
+/*                 (CCRx store is skipped when channel already holds the image)   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_ChannelApplyCompiledConfig(uint8_t Copy_ChannelId , DMA_ChannelCompiledConfig_t* Copy_pCompiledConfig);
+
 /*--------------------------------------------------------------------------------*/
 /* @Function Name: ChannelStart          			                              */
 /*--------------------------------------------------------------------------------*/
@@ -316,4 +480,370 @@ ERROR_STATUS_t DMA_GetInterruptFlagStatus(uint8_t Copy_ChannelId , uint8_t Copy_
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t DMA_ClearInterruptFlag(uint8_t Copy_ChannelId , uint8_t Copy_InterruptFlagId);
 
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: StreamStart          			                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*			       -------------------------------------------------------------- */
+/*	               uint32_t* Copy_pPeripheralAddress                              */
+/*			       Brief: Pointer to peripheral data register (CPAR)              */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               void* Copy_pBuffer                                             */
+/*			       Brief: Pointer to stream buffer (CMAR) split into two halves   */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               uint16_t Copy_Length                                           */
+/*			       Brief: Number of data items in the whole buffer                */
+/*			       Range: Even value (2 --> 65534)                                */
+/*			       -------------------------------------------------------------- */
+/*	               void(*Copy_ConsumerFunc)(void*,uint16_t)                       */
+/*			       Brief: Pointer to function that consumes each completed half   */
+/*			              (pointer to half and its length in data items)          */
+/*			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function starts a continuous double-buffer (ping-pong)    */
+/*                 stream on a channel already initialized by DMA_ChannelInit.    */
+/*                 Circular mode and half/complete/error interrupts are forced on */
+/*                 and the consumer is called from the channel IRQ with the half  */
+/*                 of the buffer that has just been filled (zero CPU copies)      */
+/*                 Returns BUSY_FUNC if channel is chaining queued transfers or   */
+/*                 running a Memcpy/Memset job                                    */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_StreamStart(uint8_t Copy_ChannelId , uint32_t* Copy_pPeripheralAddress , void* Copy_pBuffer , uint16_t Copy_Length ,
+							   void(*Copy_ConsumerFunc)(void* Copy_pBlock , uint16_t Copy_BlockLength));
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: StreamStop          			                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function stops a running stream and disables its channel  */
+/*                 Returns RT_NOK if channel is not streaming (never started,     */
+/*                 already stopped or ended by a transfer error)                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_StreamStop(uint8_t Copy_ChannelId);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetStreamStatistics      		                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : DMA_StreamStatistics_t* Copy_pStatistics                       */
+/*                 Brief: Pointer to variable that will hold stream counters      */
+/*                 Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gets throughput and overrun counters of the      */
+/*                 stream running (or last run) on selected channel               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_GetStreamStatistics(uint8_t Copy_ChannelId , DMA_StreamStatistics_t* Copy_pStatistics);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: QueueTransfer          			                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*			       -------------------------------------------------------------- */
+/*	               DMA_TransferDescriptor_t* Copy_pDescriptor                     */
+/*			       Brief: Pointer to transfer descriptor (copied into the queue)  */
+/*			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function appends a transfer to the scatter-gather queue   */
+/*                 of a channel already initialized by DMA_ChannelInit. If the    */
+/*                 channel is idle the transfer starts at once, otherwise it is   */
+/*                 chained from transfer complete IRQ of the previous one.        */
+/*                 Returns BUSY_FUNC if queue is full, a stream is running or a   */
+/*                 Memcpy/Memset job owns the channel                             */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_QueueTransfer(uint8_t Copy_ChannelId , DMA_TransferDescriptor_t* Copy_pDescriptor);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: QueueFlush          			                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function aborts current queued transfer and drops all     */
+/*                 pending descriptors of selected channel                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_QueueFlush(uint8_t Copy_ChannelId);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: RegisterTimestampFunc      		                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint32_t(*Copy_TimestampFunc)(void)                            */
+/* 			       Brief: Pointer to free-running time base used to measure gap   */
+/*                        latency of chained transfers and channels ownership     */
+/*                        time (NULL disables both)                               */
+/*			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                          		          */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function sets time base of DMA timing statistics         */
+/*--------------------------------------------------------------------------------*/
+void DMA_RegisterTimestampFunc(uint32_t(*Copy_TimestampFunc)(void));
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetQueueStatistics      		                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : DMA_QueueStatistics_t* Copy_pStatistics                        */
+/*                 Brief: Pointer to variable that will hold queue counters       */
+/*                 Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gets queue depth and gap latency statistics of   */
+/*                 selected channel                                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_GetQueueStatistics(uint8_t Copy_ChannelId , DMA_QueueStatistics_t* Copy_pStatistics);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Memcpy                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelPoolMask                                   */
+/* 			       Brief: Channels allowed to run the job (DMA_CHx_POOL_MASK ORed)*/
+/*			       Range: (0x01 --> 0x7F)                                         */
+/*			       -------------------------------------------------------------- */
+/*	               void* Copy_pDestination                                        */
+/*			       Brief: Pointer to destination memory                           */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               const void* Copy_pSource                                       */
+/*			       Brief: Pointer to source memory                                */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               uint32_t Copy_Size                                             */
+/*			       Brief: Number of bytes                                         */
+/*			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function copies memory through the first idle channel of  */
+/*                 the pool in memory to memory mode and waits for completion.    */
+/*                 Widest item size allowed by alignment is used, unaligned       */
+/*                 head/tail bytes and sizes below                                */
+/*                 DMA_MEMORY_ENGINE_CPU_THRESHOLD are copied by CPU and sizes    */
+/*                 above 65535 items are split into chunks.                       */
+/*                 Returns BUSY_FUNC if no channel of the pool is idle            */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_Memcpy(uint8_t Copy_ChannelPoolMask , void* Copy_pDestination , const void* Copy_pSource , uint32_t Copy_Size);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: MemcpyAsync                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelPoolMask                                   */
+/* 			       Brief: Channels allowed to run the job (DMA_CHx_POOL_MASK ORed)*/
+/*			       Range: (0x01 --> 0x7F)                                         */
+/*			       -------------------------------------------------------------- */
+/*	               void* Copy_pDestination                                        */
+/*			       Brief: Pointer to destination memory                           */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               const void* Copy_pSource                                       */
+/*			       Brief: Pointer to source memory                                */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               uint32_t Copy_Size                                             */
+/*			       Brief: Number of bytes                                         */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               void(*Copy_NotificationFunc)(ERROR_STATUS_t)                   */
+/*			       Brief: Completion callback called from channel IRQ with job    */
+/*                        status (RT_OK or RT_NOK on transfer error)              */
+/*			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Asynchronous version of DMA_Memcpy. It returns once the job is */
+/*                 started, chunks are chained from channel IRQ (channel IRQ must */
+/*                 be enabled on NVIC) and callback is called at the end.         */
+/*                 Jobs done entirely by CPU call the callback before returning   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_MemcpyAsync(uint8_t Copy_ChannelPoolMask , void* Copy_pDestination , const void* Copy_pSource , uint32_t Copy_Size ,
+						       void(*Copy_NotificationFunc)(ERROR_STATUS_t Copy_JobStatus));
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Memset                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelPoolMask                                   */
+/* 			       Brief: Channels allowed to run the job (DMA_CHx_POOL_MASK ORed)*/
+/*			       Range: (0x01 --> 0x7F)                                         */
+/*			       -------------------------------------------------------------- */
+/*	               void* Copy_pDestination                                        */
+/*			       Brief: Pointer to destination memory                           */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               uint8_t Copy_Value                                             */
+/*			       Brief: Byte value to fill destination with                     */
+/*			       Range: (0 --> 255)                                             */
+/*			       -------------------------------------------------------------- */
+/*	               uint32_t Copy_Size                                             */
+/*			       Brief: Number of bytes                                         */
+/*			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function fills memory with a byte value through the first */
+/*                 idle channel of the pool (source address does not increment)   */
+/*                 and waits for completion. Same sizing rules of DMA_Memcpy      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_Memset(uint8_t Copy_ChannelPoolMask , void* Copy_pDestination , uint8_t Copy_Value , uint32_t Copy_Size);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: MemsetAsync                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelPoolMask                                   */
+/* 			       Brief: Channels allowed to run the job (DMA_CHx_POOL_MASK ORed)*/
+/*			       Range: (0x01 --> 0x7F)                                         */
+/*			       -------------------------------------------------------------- */
+/*	               void* Copy_pDestination                                        */
+/*			       Brief: Pointer to destination memory                           */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               uint8_t Copy_Value                                             */
+/*			       Brief: Byte value to fill destination with                     */
+/*			       Range: (0 --> 255)                                             */
+/*			       -------------------------------------------------------------- */
+/*	               uint32_t Copy_Size                                             */
+/*			       Brief: Number of bytes                                         */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               void(*Copy_NotificationFunc)(ERROR_STATUS_t)                   */
+/*			       Brief: Completion callback called from channel IRQ with job    */
+/*                        status (RT_OK or RT_NOK on transfer error)              */
+/*			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Asynchronous version of DMA_Memset (same rules of               */
+/*                 DMA_MemcpyAsync)                                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_MemsetAsync(uint8_t Copy_ChannelPoolMask , void* Copy_pDestination , uint8_t Copy_Value , uint32_t Copy_Size ,
+						       void(*Copy_NotificationFunc)(ERROR_STATUS_t Copy_JobStatus));
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: AllocateChannel          			                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_RequestId                                         */
+/* 			       Brief: Peripheral request line that needs a channel            */
+/*			       Range: (DMA_REQUEST_ADC1 --> DMA_REQUEST_MEM_TO_MEM)           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pChannelId                                       */
+/*                 Brief: Pointer to variable that will hold allocated channel id */
+/*                 Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function hands out a free channel that is legal for the   */
+/*                 passed request line (peripheral requests are hard-wired to one */
+/*                 channel, memory to memory may use any channel, highest first). */
+/*                 Returns BUSY_FUNC if every legal channel is already owned      */
+/*                 (allocated, running a Memcpy/Memset job, streaming or chaining */
+/*                 queued transfers)                                              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_AllocateChannel(uint8_t Copy_RequestId , uint8_t* Copy_pChannelId);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FreeChannel          			                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Channel id returned by DMA_AllocateChannel              */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function disables an allocated channel and gives it back  */
+/*                 to the pool (its configuration cache is kept so the next owner */
+/*                 with same configuration skips register rewrite)                */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_FreeChannel(uint8_t Copy_ChannelId);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetChannelUtilization      		                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : DMA_ChannelUtilization_t* Copy_pUtilization                    */
+/*                 Brief: Pointer to variable that will hold channel counters     */
+/*                 Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gets ownership and configuration counters of     */
+/*                 selected channel                                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_GetChannelUtilization(uint8_t Copy_ChannelId , DMA_ChannelUtilization_t* Copy_pUtilization);
+
 #endif /* MCAL_DMA_INTERFACE_H_ */
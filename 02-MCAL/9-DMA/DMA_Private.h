@@ -61,6 +61,9 @@ typedef struct
 #define CCR_CIRC            5U
 #define CCR_PINC            6U
 #define CCR_MINC            7U
+#define CCR_PSIZE           8U
+#define CCR_MSIZE           10U
+#define CCR_PL              12U
 #define CCR_MEM2MEM         14U
 
 /*-----------------------------------------------------------------------------------*/
@@ -92,4 +95,119 @@ typedef struct
 #define DMA_MIN_BLOCK_LENGTH_VAL                            0U
 #define DMA_MAX_BLOCK_LENGTH_VAL                            65535U
 
+/* Define Number of DMA Channels */
+#define DMA_CHANNELS_NUMBER                                 7U
+
+/* Define Memory Size Field Mask (After Shifting CCRx by CCR_MSIZE) */
+#define DMA_MEMORY_SIZE_FIELD_MASK                          0x00000003U
+
+/* Define Min Stream Buffer Length Value (Two halves of one item each at least) */
+#define DMA_MIN_STREAM_LENGTH_VAL                           2U
+
+/* Define Mask of CCRx Configuration Bits (MEM2MEM --> TCIE, EN excluded) */
+#define DMA_CCR_CONFIG_BITS_MASK                            0x00007FFEU
+
+/* Define Mask of CCRx Fields Reprogrammed per Queued Transfer (CIRC, PINC, MINC, PSIZE and MSIZE) */
+#define DMA_QUEUE_TRANSFER_FIELDS_MASK                      0xFFFFF01FU
+
+/* Define Min Queued Transfer Length Value */
+#define DMA_MIN_QUEUE_TRANSFER_LENGTH_VAL                   1U
+
+/* Define Address/Size Alignment Masks used to pick widest legal memory engine transfer size */
+#define DMA_WORD_ALIGNMENT_MASK                             0x00000003U
+#define DMA_HALF_WORD_ALIGNMENT_MASK                        0x00000001U
+
+/* Define Byte Replication Factor used to build a memset word pattern */
+#define DMA_BYTE_PATTERN_REPLICATION                        0x01010101U
+
+/* Define Mask of All DMA Channels in a Channel Pool */
+#define DMA_ALL_CHANNELS_POOL_MASK                          0x0000007FU
+
+/* Define Number of DMA Peripheral Request Lines (DMA_REQUEST_ADC1 --> DMA_REQUEST_MEM_TO_MEM) */
+#define DMA_REQUESTS_NUMBER                                 37U
+
+/* Define Interrupt Flags Nibble of a Channel in ISR/IFCR Registers */
+#define DMA_CHANNEL_FLAGS_MASK                              0x0000000FU
+#define DMA_CHANNEL_FLAGS_WIDTH                             4U
+
+/* Critical section macros are Cortex-M3 specific, a host build (05-TEST) defines its own before this header */
+#ifndef DMA_ENTER_CRITICAL_SECTION
+
+/* Save PRIMASK then mask configurable interrupts (queue is shared between thread and channel IRQ) */
+#define DMA_ENTER_CRITICAL_SECTION(Copy_PrimaskState)		__asm volatile("MRS %0, PRIMASK\n\tCPSID I" : "=r"(Copy_PrimaskState) : : "memory")
+
+/* Restore PRIMASK saved by DMA_ENTER_CRITICAL_SECTION */
+#define DMA_EXIT_CRITICAL_SECTION(Copy_PrimaskState)		__asm volatile("MSR PRIMASK, %0" : : "r"(Copy_PrimaskState) : "memory")
+
+#endif
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                              PRIVATE DATA TYPES		       		    		     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* DMA Channel Interrupt Descriptor Type (Callbacks invoked by the shared IRQ dispatcher) */
+typedef struct
+{
+	void(*TransferCompleteNotificationFunc)(void);	  /* Pointer to channel transfer complete callback function */
+	void(*HalfTransferNotificationFunc)(void);        /* Pointer to channel half transfer callback function */
+	void(*TransferErrorNotificationFunc)(void);       /* Pointer to channel transfer error callback function */
+}DMA_ChannelDescriptor_t;
+
+/* DMA Channel Stream (Double-Buffer) State Type */
+typedef struct
+{
+	void(*ConsumerFunc)(void* Copy_pBlock , uint16_t Copy_BlockLength);	/* Pointer to consumer of completed buffer halves (NULL if stream is stopped) */
+	uint8_t* pBuffer;                                                       /* Start address of stream buffer */
+	uint16_t HalfLength;                                                    /* Number of data items in one buffer half */
+	uint8_t  ItemSize;                                                      /* Size of one data item in bytes */
+	uint32_t BlocksDelivered;                                               /* Number of buffer halves handed to consumer */
+	uint32_t ItemsDelivered;                                                /* Number of data items handed to consumer */
+	uint32_t Overruns;                                                      /* Number of buffer halves overwritten before being consumed */
+	uint32_t TransferErrors;                                                /* Number of transfer errors raised while streaming */
+}DMA_StreamState_t;
+
+/* DMA Channel Scatter-Gather Queue State Type (Descriptors ring itself is defined with public descriptor type) */
+typedef struct
+{
+	uint8_t Head;                       /* Index of descriptor currently being transferred */
+	uint8_t Tail;                       /* Index of next free descriptor slot */
+	volatile uint8_t Count;             /* Number of queued descriptors (including the one being transferred) */
+	volatile uint8_t Active;            /* Channel is chaining queued descriptors */
+	uint8_t MaxDepth;                   /* Highest number of queued descriptors seen */
+	uint32_t TransfersCompleted;        /* Number of completed queued transfers */
+	uint32_t TransferErrors;            /* Number of queued transfers ended by transfer error */
+	uint32_t LastGapLatency;            /* Time from servicing a completion to starting next transfer */
+	uint32_t MaxGapLatency;             /* Highest gap latency seen */
+}DMA_TransferQueueState_t;
+
+/* DMA Memory Engine (Memcpy/Memset) Job State Type */
+typedef struct
+{
+	uint32_t SourceAddress;                         /* Address of next chunk source */
+	uint32_t DestinationAddress;                    /* Address of next chunk destination */
+	uint32_t RemainingItems;                        /* Number of data items still to be transferred */
+	uint32_t Pattern;                               /* Replicated memset pattern (source of memset jobs) */
+	uint32_t ChunkItems;                            /* Number of data items of chunk in flight */
+	uint8_t  SizeShift;                             /* log2 of data item size in bytes */
+	uint8_t  SourceIncrement;                       /* Source increments (memcpy) or not (memset) */
+	volatile uint8_t Busy;                          /* Channel is owned by a memory engine job */
+	void(*NotificationFunc)(ERROR_STATUS_t Copy_JobStatus);	/* Completion callback of asynchronous jobs (NULL for synchronous ones) */
+}DMA_MemoryJob_t;
+
+/* DMA Channel Ownership and Configuration Cache State Type */
+typedef struct
+{
+	uint8_t  Allocated;                             /* Channel is owned through DMA_AllocateChannel */
+	uint8_t  OwnerRequestId;                        /* Request line of current (or last) owner */
+	uint8_t  ConfigCacheValid;                      /* CachedCCR holds last configuration image applied on the channel */
+	uint32_t CachedCCR;                             /* CCRx image (EN excluded) written by last configuration */
+	uint32_t Allocations;                           /* Number of times channel has been allocated */
+	uint32_t Configurations;                        /* Number of configuration requests */
+	uint32_t ConfigurationsSkipped;                 /* Number of configuration requests that hit the cache */
+	uint32_t OwnedTime;                             /* Accumulated ownership time of released allocations */
+	uint32_t AllocationTimestamp;                   /* Time at which current allocation started */
+}DMA_ChannelOwnership_t;
+
 #endif /* MCAL_DMA_PRIVATE_H_ */
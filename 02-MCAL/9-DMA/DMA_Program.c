@@ -31,14 +31,75 @@
 #include "DMA_Config.h"
 #include "DMA_Interface.h"
 
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                           PRIVATE FUNCTIONS PROTOTYPES		          	         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void DMA_IRQDispatch(uint8_t Copy_ChannelId);
+static void DMA_StreamService(uint8_t Copy_ChannelId , uint32_t Copy_ChannelFlags);
+static void DMA_QueueService(uint8_t Copy_ChannelId , uint32_t Copy_ChannelFlags);
+static void DMA_QueueLoadTransfer(uint8_t Copy_ChannelId);
+static ERROR_STATUS_t DMA_MemoryJobSubmit(uint8_t Copy_ChannelPoolMask , uint8_t* Copy_pDestination , const uint8_t* Copy_pSource ,
+										  uint32_t Copy_Size , uint8_t Copy_SourceIncrement , void(*Copy_NotificationFunc)(ERROR_STATUS_t Copy_JobStatus));
+static void DMA_MemoryJobLoadChunk(uint8_t Copy_ChannelId);
+static void DMA_MemoryJobService(uint8_t Copy_ChannelId , uint32_t Copy_ChannelFlags);
+static void DMA_CpuCopy(uint8_t* Copy_pDestination , const uint8_t* Copy_pSource , uint32_t Copy_Size , uint8_t Copy_SourceIncrement);
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                            GLOBAL VARIABLES DEFINITIONS		                     */
 /*                                                                                   */
 /*-----------------------------------------------------------------------------------*/
-static void(*DMA_TransferCompleteNotificationFunc[7])(void) = {NULL};		   /* Array of pointers to DMA seven channels transfer complete callback functions */
-static void(*DMA_HalfTransferNotificationFunc[7])(void) = {NULL};               /* Array of pointers to DMA seven channels half transfer callback functions */
-static void(*DMA_TransferErrorNotificationFunc[7])(void) = {NULL};              /* Array of pointers to DMA seven channels transfer error callback functions */
+static DMA_ChannelDescriptor_t DMA_ChannelDescriptor[DMA_CHANNELS_NUMBER] = {{NULL}};	/* Table of DMA seven channels interrupt descriptors (callback functions) */
+static DMA_StreamState_t DMA_StreamState[DMA_CHANNELS_NUMBER] = {{NULL}};				/* Table of DMA seven channels double-buffer stream states */
+static DMA_TransferDescriptor_t DMA_TransferQueue[DMA_CHANNELS_NUMBER][DMA_TRANSFER_QUEUE_DEPTH];	/* Scatter-gather descriptors ring of each DMA channel */
+static DMA_TransferQueueState_t DMA_TransferQueueState[DMA_CHANNELS_NUMBER] = {{0}};		/* Scatter-gather queue state of each DMA channel */
+static uint32_t(*DMA_TimestampFunc)(void) = NULL;									/* Time base of DMA timing statistics (gap latency, ownership time) */
+static DMA_MemoryJob_t DMA_MemoryJob[DMA_CHANNELS_NUMBER] = {{0}};						/* Memory engine (Memcpy/Memset) job state of each DMA channel */
+static DMA_ChannelOwnership_t DMA_ChannelOwnership[DMA_CHANNELS_NUMBER] = {{0}};			/* Ownership and configuration cache state of each DMA channel */
+
+/* Legal channels of each peripheral request line (DMA1 request mapping of STM32F103) */
+static const uint8_t DMA_RequestChannelPool[DMA_REQUESTS_NUMBER] =
+{
+	DMA_CH1_POOL_MASK,           /* DMA_REQUEST_ADC1 */
+	DMA_CH2_POOL_MASK,           /* DMA_REQUEST_SPI1_RX */
+	DMA_CH3_POOL_MASK,           /* DMA_REQUEST_SPI1_TX */
+	DMA_CH4_POOL_MASK,           /* DMA_REQUEST_SPI2_RX */
+	DMA_CH5_POOL_MASK,           /* DMA_REQUEST_SPI2_TX */
+	DMA_CH4_POOL_MASK,           /* DMA_REQUEST_USART1_TX */
+	DMA_CH5_POOL_MASK,           /* DMA_REQUEST_USART1_RX */
+	DMA_CH7_POOL_MASK,           /* DMA_REQUEST_USART2_TX */
+	DMA_CH6_POOL_MASK,           /* DMA_REQUEST_USART2_RX */
+	DMA_CH2_POOL_MASK,           /* DMA_REQUEST_USART3_TX */
+	DMA_CH3_POOL_MASK,           /* DMA_REQUEST_USART3_RX */
+	DMA_CH6_POOL_MASK,           /* DMA_REQUEST_I2C1_TX */
+	DMA_CH7_POOL_MASK,           /* DMA_REQUEST_I2C1_RX */
+	DMA_CH4_POOL_MASK,           /* DMA_REQUEST_I2C2_TX */
+	DMA_CH5_POOL_MASK,           /* DMA_REQUEST_I2C2_RX */
+	DMA_CH2_POOL_MASK,           /* DMA_REQUEST_TIM1_CH1 */
+	DMA_CH3_POOL_MASK,           /* DMA_REQUEST_TIM1_CH2 */
+	DMA_CH6_POOL_MASK,           /* DMA_REQUEST_TIM1_CH3 */
+	DMA_CH4_POOL_MASK,           /* DMA_REQUEST_TIM1_CH4 */
+	DMA_CH4_POOL_MASK,           /* DMA_REQUEST_TIM1_TRIG */
+	DMA_CH4_POOL_MASK,           /* DMA_REQUEST_TIM1_COM */
+	DMA_CH5_POOL_MASK,           /* DMA_REQUEST_TIM1_UP */
+	DMA_CH5_POOL_MASK,           /* DMA_REQUEST_TIM2_CH1 */
+	DMA_CH7_POOL_MASK,           /* DMA_REQUEST_TIM2_CH2 */
+	DMA_CH1_POOL_MASK,           /* DMA_REQUEST_TIM2_CH3 */
+	DMA_CH7_POOL_MASK,           /* DMA_REQUEST_TIM2_CH4 */
+	DMA_CH2_POOL_MASK,           /* DMA_REQUEST_TIM2_UP */
+	DMA_CH6_POOL_MASK,           /* DMA_REQUEST_TIM3_CH1 */
+	DMA_CH2_POOL_MASK,           /* DMA_REQUEST_TIM3_CH3 */
+	DMA_CH3_POOL_MASK,           /* DMA_REQUEST_TIM3_CH4 */
+	DMA_CH3_POOL_MASK,           /* DMA_REQUEST_TIM3_UP */
+	DMA_CH6_POOL_MASK,           /* DMA_REQUEST_TIM3_TRIG */
+	DMA_CH1_POOL_MASK,           /* DMA_REQUEST_TIM4_CH1 */
+	DMA_CH4_POOL_MASK,           /* DMA_REQUEST_TIM4_CH2 */
+	DMA_CH5_POOL_MASK,           /* DMA_REQUEST_TIM4_CH3 */
+	DMA_CH7_POOL_MASK,           /* DMA_REQUEST_TIM4_UP */
+	DMA_CH1_POOL_MASK | DMA_CH2_POOL_MASK | DMA_CH3_POOL_MASK | DMA_CH4_POOL_MASK | DMA_CH5_POOL_MASK | DMA_CH6_POOL_MASK | DMA_CH7_POOL_MASK /* DMA_REQUEST_MEM_TO_MEM */
+};
 
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
@@ -64,11 +125,15 @@ static void(*DMA_TransferErrorNotificationFunc[7])(void) = {NULL};
 /* @Return		 : ERROR_STATUS_t                                          		  */
 /*--------------------------------------------------------------------------------*/
 /* @Description	 : Initializes any DMA channel based on passed channel id         */
+/*                 The whole configuration is validated first then written with   */
+/*                 a single CCRx store (skipped when channel already holds the    */
+/*                 same configuration) plus CNDTRx store                          */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t DMA_ChannelInit(uint8_t Copy_ChannelId ,DMA_ChannelConfig_t* Copy_pChannelConfig)
 {
 	/* Local Variables Definitions */
 	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+	DMA_ChannelCompiledConfig_t Local_CompiledConfig;
 
 	/* Check if passed pointer is NULL pointer or not */
 	if(Copy_pChannelConfig != NULL)
@@ -76,276 +141,329 @@ ERROR_STATUS_t DMA_ChannelInit(uint8_t Copy_ChannelId ,DMA_ChannelConfig_t* Copy
 		/* Check if passed channel id is within valid range or not */
 		if(Copy_ChannelId >= DMA_CH1 && Copy_ChannelId <= DMA_CH7)
 		{
-			/* Make sure that selected DMA channel is disabled before configuration through clearing EN bit in CCRx register */
-			CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_EN);
+			/* Validate passed configuration and pack it into a CCRx image */
+			Local_ErrorStatus = DMA_ChannelConfigCompile(Copy_pChannelConfig,&Local_CompiledConfig);
 
-			/*********************************Memory To Memory Mode Configuration*********************************/
-			/* Check if memory to memory mode is enabled or not based on passed configuration */
-			if(Copy_pChannelConfig->memToMemModeEnable == DMA_MEM_TO_MEM_MODE_ENABLE)
+			/* Apply configuration only if it is valid as a whole (channel is never left half configured) */
+			if(Local_ErrorStatus == RT_OK)
 			{
-				/* Set MEM2MEM bit in CCRx register */
-				SET_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_MEM2MEM);
-			}
-			else if(Copy_pChannelConfig->memToMemModeEnable == DMA_MEM_TO_MEM_MODE_DISABLE)
-			{
-				/* Clear MEM2MEM bit in CCRx register */
-				CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_MEM2MEM);
-			}
-			else
-			{
-				/* Out of range error */
-				Local_ErrorStatus = OUT_OF_RANGE;
+				/* Apply packed configuration with a single CCRx store plus CNDTRx store */
+				Local_ErrorStatus = DMA_ChannelApplyCompiledConfig(Copy_ChannelId,&Local_CompiledConfig);
 			}
+		}
+		else
+		{
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_ErrorStatus = NULL_POINTER;
+	}
 
-			/*********************************Channel Priority Level Configuration*********************************/
-			/* Clear channel priority level bits of CCRx register */
-			DMA->Channel[Copy_ChannelId].CCR &= DMA_CHANNEL_PRIORITY_MASK;
+	return Local_ErrorStatus;
+}
 
-			/* Check channel priority level based on passed configuration */
-			switch(Copy_pChannelConfig->channelPriorityLevel)
-			{
-				case DMA_CHANNEL_PRIORITY_LOW:
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ChannelConfigCompile          		                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : DMA_ChannelConfig_t* Copy_pChannelConfig			              */
+/* 			       Brief: Pointer to DMA channel configurations                   */
+/* 			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : DMA_ChannelCompiledConfig_t* Copy_pCompiledConfig              */
+/*                 Brief: Pointer to variable that will hold packed CCRx image    */
+/*                        and block length                                        */
+/*                 Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function validates a channel configuration once and packs */
+/*                 it into a CCRx image so that switching a channel between       */
+/*                 several transfer profiles at runtime costs one CCRx store plus */
+/*                 one CNDTRx store (DMA_ChannelApplyCompiledConfig). Output is   */
+/*                 written only if whole configuration is valid                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_ChannelConfigCompile(DMA_ChannelConfig_t* Copy_pChannelConfig , DMA_ChannelCompiledConfig_t* Copy_pCompiledConfig)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+	uint32_t Local_CCR = 0;			/* CCRx image built in a core register instead of volatile read-modify-write on CCRx */
 
-					/* Set channel priority level bits of CCRx register to 00 */
-					DMA->Channel[Copy_ChannelId].CCR |= DMA_CHANNEL_PRIORITY_LOW_VAL;
+	/* Check if passed pointers are NULL pointers or not */
+	if(Copy_pChannelConfig != NULL && Copy_pCompiledConfig != NULL)
+	{
+		/*********************************Memory To Memory Mode Configuration*********************************/
+		/* Check if memory to memory mode is enabled or not based on passed configuration */
+		if(Copy_pChannelConfig->memToMemModeEnable == DMA_MEM_TO_MEM_MODE_ENABLE)
+		{
+			/* Set MEM2MEM bit in CCRx image */
+			SET_BIT(Local_CCR,CCR_MEM2MEM);
+		}
+		else if(Copy_pChannelConfig->memToMemModeEnable == DMA_MEM_TO_MEM_MODE_DISABLE)
+		{
+			/* Clear MEM2MEM bit in CCRx image */
+			CLEAR_BIT(Local_CCR,CCR_MEM2MEM);
+		}
+		else
+		{
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
+		}
 
-					break;
-				case DMA_CHANNEL_PRIORITY_MEDIUM:
+		/*********************************Channel Priority Level Configuration*********************************/
+		/* Clear channel priority level bits of CCRx image */
+		Local_CCR &= DMA_CHANNEL_PRIORITY_MASK;
 
-					/* Set channel priority level bits of CCRx register to 01 */
-					DMA->Channel[Copy_ChannelId].CCR |= DMA_CHANNEL_PRIORITY_MEDIUM_VAL;
+		/* Check channel priority level based on passed configuration */
+		switch(Copy_pChannelConfig->channelPriorityLevel)
+		{
+			case DMA_CHANNEL_PRIORITY_LOW:
 
-					break;
-				case DMA_CHANNEL_PRIORITY_HIGH:
+				/* Set channel priority level bits of CCRx image to 00 */
+				Local_CCR |= DMA_CHANNEL_PRIORITY_LOW_VAL;
 
-					/* Set channel priority level bits of CCRx register to 10 */
-					DMA->Channel[Copy_ChannelId].CCR |= DMA_CHANNEL_PRIORITY_HIGH_VAL;
+				break;
+			case DMA_CHANNEL_PRIORITY_MEDIUM:
 
-					break;
-				case DMA_CHANNEL_PRIORITY_VERY_HIGH:
+				/* Set channel priority level bits of CCRx image to 01 */
+				Local_CCR |= DMA_CHANNEL_PRIORITY_MEDIUM_VAL;
 
-					/* Set channel priority level bits of CCRx register to 11 */
-					DMA->Channel[Copy_ChannelId].CCR |= DMA_CHANNEL_PRIORITY_VERY_HIGH_VAL;
+				break;
+			case DMA_CHANNEL_PRIORITY_HIGH:
 
-					break;
-				default:
+				/* Set channel priority level bits of CCRx image to 10 */
+				Local_CCR |= DMA_CHANNEL_PRIORITY_HIGH_VAL;
 
-					/* Out of range error */
-					Local_ErrorStatus = OUT_OF_RANGE;
-			}
+				break;
+			case DMA_CHANNEL_PRIORITY_VERY_HIGH:
 
-			/*********************************Memory Size Configuration*********************************/
-			/* Clear memory size bits of CCRx register */
-			DMA->Channel[Copy_ChannelId].CCR &= DMA_MEMORY_SIZE_MASK;
+				/* Set channel priority level bits of CCRx image to 11 */
+				Local_CCR |= DMA_CHANNEL_PRIORITY_VERY_HIGH_VAL;
 
-			/* Check memory size based on passed configuration */
-			switch(Copy_pChannelConfig->memorySize)
-			{
-				case DMA_MEMORY_SIZE_8_BITS:
+				break;
+			default:
 
-					/* Set memory size bits of CCRx register to 00 */
-					DMA->Channel[Copy_ChannelId].CCR |= DMA_MEMORY_SIZE_8_BITS_VAL;
+				/* Out of range error */
+				Local_ErrorStatus = OUT_OF_RANGE;
+		}
 
-					break;
-				case DMA_MEMORY_SIZE_16_BITS:
+		/*********************************Memory Size Configuration*********************************/
+		/* Clear memory size bits of CCRx image */
+		Local_CCR &= DMA_MEMORY_SIZE_MASK;
 
-					/* Set memory size bits of CCRx register to 01 */
-					DMA->Channel[Copy_ChannelId].CCR |= DMA_MEMORY_SIZE_16_BITS_VAL;
+		/* Check memory size based on passed configuration */
+		switch(Copy_pChannelConfig->memorySize)
+		{
+			case DMA_MEMORY_SIZE_8_BITS:
 
-					break;
-				case DMA_MEMORY_SIZE_32_BITS:
+				/* Set memory size bits of CCRx image to 00 */
+				Local_CCR |= DMA_MEMORY_SIZE_8_BITS_VAL;
 
-					/* Set memory size bits of CCRx register to 10 */
-					DMA->Channel[Copy_ChannelId].CCR |= DMA_MEMORY_SIZE_32_BITS_VAL;
+				break;
+			case DMA_MEMORY_SIZE_16_BITS:
 
-					break;
-				default:
+				/* Set memory size bits of CCRx image to 01 */
+				Local_CCR |= DMA_MEMORY_SIZE_16_BITS_VAL;
 
-					/* Out of range error */
-					Local_ErrorStatus = OUT_OF_RANGE;
-			}
+				break;
+			case DMA_MEMORY_SIZE_32_BITS:
 
+				/* Set memory size bits of CCRx image to 10 */
+				Local_CCR |= DMA_MEMORY_SIZE_32_BITS_VAL;
 
-			/*********************************Peripheral Size Configuration*********************************/
-			/* Clear peripheral size bits of CCRx register */
-			DMA->Channel[Copy_ChannelId].CCR &= DMA_PERIPHERAL_SIZE_MASK;
+				break;
+			default:
 
-			/* Check peripheral size based on passed configuration */
-			switch(Copy_pChannelConfig->peripheralSize)
-			{
-				case DMA_PERIPHERAL_SIZE_8_BITS:
+				/* Out of range error */
+				Local_ErrorStatus = OUT_OF_RANGE;
+		}
 
-					/* Set peripheral size bits of CCRx register to 00 */
-					DMA->Channel[Copy_ChannelId].CCR |= DMA_PERIPHERAL_SIZE_8_BITS_VAL;
 
-					break;
-				case DMA_PERIPHERAL_SIZE_16_BITS:
+		/*********************************Peripheral Size Configuration*********************************/
+		/* Clear peripheral size bits of CCRx image */
+		Local_CCR &= DMA_PERIPHERAL_SIZE_MASK;
 
-					/* Set peripheral size bits of CCRx register to 01 */
-					DMA->Channel[Copy_ChannelId].CCR |= DMA_PERIPHERAL_SIZE_16_BITS_VAL;
+		/* Check peripheral size based on passed configuration */
+		switch(Copy_pChannelConfig->peripheralSize)
+		{
+			case DMA_PERIPHERAL_SIZE_8_BITS:
 
-					break;
-				case DMA_PERIPHERAL_SIZE_32_BITS:
+				/* Set peripheral size bits of CCRx image to 00 */
+				Local_CCR |= DMA_PERIPHERAL_SIZE_8_BITS_VAL;
 
-					/* Set peripheral size bits of CCRx register to 10 */
-					DMA->Channel[Copy_ChannelId].CCR |= DMA_PERIPHERAL_SIZE_32_BITS_VAL;
+				break;
+			case DMA_PERIPHERAL_SIZE_16_BITS:
 
-					break;
-				default:
+				/* Set peripheral size bits of CCRx image to 01 */
+				Local_CCR |= DMA_PERIPHERAL_SIZE_16_BITS_VAL;
 
-					/* Out of range error */
-					Local_ErrorStatus = OUT_OF_RANGE;
-			}
+				break;
+			case DMA_PERIPHERAL_SIZE_32_BITS:
 
-			/*********************************Memory Increment Mode Configuration*********************************/
-			/* Check if memory increment mode is enabled or not based on passed configuration */
-			if(Copy_pChannelConfig->memoryIncrementModeEnable == DMA_MEMORY_INCREMENT_MODE_ENABLE)
-			{
-				/* Set MINC bit in CCRx register */
-				SET_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_MINC);
-			}
-			else if(Copy_pChannelConfig->memoryIncrementModeEnable == DMA_MEMORY_INCREMENT_MODE_DISABLE)
-			{
-				/* Clear MINC bit in CCRx register */
-				CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_MINC);
-			}
-			else
-			{
-				/* Out of range error */
-				Local_ErrorStatus = OUT_OF_RANGE;
-			}
+				/* Set peripheral size bits of CCRx image to 10 */
+				Local_CCR |= DMA_PERIPHERAL_SIZE_32_BITS_VAL;
 
-			/*********************************Peripheral Increment Mode Configuration*********************************/
-			/* Check if peripheral increment mode is enabled or not based on passed configuration */
-			if(Copy_pChannelConfig->peripheralIncrementModeEnable == DMA_PERIPHERAL_INCREMENT_MODE_ENABLE)
-			{
-				/* Set PINC bit in CCRx register */
-				SET_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_PINC);
-			}
-			else if(Copy_pChannelConfig->peripheralIncrementModeEnable == DMA_PERIPHERAL_INCREMENT_MODE_DISABLE)
-			{
-				/* Clear PINC bit in CCRx register */
-				CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_PINC);
-			}
-			else
-			{
-				/* Out of range error */
-				Local_ErrorStatus = OUT_OF_RANGE;
-			}
+				break;
+			default:
 
-			/*********************************Circular Mode Configuration*********************************/
-			/* Check if circular mode is enabled or not based on passed configuration */
-			if(Copy_pChannelConfig->circularModeEnable == DMA_CIRCULAR_MODE_ENABLE)
-			{
-				/* Set CIRC bit in CCRx register */
-				SET_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_CIRC);
-			}
-			else if(Copy_pChannelConfig->circularModeEnable == DMA_CIRCULAR_MODE_DISABLE)
-			{
-				/* Clear CIRC bit in CCRx register */
-				CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_CIRC);
-			}
-			else
-			{
 				/* Out of range error */
 				Local_ErrorStatus = OUT_OF_RANGE;
-			}
+		}
 
-			/*********************************Data Transfer Direction Configuration*********************************/
-			/* Check data transfer direction based on passed configuration */
-			if(Copy_pChannelConfig->dataTransferDirection == DMA_READ_FROM_MEMORY)
-			{
-				/* Set DIR bit in CCRx register */
-				SET_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_DIR);
-			}
-			else if(Copy_pChannelConfig->dataTransferDirection == DMA_READ_FROM_PERIPHERAL)
-			{
-				/* Clear DIR bit in CCRx register */
-				CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_DIR);
-			}
-			else
-			{
-				/* Out of range error */
-				Local_ErrorStatus = OUT_OF_RANGE;
-			}
+		/*********************************Memory Increment Mode Configuration*********************************/
+		/* Check if memory increment mode is enabled or not based on passed configuration */
+		if(Copy_pChannelConfig->memoryIncrementModeEnable == DMA_MEMORY_INCREMENT_MODE_ENABLE)
+		{
+			/* Set MINC bit in CCRx image */
+			SET_BIT(Local_CCR,CCR_MINC);
+		}
+		else if(Copy_pChannelConfig->memoryIncrementModeEnable == DMA_MEMORY_INCREMENT_MODE_DISABLE)
+		{
+			/* Clear MINC bit in CCRx image */
+			CLEAR_BIT(Local_CCR,CCR_MINC);
+		}
+		else
+		{
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
+		}
 
-			/*********************************Transfer Error Interrupt Enable Configuration*********************************/
-			/* Check if transfer error interrupt is enabled or not based on passed configuration */
-			if(Copy_pChannelConfig->transferErrorInterruptEnable == DMA_TRANSFER_ERROR_INTERRUPT_ENABLE)
-			{
-				/* Set TEIE bit in CCRx register */
-				SET_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_TEIE);
-			}
-			else if(Copy_pChannelConfig->transferErrorInterruptEnable == DMA_TRANSFER_ERROR_INTERRUPT_DISABLE)
-			{
-				/* Clear TEIE bit in CCRx register */
-				CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_TEIE);
-			}
-			else
-			{
-				/* Out of range error */
-				Local_ErrorStatus = OUT_OF_RANGE;
-			}
+		/*********************************Peripheral Increment Mode Configuration*********************************/
+		/* Check if peripheral increment mode is enabled or not based on passed configuration */
+		if(Copy_pChannelConfig->peripheralIncrementModeEnable == DMA_PERIPHERAL_INCREMENT_MODE_ENABLE)
+		{
+			/* Set PINC bit in CCRx image */
+			SET_BIT(Local_CCR,CCR_PINC);
+		}
+		else if(Copy_pChannelConfig->peripheralIncrementModeEnable == DMA_PERIPHERAL_INCREMENT_MODE_DISABLE)
+		{
+			/* Clear PINC bit in CCRx image */
+			CLEAR_BIT(Local_CCR,CCR_PINC);
+		}
+		else
+		{
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
+		}
 
+		/*********************************Circular Mode Configuration*********************************/
+		/* Check if circular mode is enabled or not based on passed configuration */
+		if(Copy_pChannelConfig->circularModeEnable == DMA_CIRCULAR_MODE_ENABLE)
+		{
+			/* Set CIRC bit in CCRx image */
+			SET_BIT(Local_CCR,CCR_CIRC);
+		}
+		else if(Copy_pChannelConfig->circularModeEnable == DMA_CIRCULAR_MODE_DISABLE)
+		{
+			/* Clear CIRC bit in CCRx image */
+			CLEAR_BIT(Local_CCR,CCR_CIRC);
+		}
+		else
+		{
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
+		}
 
-			/*********************************Half Transfer Interrupt Enable Configuration*********************************/
-			/* Check if half transfer interrupt is enabled or not based on passed configuration */
-			if(Copy_pChannelConfig->halfTransferInterruptEnable == DMA_HALF_TRANSFER_INTERRUPT_ENABLE)
-			{
-				/* Set HTIE bit in CCRx register */
-				SET_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_HTIE);
-			}
-			else if(Copy_pChannelConfig->halfTransferInterruptEnable == DMA_HALF_TRANSFER_INTERRUPT_DISABLE)
-			{
-				/* Clear HTIE bit in CCRx register */
-				CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_HTIE);
-			}
-			else
-			{
-				/* Out of range error */
-				Local_ErrorStatus = OUT_OF_RANGE;
-			}
+		/*********************************Data Transfer Direction Configuration*********************************/
+		/* Check data transfer direction based on passed configuration */
+		if(Copy_pChannelConfig->dataTransferDirection == DMA_READ_FROM_MEMORY)
+		{
+			/* Set DIR bit in CCRx image */
+			SET_BIT(Local_CCR,CCR_DIR);
+		}
+		else if(Copy_pChannelConfig->dataTransferDirection == DMA_READ_FROM_PERIPHERAL)
+		{
+			/* Clear DIR bit in CCRx image */
+			CLEAR_BIT(Local_CCR,CCR_DIR);
+		}
+		else
+		{
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
+		}
 
-			/*********************************Transfer Complete Interrupt Enable Configuration*********************************/
-			/* Check if transfer complete interrupt is enabled or not based on passed configuration */
-			if(Copy_pChannelConfig->transferCompleteInterruptEnable == DMA_TRANSFER_COMPLETE_INTERRUPT_ENABLE)
-			{
-				/* Set TCIE bit in CCRx register */
-				SET_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_TCIE);
-			}
-			else if(Copy_pChannelConfig->transferCompleteInterruptEnable == DMA_TRANSFER_COMPLETE_INTERRUPT_DISABLE)
-			{
-				/* Clear TCIE bit in CCRx register */
-				CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_TCIE);
-			}
-			else
-			{
-				/* Out of range error */
-				Local_ErrorStatus = OUT_OF_RANGE;
-			}
+		/*********************************Transfer Error Interrupt Enable Configuration*********************************/
+		/* Check if transfer error interrupt is enabled or not based on passed configuration */
+		if(Copy_pChannelConfig->transferErrorInterruptEnable == DMA_TRANSFER_ERROR_INTERRUPT_ENABLE)
+		{
+			/* Set TEIE bit in CCRx image */
+			SET_BIT(Local_CCR,CCR_TEIE);
+		}
+		else if(Copy_pChannelConfig->transferErrorInterruptEnable == DMA_TRANSFER_ERROR_INTERRUPT_DISABLE)
+		{
+			/* Clear TEIE bit in CCRx image */
+			CLEAR_BIT(Local_CCR,CCR_TEIE);
+		}
+		else
+		{
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
+		}
 
-			/*********************************Block Length Configuration*********************************/
-			/* Check if block length based on passed configuration is within valid range or not */
-			if(Copy_pChannelConfig->channelBlockLength >= DMA_MIN_BLOCK_LENGTH_VAL && Copy_pChannelConfig->channelBlockLength <= DMA_MAX_BLOCK_LENGTH_VAL)
-			{
-				/* Set number of data bytes in the block to be transfered through selected channel in CNDTRx register */
-				DMA->Channel[Copy_ChannelId].CNDTR = Copy_pChannelConfig->channelBlockLength;
-			}
-			else
-			{
-				/* Out of range error */
-				Local_ErrorStatus = OUT_OF_RANGE;
-			}
+
+		/*********************************Half Transfer Interrupt Enable Configuration*********************************/
+		/* Check if half transfer interrupt is enabled or not based on passed configuration */
+		if(Copy_pChannelConfig->halfTransferInterruptEnable == DMA_HALF_TRANSFER_INTERRUPT_ENABLE)
+		{
+			/* Set HTIE bit in CCRx image */
+			SET_BIT(Local_CCR,CCR_HTIE);
+		}
+		else if(Copy_pChannelConfig->halfTransferInterruptEnable == DMA_HALF_TRANSFER_INTERRUPT_DISABLE)
+		{
+			/* Clear HTIE bit in CCRx image */
+			CLEAR_BIT(Local_CCR,CCR_HTIE);
+		}
+		else
+		{
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
+		}
+
+		/*********************************Transfer Complete Interrupt Enable Configuration*********************************/
+		/* Check if transfer complete interrupt is enabled or not based on passed configuration */
+		if(Copy_pChannelConfig->transferCompleteInterruptEnable == DMA_TRANSFER_COMPLETE_INTERRUPT_ENABLE)
+		{
+			/* Set TCIE bit in CCRx image */
+			SET_BIT(Local_CCR,CCR_TCIE);
+		}
+		else if(Copy_pChannelConfig->transferCompleteInterruptEnable == DMA_TRANSFER_COMPLETE_INTERRUPT_DISABLE)
+		{
+			/* Clear TCIE bit in CCRx image */
+			CLEAR_BIT(Local_CCR,CCR_TCIE);
+		}
+		else
+		{
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
+		}
+
+		/*********************************Block Length Configuration*********************************/
+		/* Check if block length based on passed configuration is within valid range or not */
+		if(Copy_pChannelConfig->channelBlockLength >= DMA_MIN_BLOCK_LENGTH_VAL && Copy_pChannelConfig->channelBlockLength <= DMA_MAX_BLOCK_LENGTH_VAL)
+		{
+			/* Set number of data items in the block to be transfered through the channel */
+			Copy_pCompiledConfig->channelBlockLength = Copy_pChannelConfig->channelBlockLength;
 		}
 		else
 		{
 			/* Out of range error */
 			Local_ErrorStatus = OUT_OF_RANGE;
 		}
+
+		/* Publish CCRx image only if whole configuration is valid */
+		if(Local_ErrorStatus == RT_OK)
+		{
+			Copy_pCompiledConfig->channelControlImage = Local_CCR;
+		}
 	}
 	else
 	{
-		/* Passed pointer is NULL pointer */
+		/* One or both of passed pointers is a NULL pointer */
 		Local_ErrorStatus = NULL_POINTER;
 	}
 
@@ -353,18 +471,15 @@ ERROR_STATUS_t DMA_ChannelInit(uint8_t Copy_ChannelId ,DMA_ChannelConfig_t* Copy
 }
 
 /*--------------------------------------------------------------------------------*/
-/* @Function Name: ChannelStart          			                              */
+/* @Function Name: ChannelApplyCompiledConfig          		                      */
 /*--------------------------------------------------------------------------------*/
 /* @Param(in)	 : uint8_t Copy_ChannelId                                         */
 /* 			       Brief: Desired DMA channel id                                  */
-/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
-/*			       -------------------------------------------------------------- */
-/*	               uint32_t* Copy_pSourceAddress                                  */
-/*			       Brief: Pointer to DMA channel source                           */
-/*			       Range: None                                                    */
-/*			       -------------------------------------------------------------- */
-/*	               uint32_t* Copy_pDestinationAddress				              */
-/* 			       Brief: Pointer to DMA channel destination                      */
+/* 			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/* 			       -------------------------------------------------------------- */
+/* 				   DMA_ChannelCompiledConfig_t* Copy_pCompiledConfig			  */
+/* 			       Brief: Pointer to configuration built by                       */
+/*                        DMA_ChannelConfigCompile or DMA_CHANNEL_CONFIG_IMAGE    */
 /* 			       Range: None                                                    */
 /*--------------------------------------------------------------------------------*/
 /* @Param(inout) : None                                                	          */
@@ -373,8 +488,87 @@ ERROR_STATUS_t DMA_ChannelInit(uint8_t Copy_ChannelId ,DMA_ChannelConfig_t* Copy
 /*--------------------------------------------------------------------------------*/
 /* @Return		 : ERROR_STATUS_t                                          		  */
 /*--------------------------------------------------------------------------------*/
-/* @Description	 : This function forces selected DMA channel to start transaction */
-/* 				   through specifying channel source address and destination      */
+/* @Description	 : This function applies a pre-validated configuration to a       */
+/*                 disabled channel with a single CCRx store plus CNDTRx store    */
+/*                 (CCRx store is skipped when channel already holds the image)   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_ChannelApplyCompiledConfig(uint8_t Copy_ChannelId , DMA_ChannelCompiledConfig_t* Copy_pCompiledConfig)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+	uint32_t Local_CCR;
+
+	/* Check if passed pointer is NULL pointer or not */
+	if(Copy_pCompiledConfig != NULL)
+	{
+		/* Check if passed channel id is within valid range or not */
+		if(Copy_ChannelId >= DMA_CH1 && Copy_ChannelId <= DMA_CH7)
+		{
+			/* Keep configuration bits only (channel is never enabled by a configuration image) */
+			Local_CCR = Copy_pCompiledConfig->channelControlImage & DMA_CCR_CONFIG_BITS_MASK;
+
+			/* Make sure that selected DMA channel is disabled before configuration through clearing EN bit in CCRx register */
+			CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_EN);
+
+			/* Count configuration request on the channel */
+			DMA_ChannelOwnership[Copy_ChannelId].Configurations++;
+
+			/* Check if channel still holds this exact image from last configuration (CCRx untouched since then) */
+			if(DMA_ChannelOwnership[Copy_ChannelId].ConfigCacheValid == 1 && Local_CCR == DMA_ChannelOwnership[Copy_ChannelId].CachedCCR &&
+			   DMA->Channel[Copy_ChannelId].CCR == Local_CCR)
+			{
+				/* Count skipped register rewrite */
+				DMA_ChannelOwnership[Copy_ChannelId].ConfigurationsSkipped++;
+			}
+			else
+			{
+				/* Write whole channel configuration with a single CCRx store and cache it */
+				DMA->Channel[Copy_ChannelId].CCR = Local_CCR;
+				DMA_ChannelOwnership[Copy_ChannelId].CachedCCR = Local_CCR;
+				DMA_ChannelOwnership[Copy_ChannelId].ConfigCacheValid = 1;
+			}
+
+			/* Re-arm block length (CNDTRx counts down on every transfer) */
+			DMA->Channel[Copy_ChannelId].CNDTR = Copy_pCompiledConfig->channelBlockLength;
+		}
+		else
+		{
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_ErrorStatus = NULL_POINTER;
+	}
+
+	return Local_ErrorStatus;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ChannelStart          			                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*			       -------------------------------------------------------------- */
+/*	               uint32_t* Copy_pSourceAddress                                  */
+/*			       Brief: Pointer to DMA channel source                           */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               uint32_t* Copy_pDestinationAddress				              */
+/* 			       Brief: Pointer to DMA channel destination                      */
+/* 			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function forces selected DMA channel to start transaction */
+/* 				   through specifying channel source address and destination      */
 /* 				   address                                                        */
 /*--------------------------------------------------------------------------------*/
 ERROR_STATUS_t DMA_ChannelStart(uint8_t Copy_ChannelId , uint32_t* Copy_pSourceAddress , uint32_t* Copy_pDestinationAddress)
@@ -500,7 +694,7 @@ ERROR_STATUS_t DMA_RegisterTransferCompleteCallback(uint8_t Copy_ChannelId , voi
 		if(Copy_ChannelId >= DMA_CH1 && Copy_ChannelId <= DMA_CH7)
 		{
 			/* Register passed pointer to function as a DMA transfer complete callback function for selected channel */
-			DMA_TransferCompleteNotificationFunc[Copy_ChannelId] = Copy_NotificationFunc;
+			DMA_ChannelDescriptor[Copy_ChannelId].TransferCompleteNotificationFunc = Copy_NotificationFunc;
 		}
 		else
 		{
@@ -550,7 +744,7 @@ ERROR_STATUS_t DMA_RegisterHalfTransferCallback(uint8_t Copy_ChannelId , void(*C
 		if(Copy_ChannelId >= DMA_CH1 && Copy_ChannelId <= DMA_CH7)
 		{
 			/* Register passed pointer to function as a DMA half transfer callback function for selected channel */
-			DMA_HalfTransferNotificationFunc[Copy_ChannelId] = Copy_NotificationFunc;
+			DMA_ChannelDescriptor[Copy_ChannelId].HalfTransferNotificationFunc = Copy_NotificationFunc;
 		}
 		else
 		{
@@ -600,7 +794,7 @@ ERROR_STATUS_t DMA_RegisterTransferErrorCallback(uint8_t Copy_ChannelId , void(*
 		if(Copy_ChannelId >= DMA_CH1 && Copy_ChannelId <= DMA_CH7)
 		{
 			/* Register passed pointer to function as a DMA transfer error callback function for selected channel */
-			DMA_TransferErrorNotificationFunc[Copy_ChannelId] = Copy_NotificationFunc;
+			DMA_ChannelDescriptor[Copy_ChannelId].TransferErrorNotificationFunc = Copy_NotificationFunc;
 		}
 		else
 		{
@@ -738,26 +932,26 @@ ERROR_STATUS_t DMA_ClearInterruptFlag(uint8_t Copy_ChannelId , uint8_t Copy_Inte
 		{
 			case DMA_GLOBAL_INTERRUPT_FLAG:
 
-				/* Clear DMA global interrupt flag by setting its corresponding interrupt flag bit to 1 in IFCR register in selected channel */
-				SET_BIT(DMA->IFCR,((Copy_ChannelId * 4) + Copy_InterruptFlagId));
+				/* Clear DMA global interrupt flag by writing 1 to its corresponding interrupt flag bit in IFCR register (write-only, no read back needed) */
+				DMA->IFCR = (1U << ((Copy_ChannelId * 4) + Copy_InterruptFlagId));
 				break;
 
 			case DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG:
 
-				/* Clear DMA transfer complete interrupt flag by setting its corresponding interrupt flag bit to 1 in IFCR register in selected channel */
-				SET_BIT(DMA->IFCR,((Copy_ChannelId * 4) + Copy_InterruptFlagId));
+				/* Clear DMA transfer complete interrupt flag by writing 1 to its corresponding interrupt flag bit in IFCR register (write-only, no read back needed) */
+				DMA->IFCR = (1U << ((Copy_ChannelId * 4) + Copy_InterruptFlagId));
 				break;
 
 			case DMA_HALF_TRANSFER_INTERRUPT_FLAG:
 
-				/* Clear DMA half transfer interrupt flag by setting its corresponding interrupt flag bit to 1 in IFCR register in selected channel */
-				SET_BIT(DMA->IFCR,((Copy_ChannelId * 4) + Copy_InterruptFlagId));
+				/* Clear DMA half transfer interrupt flag by writing 1 to its corresponding interrupt flag bit in IFCR register (write-only, no read back needed) */
+				DMA->IFCR = (1U << ((Copy_ChannelId * 4) + Copy_InterruptFlagId));
 				break;
 
 			case DMA_TRANSFER_ERROR_INTERRUPT_FLAG:
 
-				/* Clear DMA transfer error interrupt flag by setting its corresponding interrupt flag bit to 1 in IFCR register in selected channel */
-				SET_BIT(DMA->IFCR,((Copy_ChannelId * 4) + Copy_InterruptFlagId));
+				/* Clear DMA transfer error interrupt flag by writing 1 to its corresponding interrupt flag bit in IFCR register (write-only, no read back needed) */
+				DMA->IFCR = (1U << ((Copy_ChannelId * 4) + Copy_InterruptFlagId));
 				break;
 
 			default:
@@ -775,562 +969,1624 @@ ERROR_STATUS_t DMA_ClearInterruptFlag(uint8_t Copy_ChannelId , uint8_t Copy_Inte
 	return Local_ErrorStatus;
 }
 
-/*-----------------------------------------------------------------------------------*/
-/*                                                                                   */
-/*                            	  INTERRUPT HANDLERS		                    	 */
-/*                                                                                   */
-/*-----------------------------------------------------------------------------------*/
-
 /*--------------------------------------------------------------------------------*/
-/*                                                                                */
-/* @Description	: DMA1 channel1 interrupt                                         */
-/*				                                                                  */
+/* @Function Name: StreamStart          			                              */
 /*--------------------------------------------------------------------------------*/
-void DMA1_Channel1_IRQHandler(void)
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*			       -------------------------------------------------------------- */
+/*	               uint32_t* Copy_pPeripheralAddress                              */
+/*			       Brief: Pointer to peripheral data register (CPAR)              */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               void* Copy_pBuffer                                             */
+/*			       Brief: Pointer to stream buffer (CMAR) split into two halves   */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               uint16_t Copy_Length                                           */
+/*			       Brief: Number of data items in the whole buffer                */
+/*			       Range: Even value (2 --> 65534)                                */
+/*			       -------------------------------------------------------------- */
+/*	               void(*Copy_ConsumerFunc)(void*,uint16_t)                       */
+/*			       Brief: Pointer to function that consumes each completed half   */
+/*			              (pointer to half and its length in data items)          */
+/*			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function starts a continuous double-buffer (ping-pong)    */
+/*                 stream on a channel already initialized by DMA_ChannelInit.    */
+/*                 Circular mode and half/complete/error interrupts are forced on */
+/*                 and the consumer is called from the channel IRQ with the half  */
+/*                 of the buffer that has just been filled (zero CPU copies)      */
+/*                 Returns BUSY_FUNC if channel is chaining queued transfers or   */
+/*                 running a Memcpy/Memset job                                    */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_StreamStart(uint8_t Copy_ChannelId , uint32_t* Copy_pPeripheralAddress , void* Copy_pBuffer , uint16_t Copy_Length ,
+							   void(*Copy_ConsumerFunc)(void* Copy_pBlock , uint16_t Copy_BlockLength))
 {
-	/* Local variables definitions */
-	uint8_t Local_InterruptSource = 0;
-
-	/**************************************Check source of interrupt**************************************/
-
-	/* Check if interrupt source is DMA Transfer Complete */
-    DMA_GetInterruptFlagStatus(DMA_CH1, DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG, &Local_InterruptSource);
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+	uint32_t Local_CCR;
+	DMA_StreamState_t* Local_pStream;
+	uint32_t Local_PrimaskState;
 
-	if(Local_InterruptSource == 1)
+	/* Check if passed pointers are NULL pointers or not */
+	if(Copy_pPeripheralAddress != NULL && Copy_pBuffer != NULL && Copy_ConsumerFunc != NULL)
 	{
-		/* Check if DMA Transfer Complete callback function is registered or not */
-		if(DMA_TransferCompleteNotificationFunc[0] != NULL)
+		/* Check if passed channel id and buffer length are within valid range or not (buffer must split into two equal halves) */
+		if((Copy_ChannelId >= DMA_CH1 && Copy_ChannelId <= DMA_CH7) && (Copy_Length >= DMA_MIN_STREAM_LENGTH_VAL) && ((Copy_Length % 2U) == 0U))
 		{
-			/* Invoke DMA Transfer Complete Callback Function */
-			DMA_TransferCompleteNotificationFunc[0]();
-		}
-
-		/* Clear DMA Transfer Complete flag */
-		DMA_ClearInterruptFlag(DMA_CH1, DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG);
-
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
-	}
-
-	/******************************************************************************************************/
+			/* Channel owners are claimed from other contexts (queue IRQ chaining, memory engine) */
+			DMA_ENTER_CRITICAL_SECTION(Local_PrimaskState);
 
-	/* Check if interrupt source is DMA Half Transfer */
-	DMA_GetInterruptFlagStatus(DMA_CH1, DMA_HALF_TRANSFER_INTERRUPT_FLAG, &Local_InterruptSource);
+			/* Check if channel is chaining queued scatter-gather transfers or running a Memcpy/Memset job or not */
+			if(DMA_TransferQueueState[Copy_ChannelId].Active == 0 && DMA_MemoryJob[Copy_ChannelId].Busy == 0)
+			{
+				/* Get stream state of selected channel */
+				Local_pStream = &DMA_StreamState[Copy_ChannelId];
+
+				/* Make sure that selected DMA channel is disabled through clearing EN bit in CCRx register */
+				CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_EN);
+
+				/* Detach any previous consumer while stream state is being updated */
+				Local_pStream->ConsumerFunc = NULL;
+
+				/* Read channel configuration once and force circular mode with transfer complete, half transfer and transfer error interrupts */
+				Local_CCR = DMA->Channel[Copy_ChannelId].CCR;
+				SET_BIT(Local_CCR,CCR_CIRC);
+				SET_BIT(Local_CCR,CCR_TCIE);
+				SET_BIT(Local_CCR,CCR_HTIE);
+				SET_BIT(Local_CCR,CCR_TEIE);
+
+				/* Set stream state (item size is taken from memory size already configured on the channel) */
+				Local_pStream->pBuffer = (uint8_t*)Copy_pBuffer;
+				Local_pStream->HalfLength = Copy_Length / 2U;
+				Local_pStream->ItemSize = (uint8_t)(1U << ((Local_CCR >> CCR_MSIZE) & DMA_MEMORY_SIZE_FIELD_MASK));
+
+				/* Reset stream statistics */
+				Local_pStream->BlocksDelivered = 0;
+				Local_pStream->ItemsDelivered = 0;
+				Local_pStream->Overruns = 0;
+				Local_pStream->TransferErrors = 0;
+
+				/* Attach passed consumer */
+				Local_pStream->ConsumerFunc = Copy_ConsumerFunc;
+
+				/* Clear any stale flags of the channel with a single IFCR write */
+				DMA->IFCR = DMA_CHANNEL_FLAGS_MASK << (Copy_ChannelId * DMA_CHANNEL_FLAGS_WIDTH);
+
+				/* Set peripheral address, stream buffer address and whole buffer length */
+				DMA->Channel[Copy_ChannelId].CPAR = (uint32_t)Copy_pPeripheralAddress;
+				DMA->Channel[Copy_ChannelId].CMAR = (uint32_t)Copy_pBuffer;
+				DMA->Channel[Copy_ChannelId].CNDTR = Copy_Length;
+
+				/* Write back channel configuration with EN bit set to start streaming */
+				DMA->Channel[Copy_ChannelId].CCR = Local_CCR | (1U << CCR_EN);
+			}
+			else
+			{
+				/* Channel is busy chaining queued transfers or running a memory engine job */
+				Local_ErrorStatus = BUSY_FUNC;
+			}
 
-	if(Local_InterruptSource == 1)
-	{
-		/* Check if DMA Half Transfer callback function is registered or not */
-		if(DMA_HalfTransferNotificationFunc[0] != NULL)
+			/* Leave critical section */
+			DMA_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+		}
+		else
 		{
-			/* Invoke DMA Half Transfer Callback Function */
-			DMA_HalfTransferNotificationFunc[0]();
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
 		}
-
-		/* Clear DMA Half Transfer flag */
-		DMA_ClearInterruptFlag(DMA_CH1, DMA_HALF_TRANSFER_INTERRUPT_FLAG);
-
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
 	}
-
-	/******************************************************************************************************/
-
-	/* Check if interrupt source is DMA Transfer Error */
-	DMA_GetInterruptFlagStatus(DMA_CH1, DMA_TRANSFER_ERROR_INTERRUPT_FLAG, &Local_InterruptSource);
-
-	if(Local_InterruptSource == 1)
+	else
 	{
-		/* Check if DMA Transfer Error callback function is registered or not */
-		if(DMA_TransferErrorNotificationFunc[0] != NULL)
-		{
-			/* Invoke DMA Transfer Error Callback Function */
-			DMA_TransferErrorNotificationFunc[0]();
-		}
-
-		/* Clear DMA Transfer Error flag */
-		DMA_ClearInterruptFlag(DMA_CH1, DMA_TRANSFER_ERROR_INTERRUPT_FLAG);
-
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
+		/* One or more of passed pointers is a NULL pointer */
+		Local_ErrorStatus = NULL_POINTER;
 	}
 
-	/******************************************************************************************************/
-
-	/* Clear DMA Global Interrupt flag */
-	DMA_ClearInterruptFlag(DMA_CH1, DMA_GLOBAL_INTERRUPT_FLAG);
+	return Local_ErrorStatus;
 }
 
 /*--------------------------------------------------------------------------------*/
-/*                                                                                */
-/* @Description	: DMA1 channel2 interrupt                                         */
-/*				                                                                  */
+/* @Function Name: StreamStop          			                                  */
 /*--------------------------------------------------------------------------------*/
-void DMA1_Channel2_IRQHandler(void)
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function stops a running stream and disables its channel  */
+/*                 Returns RT_NOK if channel is not streaming (never started,     */
+/*                 already stopped or ended by a transfer error)                  */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_StreamStop(uint8_t Copy_ChannelId)
 {
-	/* Local variables definitions */
-	uint8_t Local_InterruptSource = 0;
-
-	/**************************************Check source of interrupt**************************************/
-
-	/* Check if interrupt source is DMA Transfer Complete */
-    DMA_GetInterruptFlagStatus(DMA_CH2, DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG, &Local_InterruptSource);
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+	uint32_t Local_PrimaskState;
 
-	if(Local_InterruptSource == 1)
+	/* Check if passed channel id is within valid range or not */
+	if(Copy_ChannelId >= DMA_CH1 && Copy_ChannelId <= DMA_CH7)
 	{
-		/* Check if DMA Transfer Complete callback function is registered or not */
-		if(DMA_TransferCompleteNotificationFunc[1] != NULL)
-		{
-			/* Invoke DMA Transfer Complete Callback Function */
-			DMA_TransferCompleteNotificationFunc[1]();
-		}
+		/* Stream is ended from channel IRQ as well (transfer error) */
+		DMA_ENTER_CRITICAL_SECTION(Local_PrimaskState);
 
-		/* Clear DMA Transfer Complete flag */
-		DMA_ClearInterruptFlag(DMA_CH2, DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG);
-
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
-	}
-
-	/******************************************************************************************************/
-
-	/* Check if interrupt source is DMA Half Transfer */
-	DMA_GetInterruptFlagStatus(DMA_CH2, DMA_HALF_TRANSFER_INTERRUPT_FLAG, &Local_InterruptSource);
+		/* Check if channel is streaming or not (channel of another owner must be left running) */
+		if(DMA_StreamState[Copy_ChannelId].ConsumerFunc != NULL)
+		{
+			/* Disable selected DMA channel through clearing EN bit in CCRx register */
+			CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_EN);
 
-	if(Local_InterruptSource == 1)
-	{
-		/* Check if DMA Half Transfer callback function is registered or not */
-		if(DMA_HalfTransferNotificationFunc[1] != NULL)
+			/* Detach stream consumer (statistics are kept until next stream start) */
+			DMA_StreamState[Copy_ChannelId].ConsumerFunc = NULL;
+		}
+		else
 		{
-			/* Invoke DMA Half Transfer Callback Function */
-			DMA_HalfTransferNotificationFunc[1]();
+			/* Channel is not in streaming mode */
+			Local_ErrorStatus = RT_NOK;
 		}
 
-		/* Clear DMA Half Transfer flag */
-		DMA_ClearInterruptFlag(DMA_CH2, DMA_HALF_TRANSFER_INTERRUPT_FLAG);
-
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
+		/* Leave critical section */
+		DMA_EXIT_CRITICAL_SECTION(Local_PrimaskState);
 	}
-
-	/******************************************************************************************************/
-
-	/* Check if interrupt source is DMA Transfer Error */
-	DMA_GetInterruptFlagStatus(DMA_CH2, DMA_TRANSFER_ERROR_INTERRUPT_FLAG, &Local_InterruptSource);
-
-	if(Local_InterruptSource == 1)
+	else
 	{
-		/* Check if DMA Transfer Error callback function is registered or not */
-		if(DMA_TransferErrorNotificationFunc[1] != NULL)
-		{
-			/* Invoke DMA Transfer Error Callback Function */
-			DMA_TransferErrorNotificationFunc[1]();
-		}
-
-		/* Clear DMA Transfer Error flag */
-		DMA_ClearInterruptFlag(DMA_CH2, DMA_TRANSFER_ERROR_INTERRUPT_FLAG);
-
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
+		/* Out of range error */
+		Local_ErrorStatus = OUT_OF_RANGE;
 	}
 
-	/******************************************************************************************************/
-
-	/* Clear DMA Global Interrupt flag */
-	DMA_ClearInterruptFlag(DMA_CH2, DMA_GLOBAL_INTERRUPT_FLAG);
+	return Local_ErrorStatus;
 }
 
 /*--------------------------------------------------------------------------------*/
-/*                                                                                */
-/* @Description	: DMA1 channel3 interrupt                                         */
-/*				                                                                  */
+/* @Function Name: GetStreamStatistics      		                              */
 /*--------------------------------------------------------------------------------*/
-void DMA1_Channel3_IRQHandler(void)
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : DMA_StreamStatistics_t* Copy_pStatistics                       */
+/*                 Brief: Pointer to variable that will hold stream counters      */
+/*                 Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gets throughput and overrun counters of the      */
+/*                 stream running (or last run) on selected channel               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_GetStreamStatistics(uint8_t Copy_ChannelId , DMA_StreamStatistics_t* Copy_pStatistics)
 {
-	/* Local variables definitions */
-	uint8_t Local_InterruptSource = 0;
-
-	/**************************************Check source of interrupt**************************************/
-
-	/* Check if interrupt source is DMA Transfer Complete */
-    DMA_GetInterruptFlagStatus(DMA_CH3, DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG, &Local_InterruptSource);
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
 
-	if(Local_InterruptSource == 1)
+	/* Check if passed pointer is a NULL pointer or not */
+	if(Copy_pStatistics != NULL)
 	{
-		/* Check if DMA Transfer Complete callback function is registered or not */
-		if(DMA_TransferCompleteNotificationFunc[2] != NULL)
+		/* Check if passed channel id is within valid range or not */
+		if(Copy_ChannelId >= DMA_CH1 && Copy_ChannelId <= DMA_CH7)
 		{
-			/* Invoke DMA Transfer Complete Callback Function */
-			DMA_TransferCompleteNotificationFunc[2]();
+			/* Copy stream counters of selected channel */
+			Copy_pStatistics->blocksDelivered = DMA_StreamState[Copy_ChannelId].BlocksDelivered;
+			Copy_pStatistics->itemsDelivered = DMA_StreamState[Copy_ChannelId].ItemsDelivered;
+			Copy_pStatistics->overruns = DMA_StreamState[Copy_ChannelId].Overruns;
+			Copy_pStatistics->transferErrors = DMA_StreamState[Copy_ChannelId].TransferErrors;
 		}
-
-		/* Clear DMA Transfer Complete flag */
-		DMA_ClearInterruptFlag(DMA_CH3, DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG);
-
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
-	}
-
-	/******************************************************************************************************/
-
-	/* Check if interrupt source is DMA Half Transfer */
-	DMA_GetInterruptFlagStatus(DMA_CH3, DMA_HALF_TRANSFER_INTERRUPT_FLAG, &Local_InterruptSource);
-
-	if(Local_InterruptSource == 1)
-	{
-		/* Check if DMA Half Transfer callback function is registered or not */
-		if(DMA_HalfTransferNotificationFunc[2] != NULL)
+		else
 		{
-			/* Invoke DMA Half Transfer Callback Function */
-			DMA_HalfTransferNotificationFunc[2]();
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
 		}
-
-		/* Clear DMA Half Transfer flag */
-		DMA_ClearInterruptFlag(DMA_CH3, DMA_HALF_TRANSFER_INTERRUPT_FLAG);
-
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
 	}
-
-	/******************************************************************************************************/
-
-	/* Check if interrupt source is DMA Transfer Error */
-	DMA_GetInterruptFlagStatus(DMA_CH3, DMA_TRANSFER_ERROR_INTERRUPT_FLAG, &Local_InterruptSource);
-
-	if(Local_InterruptSource == 1)
+	else
 	{
-		/* Check if DMA Transfer Error callback function is registered or not */
-		if(DMA_TransferErrorNotificationFunc[2] != NULL)
-		{
-			/* Invoke DMA Transfer Error Callback Function */
-			DMA_TransferErrorNotificationFunc[2]();
-		}
-
-		/* Clear DMA Transfer Error flag */
-		DMA_ClearInterruptFlag(DMA_CH3, DMA_TRANSFER_ERROR_INTERRUPT_FLAG);
-
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
+		/* Passed pointer is a NULL pointer */
+		Local_ErrorStatus = NULL_POINTER;
 	}
 
-	/******************************************************************************************************/
-
-	/* Clear DMA Global Interrupt flag */
-	DMA_ClearInterruptFlag(DMA_CH3, DMA_GLOBAL_INTERRUPT_FLAG);
+	return Local_ErrorStatus;
 }
 
 /*--------------------------------------------------------------------------------*/
-/*                                                                                */
-/* @Description	: DMA1 channel4 interrupt                                         */
-/*				                                                                  */
+/* @Function Name: QueueTransfer          			                              */
 /*--------------------------------------------------------------------------------*/
-void DMA1_Channel4_IRQHandler(void)
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*			       -------------------------------------------------------------- */
+/*	               DMA_TransferDescriptor_t* Copy_pDescriptor                     */
+/*			       Brief: Pointer to transfer descriptor (copied into the queue)  */
+/*			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function appends a transfer to the scatter-gather queue   */
+/*                 of a channel already initialized by DMA_ChannelInit. If the    */
+/*                 channel is idle the transfer starts at once, otherwise it is   */
+/*                 chained from transfer complete IRQ of the previous one.        */
+/*                 Returns BUSY_FUNC if queue is full, a stream is running or a   */
+/*                 Memcpy/Memset job owns the channel                             */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_QueueTransfer(uint8_t Copy_ChannelId , DMA_TransferDescriptor_t* Copy_pDescriptor)
 {
-	/* Local variables definitions */
-	uint8_t Local_InterruptSource = 0;
-
-	/**************************************Check source of interrupt**************************************/
-
-	/* Check if interrupt source is DMA Transfer Complete */
-    DMA_GetInterruptFlagStatus(DMA_CH4, DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG, &Local_InterruptSource);
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+	DMA_TransferQueueState_t* Local_pQueue;
+	uint32_t Local_PrimaskState;
 
-	if(Local_InterruptSource == 1)
+	/* Check if passed pointers are NULL pointers or not */
+	if(Copy_pDescriptor != NULL && Copy_pDescriptor->pPeripheralAddress != NULL && Copy_pDescriptor->pMemoryAddress != NULL)
 	{
-		/* Check if DMA Transfer Complete callback function is registered or not */
-		if(DMA_TransferCompleteNotificationFunc[3] != NULL)
+		/* Check if passed channel id and descriptor fields are within valid range or not */
+		if((Copy_ChannelId >= DMA_CH1 && Copy_ChannelId <= DMA_CH7) &&
+		   (Copy_pDescriptor->length >= DMA_MIN_QUEUE_TRANSFER_LENGTH_VAL) &&
+		   (Copy_pDescriptor->peripheralSize <= DMA_PERIPHERAL_SIZE_32_BITS) &&
+		   (Copy_pDescriptor->memorySize <= DMA_MEMORY_SIZE_32_BITS) &&
+		   (Copy_pDescriptor->peripheralIncrementModeEnable <= DMA_PERIPHERAL_INCREMENT_MODE_ENABLE) &&
+		   (Copy_pDescriptor->memoryIncrementModeEnable <= DMA_MEMORY_INCREMENT_MODE_ENABLE))
 		{
-			/* Invoke DMA Transfer Complete Callback Function */
-			DMA_TransferCompleteNotificationFunc[3]();
-		}
-
-		/* Clear DMA Transfer Complete flag */
-		DMA_ClearInterruptFlag(DMA_CH4, DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG);
+			/* Get queue state of selected channel */
+			Local_pQueue = &DMA_TransferQueueState[Copy_ChannelId];
 
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
-	}
-
-	/******************************************************************************************************/
+			/* Queue is shared with channel IRQ and channel owners are claimed from other contexts */
+			DMA_ENTER_CRITICAL_SECTION(Local_PrimaskState);
 
-	/* Check if interrupt source is DMA Half Transfer */
-	DMA_GetInterruptFlagStatus(DMA_CH4, DMA_HALF_TRANSFER_INTERRUPT_FLAG, &Local_InterruptSource);
+			/* Check if a double-buffer stream or a Memcpy/Memset job owns the channel or not */
+			if(DMA_StreamState[Copy_ChannelId].ConsumerFunc == NULL && DMA_MemoryJob[Copy_ChannelId].Busy == 0)
+			{
+				/* Check if there is a free slot in the queue or not */
+				if(Local_pQueue->Count < DMA_TRANSFER_QUEUE_DEPTH)
+				{
+					/* Copy passed descriptor into tail slot and advance tail */
+					DMA_TransferQueue[Copy_ChannelId][Local_pQueue->Tail] = *Copy_pDescriptor;
+					Local_pQueue->Tail = (uint8_t)((Local_pQueue->Tail + 1U) % DMA_TRANSFER_QUEUE_DEPTH);
+					Local_pQueue->Count++;
+
+					/* Update max queue depth statistic */
+					if(Local_pQueue->Count > Local_pQueue->MaxDepth)
+					{
+						Local_pQueue->MaxDepth = Local_pQueue->Count;
+					}
+
+					/* Start transfer at once if channel is not chaining transfers already */
+					if(Local_pQueue->Active == 0)
+					{
+						/* Clear any stale flags of the channel with a single IFCR write */
+						DMA->IFCR = DMA_CHANNEL_FLAGS_MASK << (Copy_ChannelId * DMA_CHANNEL_FLAGS_WIDTH);
+
+						/* Mark channel as chaining and load head descriptor */
+						Local_pQueue->Active = 1;
+						DMA_QueueLoadTransfer(Copy_ChannelId);
+					}
+				}
+				else
+				{
+					/* Queue is full */
+					Local_ErrorStatus = BUSY_FUNC;
+				}
+			}
+			else
+			{
+				/* Channel is busy streaming or running a memory engine job */
+				Local_ErrorStatus = BUSY_FUNC;
+			}
 
-	if(Local_InterruptSource == 1)
-	{
-		/* Check if DMA Half Transfer callback function is registered or not */
-		if(DMA_HalfTransferNotificationFunc[3] != NULL)
+			/* Leave critical section */
+			DMA_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+		}
+		else
 		{
-			/* Invoke DMA Half Transfer Callback Function */
-			DMA_HalfTransferNotificationFunc[3]();
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
 		}
-
-		/* Clear DMA Half Transfer flag */
-		DMA_ClearInterruptFlag(DMA_CH4, DMA_HALF_TRANSFER_INTERRUPT_FLAG);
-
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
+	}
+	else
+	{
+		/* One or more of passed pointers is a NULL pointer */
+		Local_ErrorStatus = NULL_POINTER;
 	}
 
-	/******************************************************************************************************/
+	return Local_ErrorStatus;
+}
 
-	/* Check if interrupt source is DMA Transfer Error */
-	DMA_GetInterruptFlagStatus(DMA_CH4, DMA_TRANSFER_ERROR_INTERRUPT_FLAG, &Local_InterruptSource);
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: QueueFlush          			                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function aborts current queued transfer and drops all     */
+/*                 pending descriptors of selected channel                        */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_QueueFlush(uint8_t Copy_ChannelId)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+	uint32_t Local_PrimaskState;
+
+	/* Check if passed channel id is within valid range or not */
+	if(Copy_ChannelId >= DMA_CH1 && Copy_ChannelId <= DMA_CH7)
+	{
+		/* Queue is shared with channel IRQ */
+		DMA_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+		/* Check if channel is chaining queued transfers (never touch a channel owned by other users) */
+		if(DMA_TransferQueueState[Copy_ChannelId].Active == 1)
+		{
+			/* Disable selected DMA channel through clearing EN bit in CCRx register */
+			CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_EN);
+
+			/* Clear any pending flags of the channel with a single IFCR write */
+			DMA->IFCR = DMA_CHANNEL_FLAGS_MASK << (Copy_ChannelId * DMA_CHANNEL_FLAGS_WIDTH);
+		}
+
+		/* Drop all queued descriptors */
+		DMA_TransferQueueState[Copy_ChannelId].Head = 0;
+		DMA_TransferQueueState[Copy_ChannelId].Tail = 0;
+		DMA_TransferQueueState[Copy_ChannelId].Count = 0;
+		DMA_TransferQueueState[Copy_ChannelId].Active = 0;
+
+		/* Leave critical section */
+		DMA_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+	}
+	else
+	{
+		/* Out of range error */
+		Local_ErrorStatus = OUT_OF_RANGE;
+	}
+
+	return Local_ErrorStatus;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: RegisterTimestampFunc      		                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint32_t(*Copy_TimestampFunc)(void)                            */
+/* 			       Brief: Pointer to free-running time base used to measure gap   */
+/*                        latency of chained transfers and channels ownership     */
+/*                        time (NULL disables both)                               */
+/*			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                          		          */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function sets time base of DMA timing statistics         */
+/*--------------------------------------------------------------------------------*/
+void DMA_RegisterTimestampFunc(uint32_t(*Copy_TimestampFunc)(void))
+{
+	/* Set passed time base (NULL pointer simply disables timing statistics) */
+	DMA_TimestampFunc = Copy_TimestampFunc;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetQueueStatistics      		                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : DMA_QueueStatistics_t* Copy_pStatistics                        */
+/*                 Brief: Pointer to variable that will hold queue counters       */
+/*                 Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gets queue depth and gap latency statistics of   */
+/*                 selected channel                                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_GetQueueStatistics(uint8_t Copy_ChannelId , DMA_QueueStatistics_t* Copy_pStatistics)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+
+	/* Check if passed pointer is a NULL pointer or not */
+	if(Copy_pStatistics != NULL)
+	{
+		/* Check if passed channel id is within valid range or not */
+		if(Copy_ChannelId >= DMA_CH1 && Copy_ChannelId <= DMA_CH7)
+		{
+			/* Copy queue counters of selected channel */
+			Copy_pStatistics->currentDepth = DMA_TransferQueueState[Copy_ChannelId].Count;
+			Copy_pStatistics->maxDepth = DMA_TransferQueueState[Copy_ChannelId].MaxDepth;
+			Copy_pStatistics->transfersCompleted = DMA_TransferQueueState[Copy_ChannelId].TransfersCompleted;
+			Copy_pStatistics->transferErrors = DMA_TransferQueueState[Copy_ChannelId].TransferErrors;
+			Copy_pStatistics->lastGapLatency = DMA_TransferQueueState[Copy_ChannelId].LastGapLatency;
+			Copy_pStatistics->maxGapLatency = DMA_TransferQueueState[Copy_ChannelId].MaxGapLatency;
+		}
+		else
+		{
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
+		}
+	}
+	else
+	{
+		/* Passed pointer is a NULL pointer */
+		Local_ErrorStatus = NULL_POINTER;
+	}
+
+	return Local_ErrorStatus;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Memcpy                                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelPoolMask                                   */
+/* 			       Brief: Channels allowed to run the job (DMA_CHx_POOL_MASK ORed)*/
+/*			       Range: (0x01 --> 0x7F)                                         */
+/*			       -------------------------------------------------------------- */
+/*	               void* Copy_pDestination                                        */
+/*			       Brief: Pointer to destination memory                           */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               const void* Copy_pSource                                       */
+/*			       Brief: Pointer to source memory                                */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               uint32_t Copy_Size                                             */
+/*			       Brief: Number of bytes                                         */
+/*			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function copies memory through the first idle channel of  */
+/*                 the pool in memory to memory mode and waits for completion.    */
+/*                 Widest item size allowed by alignment is used, unaligned       */
+/*                 head/tail bytes and sizes below                                */
+/*                 DMA_MEMORY_ENGINE_CPU_THRESHOLD are copied by CPU and sizes    */
+/*                 above 65535 items are split into chunks.                       */
+/*                 Returns BUSY_FUNC if no channel of the pool is idle            */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_Memcpy(uint8_t Copy_ChannelPoolMask , void* Copy_pDestination , const void* Copy_pSource , uint32_t Copy_Size)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+
+	/* Check if passed pointers are NULL pointers or not */
+	if(Copy_pDestination != NULL && Copy_pSource != NULL)
+	{
+		/* Run synchronous memory copy job */
+		Local_ErrorStatus = DMA_MemoryJobSubmit(Copy_ChannelPoolMask,(uint8_t*)Copy_pDestination,(const uint8_t*)Copy_pSource,Copy_Size,DMA_PERIPHERAL_INCREMENT_MODE_ENABLE,NULL);
+	}
+	else
+	{
+		/* One or both of passed pointers is a NULL pointer */
+		Local_ErrorStatus = NULL_POINTER;
+	}
+
+	return Local_ErrorStatus;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: MemcpyAsync                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelPoolMask                                   */
+/* 			       Brief: Channels allowed to run the job (DMA_CHx_POOL_MASK ORed)*/
+/*			       Range: (0x01 --> 0x7F)                                         */
+/*			       -------------------------------------------------------------- */
+/*	               void* Copy_pDestination                                        */
+/*			       Brief: Pointer to destination memory                           */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               const void* Copy_pSource                                       */
+/*			       Brief: Pointer to source memory                                */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               uint32_t Copy_Size                                             */
+/*			       Brief: Number of bytes                                         */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               void(*Copy_NotificationFunc)(ERROR_STATUS_t)                   */
+/*			       Brief: Completion callback called from channel IRQ with job    */
+/*                        status (RT_OK or RT_NOK on transfer error)              */
+/*			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Asynchronous version of DMA_Memcpy. It returns once the job is */
+/*                 started, chunks are chained from channel IRQ (channel IRQ must */
+/*                 be enabled on NVIC) and callback is called at the end.         */
+/*                 Jobs done entirely by CPU call the callback before returning   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_MemcpyAsync(uint8_t Copy_ChannelPoolMask , void* Copy_pDestination , const void* Copy_pSource , uint32_t Copy_Size ,
+						       void(*Copy_NotificationFunc)(ERROR_STATUS_t Copy_JobStatus))
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+
+	/* Check if passed pointers are NULL pointers or not */
+	if(Copy_pDestination != NULL && Copy_pSource != NULL && Copy_NotificationFunc != NULL)
+	{
+		/* Start asynchronous memory copy job */
+		Local_ErrorStatus = DMA_MemoryJobSubmit(Copy_ChannelPoolMask,(uint8_t*)Copy_pDestination,(const uint8_t*)Copy_pSource,Copy_Size,DMA_PERIPHERAL_INCREMENT_MODE_ENABLE,Copy_NotificationFunc);
+	}
+	else
+	{
+		/* One or more of passed pointers is a NULL pointer */
+		Local_ErrorStatus = NULL_POINTER;
+	}
+
+	return Local_ErrorStatus;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Memset                                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelPoolMask                                   */
+/* 			       Brief: Channels allowed to run the job (DMA_CHx_POOL_MASK ORed)*/
+/*			       Range: (0x01 --> 0x7F)                                         */
+/*			       -------------------------------------------------------------- */
+/*	               void* Copy_pDestination                                        */
+/*			       Brief: Pointer to destination memory                           */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               uint8_t Copy_Value                                             */
+/*			       Brief: Byte value to fill destination with                     */
+/*			       Range: (0 --> 255)                                             */
+/*			       -------------------------------------------------------------- */
+/*	               uint32_t Copy_Size                                             */
+/*			       Brief: Number of bytes                                         */
+/*			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function fills memory with a byte value through the first */
+/*                 idle channel of the pool (source address does not increment)   */
+/*                 and waits for completion. Same sizing rules of DMA_Memcpy      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_Memset(uint8_t Copy_ChannelPoolMask , void* Copy_pDestination , uint8_t Copy_Value , uint32_t Copy_Size)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+	uint32_t Local_Pattern = Copy_Value * DMA_BYTE_PATTERN_REPLICATION;	/* Word-aligned replicated pattern (job copies it before returning) */
+
+	/* Check if passed pointer is a NULL pointer or not */
+	if(Copy_pDestination != NULL)
+	{
+		/* Run synchronous memory fill job */
+		Local_ErrorStatus = DMA_MemoryJobSubmit(Copy_ChannelPoolMask,(uint8_t*)Copy_pDestination,(const uint8_t*)&Local_Pattern,Copy_Size,DMA_PERIPHERAL_INCREMENT_MODE_DISABLE,NULL);
+	}
+	else
+	{
+		/* Passed pointer is a NULL pointer */
+		Local_ErrorStatus = NULL_POINTER;
+	}
+
+	return Local_ErrorStatus;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: MemsetAsync                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelPoolMask                                   */
+/* 			       Brief: Channels allowed to run the job (DMA_CHx_POOL_MASK ORed)*/
+/*			       Range: (0x01 --> 0x7F)                                         */
+/*			       -------------------------------------------------------------- */
+/*	               void* Copy_pDestination                                        */
+/*			       Brief: Pointer to destination memory                           */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               uint8_t Copy_Value                                             */
+/*			       Brief: Byte value to fill destination with                     */
+/*			       Range: (0 --> 255)                                             */
+/*			       -------------------------------------------------------------- */
+/*	               uint32_t Copy_Size                                             */
+/*			       Brief: Number of bytes                                         */
+/*			       Range: None                                                    */
+/*			       -------------------------------------------------------------- */
+/*	               void(*Copy_NotificationFunc)(ERROR_STATUS_t)                   */
+/*			       Brief: Completion callback called from channel IRQ with job    */
+/*                        status (RT_OK or RT_NOK on transfer error)              */
+/*			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Asynchronous version of DMA_Memset (same rules of               */
+/*                 DMA_MemcpyAsync)                                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_MemsetAsync(uint8_t Copy_ChannelPoolMask , void* Copy_pDestination , uint8_t Copy_Value , uint32_t Copy_Size ,
+						       void(*Copy_NotificationFunc)(ERROR_STATUS_t Copy_JobStatus))
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+	uint32_t Local_Pattern = Copy_Value * DMA_BYTE_PATTERN_REPLICATION;	/* Word-aligned replicated pattern (job copies it before returning) */
+
+	/* Check if passed pointers are NULL pointers or not */
+	if(Copy_pDestination != NULL && Copy_NotificationFunc != NULL)
+	{
+		/* Start asynchronous memory fill job */
+		Local_ErrorStatus = DMA_MemoryJobSubmit(Copy_ChannelPoolMask,(uint8_t*)Copy_pDestination,(const uint8_t*)&Local_Pattern,Copy_Size,DMA_PERIPHERAL_INCREMENT_MODE_DISABLE,Copy_NotificationFunc);
+	}
+	else
+	{
+		/* One or both of passed pointers is a NULL pointer */
+		Local_ErrorStatus = NULL_POINTER;
+	}
+
+	return Local_ErrorStatus;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: AllocateChannel          			                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_RequestId                                         */
+/* 			       Brief: Peripheral request line that needs a channel            */
+/*			       Range: (DMA_REQUEST_ADC1 --> DMA_REQUEST_MEM_TO_MEM)           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint8_t* Copy_pChannelId                                       */
+/*                 Brief: Pointer to variable that will hold allocated channel id */
+/*                 Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function hands out a free channel that is legal for the   */
+/*                 passed request line (peripheral requests are hard-wired to one */
+/*                 channel, memory to memory may use any channel, highest first). */
+/*                 Returns BUSY_FUNC if every legal channel is already owned      */
+/*                 (allocated, running a Memcpy/Memset job, streaming or chaining */
+/*                 queued transfers)                                              */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_AllocateChannel(uint8_t Copy_RequestId , uint8_t* Copy_pChannelId)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = BUSY_FUNC;
+	uint8_t Local_Iterator;
+	uint32_t Local_PrimaskState;
+
+	/* Check if passed pointer is a NULL pointer or not */
+	if(Copy_pChannelId != NULL)
+	{
+		/* Check if passed request line is within valid range or not */
+		if(Copy_RequestId < DMA_REQUESTS_NUMBER)
+		{
+			/* Ownership table is shared with other contexts */
+			DMA_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+			/* Search legal channels from highest to lowest (keeps low channels free for peripherals when allocating memory to memory) */
+			for(Local_Iterator = DMA_CHANNELS_NUMBER ; Local_Iterator > 0 && Local_ErrorStatus == BUSY_FUNC ; Local_Iterator--)
+			{
+				/* Check if channel is legal for the request and neither allocated, running a memory engine job, streaming nor chaining queued transfers */
+				if(GET_BIT(DMA_RequestChannelPool[Copy_RequestId],(Local_Iterator - 1U)) == 1 &&
+				   DMA_ChannelOwnership[Local_Iterator - 1U].Allocated == 0 && DMA_MemoryJob[Local_Iterator - 1U].Busy == 0 &&
+				   DMA_StreamState[Local_Iterator - 1U].ConsumerFunc == NULL && DMA_TransferQueueState[Local_Iterator - 1U].Active == 0)
+				{
+					/* Take ownership of the channel */
+					DMA_ChannelOwnership[Local_Iterator - 1U].Allocated = 1;
+					DMA_ChannelOwnership[Local_Iterator - 1U].OwnerRequestId = Copy_RequestId;
+					DMA_ChannelOwnership[Local_Iterator - 1U].Allocations++;
+
+					/* Start ownership time measurement if a time base is registered */
+					if(DMA_TimestampFunc != NULL)
+					{
+						DMA_ChannelOwnership[Local_Iterator - 1U].AllocationTimestamp = DMA_TimestampFunc();
+					}
+
+					/* Return allocated channel */
+					*Copy_pChannelId = (uint8_t)(Local_Iterator - 1U);
+					Local_ErrorStatus = RT_OK;
+				}
+			}
+
+			/* Leave critical section */
+			DMA_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+		}
+		else
+		{
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
+		}
+	}
+	else
+	{
+		/* Passed pointer is a NULL pointer */
+		Local_ErrorStatus = NULL_POINTER;
+	}
+
+	return Local_ErrorStatus;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: FreeChannel          			                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Channel id returned by DMA_AllocateChannel              */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function disables an allocated channel and gives it back  */
+/*                 to the pool (its configuration cache is kept so the next owner */
+/*                 with same configuration skips register rewrite)                */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_FreeChannel(uint8_t Copy_ChannelId)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+	uint32_t Local_PrimaskState;
+
+	/* Check if passed channel id is within valid range or not */
+	if(Copy_ChannelId >= DMA_CH1 && Copy_ChannelId <= DMA_CH7)
+	{
+		/* Ownership table is shared with other contexts */
+		DMA_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+		/* Check if channel is allocated or not */
+		if(DMA_ChannelOwnership[Copy_ChannelId].Allocated == 1)
+		{
+			/* Disable channel through clearing EN bit in CCRx register */
+			CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_EN);
+
+			/* Accumulate ownership time if a time base is registered */
+			if(DMA_TimestampFunc != NULL)
+			{
+				DMA_ChannelOwnership[Copy_ChannelId].OwnedTime += DMA_TimestampFunc() - DMA_ChannelOwnership[Copy_ChannelId].AllocationTimestamp;
+			}
+
+			/* Give channel back to the pool */
+			DMA_ChannelOwnership[Copy_ChannelId].Allocated = 0;
+		}
+		else
+		{
+			/* Channel is not allocated */
+			Local_ErrorStatus = RT_NOK;
+		}
+
+		/* Leave critical section */
+		DMA_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+	}
+	else
+	{
+		/* Out of range error */
+		Local_ErrorStatus = OUT_OF_RANGE;
+	}
+
+	return Local_ErrorStatus;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetChannelUtilization      		                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: Desired DMA channel id                                  */
+/*			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : DMA_ChannelUtilization_t* Copy_pUtilization                    */
+/*                 Brief: Pointer to variable that will hold channel counters     */
+/*                 Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : This function gets ownership and configuration counters of     */
+/*                 selected channel                                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t DMA_GetChannelUtilization(uint8_t Copy_ChannelId , DMA_ChannelUtilization_t* Copy_pUtilization)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+	DMA_ChannelOwnership_t* Local_pOwnership;
+
+	/* Check if passed pointer is a NULL pointer or not */
+	if(Copy_pUtilization != NULL)
+	{
+		/* Check if passed channel id is within valid range or not */
+		if(Copy_ChannelId >= DMA_CH1 && Copy_ChannelId <= DMA_CH7)
+		{
+			/* Copy counters of selected channel */
+			Local_pOwnership = &DMA_ChannelOwnership[Copy_ChannelId];
+			Copy_pUtilization->isAllocated = Local_pOwnership->Allocated;
+			Copy_pUtilization->ownerRequestId = Local_pOwnership->OwnerRequestId;
+			Copy_pUtilization->allocations = Local_pOwnership->Allocations;
+			Copy_pUtilization->configurations = Local_pOwnership->Configurations;
+			Copy_pUtilization->configurationsSkipped = Local_pOwnership->ConfigurationsSkipped;
+			Copy_pUtilization->ownedTime = Local_pOwnership->OwnedTime;
+
+			/* Include running allocation in ownership time */
+			if(Local_pOwnership->Allocated == 1 && DMA_TimestampFunc != NULL)
+			{
+				Copy_pUtilization->ownedTime += DMA_TimestampFunc() - Local_pOwnership->AllocationTimestamp;
+			}
+		}
+		else
+		{
+			/* Out of range error */
+			Local_ErrorStatus = OUT_OF_RANGE;
+		}
+	}
+	else
+	{
+		/* Passed pointer is a NULL pointer */
+		Local_ErrorStatus = NULL_POINTER;
+	}
+
+	return Local_ErrorStatus;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: IRQDispatch          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: DMA channel id whose IRQ handler is running             */
+/* 			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                          				  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Shared core of DMA channels IRQ handlers. It latches ISR      */
+/*                 register once, clears the latched flags of the channel with    */
+/*                 one IFCR write then invokes the registered callbacks           */
+/*--------------------------------------------------------------------------------*/
+static void DMA_IRQDispatch(uint8_t Copy_ChannelId)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_FlagsShift = (uint32_t)Copy_ChannelId * DMA_CHANNEL_FLAGS_WIDTH;	/* Position of channel flags nibble in ISR/IFCR */
+	uint32_t Local_ChannelFlags;														/* Latched channel flags nibble */
+	DMA_ChannelDescriptor_t* Local_pDescriptor = &DMA_ChannelDescriptor[Copy_ChannelId];
+
+	/* Latch ISR register once then mask the nibble of the channel */
+	Local_ChannelFlags = (DMA->ISR >> Local_FlagsShift) & DMA_CHANNEL_FLAGS_MASK;
+
+	/* Clear all latched flags of the channel (including global flag) with a single IFCR write before invoking the callbacks,
+	 * so that any event raised again while a callback is running is kept pending and not lost */
+	DMA->IFCR = (Local_ChannelFlags | (1U << DMA_GLOBAL_INTERRUPT_FLAG)) << Local_FlagsShift;
+
+	/* Check if a stream is running on the channel to hand it the completed buffer half */
+	if(DMA_StreamState[Copy_ChannelId].ConsumerFunc != NULL)
+	{
+		/* Service double-buffer stream of the channel */
+		DMA_StreamService(Copy_ChannelId,Local_ChannelFlags);
+	}
+	/* Check if the channel is chaining queued scatter-gather transfers */
+	else if(DMA_TransferQueueState[Copy_ChannelId].Active == 1)
+	{
+		/* Service scatter-gather queue of the channel */
+		DMA_QueueService(Copy_ChannelId,Local_ChannelFlags);
+	}
+	/* Check if the channel is running an asynchronous memory engine job */
+	else if(DMA_MemoryJob[Copy_ChannelId].Busy == 1 && DMA_MemoryJob[Copy_ChannelId].NotificationFunc != NULL)
+	{
+		/* Service memory engine job of the channel */
+		DMA_MemoryJobService(Copy_ChannelId,Local_ChannelFlags);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	/* Check if interrupt source is DMA Transfer Complete and its callback function is registered or not */
+	if((GET_BIT(Local_ChannelFlags,DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG) == 1) && (Local_pDescriptor->TransferCompleteNotificationFunc != NULL))
+	{
+		/* Invoke DMA Transfer Complete Callback Function */
+		Local_pDescriptor->TransferCompleteNotificationFunc();
+	}
+
+	/* Check if interrupt source is DMA Half Transfer and its callback function is registered or not */
+	if((GET_BIT(Local_ChannelFlags,DMA_HALF_TRANSFER_INTERRUPT_FLAG) == 1) && (Local_pDescriptor->HalfTransferNotificationFunc != NULL))
+	{
+		/* Invoke DMA Half Transfer Callback Function */
+		Local_pDescriptor->HalfTransferNotificationFunc();
+	}
+
+	/* Check if interrupt source is DMA Transfer Error and its callback function is registered or not */
+	if((GET_BIT(Local_ChannelFlags,DMA_TRANSFER_ERROR_INTERRUPT_FLAG) == 1) && (Local_pDescriptor->TransferErrorNotificationFunc != NULL))
+	{
+		/* Invoke DMA Transfer Error Callback Function */
+		Local_pDescriptor->TransferErrorNotificationFunc();
+	}
+}
 
-	if(Local_InterruptSource == 1)
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: StreamService          					                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: DMA channel id running in stream mode                   */
+/* 			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/* 			       -------------------------------------------------------------- */
+/* 				   uint32_t Copy_ChannelFlags			                          */
+/* 			       Brief: Latched interrupt flags nibble of the channel           */
+/* 			       Range: (0x0 --> 0xF)                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                          				  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Hands the buffer half that has just been completed to the      */
+/*                 stream consumer and updates stream statistics                  */
+/*--------------------------------------------------------------------------------*/
+static void DMA_StreamService(uint8_t Copy_ChannelId , uint32_t Copy_ChannelFlags)
+{
+	/* Local Variables Definitions */
+	DMA_StreamState_t* Local_pStream = &DMA_StreamState[Copy_ChannelId];
+	uint8_t Local_HalfCompleted = GET_BIT(Copy_ChannelFlags,DMA_HALF_TRANSFER_INTERRUPT_FLAG);
+	uint8_t Local_FullCompleted = GET_BIT(Copy_ChannelFlags,DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG);
+	uint8_t Local_PendingFlagId;											/* Flag that must not be raised again before consumer returns */
+	uint8_t* Local_pBlock;													/* Start of completed buffer half */
+
+	/* Check if a transfer error is raised (hardware disables the channel on transfer error) */
+	if(GET_BIT(Copy_ChannelFlags,DMA_TRANSFER_ERROR_INTERRUPT_FLAG) == 1)
+	{
+		/* Count transfer error and stop the stream */
+		Local_pStream->TransferErrors++;
+		Local_pStream->ConsumerFunc = NULL;
+	}
+	/* Check if both halves completed before the IRQ was serviced (consumer or IRQ latency fell behind) */
+	else if(Local_HalfCompleted == 1 && Local_FullCompleted == 1)
 	{
-		/* Check if DMA Transfer Error callback function is registered or not */
-		if(DMA_TransferErrorNotificationFunc[3] != NULL)
+		/* One of the two halves is already being overwritten */
+		Local_pStream->Overruns++;
+
+		/* Keep only the half that DMA is not writing now: remaining items above one half means DMA is in first half */
+		if(DMA->Channel[Copy_ChannelId].CNDTR > Local_pStream->HalfLength)
+		{
+			/* Second half is the stable one */
+			Local_HalfCompleted = 0;
+		}
+		else
 		{
-			/* Invoke DMA Transfer Error Callback Function */
-			DMA_TransferErrorNotificationFunc[3]();
+			/* First half is the stable one */
+			Local_FullCompleted = 0;
 		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
 
-		/* Clear DMA Transfer Error flag */
-		DMA_ClearInterruptFlag(DMA_CH4, DMA_TRANSFER_ERROR_INTERRUPT_FLAG);
+	/* Check if there is a completed half to hand to the consumer */
+	if(Local_pStream->ConsumerFunc != NULL && (Local_HalfCompleted == 1 || Local_FullCompleted == 1))
+	{
+		/* Check which half has been completed */
+		if(Local_HalfCompleted == 1)
+		{
+			/* First half is completed, DMA is now filling second half */
+			Local_pBlock = Local_pStream->pBuffer;
+			Local_PendingFlagId = DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG;
+		}
+		else
+		{
+			/* Second half is completed, DMA wrapped and is now filling first half */
+			Local_pBlock = Local_pStream->pBuffer + ((uint32_t)Local_pStream->HalfLength * Local_pStream->ItemSize);
+			Local_PendingFlagId = DMA_HALF_TRANSFER_INTERRUPT_FLAG;
+		}
 
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
-	}
+		/* Hand completed half to the consumer in place */
+		Local_pStream->ConsumerFunc(Local_pBlock,Local_pStream->HalfLength);
 
-	/******************************************************************************************************/
+		/* Update throughput counters */
+		Local_pStream->BlocksDelivered++;
+		Local_pStream->ItemsDelivered += Local_pStream->HalfLength;
 
-	/* Clear DMA Global Interrupt flag */
-	DMA_ClearInterruptFlag(DMA_CH4, DMA_GLOBAL_INTERRUPT_FLAG);
+		/* If the other half got completed while consumer was running, DMA has wrapped into the half the consumer was reading */
+		if(GET_BIT(DMA->ISR,((Copy_ChannelId * DMA_CHANNEL_FLAGS_WIDTH) + Local_PendingFlagId)) == 1)
+		{
+			/* Consumer fell behind the stream */
+			Local_pStream->Overruns++;
+		}
+	}
 }
 
 /*--------------------------------------------------------------------------------*/
-/*                                                                                */
-/* @Description	: DMA1 channel5 interrupt                                         */
-/*				                                                                  */
+/* @Function Name: QueueService          					                      */
 /*--------------------------------------------------------------------------------*/
-void DMA1_Channel5_IRQHandler(void)
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: DMA channel id chaining queued transfers                */
+/* 			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/* 			       -------------------------------------------------------------- */
+/* 				   uint32_t Copy_ChannelFlags			                          */
+/* 			       Brief: Latched interrupt flags nibble of the channel           */
+/* 			       Range: (0x0 --> 0xF)                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                          				  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Retires the finished queued transfer and programs the next     */
+/*                 one (if any) back-to-back from the channel IRQ                 */
+/*--------------------------------------------------------------------------------*/
+static void DMA_QueueService(uint8_t Copy_ChannelId , uint32_t Copy_ChannelFlags)
 {
-	/* Local variables definitions */
-	uint8_t Local_InterruptSource = 0;
-
-	/**************************************Check source of interrupt**************************************/
+	/* Local Variables Definitions */
+	DMA_TransferQueueState_t* Local_pQueue = &DMA_TransferQueueState[Copy_ChannelId];
+	uint32_t Local_StartTime = 0;
+	uint32_t Local_GapLatency;
 
-	/* Check if interrupt source is DMA Transfer Complete */
-    DMA_GetInterruptFlagStatus(DMA_CH5, DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG, &Local_InterruptSource);
+	/* Take service start time as early as possible if a time base is registered */
+	if(DMA_TimestampFunc != NULL)
+	{
+		Local_StartTime = DMA_TimestampFunc();
+	}
 
-	if(Local_InterruptSource == 1)
+	/* Check if head transfer has ended (completed or aborted by hardware on transfer error) */
+	if(GET_BIT(Copy_ChannelFlags,DMA_TRANSFER_ERROR_INTERRUPT_FLAG) == 1 || GET_BIT(Copy_ChannelFlags,DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG) == 1)
 	{
-		/* Check if DMA Transfer Complete callback function is registered or not */
-		if(DMA_TransferCompleteNotificationFunc[4] != NULL)
+		/* Count how head transfer has ended */
+		if(GET_BIT(Copy_ChannelFlags,DMA_TRANSFER_ERROR_INTERRUPT_FLAG) == 1)
 		{
-			/* Invoke DMA Transfer Complete Callback Function */
-			DMA_TransferCompleteNotificationFunc[4]();
+			Local_pQueue->TransferErrors++;
+		}
+		else
+		{
+			Local_pQueue->TransfersCompleted++;
 		}
 
-		/* Clear DMA Transfer Complete flag */
-		DMA_ClearInterruptFlag(DMA_CH5, DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG);
-
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
-	}
+		/* Retire head descriptor */
+		Local_pQueue->Head = (uint8_t)((Local_pQueue->Head + 1U) % DMA_TRANSFER_QUEUE_DEPTH);
+		Local_pQueue->Count--;
 
-	/******************************************************************************************************/
+		/* Check if there are more queued transfers to chain */
+		if(Local_pQueue->Count > 0)
+		{
+			/* Start next transfer back-to-back */
+			DMA_QueueLoadTransfer(Copy_ChannelId);
 
-	/* Check if interrupt source is DMA Half Transfer */
-	DMA_GetInterruptFlagStatus(DMA_CH5, DMA_HALF_TRANSFER_INTERRUPT_FLAG, &Local_InterruptSource);
+			/* Update gap latency statistics */
+			if(DMA_TimestampFunc != NULL)
+			{
+				Local_GapLatency = DMA_TimestampFunc() - Local_StartTime;
+				Local_pQueue->LastGapLatency = Local_GapLatency;
 
-	if(Local_InterruptSource == 1)
-	{
-		/* Check if DMA Half Transfer callback function is registered or not */
-		if(DMA_HalfTransferNotificationFunc[4] != NULL)
+				if(Local_GapLatency > Local_pQueue->MaxGapLatency)
+				{
+					Local_pQueue->MaxGapLatency = Local_GapLatency;
+				}
+			}
+		}
+		else
 		{
-			/* Invoke DMA Half Transfer Callback Function */
-			DMA_HalfTransferNotificationFunc[4]();
+			/* Queue drained, disable channel (EN stays set after a normal mode transfer) so other users can claim it and go idle */
+			CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_EN);
+			Local_pQueue->Active = 0;
 		}
-
-		/* Clear DMA Half Transfer flag */
-		DMA_ClearInterruptFlag(DMA_CH5, DMA_HALF_TRANSFER_INTERRUPT_FLAG);
-
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
 	}
+}
 
-	/******************************************************************************************************/
-
-	/* Check if interrupt source is DMA Transfer Error */
-	DMA_GetInterruptFlagStatus(DMA_CH5, DMA_TRANSFER_ERROR_INTERRUPT_FLAG, &Local_InterruptSource);
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: QueueLoadTransfer          					                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: DMA channel id                                          */
+/* 			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                          				  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Programs the descriptor at head of channel queue into channel  */
+/*                 registers (one CCR store) and enables the channel              */
+/*--------------------------------------------------------------------------------*/
+static void DMA_QueueLoadTransfer(uint8_t Copy_ChannelId)
+{
+	/* Local Variables Definitions */
+	DMA_TransferDescriptor_t* Local_pDescriptor = &DMA_TransferQueue[Copy_ChannelId][DMA_TransferQueueState[Copy_ChannelId].Head];
+	uint32_t Local_CCR;
 
-	if(Local_InterruptSource == 1)
-	{
-		/* Check if DMA Transfer Error callback function is registered or not */
-		if(DMA_TransferErrorNotificationFunc[4] != NULL)
-		{
-			/* Invoke DMA Transfer Error Callback Function */
-			DMA_TransferErrorNotificationFunc[4]();
-		}
+	/* Make sure that selected DMA channel is disabled through clearing EN bit in CCRx register */
+	CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_EN);
 
-		/* Clear DMA Transfer Error flag */
-		DMA_ClearInterruptFlag(DMA_CH5, DMA_TRANSFER_ERROR_INTERRUPT_FLAG);
+	/* Keep direction, priority, MEM2MEM and half transfer settings of DMA_ChannelInit and drop per transfer fields (circular mode is never used when chaining) */
+	Local_CCR = DMA->Channel[Copy_ChannelId].CCR & DMA_QUEUE_TRANSFER_FIELDS_MASK;
 
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
-	}
+	/* Build per transfer fields from descriptor and force transfer complete and transfer error interrupts used for chaining */
+	Local_CCR |= ((uint32_t)Local_pDescriptor->peripheralSize << CCR_PSIZE) |
+				 ((uint32_t)Local_pDescriptor->memorySize << CCR_MSIZE) |
+				 ((uint32_t)Local_pDescriptor->peripheralIncrementModeEnable << CCR_PINC) |
+				 ((uint32_t)Local_pDescriptor->memoryIncrementModeEnable << CCR_MINC) |
+				 (1U << CCR_TCIE) | (1U << CCR_TEIE);
 
-	/******************************************************************************************************/
+	/* Set addresses and number of data items of the transfer */
+	DMA->Channel[Copy_ChannelId].CPAR = (uint32_t)Local_pDescriptor->pPeripheralAddress;
+	DMA->Channel[Copy_ChannelId].CMAR = (uint32_t)Local_pDescriptor->pMemoryAddress;
+	DMA->Channel[Copy_ChannelId].CNDTR = Local_pDescriptor->length;
 
-	/* Clear DMA Global Interrupt flag */
-	DMA_ClearInterruptFlag(DMA_CH5, DMA_GLOBAL_INTERRUPT_FLAG);
+	/* Write channel configuration with EN bit set in one store to start the transfer */
+	DMA->Channel[Copy_ChannelId].CCR = Local_CCR | (1U << CCR_EN);
 }
 
 /*--------------------------------------------------------------------------------*/
-/*                                                                                */
-/* @Description	: DMA1 channel6 interrupt                                         */
-/*				                                                                  */
+/* @Function Name: MemoryJobSubmit          					                  */
 /*--------------------------------------------------------------------------------*/
-void DMA1_Channel6_IRQHandler(void)
+/* @Param(in)	 : uint8_t Copy_ChannelPoolMask                                   */
+/* 			       Brief: Channels allowed to run the job (bit n = DMA_CH(n+1))   */
+/* 			       Range: (0x01 --> 0x7F)                                         */
+/* 			       -------------------------------------------------------------- */
+/* 				   uint8_t* Copy_pDestination , const uint8_t* Copy_pSource      */
+/* 			       Brief: Destination and source of the job (source is pattern    */
+/*                        word for memset jobs)                                   */
+/* 			       Range: None                                                    */
+/* 			       -------------------------------------------------------------- */
+/* 				   uint32_t Copy_Size , uint8_t Copy_SourceIncrement              */
+/* 			       Brief: Job size in bytes and whether source increments         */
+/* 			       Range: None                                                    */
+/* 			       -------------------------------------------------------------- */
+/* 				   void(*Copy_NotificationFunc)(ERROR_STATUS_t)                   */
+/* 			       Brief: Completion callback (NULL runs job synchronously)       */
+/* 			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                          		  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Common core of DMA_Memcpy/DMA_Memset family. It copies the      */
+/*                 unaligned head/tail bytes with CPU, picks widest legal item    */
+/*                 size, claims an idle channel of the pool and runs the job      */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t DMA_MemoryJobSubmit(uint8_t Copy_ChannelPoolMask , uint8_t* Copy_pDestination , const uint8_t* Copy_pSource ,
+										  uint32_t Copy_Size , uint8_t Copy_SourceIncrement , void(*Copy_NotificationFunc)(ERROR_STATUS_t Copy_JobStatus))
 {
-	/* Local variables definitions */
-	uint8_t Local_InterruptSource = 0;
-
-	/**************************************Check source of interrupt**************************************/
-
-	/* Check if interrupt source is DMA Transfer Complete */
-    DMA_GetInterruptFlagStatus(DMA_CH6, DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG, &Local_InterruptSource);
-
-	if(Local_InterruptSource == 1)
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_ErrorStatus = RT_OK;
+	uint32_t Local_DestinationAddress = (uint32_t)Copy_pDestination;
+	uint32_t Local_AlignmentMask;			/* Alignment both ends of DMA part must share */
+	uint32_t Local_HeadSize;				/* Bytes copied by CPU before DMA part */
+	uint32_t Local_TailSize;				/* Bytes copied by CPU after DMA part */
+	uint8_t Local_SizeShift;				/* log2 of DMA item size */
+	uint8_t Local_ChannelId = DMA_CHANNELS_NUMBER;
+	uint8_t Local_Iterator;
+	uint32_t Local_PrimaskState;
+	uint32_t Local_ChannelFlags;
+	DMA_MemoryJob_t* Local_pJob;
+
+	/* Check if passed channel pool is within valid range or not */
+	if(Copy_ChannelPoolMask != 0 && (Copy_ChannelPoolMask & ~DMA_ALL_CHANNELS_POOL_MASK) == 0)
 	{
-		/* Check if DMA Transfer Complete callback function is registered or not */
-		if(DMA_TransferCompleteNotificationFunc[5] != NULL)
+		/* Pick widest item size both ends can keep aligned to (memset source is a word pattern so only destination matters) */
+		if(Copy_SourceIncrement == DMA_PERIPHERAL_INCREMENT_MODE_DISABLE || ((Local_DestinationAddress ^ (uint32_t)Copy_pSource) & DMA_WORD_ALIGNMENT_MASK) == 0)
 		{
-			/* Invoke DMA Transfer Complete Callback Function */
-			DMA_TransferCompleteNotificationFunc[5]();
+			/* 32 bits items */
+			Local_AlignmentMask = DMA_WORD_ALIGNMENT_MASK;
+			Local_SizeShift = DMA_MEMORY_SIZE_32_BITS;
+		}
+		else if(((Local_DestinationAddress ^ (uint32_t)Copy_pSource) & DMA_HALF_WORD_ALIGNMENT_MASK) == 0)
+		{
+			/* 16 bits items */
+			Local_AlignmentMask = DMA_HALF_WORD_ALIGNMENT_MASK;
+			Local_SizeShift = DMA_MEMORY_SIZE_16_BITS;
+		}
+		else
+		{
+			/* 8 bits items */
+			Local_AlignmentMask = 0;
+			Local_SizeShift = DMA_MEMORY_SIZE_8_BITS;
 		}
 
-		/* Clear DMA Transfer Complete flag */
-		DMA_ClearInterruptFlag(DMA_CH6, DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG);
-
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
-	}
-
-	/******************************************************************************************************/
-
-	/* Check if interrupt source is DMA Half Transfer */
-	DMA_GetInterruptFlagStatus(DMA_CH6, DMA_HALF_TRANSFER_INTERRUPT_FLAG, &Local_InterruptSource);
+		/* Split job into CPU head (up to alignment), DMA middle and CPU tail (remainder of last item) */
+		Local_HeadSize = ((Local_AlignmentMask + 1U) - (Local_DestinationAddress & Local_AlignmentMask)) & Local_AlignmentMask;
 
-	if(Local_InterruptSource == 1)
-	{
-		/* Check if DMA Half Transfer callback function is registered or not */
-		if(DMA_HalfTransferNotificationFunc[5] != NULL)
+		/* Check if job is too small to be worth DMA setup cost */
+		if(Copy_Size < (Local_HeadSize + DMA_MEMORY_ENGINE_CPU_THRESHOLD) || Copy_Size < (Local_HeadSize + Local_AlignmentMask + 1U))
 		{
-			/* Invoke DMA Half Transfer Callback Function */
-			DMA_HalfTransferNotificationFunc[5]();
+			/* Whole job is done by CPU */
+			DMA_CpuCopy(Copy_pDestination,Copy_pSource,Copy_Size,Copy_SourceIncrement);
+
+			/* Notify asynchronous caller at once */
+			if(Copy_NotificationFunc != NULL)
+			{
+				Copy_NotificationFunc(RT_OK);
+			}
 		}
+		else
+		{
+			/* Claim first idle channel of the pool (not allocated, not streaming, not chaining, not running a job and disabled) */
+			DMA_ENTER_CRITICAL_SECTION(Local_PrimaskState);
 
-		/* Clear DMA Half Transfer flag */
-		DMA_ClearInterruptFlag(DMA_CH6, DMA_HALF_TRANSFER_INTERRUPT_FLAG);
+			for(Local_Iterator = DMA_CH1 ; Local_Iterator <= DMA_CH7 && Local_ChannelId == DMA_CHANNELS_NUMBER ; Local_Iterator++)
+			{
+				if(GET_BIT(Copy_ChannelPoolMask,Local_Iterator) == 1 && DMA_MemoryJob[Local_Iterator].Busy == 0 && DMA_ChannelOwnership[Local_Iterator].Allocated == 0 &&
+				   DMA_StreamState[Local_Iterator].ConsumerFunc == NULL && DMA_TransferQueueState[Local_Iterator].Active == 0 &&
+				   GET_BIT(DMA->Channel[Local_Iterator].CCR,CCR_EN) == 0)
+				{
+					/* Take ownership of the channel */
+					Local_ChannelId = Local_Iterator;
+					DMA_MemoryJob[Local_ChannelId].Busy = 1;
+				}
+			}
 
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
+			/* Leave critical section */
+			DMA_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+
+			/* Check if an idle channel is found or not */
+			if(Local_ChannelId < DMA_CHANNELS_NUMBER)
+			{
+				/* Tail is what does not fill a whole item after the head */
+				Local_TailSize = (Copy_Size - Local_HeadSize) & Local_AlignmentMask;
+
+				/* Copy unaligned head and tail bytes with CPU (regions never overlap so order does not matter) */
+				DMA_CpuCopy(Copy_pDestination,Copy_pSource,Local_HeadSize,Copy_SourceIncrement);
+				DMA_CpuCopy(Copy_pDestination + (Copy_Size - Local_TailSize),
+							(Copy_SourceIncrement == DMA_PERIPHERAL_INCREMENT_MODE_ENABLE) ? (Copy_pSource + (Copy_Size - Local_TailSize)) : Copy_pSource,
+							Local_TailSize,Copy_SourceIncrement);
+
+				/* Set job state of the channel (memset pattern is copied into job so caller's pattern can go out of scope) */
+				Local_pJob = &DMA_MemoryJob[Local_ChannelId];
+				if(Copy_SourceIncrement == DMA_PERIPHERAL_INCREMENT_MODE_ENABLE)
+				{
+					Local_pJob->SourceAddress = (uint32_t)Copy_pSource + Local_HeadSize;
+				}
+				else
+				{
+					Local_pJob->Pattern = *(const uint32_t*)Copy_pSource;
+					Local_pJob->SourceAddress = (uint32_t)&Local_pJob->Pattern;
+				}
+				Local_pJob->DestinationAddress = Local_DestinationAddress + Local_HeadSize;
+				Local_pJob->RemainingItems = (Copy_Size - Local_HeadSize - Local_TailSize) >> Local_SizeShift;
+				Local_pJob->SizeShift = Local_SizeShift;
+				Local_pJob->SourceIncrement = Copy_SourceIncrement;
+				Local_pJob->NotificationFunc = Copy_NotificationFunc;
+				Local_pJob->ChunkItems = 0;
+
+				/* Clear any stale flags of the channel with a single IFCR write */
+				DMA->IFCR = DMA_CHANNEL_FLAGS_MASK << (Local_ChannelId * DMA_CHANNEL_FLAGS_WIDTH);
+
+				/* Start first chunk */
+				DMA_MemoryJobLoadChunk(Local_ChannelId);
+
+				/* Check if job is synchronous or not */
+				if(Copy_NotificationFunc == NULL)
+				{
+					/* Run chunks by polling channel flags (interrupts are off for synchronous jobs) */
+					while(Local_pJob->RemainingItems > 0 || Local_pJob->ChunkItems > 0)
+					{
+						/* Wait for chunk to complete or fail */
+						do
+						{
+							Local_ChannelFlags = (DMA->ISR >> (Local_ChannelId * DMA_CHANNEL_FLAGS_WIDTH)) & DMA_CHANNEL_FLAGS_MASK;
+						}
+						while(GET_BIT(Local_ChannelFlags,DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG) == 0 && GET_BIT(Local_ChannelFlags,DMA_TRANSFER_ERROR_INTERRUPT_FLAG) == 0);
+
+						/* Clear channel flags with a single IFCR write */
+						DMA->IFCR = DMA_CHANNEL_FLAGS_MASK << (Local_ChannelId * DMA_CHANNEL_FLAGS_WIDTH);
+
+						/* Check if chunk failed or not */
+						if(GET_BIT(Local_ChannelFlags,DMA_TRANSFER_ERROR_INTERRUPT_FLAG) == 1)
+						{
+							/* Abort job */
+							Local_pJob->RemainingItems = 0;
+							Local_pJob->ChunkItems = 0;
+							Local_ErrorStatus = RT_NOK;
+						}
+						else if(Local_pJob->RemainingItems > 0)
+						{
+							/* Start next chunk */
+							DMA_MemoryJobLoadChunk(Local_ChannelId);
+						}
+						else
+						{
+							/* Last chunk is done */
+							Local_pJob->ChunkItems = 0;
+						}
+					}
+
+					/* Disable channel and release it */
+					CLEAR_BIT(DMA->Channel[Local_ChannelId].CCR,CCR_EN);
+					Local_pJob->Busy = 0;
+				}
+			}
+			else
+			{
+				/* No idle channel in the pool */
+				Local_ErrorStatus = BUSY_FUNC;
+			}
+		}
+	}
+	else
+	{
+		/* Out of range error */
+		Local_ErrorStatus = OUT_OF_RANGE;
 	}
 
-	/******************************************************************************************************/
+	return Local_ErrorStatus;
+}
 
-	/* Check if interrupt source is DMA Transfer Error */
-	DMA_GetInterruptFlagStatus(DMA_CH6, DMA_TRANSFER_ERROR_INTERRUPT_FLAG, &Local_InterruptSource);
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: MemoryJobLoadChunk          					                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: DMA channel id owned by a memory engine job             */
+/* 			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                          				  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Programs next chunk (up to 65535 items) of the job into the    */
+/*                 channel with one CCR store and starts it                       */
+/*--------------------------------------------------------------------------------*/
+static void DMA_MemoryJobLoadChunk(uint8_t Copy_ChannelId)
+{
+	/* Local Variables Definitions */
+	DMA_MemoryJob_t* Local_pJob = &DMA_MemoryJob[Copy_ChannelId];
+	uint32_t Local_CCR;
 
-	if(Local_InterruptSource == 1)
+	/* Advance addresses past the previous chunk */
+	Local_pJob->DestinationAddress += Local_pJob->ChunkItems << Local_pJob->SizeShift;
+	if(Local_pJob->SourceIncrement == DMA_PERIPHERAL_INCREMENT_MODE_ENABLE)
 	{
-		/* Check if DMA Transfer Error callback function is registered or not */
-		if(DMA_TransferErrorNotificationFunc[5] != NULL)
-		{
-			/* Invoke DMA Transfer Error Callback Function */
-			DMA_TransferErrorNotificationFunc[5]();
-		}
+		Local_pJob->SourceAddress += Local_pJob->ChunkItems << Local_pJob->SizeShift;
+	}
 
-		/* Clear DMA Transfer Error flag */
-		DMA_ClearInterruptFlag(DMA_CH6, DMA_TRANSFER_ERROR_INTERRUPT_FLAG);
+	/* Take next chunk, CNDTR holds up to 65535 items */
+	Local_pJob->ChunkItems = (Local_pJob->RemainingItems > DMA_MAX_BLOCK_LENGTH_VAL) ? DMA_MAX_BLOCK_LENGTH_VAL : Local_pJob->RemainingItems;
+	Local_pJob->RemainingItems -= Local_pJob->ChunkItems;
 
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
+	/* Build memory to memory image: read from CPAR (source) to CMAR (destination), both sides same item size */
+	Local_CCR = (1U << CCR_MEM2MEM) | ((uint32_t)DMA_MEMORY_ENGINE_PRIORITY << CCR_PL) |
+				((uint32_t)Local_pJob->SizeShift << CCR_MSIZE) | ((uint32_t)Local_pJob->SizeShift << CCR_PSIZE) |
+				(1U << CCR_MINC) | ((uint32_t)Local_pJob->SourceIncrement << CCR_PINC);
+
+	/* Asynchronous jobs are chained from transfer complete and transfer error interrupts */
+	if(Local_pJob->NotificationFunc != NULL)
+	{
+		Local_CCR |= (1U << CCR_TCIE) | (1U << CCR_TEIE);
 	}
 
-	/******************************************************************************************************/
+	/* Make sure that selected DMA channel is disabled through clearing EN bit in CCRx register */
+	CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_EN);
 
-	/* Clear DMA Global Interrupt flag */
-	DMA_ClearInterruptFlag(DMA_CH6, DMA_GLOBAL_INTERRUPT_FLAG);
+	/* Set chunk addresses and number of data items */
+	DMA->Channel[Copy_ChannelId].CPAR = Local_pJob->SourceAddress;
+	DMA->Channel[Copy_ChannelId].CMAR = Local_pJob->DestinationAddress;
+	DMA->Channel[Copy_ChannelId].CNDTR = Local_pJob->ChunkItems;
+
+	/* Write channel configuration with EN bit set in one store to start the chunk */
+	DMA->Channel[Copy_ChannelId].CCR = Local_CCR | (1U << CCR_EN);
 }
 
 /*--------------------------------------------------------------------------------*/
-/*                                                                                */
-/* @Description	: DMA1 channel7 interrupt                                         */
-/*				                                                                  */
+/* @Function Name: MemoryJobService          					                  */
 /*--------------------------------------------------------------------------------*/
-void DMA1_Channel7_IRQHandler(void)
+/* @Param(in)	 : uint8_t Copy_ChannelId                                         */
+/* 			       Brief: DMA channel id owned by an asynchronous job             */
+/* 			       Range: (DMA_CH1 --> DMA_CH7)                                   */
+/* 			       -------------------------------------------------------------- */
+/* 				   uint32_t Copy_ChannelFlags			                          */
+/* 			       Brief: Latched interrupt flags nibble of the channel           */
+/* 			       Range: (0x0 --> 0xF)                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                          				  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Chains next chunk of an asynchronous job from the channel IRQ  */
+/*                 or releases the channel and notifies the caller                */
+/*--------------------------------------------------------------------------------*/
+static void DMA_MemoryJobService(uint8_t Copy_ChannelId , uint32_t Copy_ChannelFlags)
 {
-	/* Local variables definitions */
-	uint8_t Local_InterruptSource = 0;
-
-	/**************************************Check source of interrupt**************************************/
-
-	/* Check if interrupt source is DMA Transfer Complete */
-    DMA_GetInterruptFlagStatus(DMA_CH7, DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG, &Local_InterruptSource);
+	/* Local Variables Definitions */
+	DMA_MemoryJob_t* Local_pJob = &DMA_MemoryJob[Copy_ChannelId];
+	void(*Local_NotificationFunc)(ERROR_STATUS_t Copy_JobStatus) = Local_pJob->NotificationFunc;
 
-	if(Local_InterruptSource == 1)
+	/* Check if chunk failed (hardware already disabled the channel) */
+	if(GET_BIT(Copy_ChannelFlags,DMA_TRANSFER_ERROR_INTERRUPT_FLAG) == 1)
 	{
-		/* Check if DMA Transfer Complete callback function is registered or not */
-		if(DMA_TransferCompleteNotificationFunc[6] != NULL)
+		/* Release channel then notify caller of the failure */
+		CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_EN);
+		Local_pJob->Busy = 0;
+		Local_NotificationFunc(RT_NOK);
+	}
+	/* Check if chunk completed */
+	else if(GET_BIT(Copy_ChannelFlags,DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG) == 1)
+	{
+		/* Chain next chunk if any */
+		if(Local_pJob->RemainingItems > 0)
 		{
-			/* Invoke DMA Transfer Complete Callback Function */
-			DMA_TransferCompleteNotificationFunc[6]();
+			DMA_MemoryJobLoadChunk(Copy_ChannelId);
+		}
+		else
+		{
+			/* Release channel before notifying so the callback can submit a new job */
+			CLEAR_BIT(DMA->Channel[Copy_ChannelId].CCR,CCR_EN);
+			Local_pJob->ChunkItems = 0;
+			Local_pJob->Busy = 0;
+			Local_NotificationFunc(RT_OK);
 		}
-
-		/* Clear DMA Transfer Complete flag */
-		DMA_ClearInterruptFlag(DMA_CH7, DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG);
-
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
 	}
+	else
+	{
+		/* Do nothing */
+	}
+}
 
-	/******************************************************************************************************/
-
-	/* Check if interrupt source is DMA Half Transfer */
-	DMA_GetInterruptFlagStatus(DMA_CH7, DMA_HALF_TRANSFER_INTERRUPT_FLAG, &Local_InterruptSource);
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: CpuCopy          					                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t* Copy_pDestination , const uint8_t* Copy_pSource       */
+/* 			       Brief: Destination and source (source is a word-aligned        */
+/*                        replicated pattern when it does not increment)          */
+/* 			       Range: None                                                    */
+/* 			       -------------------------------------------------------------- */
+/* 				   uint32_t Copy_Size , uint8_t Copy_SourceIncrement              */
+/* 			       Brief: Size in bytes and whether source increments             */
+/* 			       Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                	          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                            	              */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                          				  */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : CPU fallback of the memory engine. Copies words whenever        */
+/*                 destination and source alignment allow it, bytes otherwise     */
+/*--------------------------------------------------------------------------------*/
+static void DMA_CpuCopy(uint8_t* Copy_pDestination , const uint8_t* Copy_pSource , uint32_t Copy_Size , uint8_t Copy_SourceIncrement)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_SourceStep = (Copy_SourceIncrement == DMA_PERIPHERAL_INCREMENT_MODE_ENABLE) ? 1U : 0U;
 
-	if(Local_InterruptSource == 1)
+	/* Word copy is possible only if both ends can reach word alignment together */
+	if(Local_SourceStep == 0 || (((uint32_t)Copy_pDestination ^ (uint32_t)Copy_pSource) & DMA_WORD_ALIGNMENT_MASK) == 0)
 	{
-		/* Check if DMA Half Transfer callback function is registered or not */
-		if(DMA_HalfTransferNotificationFunc[6] != NULL)
+		/* Copy bytes up to word alignment */
+		while(Copy_Size > 0 && ((uint32_t)Copy_pDestination & DMA_WORD_ALIGNMENT_MASK) != 0)
 		{
-			/* Invoke DMA Half Transfer Callback Function */
-			DMA_HalfTransferNotificationFunc[6]();
+			*Copy_pDestination++ = *Copy_pSource;
+			Copy_pSource += Local_SourceStep;
+			Copy_Size--;
 		}
 
-		/* Clear DMA Half Transfer flag */
-		DMA_ClearInterruptFlag(DMA_CH7, DMA_HALF_TRANSFER_INTERRUPT_FLAG);
+		/* Copy whole words */
+		while(Copy_Size >= sizeof(uint32_t))
+		{
+			*(uint32_t*)Copy_pDestination = *(const uint32_t*)Copy_pSource;
+			Copy_pDestination += sizeof(uint32_t);
+			Copy_pSource += Local_SourceStep * sizeof(uint32_t);
+			Copy_Size -= sizeof(uint32_t);
+		}
+	}
 
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
+	/* Copy remaining bytes */
+	while(Copy_Size > 0)
+	{
+		*Copy_pDestination++ = *Copy_pSource;
+		Copy_pSource += Local_SourceStep;
+		Copy_Size--;
 	}
+}
 
-	/******************************************************************************************************/
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            	  INTERRUPT HANDLERS		                    	 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
 
-	/* Check if interrupt source is DMA Transfer Error */
-	DMA_GetInterruptFlagStatus(DMA_CH7, DMA_TRANSFER_ERROR_INTERRUPT_FLAG, &Local_InterruptSource);
+/*--------------------------------------------------------------------------------*/
+/*                                                                                */
+/* @Description	: DMA1 channel1 interrupt                                         */
+/*				                                                                  */
+/*--------------------------------------------------------------------------------*/
+void DMA1_Channel1_IRQHandler(void)
+{
+	/* Dispatch channel1 raised interrupts to their registered callbacks */
+	DMA_IRQDispatch(DMA_CH1);
+}
 
-	if(Local_InterruptSource == 1)
-	{
-		/* Check if DMA Transfer Error callback function is registered or not */
-		if(DMA_TransferErrorNotificationFunc[6] != NULL)
-		{
-			/* Invoke DMA Transfer Error Callback Function */
-			DMA_TransferErrorNotificationFunc[6]();
-		}
+/*--------------------------------------------------------------------------------*/
+/*                                                                                */
+/* @Description	: DMA1 channel2 interrupt                                         */
+/*				                                                                  */
+/*--------------------------------------------------------------------------------*/
+void DMA1_Channel2_IRQHandler(void)
+{
+	/* Dispatch channel2 raised interrupts to their registered callbacks */
+	DMA_IRQDispatch(DMA_CH2);
+}
 
-		/* Clear DMA Transfer Error flag */
-		DMA_ClearInterruptFlag(DMA_CH7, DMA_TRANSFER_ERROR_INTERRUPT_FLAG);
+/*--------------------------------------------------------------------------------*/
+/*                                                                                */
+/* @Description	: DMA1 channel3 interrupt                                         */
+/*				                                                                  */
+/*--------------------------------------------------------------------------------*/
+void DMA1_Channel3_IRQHandler(void)
+{
+	/* Dispatch channel3 raised interrupts to their registered callbacks */
+	DMA_IRQDispatch(DMA_CH3);
+}
 
-		/* Clear Local_InterruptSource */
-		Local_InterruptSource = 0;
-	}
+/*--------------------------------------------------------------------------------*/
+/*                                                                                */
+/* @Description	: DMA1 channel4 interrupt                                         */
+/*				                                                                  */
+/*--------------------------------------------------------------------------------*/
+void DMA1_Channel4_IRQHandler(void)
+{
+	/* Dispatch channel4 raised interrupts to their registered callbacks */
+	DMA_IRQDispatch(DMA_CH4);
+}
 
-	/******************************************************************************************************/
+/*--------------------------------------------------------------------------------*/
+/*                                                                                */
+/* @Description	: DMA1 channel5 interrupt                                         */
+/*				                                                                  */
+/*--------------------------------------------------------------------------------*/
+void DMA1_Channel5_IRQHandler(void)
+{
+	/* Dispatch channel5 raised interrupts to their registered callbacks */
+	DMA_IRQDispatch(DMA_CH5);
+}
 
-	/* Clear DMA Global Interrupt flag */
-	DMA_ClearInterruptFlag(DMA_CH7, DMA_GLOBAL_INTERRUPT_FLAG);
+/*--------------------------------------------------------------------------------*/
+/*                                                                                */
+/* @Description	: DMA1 channel6 interrupt                                         */
+/*				                                                                  */
+/*--------------------------------------------------------------------------------*/
+void DMA1_Channel6_IRQHandler(void)
+{
+	/* Dispatch channel6 raised interrupts to their registered callbacks */
+	DMA_IRQDispatch(DMA_CH6);
 }
 
+/*--------------------------------------------------------------------------------*/
+/*                                                                                */
+/* @Description	: DMA1 channel7 interrupt                                         */
+/*				                                                                  */
+/*--------------------------------------------------------------------------------*/
+void DMA1_Channel7_IRQHandler(void)
+{
+	/* Dispatch channel7 raised interrupts to their registered callbacks */
+	DMA_IRQDispatch(DMA_CH7);
+}
@@ -0,0 +1,581 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : Format Functions Program     */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*                                                                                                                           */
+/*  ______   ____   _____   __  __            _______   ______  _    _  _   _   _____  _______  _____   ____   _   _   _____ */
+/* |  ____| / __ \ |  __ \ |  \/  |    /\    |__   __| |  ____|| |  | || \ | | / ____||__   __||_   _| / __ \ | \ | | / ____| */
+/* | |__   | |  | || |__) || \  / |   /  \      | |    | |__   | |  | ||  \| || |        | |     | |  | |  | ||  \| || (___  */
+/* |  __|  | |  | ||  _  / | |\/| |  / /\ \     | |    |  __|  | |  | || . ` || |        | |     | |  | |  | || . ` | \___ \ */
+/* | |     | |__| || | \ \ | |  | | / ____ \    | |    | |     | |__| || |\  || |____    | |    _| |_ | |__| || |\  | ____) | */
+/* |_|      \____/ |_|  \_\|_|  |_|/_/    \_\   |_|    |_|      \____/ |_| \_| \_____|   |_|   |_____| \____/ |_| \_||_____/ */
+/*                                                                                                                           */
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "FORMAT_FUNCTIONS.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#define FMT_MAX_DECIMAL_DIGITS		10U								/* Number of decimal digits in largest uint32_t */
+#define FMT_DIGIT_PAIRS_SIZE		200U							/* Two characters for every number 00 --> 99 */
+#define FMT_RECIPROCAL_100			1374389535ULL					/* ceil(2^37 / 100), exact quotient for any uint32_t */
+#define FMT_RECIPROCAL_100_SHIFT	37U								/* Shift that scales back reciprocal of 100 */
+#define FMT_DIVIDE_BY_100(Value)	((uint32_t)(((uint64_t)(Value) * FMT_RECIPROCAL_100) >> FMT_RECIPROCAL_100_SHIFT))
+#define FMT_NIBBLE_MASK				0x0FU							/* Mask of one hex digit */
+#define FMT_NIBBLE_BITS				4U								/* Number of bits in one hex digit */
+#define FMT_LOWER_CASE_OFFSET		16U								/* Offset of lower case letters in hex digits table */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            PRIVATE FUNCTIONS PROTOTYPES                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static uint8_t FMT_WriteDigits(uint32_t Copy_Value , uint8_t Copy_MinDigits , uint8_t* Copy_pBuffer);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* Decimal characters of every number 00 --> 99, so two digits are produced per reciprocal multiplication */
+static const uint8_t Global_DigitPairs[FMT_DIGIT_PAIRS_SIZE] =
+	"00010203040506070809101112131415161718192021222324"
+	"25262728293031323334353637383940414243444546474849"
+	"50515253545556575859606162636465666768697071727374"
+	"75767778798081828384858687888990919293949596979899";
+
+/* Hex digits in upper case followed by lower case */
+static const uint8_t Global_HexDigits[] = "0123456789ABCDEF0123456789abcdef";
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Unsigned                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_Value                                         */
+/*					  Brief: Number to be formatted                               */
+/*					  Range: Any uint32_t value                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: uint8_t* Copy_pBuffer                                       */
+/*					  Brief: Buffer to hold formatted characters followed by null */
+/*					         terminator                                           */
+/*					  Range: Any pointer to array of at least                     */
+/*					         FMT_DECIMAL_BUFFER_SIZE bytes                        */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t* Copy_pLength                                       */
+/*					  Brief: Number of formatted characters (null terminator      */
+/*					         excluded)                                            */
+/*					  Range: Any pointer to uint8_t or NULL if not needed         */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Converts unsigned number to its decimal characters without  */
+/*					  any division instruction, two digits per step using digit   */
+/*					  pairs table and reciprocal multiplication by 100            */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FMT_Unsigned(uint32_t Copy_Value , uint8_t* Copy_pBuffer , uint8_t* Copy_pLength)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t Local_Length;			/* Number of formatted characters */
+
+	/* Check pointer */
+	if(Copy_pBuffer != NULL)
+	{
+		/* Convert number to digits */
+		Local_Length = FMT_WriteDigits(Copy_Value , 1 , Copy_pBuffer);
+
+		/* Terminate string */
+		Copy_pBuffer[Local_Length] = '\0';
+
+		/* Return length if needed */
+		if(Copy_pLength != NULL)
+		{
+			*Copy_pLength = Local_Length;
+		}
+	}
+	else
+	{
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Signed                                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: sint32_t Copy_Value                                         */
+/*					  Brief: Number to be formatted                               */
+/*					  Range: Any sint32_t value                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: uint8_t* Copy_pBuffer                                       */
+/*					  Brief: Buffer to hold formatted characters followed by null */
+/*					         terminator                                           */
+/*					  Range: Any pointer to array of at least                     */
+/*					         FMT_DECIMAL_BUFFER_SIZE bytes                        */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t* Copy_pLength                                       */
+/*					  Brief: Number of formatted characters (null terminator      */
+/*					         excluded)                                            */
+/*					  Range: Any pointer to uint8_t or NULL if not needed         */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Converts signed number to its decimal characters preceded   */
+/*					  by '-' if negative. Magnitude is taken in unsigned          */
+/*					  arithmetic so that INT32_MIN is formatted correctly         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FMT_Signed(sint32_t Copy_Value , uint8_t* Copy_pBuffer , uint8_t* Copy_pLength)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_Magnitude;		/* Absolute value of number */
+	uint8_t Local_Length = 0;		/* Number of formatted characters */
+
+	/* Check pointer */
+	if(Copy_pBuffer != NULL)
+	{
+		/* Check sign of number */
+		if(Copy_Value < 0)
+		{
+			/* Put sign and negate in unsigned arithmetic (INT32_MIN has no positive sint32_t) */
+			Copy_pBuffer[Local_Length++] = '-';
+			Local_Magnitude = 0UL - (uint32_t)Copy_Value;
+		}
+		else
+		{
+			Local_Magnitude = (uint32_t)Copy_Value;
+		}
+
+		/* Convert magnitude to digits */
+		Local_Length += FMT_WriteDigits(Local_Magnitude , 1 , &Copy_pBuffer[Local_Length]);
+
+		/* Terminate string */
+		Copy_pBuffer[Local_Length] = '\0';
+
+		/* Return length if needed */
+		if(Copy_pLength != NULL)
+		{
+			*Copy_pLength = Local_Length;
+		}
+	}
+	else
+	{
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Hex                                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_Value                                         */
+/*					  Brief: Number to be formatted                               */
+/*					  Range: Any uint32_t value                                   */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_MinDigits                                      */
+/*					  Brief: Minimum number of digits, padded by leading zeros    */
+/*					  Range: 1 --> FMT_MAX_HEX_DIGITS                             */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_LetterCase                                     */
+/*					  Brief: Case of hex digits A --> F                           */
+/*					  Range: FMT_HEX_UPPER_CASE - FMT_HEX_LOWER_CASE              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: uint8_t* Copy_pBuffer                                       */
+/*					  Brief: Buffer to hold formatted characters followed by null */
+/*					         terminator                                           */
+/*					  Range: Any pointer to array of at least FMT_HEX_BUFFER_SIZE */
+/*					         bytes                                                */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t* Copy_pLength                                       */
+/*					  Brief: Number of formatted characters (null terminator      */
+/*					         excluded)                                            */
+/*					  Range: Any pointer to uint8_t or NULL if not needed         */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Converts number to its hexadecimal characters (without 0x   */
+/*					  prefix) using shifts and masks only                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FMT_Hex(uint32_t Copy_Value ,
+				uint8_t Copy_MinDigits ,
+				uint8_t Copy_LetterCase ,
+				uint8_t* Copy_pBuffer ,
+				uint8_t* Copy_pLength)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t Local_Length = FMT_MAX_HEX_DIGITS;	/* Number of formatted characters */
+	uint8_t Local_Offset;						/* Offset of requested case in hex digits table */
+	uint8_t Local_Index;						/* Loop index */
+
+	/* Check pointer */
+	if(Copy_pBuffer != NULL)
+	{
+		/* Check range */
+		if((Copy_MinDigits >= 1) && (Copy_MinDigits <= FMT_MAX_HEX_DIGITS) && (Copy_LetterCase <= FMT_HEX_LOWER_CASE))
+		{
+			/* Drop leading zero nibbles beyond minimum number of digits */
+			while((Local_Length > Copy_MinDigits) && (((Copy_Value >> ((Local_Length - 1) * FMT_NIBBLE_BITS)) & FMT_NIBBLE_MASK) == 0))
+			{
+				Local_Length--;
+			}
+
+			/* Select letter case */
+			Local_Offset = (Copy_LetterCase == FMT_HEX_LOWER_CASE) ? FMT_LOWER_CASE_OFFSET : 0;
+
+			/* Write digits starting from least significant nibble */
+			for(Local_Index = Local_Length ; Local_Index > 0 ; Local_Index--)
+			{
+				Copy_pBuffer[Local_Index - 1] = Global_HexDigits[Local_Offset + (Copy_Value & FMT_NIBBLE_MASK)];
+				Copy_Value >>= FMT_NIBBLE_BITS;
+			}
+
+			/* Terminate string */
+			Copy_pBuffer[Local_Length] = '\0';
+
+			/* Return length if needed */
+			if(Copy_pLength != NULL)
+			{
+				*Copy_pLength = Local_Length;
+			}
+		}
+		else
+		{
+			Local_Status = OUT_OF_RANGE;
+		}
+	}
+	else
+	{
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: FixedPoint                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: sint32_t Copy_Value                                         */
+/*					  Brief: Number scaled by 10 ^ Copy_FractionDigits (e.g. 2505 */
+/*					         with 2 digits is 25.05)                              */
+/*					  Range: Any sint32_t value                                   */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_FractionDigits                                 */
+/*					  Brief: Number of digits after decimal point                 */
+/*					  Range: 0 --> FMT_MAX_FRACTION_DIGITS                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: uint8_t* Copy_pBuffer                                       */
+/*					  Brief: Buffer to hold formatted characters followed by null */
+/*					         terminator                                           */
+/*					  Range: Any pointer to array of at least                     */
+/*					         FMT_FIXED_POINT_BUFFER_SIZE bytes                    */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t* Copy_pLength                                       */
+/*					  Brief: Number of formatted characters (null terminator      */
+/*					         excluded)                                            */
+/*					  Range: Any pointer to uint8_t or NULL if not needed         */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Formats fixed-point number as decimal with point, keeping   */
+/*					  leading zero of integer part and trailing zeros of fraction */
+/*					  (e.g. -5 with 2 digits is -0.05) so that no floating point  */
+/*					  is needed                                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FMT_FixedPoint(sint32_t Copy_Value ,
+				uint8_t Copy_FractionDigits ,
+				uint8_t* Copy_pBuffer ,
+				uint8_t* Copy_pLength)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t Local_Digits[FMT_MAX_DECIMAL_DIGITS];	/* Digits of magnitude */
+	uint8_t Local_DigitsCount;						/* Number of digits of magnitude */
+	uint8_t Local_IntegerDigits;					/* Number of digits before decimal point */
+	uint32_t Local_Magnitude;						/* Absolute value of number */
+	uint8_t Local_Length = 0;						/* Number of formatted characters */
+	uint8_t Local_Index;							/* Loop index */
+
+	/* Check pointer */
+	if(Copy_pBuffer != NULL)
+	{
+		/* Check range */
+		if(Copy_FractionDigits <= FMT_MAX_FRACTION_DIGITS)
+		{
+			/* Check sign of number */
+			if(Copy_Value < 0)
+			{
+				/* Put sign and negate in unsigned arithmetic (INT32_MIN has no positive sint32_t) */
+				Copy_pBuffer[Local_Length++] = '-';
+				Local_Magnitude = 0UL - (uint32_t)Copy_Value;
+			}
+			else
+			{
+				Local_Magnitude = (uint32_t)Copy_Value;
+			}
+
+			/* Convert magnitude with at least one integer digit before fraction digits */
+			Local_DigitsCount = FMT_WriteDigits(Local_Magnitude , Copy_FractionDigits + 1 , Local_Digits);
+			Local_IntegerDigits = Local_DigitsCount - Copy_FractionDigits;
+
+			/* Copy integer part, decimal point then fraction part */
+			for(Local_Index = 0 ; Local_Index < Local_DigitsCount ; Local_Index++)
+			{
+				if(Local_Index == Local_IntegerDigits)
+				{
+					Copy_pBuffer[Local_Length++] = '.';
+				}
+				Copy_pBuffer[Local_Length++] = Local_Digits[Local_Index];
+			}
+
+			/* Terminate string */
+			Copy_pBuffer[Local_Length] = '\0';
+
+			/* Return length if needed */
+			if(Copy_pLength != NULL)
+			{
+				*Copy_pLength = Local_Length;
+			}
+		}
+		else
+		{
+			Local_Status = OUT_OF_RANGE;
+		}
+	}
+	else
+	{
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Field                                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: const uint8_t* Copy_pText                                   */
+/*					  Brief: Null terminated text to be placed in field           */
+/*					  Range: Any pointer to string (may be same as Copy_pBuffer)  */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_Width                                          */
+/*					  Brief: Width of field in characters                         */
+/*					  Range: 0 --> 255 (text longer than width is not truncated)  */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_Alignment                                      */
+/*					  Brief: Alignment of text inside field                       */
+/*					  Range: FMT_ALIGN_LEFT - FMT_ALIGN_RIGHT - FMT_ALIGN_CENTER  */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_PadCharacter                                   */
+/*					  Brief: Character used to fill rest of field                 */
+/*					  Range: Any character ('0' keeps leading '-' first)          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: uint8_t* Copy_pBuffer                                       */
+/*					  Brief: Buffer to hold field followed by null terminator     */
+/*					  Range: Any pointer to array of at least (Copy_Width + 1)    */
+/*					         bytes or text length + 1                             */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t* Copy_pLength                                       */
+/*					  Brief: Number of formatted characters (null terminator      */
+/*					         excluded)                                            */
+/*					  Range: Any pointer to uint8_t or NULL if not needed         */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Pads text to a fixed width field with requested alignment.  */
+/*					  Zero padding of right aligned negative numbers keeps the    */
+/*					  sign first (e.g. -0042). Text may be formatted in place     */
+/*					  inside the output buffer                                    */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FMT_Field(const uint8_t* Copy_pText ,
+				uint8_t Copy_Width ,
+				uint8_t Copy_Alignment ,
+				uint8_t Copy_PadCharacter ,
+				uint8_t* Copy_pBuffer ,
+				uint8_t* Copy_pLength)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t Local_TextLength = 0;		/* Number of text characters */
+	uint8_t Local_PadBefore = 0;		/* Number of pad characters before text */
+	uint8_t Local_PadAfter = 0;			/* Number of pad characters after text */
+	uint8_t Local_SignFirst = 0;		/* 1 if sign is kept before zero padding */
+	uint8_t Local_Index;				/* Loop index */
+
+	/* Check pointers */
+	if((Copy_pText != NULL) && (Copy_pBuffer != NULL))
+	{
+		/* Check range */
+		if(Copy_Alignment <= FMT_ALIGN_CENTER)
+		{
+			/* Get text length */
+			while((Copy_pText[Local_TextLength] != '\0') && (Local_TextLength < 255))
+			{
+				Local_TextLength++;
+			}
+
+			/* Split padding according to alignment (text longer than field is not truncated) */
+			if(Copy_Width > Local_TextLength)
+			{
+				switch(Copy_Alignment)
+				{
+					case FMT_ALIGN_LEFT :
+						Local_PadAfter = Copy_Width - Local_TextLength;
+						break;
+					case FMT_ALIGN_RIGHT :
+						Local_PadBefore = Copy_Width - Local_TextLength;
+						break;
+					default :
+						Local_PadBefore = (Copy_Width - Local_TextLength) / 2;
+						Local_PadAfter = (Copy_Width - Local_TextLength) - Local_PadBefore;
+						break;
+				}
+			}
+
+			/* Keep sign before zero padding (e.g. -0042 not 00-42) */
+			if((Copy_PadCharacter == '0') && (Local_PadBefore != 0) && (Copy_pText[0] == '-'))
+			{
+				Local_SignFirst = 1;
+			}
+
+			/* Move text starting from its end so that text may already be inside buffer */
+			for(Local_Index = Local_TextLength ; Local_Index > Local_SignFirst ; Local_Index--)
+			{
+				Copy_pBuffer[Local_PadBefore + Local_Index - 1] = Copy_pText[Local_Index - 1];
+			}
+
+			/* Put sign then padding before text */
+			if(Local_SignFirst == 1)
+			{
+				Copy_pBuffer[0] = '-';
+			}
+			for(Local_Index = 0 ; Local_Index < Local_PadBefore ; Local_Index++)
+			{
+				Copy_pBuffer[Local_SignFirst + Local_Index] = Copy_PadCharacter;
+			}
+
+			/* Put padding after text */
+			for(Local_Index = 0 ; Local_Index < Local_PadAfter ; Local_Index++)
+			{
+				Copy_pBuffer[Local_PadBefore + Local_TextLength + Local_Index] = Copy_PadCharacter;
+			}
+
+			/* Terminate string */
+			Copy_pBuffer[Local_PadBefore + Local_TextLength + Local_PadAfter] = '\0';
+
+			/* Return length if needed */
+			if(Copy_pLength != NULL)
+			{
+				*Copy_pLength = Local_PadBefore + Local_TextLength + Local_PadAfter;
+			}
+		}
+		else
+		{
+			Local_Status = OUT_OF_RANGE;
+		}
+	}
+	else
+	{
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: WriteDigits                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_Value                                         */
+/*					  Brief: Number to be converted                               */
+/*					  Range: Any uint32_t value                                   */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_MinDigits                                      */
+/*					  Brief: Minimum number of digits, padded by leading zeros    */
+/*					  Range: 1 --> FMT_MAX_DECIMAL_DIGITS                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: uint8_t* Copy_pBuffer                                       */
+/*					  Brief: Buffer to hold digits (not null terminated)          */
+/*					  Range: Any pointer to array of at least                     */
+/*					         FMT_MAX_DECIMAL_DIGITS bytes                         */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : uint8_t (Number of written digits)                          */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Writes decimal digits of number most significant first, two */
+/*					  digits per step from digit pairs table                      */
+/*--------------------------------------------------------------------------------*/
+static uint8_t FMT_WriteDigits(uint32_t Copy_Value , uint8_t Copy_MinDigits , uint8_t* Copy_pBuffer)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_Digits[FMT_MAX_DECIMAL_DIGITS];		/* Digits filled from least significant side */
+	uint8_t Local_Index = FMT_MAX_DECIMAL_DIGITS;		/* Index of most significant written digit */
+	uint8_t Local_Count;								/* Number of written digits */
+	uint32_t Local_Quotient;							/* Value divided by 100 */
+	uint32_t Local_Pair;								/* Two least significant digits of value */
+
+	/* Produce two digits per step using reciprocal multiplication instead of division */
+	while(Copy_Value >= 100UL)
+	{
+		Local_Quotient = FMT_DIVIDE_BY_100(Copy_Value);
+		Local_Pair = (Copy_Value - (Local_Quotient * 100UL)) * 2UL;
+		Local_Digits[--Local_Index] = Global_DigitPairs[Local_Pair + 1];
+		Local_Digits[--Local_Index] = Global_DigitPairs[Local_Pair];
+		Copy_Value = Local_Quotient;
+	}
+
+	/* Produce last one or two digits */
+	if(Copy_Value >= 10UL)
+	{
+		Local_Digits[--Local_Index] = Global_DigitPairs[(Copy_Value * 2UL) + 1];
+		Local_Digits[--Local_Index] = Global_DigitPairs[Copy_Value * 2UL];
+	}
+	else
+	{
+		Local_Digits[--Local_Index] = '0' + (uint8_t)Copy_Value;
+	}
+
+	/* Pad with leading zeros up to minimum number of digits */
+	while((FMT_MAX_DECIMAL_DIGITS - Local_Index) < Copy_MinDigits)
+	{
+		Local_Digits[--Local_Index] = '0';
+	}
+
+	/* Copy digits to buffer most significant first */
+	for(Local_Count = 0 ; Local_Index < FMT_MAX_DECIMAL_DIGITS ; Local_Count++)
+	{
+		Copy_pBuffer[Local_Count] = Local_Digits[Local_Index++];
+	}
+
+	return Local_Count;
+}
@@ -0,0 +1,229 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : Format Functions Interface   */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*                                                                                                                           */
+/*  ______   ____   _____   __  __            _______   ______  _    _  _   _   _____  _______  _____   ____   _   _   _____ */
+/* |  ____| / __ \ |  __ \ |  \/  |    /\    |__   __| |  ____|| |  | || \ | | / ____||__   __||_   _| / __ \ | \ | | / ____| */
+/* | |__   | |  | || |__) || \  / |   /  \      | |    | |__   | |  | ||  \| || |        | |     | |  | |  | ||  \| || (___  */
+/* |  __|  | |  | ||  _  / | |\/| |  / /\ \     | |    |  __|  | |  | || . ` || |        | |     | |  | |  | || . ` | \___ \ */
+/* | |     | |__| || | \ \ | |  | | / ____ \    | |    | |     | |__| || |\  || |____    | |    _| |_ | |__| || |\  | ____) | */
+/* |_|      \____/ |_|  \_\|_|  |_|/_/    \_\   |_|    |_|      \____/ |_| \_| \_____|   |_|   |_____| \____/ |_| \_||_____/ */
+/*                                                                                                                           */
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef LIB_FORMAT_FUNCTIONS_H
+#define LIB_FORMAT_FUNCTIONS_H
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  INTERFACE MACROS                                 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Buffer Sizes Needed by Formatting Functions (Null Terminator Included) */
+#define FMT_DECIMAL_BUFFER_SIZE			12U		/* Sign, 10 digits and null terminator */
+#define FMT_HEX_BUFFER_SIZE				9U		/* 8 digits and null terminator */
+#define FMT_FIXED_POINT_BUFFER_SIZE		13U		/* Sign, 10 digits, decimal point and null terminator */
+
+/* Formatting Limits */
+#define FMT_MAX_HEX_DIGITS				8U		/* Number of nibbles in uint32_t */
+#define FMT_MAX_FRACTION_DIGITS			9U		/* Largest power of 10 that fits in sint32_t */
+
+/* Hex Letter Cases */
+#define FMT_HEX_UPPER_CASE				0U
+#define FMT_HEX_LOWER_CASE				1U
+
+/* Field Alignments */
+#define FMT_ALIGN_LEFT					0U
+#define FMT_ALIGN_RIGHT					1U
+#define FMT_ALIGN_CENTER				2U
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                FUNCTIONS PROTOTYPES                               */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Unsigned                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_Value                                         */
+/*					  Brief: Number to be formatted                               */
+/*					  Range: Any uint32_t value                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: uint8_t* Copy_pBuffer                                       */
+/*					  Brief: Buffer to hold formatted characters followed by null */
+/*					         terminator                                           */
+/*					  Range: Any pointer to array of at least                     */
+/*					         FMT_DECIMAL_BUFFER_SIZE bytes                        */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t* Copy_pLength                                       */
+/*					  Brief: Number of formatted characters (null terminator      */
+/*					         excluded)                                            */
+/*					  Range: Any pointer to uint8_t or NULL if not needed         */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Converts unsigned number to its decimal characters without  */
+/*					  any division instruction, two digits per step using digit   */
+/*					  pairs table and reciprocal multiplication by 100            */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FMT_Unsigned(uint32_t Copy_Value , uint8_t* Copy_pBuffer , uint8_t* Copy_pLength);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Signed                                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: sint32_t Copy_Value                                         */
+/*					  Brief: Number to be formatted                               */
+/*					  Range: Any sint32_t value                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: uint8_t* Copy_pBuffer                                       */
+/*					  Brief: Buffer to hold formatted characters followed by null */
+/*					         terminator                                           */
+/*					  Range: Any pointer to array of at least                     */
+/*					         FMT_DECIMAL_BUFFER_SIZE bytes                        */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t* Copy_pLength                                       */
+/*					  Brief: Number of formatted characters (null terminator      */
+/*					         excluded)                                            */
+/*					  Range: Any pointer to uint8_t or NULL if not needed         */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Converts signed number to its decimal characters preceded   */
+/*					  by '-' if negative. Magnitude is taken in unsigned          */
+/*					  arithmetic so that INT32_MIN is formatted correctly         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FMT_Signed(sint32_t Copy_Value , uint8_t* Copy_pBuffer , uint8_t* Copy_pLength);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Hex                                                         */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_Value                                         */
+/*					  Brief: Number to be formatted                               */
+/*					  Range: Any uint32_t value                                   */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_MinDigits                                      */
+/*					  Brief: Minimum number of digits, padded by leading zeros    */
+/*					  Range: 1 --> FMT_MAX_HEX_DIGITS                             */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_LetterCase                                     */
+/*					  Brief: Case of hex digits A --> F                           */
+/*					  Range: FMT_HEX_UPPER_CASE - FMT_HEX_LOWER_CASE              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: uint8_t* Copy_pBuffer                                       */
+/*					  Brief: Buffer to hold formatted characters followed by null */
+/*					         terminator                                           */
+/*					  Range: Any pointer to array of at least FMT_HEX_BUFFER_SIZE */
+/*					         bytes                                                */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t* Copy_pLength                                       */
+/*					  Brief: Number of formatted characters (null terminator      */
+/*					         excluded)                                            */
+/*					  Range: Any pointer to uint8_t or NULL if not needed         */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Converts number to its hexadecimal characters (without 0x   */
+/*					  prefix) using shifts and masks only                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FMT_Hex(uint32_t Copy_Value ,
+				uint8_t Copy_MinDigits ,
+				uint8_t Copy_LetterCase ,
+				uint8_t* Copy_pBuffer ,
+				uint8_t* Copy_pLength);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: FixedPoint                                                  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: sint32_t Copy_Value                                         */
+/*					  Brief: Number scaled by 10 ^ Copy_FractionDigits (e.g. 2505 */
+/*					         with 2 digits is 25.05)                              */
+/*					  Range: Any sint32_t value                                   */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_FractionDigits                                 */
+/*					  Brief: Number of digits after decimal point                 */
+/*					  Range: 0 --> FMT_MAX_FRACTION_DIGITS                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: uint8_t* Copy_pBuffer                                       */
+/*					  Brief: Buffer to hold formatted characters followed by null */
+/*					         terminator                                           */
+/*					  Range: Any pointer to array of at least                     */
+/*					         FMT_FIXED_POINT_BUFFER_SIZE bytes                    */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t* Copy_pLength                                       */
+/*					  Brief: Number of formatted characters (null terminator      */
+/*					         excluded)                                            */
+/*					  Range: Any pointer to uint8_t or NULL if not needed         */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Formats fixed-point number as decimal with point, keeping   */
+/*					  leading zero of integer part and trailing zeros of fraction */
+/*					  (e.g. -5 with 2 digits is -0.05) so that no floating point  */
+/*					  is needed                                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FMT_FixedPoint(sint32_t Copy_Value ,
+				uint8_t Copy_FractionDigits ,
+				uint8_t* Copy_pBuffer ,
+				uint8_t* Copy_pLength);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Field                                                       */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: const uint8_t* Copy_pText                                   */
+/*					  Brief: Null terminated text to be placed in field           */
+/*					  Range: Any pointer to string (may be same as Copy_pBuffer)  */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_Width                                          */
+/*					  Brief: Width of field in characters                         */
+/*					  Range: 0 --> 255 (text longer than width is not truncated)  */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_Alignment                                      */
+/*					  Brief: Alignment of text inside field                       */
+/*					  Range: FMT_ALIGN_LEFT - FMT_ALIGN_RIGHT - FMT_ALIGN_CENTER  */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_PadCharacter                                   */
+/*					  Brief: Character used to fill rest of field                 */
+/*					  Range: Any character ('0' keeps leading '-' first)          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: uint8_t* Copy_pBuffer                                       */
+/*					  Brief: Buffer to hold field followed by null terminator     */
+/*					  Range: Any pointer to array of at least (Copy_Width + 1)    */
+/*					         bytes or text length + 1                             */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t* Copy_pLength                                       */
+/*					  Brief: Number of formatted characters (null terminator      */
+/*					         excluded)                                            */
+/*					  Range: Any pointer to uint8_t or NULL if not needed         */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Pads text to a fixed width field with requested alignment.  */
+/*					  Zero padding of right aligned negative numbers keeps the    */
+/*					  sign first (e.g. -0042). Text may be formatted in place     */
+/*					  inside the output buffer                                    */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t FMT_Field(const uint8_t* Copy_pText ,
+				uint8_t Copy_Width ,
+				uint8_t Copy_Alignment ,
+				uint8_t Copy_PadCharacter ,
+				uint8_t* Copy_pBuffer ,
+				uint8_t* Copy_pLength);
+
+#endif /* LIB_FORMAT_FUNCTIONS_H */
@@ -0,0 +1,659 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : Hex Parser Program           */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*                                                                                                                           */
+/*  _    _  ______  __   __  _____             _____    _____  ______  _____                                                 */
+/* | |  | ||  ____| \ \ / / |  __ \     /\    |  __ \  / ____||  ____||  __ \                                                */
+/* | |__| || |__     \ V /  | |__) |   /  \   | |__) || (___  | |__   | |__) |                                               */
+/* |  __  ||  __|     > <   |  ___/   / /\ \  |  _  /  \___ \ |  __|  |  _  /                                                */
+/* | |  | || |____   / . \  | |      / ____ \ | | \ \  ____) || |____ | | \ \                                                */
+/* |_|  |_||______| /_/ \_\ |_|     /_/    \_\|_|  \_\|_____/ |______||_|  \_\                                               */
+/*                                                                                                                           */
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "HEX_PARSER.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#define HEX_STATE_IDLE				0U								/* Waiting for ':' of next record */
+#define HEX_STATE_HIGH_NIBBLE		1U								/* Waiting for high nibble of a byte */
+#define HEX_STATE_LOW_NIBBLE		2U								/* Waiting for low nibble of a byte */
+#define HEX_STATE_DONE				3U								/* End of file record is received */
+#define HEX_STATE_ERROR				4U								/* Malformed input is received */
+
+#define HEX_RECORD_MARK				':'								/* First character of every record */
+#define HEX_INVALID_NIBBLE			0xFFU							/* Nibbles table value of non hex characters */
+#define HEX_NIBBLE_BITS				4U								/* Number of bits in one hex digit */
+#define HEX_ERASED_BYTE				0xFFU							/* Padding of incomplete halfwords */
+#define HEX_NO_PARTIAL				0xFFFFFFFFUL					/* Free kept partial halfword (odd, never a halfword address) */
+
+#define HEX_RECORD_BYTE_COUNT		0U								/* Index of byte count in record */
+#define HEX_RECORD_ADDRESS_HIGH		1U								/* Index of address high byte in record */
+#define HEX_RECORD_ADDRESS_LOW		2U								/* Index of address low byte in record */
+#define HEX_RECORD_TYPE				3U								/* Index of record type in record */
+#define HEX_RECORD_DATA				4U								/* Index of first data byte in record */
+
+#define HEX_TYPE_DATA						0x00U
+#define HEX_TYPE_END_OF_FILE				0x01U
+#define HEX_TYPE_EXTENDED_SEGMENT_ADDRESS	0x02U
+#define HEX_TYPE_START_SEGMENT_ADDRESS		0x03U
+#define HEX_TYPE_EXTENDED_LINEAR_ADDRESS	0x04U
+#define HEX_TYPE_START_LINEAR_ADDRESS		0x05U
+
+#define HEX_ADDRESS_RECORD_LENGTH	2U								/* Data length of extended address records */
+#define HEX_START_RECORD_LENGTH		4U								/* Data length of start address records */
+#define HEX_SEGMENT_SHIFT			4U								/* Segment address is paragraph (16 bytes) number */
+#define HEX_LINEAR_SHIFT			16U								/* Linear address is upper 16 bits of address */
+
+#define HEX_IS_WHITESPACE(Char)		(((Char) == '\r') || ((Char) == '\n') || ((Char) == ' ') || ((Char) == '\t'))
+#define HEX_GET_UINT16(pBytes)		(((uint32_t)(pBytes)[0] << 8) | (uint32_t)(pBytes)[1])
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            PRIVATE FUNCTIONS PROTOTYPES                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static ERROR_STATUS_t HEX_ProcessRecord(HEX_Parser_t* Copy_pParser);
+static ERROR_STATUS_t HEX_FlushRun(HEX_Parser_t* Copy_pParser);
+static ERROR_STATUS_t HEX_TakePartialByte(HEX_Parser_t* Copy_pParser , uint32_t Copy_Address , uint8_t Copy_IsHigh , uint8_t* Copy_pByte);
+static void HEX_KeepPartialByte(HEX_Parser_t* Copy_pParser , uint32_t Copy_Address , uint8_t Copy_IsHigh , uint8_t Copy_Byte);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+/* Value of every character as a hex digit (HEX_INVALID_NIBBLE for non hex characters), one load per character */
+static const uint8_t Global_Nibbles[256] =
+{
+	0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U, 0x09U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0xFFU, 0x0AU, 0x0BU, 0x0CU, 0x0DU, 0x0EU, 0x0FU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0xFFU, 0x0AU, 0x0BU, 0x0CU, 0x0DU, 0x0EU, 0x0FU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+	0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+};
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Init                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: HEX_WriteFunc_t Copy_pWriteFunc                             */
+/*					  Brief: Function that receives decoded halfword runs,        */
+/*					         FPEC_BufferWrite can be passed directly              */
+/*					  Range: Any pointer to function                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: HEX_Parser_t* Copy_pParser                                  */
+/*					  Brief: Parser context (caller owned, no allocation)         */
+/*					  Range: Any pointer to HEX_Parser_t                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Resets parser context to wait for the first record with     */
+/*					  base address 0 and no entry address                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t HEX_Init(HEX_Parser_t* Copy_pParser , HEX_WriteFunc_t Copy_pWriteFunc)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t Local_Counter;			/* Number of freed partial halfwords */
+
+	/* Check pointers */
+	if((Copy_pParser != NULL) && (Copy_pWriteFunc != NULL))
+	{
+		/* Reset parser context */
+		Copy_pParser->WriteFunc = Copy_pWriteFunc;
+		Copy_pParser->BaseAddress = 0;
+		Copy_pParser->EntryAddress = HEX_NO_ENTRY_ADDRESS;
+		Copy_pParser->RunLength = 0;
+		Copy_pParser->State = HEX_STATE_IDLE;
+
+		/* No padded halfword is passed yet */
+		for(Local_Counter = 0 ; Local_Counter < HEX_PARTIAL_HALFWORDS ; Local_Counter++)
+		{
+			Copy_pParser->PartialAddress[Local_Counter] = HEX_NO_PARTIAL;
+		}
+		Copy_pParser->PartialNext = 0;
+	}
+	else
+	{
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Feed                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: const uint8_t* Copy_pData                                   */
+/*					  Brief: Characters of the hex file fragment                  */
+/*					  Range: None                                                 */
+/*					  ----------------------------------------------------------- */
+/*					  uint32_t Copy_Length                                        */
+/*					  Brief: Number of characters                                 */
+/*					  Range: Any uint32_t value                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: HEX_Parser_t* Copy_pParser                                  */
+/*					  Brief: Parser context (caller owned, no allocation)         */
+/*					  Range: Any pointer to HEX_Parser_t                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Parses a fragment of an Intel-HEX file of any size as it    */
+/*					  arrives (a record may be split over many fragments).        */
+/*					  Checksum of each record is checked, extended segment and    */
+/*					  linear address records move the base address and contiguous */
+/*					  data records are gathered into halfword aligned runs passed */
+/*					  to the write function. A run edge on an odd address is      */
+/*					  padded with 0xFF, a later record filling the padded byte    */
+/*					  writes the whole halfword again with the kept byte (last    */
+/*					  HEX_PARTIAL_HALFWORDS padded halfwords are kept). Returns   */
+/*					  RT_NOK on malformed input (parser stays failed until        */
+/*					  HEX_Init) or status of the write function if it fails       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t HEX_Feed(HEX_Parser_t* Copy_pParser , const uint8_t* Copy_pData , uint32_t Copy_Length)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_Counter = 0;		/* Number of parsed characters */
+	uint8_t Local_Char;				/* Current character */
+	uint8_t Local_Nibble;			/* Value of current character as a hex digit */
+	uint8_t Local_Byte;				/* Decoded byte */
+
+	/* Check pointers */
+	if((Copy_pParser != NULL) && (Copy_pData != NULL))
+	{
+		/* Check if parser failed before */
+		if(Copy_pParser->State == HEX_STATE_ERROR)
+		{
+			Local_Status = RT_NOK;
+		}
+
+		/* Parse characters one by one until fragment end or an error */
+		while((Local_Status == RT_OK) && (Local_Counter < Copy_Length))
+		{
+			/* Get character and its hex value */
+			Local_Char = Copy_pData[Local_Counter];
+			Local_Nibble = Global_Nibbles[Local_Char];
+			Local_Counter++;
+
+			switch(Copy_pParser->State)
+			{
+				case HEX_STATE_HIGH_NIBBLE:
+
+					/* Check hex digit then keep it as high nibble */
+					if(Local_Nibble != HEX_INVALID_NIBBLE)
+					{
+						Copy_pParser->HighNibble = (uint8_t)(Local_Nibble << HEX_NIBBLE_BITS);
+						Copy_pParser->State = HEX_STATE_LOW_NIBBLE;
+					}
+					else
+					{
+						Local_Status = RT_NOK;
+					}
+
+					break;
+
+				case HEX_STATE_LOW_NIBBLE:
+
+					/* Check hex digit */
+					if(Local_Nibble != HEX_INVALID_NIBBLE)
+					{
+						/* Store decoded byte and add it to checksum */
+						Local_Byte = (uint8_t)(Copy_pParser->HighNibble | Local_Nibble);
+						Copy_pParser->Record[Copy_pParser->RecordLength] = Local_Byte;
+						Copy_pParser->RecordLength++;
+						Copy_pParser->Checksum = (uint8_t)(Copy_pParser->Checksum + Local_Byte);
+
+						/* Byte count (first byte) gives size of the record */
+						if(Copy_pParser->RecordLength == 1U)
+						{
+							Copy_pParser->RecordSize = (uint16_t)(Local_Byte + HEX_RECORD_OVERHEAD);
+						}
+
+						/* Check if record is complete */
+						if(Copy_pParser->RecordLength == Copy_pParser->RecordSize)
+						{
+							/* Sum of all record bytes including checksum must be zero */
+							if(Copy_pParser->Checksum == 0)
+							{
+								Copy_pParser->State = HEX_STATE_IDLE;
+								Local_Status = HEX_ProcessRecord(Copy_pParser);
+							}
+							else
+							{
+								Local_Status = RT_NOK;
+							}
+						}
+						else
+						{
+							Copy_pParser->State = HEX_STATE_HIGH_NIBBLE;
+						}
+					}
+					else
+					{
+						Local_Status = RT_NOK;
+					}
+
+					break;
+
+				case HEX_STATE_IDLE:
+
+					/* Check if a new record starts */
+					if(Local_Char == HEX_RECORD_MARK)
+					{
+						Copy_pParser->RecordLength = 0;
+						Copy_pParser->RecordSize = HEX_RECORD_OVERHEAD;
+						Copy_pParser->Checksum = 0;
+						Copy_pParser->State = HEX_STATE_HIGH_NIBBLE;
+					}
+					else if(!HEX_IS_WHITESPACE(Local_Char))
+					{
+						Local_Status = RT_NOK;
+					}
+					else
+					{
+						/* Line ends between records are skipped */
+					}
+
+					break;
+
+				default:
+
+					/* Only line ends may follow end of file record */
+					if(!HEX_IS_WHITESPACE(Local_Char))
+					{
+						Local_Status = RT_NOK;
+					}
+			}
+		}
+
+		/* Check if parser fails (it stays failed until it is initialized again) */
+		if(Local_Status != RT_OK)
+		{
+			Copy_pParser->State = HEX_STATE_ERROR;
+		}
+	}
+	else
+	{
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Finish                                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: HEX_Parser_t* Copy_pParser                                  */
+/*					  Brief: Parser context (caller owned, no allocation)         */
+/*					  Range: Any pointer to HEX_Parser_t                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: uint32_t* Copy_pEntryAddress                                */
+/*					  Brief: Start address from start segment or start linear     */
+/*					         address record                                       */
+/*					  Range: Any pointer to uint32_t or NULL if not needed        */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Checks that end of file record is received. Entry address   */
+/*					  is HEX_NO_ENTRY_ADDRESS if the file holds no start address  */
+/*					  record                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t HEX_Finish(HEX_Parser_t* Copy_pParser , uint32_t* Copy_pEntryAddress)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check pointer */
+	if(Copy_pParser != NULL)
+	{
+		/* Check if end of file record is received */
+		if(Copy_pParser->State == HEX_STATE_DONE)
+		{
+			/* Return entry address if needed */
+			if(Copy_pEntryAddress != NULL)
+			{
+				*Copy_pEntryAddress = Copy_pParser->EntryAddress;
+			}
+		}
+		else
+		{
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: ProcessRecord                                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: HEX_Parser_t* Copy_pParser                                  */
+/*					  Brief: Parser context (caller owned, no allocation)         */
+/*					  Range: Any pointer to HEX_Parser_t                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Applies a complete record whose checksum is checked (data,  */
+/*					  end of file, extended address or start address record)      */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t HEX_ProcessRecord(HEX_Parser_t* Copy_pParser)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	const uint8_t* Local_pData = &Copy_pParser->Record[HEX_RECORD_DATA];		/* Data field of the record */
+	uint32_t Local_Address;			/* Address of current data byte */
+	uint8_t Local_Length = Copy_pParser->Record[HEX_RECORD_BYTE_COUNT];		/* Data field length */
+	uint8_t Local_Counter = 0;		/* Number of processed data bytes */
+
+	switch(Copy_pParser->Record[HEX_RECORD_TYPE])
+	{
+		case HEX_TYPE_DATA:
+
+			/* Get address of first data byte */
+			Local_Address = Copy_pParser->BaseAddress + HEX_GET_UINT16(&Copy_pParser->Record[HEX_RECORD_ADDRESS_HIGH]);
+
+			/* Gather data bytes into the run */
+			while((Local_Status == RT_OK) && (Local_Counter < Local_Length))
+			{
+				/* Check if byte doesn't continue the run */
+				if((Copy_pParser->RunLength != 0) && (Local_Address != (Copy_pParser->RunAddress + Copy_pParser->RunLength)))
+				{
+					Local_Status = HEX_FlushRun(Copy_pParser);
+				}
+
+				/* Check if a new run starts */
+				if(Copy_pParser->RunLength == 0)
+				{
+					/* Runs start at a halfword boundary, an odd first byte is preceded by the byte an earlier record left in its halfword or padding */
+					Copy_pParser->RunAddress = Local_Address & ~1UL;
+					Copy_pParser->RunPaddedHead = 0;
+					if((Local_Address & 1UL) != 0)
+					{
+						if(HEX_TakePartialByte(Copy_pParser , Copy_pParser->RunAddress , 0 , (uint8_t*)Copy_pParser->Run) != RT_OK)
+						{
+							Copy_pParser->RunPaddedHead = 1;
+						}
+						Copy_pParser->RunLength = 1;
+					}
+				}
+
+				/* Append byte to the run */
+				((uint8_t*)Copy_pParser->Run)[Copy_pParser->RunLength] = Local_pData[Local_Counter];
+				Copy_pParser->RunLength++;
+				Local_Address++;
+				Local_Counter++;
+
+				/* Check if run is full */
+				if((Local_Status == RT_OK) && (Copy_pParser->RunLength == HEX_RUN_SIZE))
+				{
+					Local_Status = HEX_FlushRun(Copy_pParser);
+				}
+			}
+
+			break;
+
+		case HEX_TYPE_END_OF_FILE:
+
+			/* Pass last run then ignore rest of the file */
+			if(Local_Length == 0)
+			{
+				Local_Status = HEX_FlushRun(Copy_pParser);
+				Copy_pParser->State = HEX_STATE_DONE;
+			}
+			else
+			{
+				Local_Status = RT_NOK;
+			}
+
+			break;
+
+		case HEX_TYPE_EXTENDED_SEGMENT_ADDRESS:
+		case HEX_TYPE_EXTENDED_LINEAR_ADDRESS:
+
+			/* Set base address of next data records */
+			if(Local_Length == HEX_ADDRESS_RECORD_LENGTH)
+			{
+				Copy_pParser->BaseAddress = HEX_GET_UINT16(Local_pData) <<
+											((Copy_pParser->Record[HEX_RECORD_TYPE] == HEX_TYPE_EXTENDED_LINEAR_ADDRESS) ? HEX_LINEAR_SHIFT : HEX_SEGMENT_SHIFT);
+			}
+			else
+			{
+				Local_Status = RT_NOK;
+			}
+
+			break;
+
+		case HEX_TYPE_START_SEGMENT_ADDRESS:
+		case HEX_TYPE_START_LINEAR_ADDRESS:
+
+			/* Keep start address (CS:IP or 32-bit EIP) */
+			if(Local_Length == HEX_START_RECORD_LENGTH)
+			{
+				if(Copy_pParser->Record[HEX_RECORD_TYPE] == HEX_TYPE_START_LINEAR_ADDRESS)
+				{
+					Copy_pParser->EntryAddress = (HEX_GET_UINT16(Local_pData) << HEX_LINEAR_SHIFT) | HEX_GET_UINT16(&Local_pData[2]);
+				}
+				else
+				{
+					Copy_pParser->EntryAddress = (HEX_GET_UINT16(Local_pData) << HEX_SEGMENT_SHIFT) + HEX_GET_UINT16(&Local_pData[2]);
+				}
+			}
+			else
+			{
+				Local_Status = RT_NOK;
+			}
+
+			break;
+
+		default:
+
+			/* Unknown record type */
+			Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: FlushRun                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: HEX_Parser_t* Copy_pParser                                  */
+/*					  Brief: Parser context (caller owned, no allocation)         */
+/*					  Range: Any pointer to HEX_Parser_t                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Passes gathered run to the write function, an odd run       */
+/*					  length is completed by the byte an earlier record left in   */
+/*					  the last halfword or by an erased byte (0xFF). Known byte   */
+/*					  of a padded halfword is kept for a later record             */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t HEX_FlushRun(HEX_Parser_t* Copy_pParser)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint8_t* Local_pBytes = (uint8_t*)Copy_pParser->Run;		/* Gathered run as bytes */
+	uint32_t Local_LastAddress;		/* Address of last halfword of the run */
+
+	/* Check if run holds bytes */
+	if(Copy_pParser->RunLength != 0)
+	{
+		/* Keep high byte of a padded first halfword */
+		if(Copy_pParser->RunPaddedHead == 1)
+		{
+			HEX_KeepPartialByte(Copy_pParser , Copy_pParser->RunAddress , 1 , Local_pBytes[1]);
+			Copy_pParser->RunPaddedHead = 0;
+		}
+
+		/* Complete last halfword */
+		if((Copy_pParser->RunLength & 1U) != 0)
+		{
+			Local_LastAddress = Copy_pParser->RunAddress + Copy_pParser->RunLength - 1U;
+			if(HEX_TakePartialByte(Copy_pParser , Local_LastAddress , 1 , &Local_pBytes[Copy_pParser->RunLength]) != RT_OK)
+			{
+				HEX_KeepPartialByte(Copy_pParser , Local_LastAddress , 0 , Local_pBytes[Copy_pParser->RunLength - 1U]);
+			}
+			Copy_pParser->RunLength++;
+		}
+
+		/* Pass run then start a new one */
+		Local_Status = Copy_pParser->WriteFunc(Copy_pParser->RunAddress , Copy_pParser->Run , (uint16_t)(Copy_pParser->RunLength / 2U));
+		Copy_pParser->RunLength = 0;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: TakePartialByte                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_Address                                       */
+/*					  Brief: Address of the halfword                              */
+/*					  Range: Any even uint32_t value                              */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_IsHigh                                         */
+/*					  Brief: Byte needed is the high (odd address) one            */
+/*					  Range: 0 - 1                                                */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: HEX_Parser_t* Copy_pParser                                  */
+/*					  Brief: Parser context (caller owned, no allocation)         */
+/*					  Range: Any pointer to HEX_Parser_t                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: uint8_t* Copy_pByte                                         */
+/*					  Brief: Kept byte, or erased byte (0xFF) if none is kept     */
+/*					  Range: Any pointer to uint8_t                               */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Gets byte an earlier record left in a halfword passed with  */
+/*					  padding, the halfword is complete now so it is not kept     */
+/*					  anymore. Returns RT_NOK if no such byte is kept             */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t HEX_TakePartialByte(HEX_Parser_t* Copy_pParser , uint32_t Copy_Address , uint8_t Copy_IsHigh , uint8_t* Copy_pByte)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_NOK;
+	uint8_t Local_Counter;			/* Number of searched partial halfwords */
+
+	/* Padding unless a byte is kept */
+	*Copy_pByte = HEX_ERASED_BYTE;
+
+	/* Search kept partial halfwords */
+	for(Local_Counter = 0 ; Local_Counter < HEX_PARTIAL_HALFWORDS ; Local_Counter++)
+	{
+		if((Copy_pParser->PartialAddress[Local_Counter] == Copy_Address) && (Copy_pParser->PartialIsHigh[Local_Counter] == Copy_IsHigh))
+		{
+			*Copy_pByte = Copy_pParser->PartialByte[Local_Counter];
+			Copy_pParser->PartialAddress[Local_Counter] = HEX_NO_PARTIAL;
+			Local_Status = RT_OK;
+		}
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: KeepPartialByte                                             */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_Address                                       */
+/*					  Brief: Address of the halfword passed with padding          */
+/*					  Range: Any even uint32_t value                              */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_IsHigh                                         */
+/*					  Brief: Known byte is the high (odd address) one             */
+/*					  Range: 0 - 1                                                */
+/*					  ----------------------------------------------------------- */
+/*					  uint8_t Copy_Byte                                           */
+/*					  Brief: Known byte of the halfword                           */
+/*					  Range: Any uint8_t value                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: HEX_Parser_t* Copy_pParser                                  */
+/*					  Brief: Parser context (caller owned, no allocation)         */
+/*					  Range: Any pointer to HEX_Parser_t                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : void                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Keeps known byte of a halfword passed with padding so that  */
+/*					  a later record filling the padded byte writes both. A byte  */
+/*					  kept for the same halfword byte is replaced, otherwise the  */
+/*					  oldest kept byte is dropped                                 */
+/*--------------------------------------------------------------------------------*/
+static void HEX_KeepPartialByte(HEX_Parser_t* Copy_pParser , uint32_t Copy_Address , uint8_t Copy_IsHigh , uint8_t Copy_Byte)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_Slot = HEX_PARTIAL_HALFWORDS;		/* Kept partial halfword to be used */
+	uint8_t Local_Counter;			/* Number of searched partial halfwords */
+
+	/* Check if same byte of the halfword is already kept */
+	for(Local_Counter = 0 ; Local_Counter < HEX_PARTIAL_HALFWORDS ; Local_Counter++)
+	{
+		if((Copy_pParser->PartialAddress[Local_Counter] == Copy_Address) && (Copy_pParser->PartialIsHigh[Local_Counter] == Copy_IsHigh))
+		{
+			Local_Slot = Local_Counter;
+		}
+	}
+
+	/* Otherwise replace oldest kept byte */
+	if(Local_Slot == HEX_PARTIAL_HALFWORDS)
+	{
+		Local_Slot = Copy_pParser->PartialNext;
+		Copy_pParser->PartialNext = (uint8_t)((Copy_pParser->PartialNext + 1U) % HEX_PARTIAL_HALFWORDS);
+	}
+
+	Copy_pParser->PartialAddress[Local_Slot] = Copy_Address;
+	Copy_pParser->PartialIsHigh[Local_Slot] = Copy_IsHigh;
+	Copy_pParser->PartialByte[Local_Slot] = Copy_Byte;
+}
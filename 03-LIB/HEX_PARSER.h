@@ -0,0 +1,155 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : Hex Parser Interface         */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*                                                                                                                           */
+/*  _    _  ______  __   __  _____             _____    _____  ______  _____                                                 */
+/* | |  | ||  ____| \ \ / / |  __ \     /\    |  __ \  / ____||  ____||  __ \                                                */
+/* | |__| || |__     \ V /  | |__) |   /  \   | |__) || (___  | |__   | |__) |                                               */
+/* |  __  ||  __|     > <   |  ___/   / /\ \  |  _  /  \___ \ |  __|  |  _  /                                                */
+/* | |  | || |____   / . \  | |      / ____ \ | | \ \  ____) || |____ | | \ \                                                */
+/* |_|  |_||______| /_/ \_\ |_|     /_/    \_\|_|  \_\|_____/ |______||_|  \_\                                               */
+/*                                                                                                                           */
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef LIB_HEX_PARSER_H
+#define LIB_HEX_PARSER_H
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  INTERFACE MACROS                                 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Record Limits */
+#define HEX_MAX_DATA_BYTES				255U	/* Largest data field of a record */
+#define HEX_RECORD_OVERHEAD				5U		/* Byte count, address (2 bytes), type and checksum */
+#define HEX_MAX_RECORD_BYTES			(HEX_MAX_DATA_BYTES + HEX_RECORD_OVERHEAD)
+
+/* Size of Halfword Run Passed to Write Function in Bytes (even) */
+#define HEX_RUN_SIZE					128U
+
+/* Entry Address When File Holds No Start Address Record */
+#define HEX_NO_ENTRY_ADDRESS			0xFFFFFFFFUL
+
+/* Number of Padded Halfwords (run edges) Whose Known Byte Is Kept for Later Records */
+#define HEX_PARTIAL_HALFWORDS			8U
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   NEW DATA TYPES                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Function Receiving Decoded Halfword Runs (same prototype as FPEC_BufferWrite) */
+typedef ERROR_STATUS_t (*HEX_WriteFunc_t)(uint32_t Copy_Address , const uint16_t* Copy_pData , uint16_t Copy_Length);
+
+/* Parser Context Type */
+typedef struct
+{
+	HEX_WriteFunc_t WriteFunc;				/* Function receiving decoded halfword runs */
+	uint32_t BaseAddress;					/* Base address set by extended segment/linear address records */
+	uint32_t EntryAddress;					/* Start address of the file */
+	uint32_t RunAddress;					/* Address of first halfword of gathered run */
+	uint16_t RunLength;						/* Number of gathered bytes */
+	uint16_t RecordLength;					/* Number of decoded bytes of current record */
+	uint16_t RecordSize;					/* Number of bytes of current record (known after byte count) */
+	uint8_t  State;							/* Parsing state */
+	uint8_t  HighNibble;					/* High nibble of byte being decoded */
+	uint8_t  Checksum;						/* Sum of decoded bytes of current record */
+	uint8_t  Record[HEX_MAX_RECORD_BYTES];	/* Decoded bytes of current record */
+	uint16_t Run[HEX_RUN_SIZE / 2U];		/* Gathered halfword run */
+	uint8_t  RunPaddedHead;					/* First byte of gathered run is padding */
+	uint8_t  PartialNext;					/* Kept partial halfword replaced next (oldest) */
+	uint32_t PartialAddress[HEX_PARTIAL_HALFWORDS];	/* Address of padded halfwords passed to write function */
+	uint8_t  PartialByte[HEX_PARTIAL_HALFWORDS];	/* Known byte of each padded halfword */
+	uint8_t  PartialIsHigh[HEX_PARTIAL_HALFWORDS];	/* Known byte is the high (odd address) one */
+}HEX_Parser_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                FUNCTIONS PROTOTYPES                               */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Init                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: HEX_WriteFunc_t Copy_pWriteFunc                             */
+/*					  Brief: Function that receives decoded halfword runs,        */
+/*					         FPEC_BufferWrite can be passed directly              */
+/*					  Range: Any pointer to function                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: HEX_Parser_t* Copy_pParser                                  */
+/*					  Brief: Parser context (caller owned, no allocation)         */
+/*					  Range: Any pointer to HEX_Parser_t                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Resets parser context to wait for the first record with     */
+/*					  base address 0 and no entry address                         */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t HEX_Init(HEX_Parser_t* Copy_pParser , HEX_WriteFunc_t Copy_pWriteFunc);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Feed                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: const uint8_t* Copy_pData                                   */
+/*					  Brief: Characters of the hex file fragment                  */
+/*					  Range: None                                                 */
+/*					  ----------------------------------------------------------- */
+/*					  uint32_t Copy_Length                                        */
+/*					  Brief: Number of characters                                 */
+/*					  Range: Any uint32_t value                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: HEX_Parser_t* Copy_pParser                                  */
+/*					  Brief: Parser context (caller owned, no allocation)         */
+/*					  Range: Any pointer to HEX_Parser_t                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Parses a fragment of an Intel-HEX file of any size as it    */
+/*					  arrives (a record may be split over many fragments).        */
+/*					  Checksum of each record is checked, extended segment and    */
+/*					  linear address records move the base address and contiguous */
+/*					  data records are gathered into halfword aligned runs passed */
+/*					  to the write function. A run edge on an odd address is      */
+/*					  padded with 0xFF, a later record filling the padded byte    */
+/*					  writes the whole halfword again with the kept byte (last    */
+/*					  HEX_PARTIAL_HALFWORDS padded halfwords are kept). Returns   */
+/*					  RT_NOK on malformed input (parser stays failed until        */
+/*					  HEX_Init) or status of the write function if it fails       */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t HEX_Feed(HEX_Parser_t* Copy_pParser , const uint8_t* Copy_pData , uint32_t Copy_Length);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Finish                                                      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: None                                                        */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: HEX_Parser_t* Copy_pParser                                  */
+/*					  Brief: Parser context (caller owned, no allocation)         */
+/*					  Range: Any pointer to HEX_Parser_t                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: uint32_t* Copy_pEntryAddress                                */
+/*					  Brief: Start address from start segment or start linear     */
+/*					         address record                                       */
+/*					  Range: Any pointer to uint32_t or NULL if not needed        */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : ERROR_STATUS_t                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Checks that end of file record is received. Entry address   */
+/*					  is HEX_NO_ENTRY_ADDRESS if the file holds no start address  */
+/*					  record                                                      */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t HEX_Finish(HEX_Parser_t* Copy_pParser , uint32_t* Copy_pEntryAddress);
+
+#endif /* LIB_HEX_PARSER_H */
@@ -25,6 +25,36 @@
 #include "STD_TYPES.h"
 #include "SERVICE_FUNCTIONS.h"
 
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            		PRIVATE MACROS				       		         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#define SERV_DEMCR					(*((volatile uint32_t*)0xE000EDFC))	/* Debug exception and monitor control register */
+#define SERV_DWT_CTRL				(*((volatile uint32_t*)0xE0001000))	/* DWT control register */
+#define SERV_DWT_CYCCNT				(*((volatile uint32_t*)0xE0001004))	/* DWT cycle count register */
+#define SERV_DEMCR_TRCENA			24U									/* Trace (DWT) enable bit */
+#define SERV_DWT_CTRL_CYCCNTENA		0U									/* Cycle counter enable bit */
+#define SERV_RESET_CORE_CLOCK_MHZ	8UL									/* Core clock after reset (HSI) in MHz */
+#define SERV_MICROSECONDS_PER_SECOND		1000000UL					/* Number of microseconds in one second */
+#define SERV_MICROSECONDS_PER_MILLISECOND	1000UL						/* Number of microseconds in one millisecond */
+#define SERV_MAX_DELAY_CHUNK_MS		1000UL								/* Longest wait in one cycle counter pass (fits 32 bits up to 72 MHz) */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                           	PRIVATE FUNCTIONS PROTOTYPES	                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void SERV_WaitCycles(uint32_t Copy_Cycles , void (*Copy_pYieldFunction)(void));
+static void SERV_EnableCycleCounter(void);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS		                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static uint32_t Global_CyclesPerMicrosecond = SERV_RESET_CORE_CLOCK_MHZ;	/* Core clock cycles per microsecond used to scale delays */
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                             FUNCTIONS IMPLEMENTATIONS		                   	 */
@@ -150,25 +180,257 @@ uint32_t SERV_Pow(uint32_t Copy_Base , uint32_t Copy_Power)
 }
 
 /*--------------------------------------------------------------------------------*/
-/* @Function Name 	: Pow											        	  */
+/* @Function Name 	: DelayInit										        	  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_CoreClockFrequency							  */
+/*					  Brief: Cortex core (AHB) clock frequency in Hz		      */
+/*					  Range: 1000000UL --> 72000000UL						      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : void		  	        	      		        			  */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Sets core clock used to scale delays (e.g. value returned   */
+/*					  by RCC_GetAHBClockFrequency) and starts DWT cycle counter	  */
+/*					  if it is not running (counter is never reset). Called by	  */
+/*					  RCC_Init once system clock is switched, delays assume 8 MHz */
+/*					  HSI reset clock until then								  */
+/*--------------------------------------------------------------------------------*/
+void SERV_DelayInit(uint32_t Copy_CoreClockFrequency)
+{
+	/* Get number of core cycles per microsecond (rounded up so delays are never shorter) */
+	Global_CyclesPerMicrosecond = (Copy_CoreClockFrequency + (SERV_MICROSECONDS_PER_SECOND - 1UL)) / SERV_MICROSECONDS_PER_SECOND;
+
+	/* Keep at least one cycle per microsecond */
+	if(Global_CyclesPerMicrosecond == 0)
+	{
+		Global_CyclesPerMicrosecond = 1;
+	}
+
+	/* Start DWT cycle counter if it is not running (never reset: running timeouts keep their start cycle) */
+	SERV_EnableCycleCounter();
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Delay_us										        	  */
 /*--------------------------------------------------------------------------------*/
 /* @Param(in) 		: uint32_t Copy_Time										  */
+/*					  Brief: Delay time in microseconds						      */
+/*					  Range: Any uint32_t value								      */
 /*--------------------------------------------------------------------------------*/
 /* @Param(inout)	: None														  */
 /*--------------------------------------------------------------------------------*/
 /* @Param(out)		: None														  */
 /*--------------------------------------------------------------------------------*/
-/* @Return          : uint32_t  	        	      		        			  */
+/* @Return          : void		  	        	      		        			  */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Function to block the processor for at least specified	  */
+/*					  delay in us, measured by DWT cycle counter				  */
+/*--------------------------------------------------------------------------------*/
+void SERV_Delay_us(uint32_t Copy_Time)
+{
+	/* Busy wait for passed time */
+	SERV_DelayYield_us(Copy_Time , NULL);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Delay_ms										        	  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_Time										  */
+/*					  Brief: Delay time in milliseconds						      */
+/*					  Range: Any uint32_t value								      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : void		  	        	      		        			  */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Function to block the processor for at least specified	  */
+/*					  delay in ms, measured by DWT cycle counter				  */
+/*--------------------------------------------------------------------------------*/
+void SERV_Delay_ms(uint32_t Copy_Time)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_Chunk;			/* Part of delay that fits in cycle counter range */
+
+	/* Wait in chunks so that number of cycles never overflows */
+	while(Copy_Time != 0)
+	{
+		/* Get next chunk of delay */
+		Local_Chunk = (Copy_Time > SERV_MAX_DELAY_CHUNK_MS) ? SERV_MAX_DELAY_CHUNK_MS : Copy_Time;
+		Copy_Time -= Local_Chunk;
+
+		/* Wait for chunk */
+		SERV_WaitCycles(Local_Chunk * SERV_MICROSECONDS_PER_MILLISECOND * Global_CyclesPerMicrosecond , NULL);
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: DelayYield_us									        	  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_Time										  */
+/*					  Brief: Delay time in microseconds						      */
+/*					  Range: Any uint32_t value								      */
+/*					  ----------------------------------------------------------- */
+/*					  void (*Copy_pYieldFunction)(void)							  */
+/*					  Brief: Function invoked repeatedly while waiting		      */
+/*					  Range: Any pointer to function or NULL (busy wait)	      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : void		  	        	      		        			  */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Waits for at least specified delay in us while running	  */
+/*					  passed yield function to do other work. Delay may be		  */
+/*					  extended by duration of last yield function call			  */
+/*--------------------------------------------------------------------------------*/
+void SERV_DelayYield_us(uint32_t Copy_Time , void (*Copy_pYieldFunction)(void))
+{
+	/* Local Variables Definitions */
+	uint32_t Local_Chunk;			/* Part of delay that fits in cycle counter range */
+
+	/* Wait in chunks so that number of cycles never overflows */
+	while(Copy_Time != 0)
+	{
+		/* Get next chunk of delay */
+		Local_Chunk = (Copy_Time > (SERV_MAX_DELAY_CHUNK_MS * SERV_MICROSECONDS_PER_MILLISECOND)) ? (SERV_MAX_DELAY_CHUNK_MS * SERV_MICROSECONDS_PER_MILLISECOND) : Copy_Time;
+		Copy_Time -= Local_Chunk;
+
+		/* Wait for chunk */
+		SERV_WaitCycles(Local_Chunk * Global_CyclesPerMicrosecond , Copy_pYieldFunction);
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: StartTimeout_us								        	  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_Time										  */
+/*					  Brief: Timeout in microseconds						      */
+/*					  Range: (0 --> 59000000UL) at 72 MHz core clock	      	  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: SERV_Timeout_t* Copy_pTimeout								  */
+/*					  Brief: Timeout object to be started					      */
+/*					  Range: Any pointer to SERV_Timeout_t					      */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : void		  	        	      		        			  */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Starts a non-blocking timeout on DWT cycle counter so that  */
+/*					  callers can poll SERV_IsTimeoutExpired instead of blocking  */
+/*--------------------------------------------------------------------------------*/
+void SERV_StartTimeout_us(SERV_Timeout_t* Copy_pTimeout , uint32_t Copy_Time)
+{
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pTimeout != NULL)
+	{
+		/* Start DWT cycle counter if it is not running (SERV_DelayInit not called) */
+		SERV_EnableCycleCounter();
+
+		/* Sample cycle counter and convert timeout to cycles */
+		Copy_pTimeout->StartCycle = SERV_DWT_CYCCNT;
+		Copy_pTimeout->Cycles = Copy_Time * Global_CyclesPerMicrosecond;
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: IsTimeoutExpired								        	  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: const SERV_Timeout_t* Copy_pTimeout						  */
+/*					  Brief: Timeout object started by SERV_StartTimeout_us	      */
+/*					  Range: Any pointer to SERV_Timeout_t					      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : uint8_t (1 if timeout expired, 0 otherwise)				  */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Checks if a started timeout has expired					  */
+/*--------------------------------------------------------------------------------*/
+uint8_t SERV_IsTimeoutExpired(const SERV_Timeout_t* Copy_pTimeout)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_Expired = 1;		/* A NULL timeout is treated as expired */
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pTimeout != NULL)
+	{
+		/* Compare elapsed cycles with timeout length (wrap-around safe) */
+		Local_Expired = ((SERV_DWT_CYCCNT - Copy_pTimeout->StartCycle) >= Copy_pTimeout->Cycles);
+	}
+
+	return Local_Expired;
+}
+
 /*--------------------------------------------------------------------------------*/
-/* @Description     : Function to block the processor for specified delay in ms	  */
+/* @Function Name 	: WaitCycles									        	  */
 /*--------------------------------------------------------------------------------*/
-uint32_t SERV_Delay_ms(uint32_t Copy_Time)
+/* @Param(in) 		: uint32_t Copy_Cycles										  */
+/*					  Brief: Number of core clock cycles to wait			      */
+/*					  Range: Any uint32_t value								      */
+/*					  ----------------------------------------------------------- */
+/*					  void (*Copy_pYieldFunction)(void)							  */
+/*					  Brief: Function invoked repeatedly while waiting		      */
+/*					  Range: Any pointer to function or NULL (busy wait)	      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : void		  	        	      		        			  */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Waits until DWT cycle counter advances by passed number of  */
+/*					  cycles (counter wrap-around is handled by unsigned		  */
+/*					  subtraction)												  */
+/*--------------------------------------------------------------------------------*/
+static void SERV_WaitCycles(uint32_t Copy_Cycles , void (*Copy_pYieldFunction)(void))
 {
-	uint32_t Local_Ticks = (500 * Copy_Time);
-	uint32_t Local_TicksCounter;
+	/* Local Variables Definitions */
+	uint32_t Local_StartCycle;		/* Cycle counter value at start of wait */
+
+	/* Start DWT cycle counter if it is not running (SERV_DelayInit not called) */
+	SERV_EnableCycleCounter();
+
+	/* Sample cycle counter */
+	Local_StartCycle = SERV_DWT_CYCCNT;
 
-	for(Local_TicksCounter = 0 ; Local_TicksCounter < Local_Ticks ;Local_TicksCounter++)
+	/* Wait until passed number of cycles elapses */
+	while((SERV_DWT_CYCCNT - Local_StartCycle) < Copy_Cycles)
+	{
+		/* Run other work while waiting if a yield function is passed */
+		if(Copy_pYieldFunction != NULL)
+		{
+			Copy_pYieldFunction();
+		}
+	}
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: EnableCycleCounter							        	  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : void		  	        	      		        			  */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Starts DWT cycle counter if it is not running				  */
+/*--------------------------------------------------------------------------------*/
+static void SERV_EnableCycleCounter(void)
+{
+	/* Check if DWT cycle counter is running or not */
+	if(((SERV_DWT_CTRL >> SERV_DWT_CTRL_CYCCNTENA) & 1UL) == 0)
 	{
-		__asm("NOP");
+		/* Enable trace block then start DWT cycle counter */
+		SERV_DEMCR |= (1UL << SERV_DEMCR_TRCENA);
+		SERV_DWT_CTRL |= (1UL << SERV_DWT_CTRL_CYCCNTENA);
 	}
 }
@@ -20,6 +20,19 @@
 #ifndef LIB_SERVICE_FUNCTIONS_H
 #define LIB_SERVICE_FUNCTIONS_H
 
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                           	     NEW DATA TYPES			               	         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Non-Blocking Timeout Type */
+typedef struct
+{
+	uint32_t StartCycle;				/* DWT cycle counter value when timeout was started */
+	uint32_t Cycles;					/* Timeout length in core clock cycles */
+}SERV_Timeout_t;
+
 /*-----------------------------------------------------------------------------------*/
 /*                                                                                   */
 /*                           	 FUNCTIONS PROTOTYPES		                   	     */
@@ -94,18 +107,120 @@ uint32_t SERV_CeilDev(float32_t Copy_Num1 , float32_t Copy_Num2);
 uint32_t SERV_Pow(uint32_t Copy_Base , uint32_t Copy_Power);
 
 /*--------------------------------------------------------------------------------*/
-/* @Function Name 	: Pow											        	  */
+/* @Function Name 	: DelayInit										        	  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_CoreClockFrequency							  */
+/*					  Brief: Cortex core (AHB) clock frequency in Hz		      */
+/*					  Range: 1000000UL --> 72000000UL						      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : void		  	        	      		        			  */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Sets core clock used to scale delays (e.g. value returned   */
+/*					  by RCC_GetAHBClockFrequency) and starts DWT cycle counter	  */
+/*					  if it is not running (counter is never reset). Called by	  */
+/*					  RCC_Init once system clock is switched, delays assume 8 MHz */
+/*					  HSI reset clock until then								  */
+/*--------------------------------------------------------------------------------*/
+void SERV_DelayInit(uint32_t Copy_CoreClockFrequency);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Delay_us										        	  */
 /*--------------------------------------------------------------------------------*/
 /* @Param(in) 		: uint32_t Copy_Time										  */
+/*					  Brief: Delay time in microseconds						      */
+/*					  Range: Any uint32_t value								      */
 /*--------------------------------------------------------------------------------*/
 /* @Param(inout)	: None														  */
 /*--------------------------------------------------------------------------------*/
 /* @Param(out)		: None														  */
 /*--------------------------------------------------------------------------------*/
-/* @Return          : uint32_t  	        	      		        			  */
+/* @Return          : void		  	        	      		        			  */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Function to block the processor for at least specified	  */
+/*					  delay in us, measured by DWT cycle counter				  */
+/*--------------------------------------------------------------------------------*/
+void SERV_Delay_us(uint32_t Copy_Time);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: Delay_ms										        	  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_Time										  */
+/*					  Brief: Delay time in milliseconds						      */
+/*					  Range: Any uint32_t value								      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : void		  	        	      		        			  */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Function to block the processor for at least specified	  */
+/*					  delay in ms, measured by DWT cycle counter				  */
+/*--------------------------------------------------------------------------------*/
+void SERV_Delay_ms(uint32_t Copy_Time);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: DelayYield_us									        	  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_Time										  */
+/*					  Brief: Delay time in microseconds						      */
+/*					  Range: Any uint32_t value								      */
+/*					  ----------------------------------------------------------- */
+/*					  void (*Copy_pYieldFunction)(void)							  */
+/*					  Brief: Function invoked repeatedly while waiting		      */
+/*					  Range: Any pointer to function or NULL (busy wait)	      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : void		  	        	      		        			  */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Waits for at least specified delay in us while running	  */
+/*					  passed yield function to do other work. Delay may be		  */
+/*					  extended by duration of last yield function call			  */
+/*--------------------------------------------------------------------------------*/
+void SERV_DelayYield_us(uint32_t Copy_Time , void (*Copy_pYieldFunction)(void));
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: StartTimeout_us								        	  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: uint32_t Copy_Time										  */
+/*					  Brief: Timeout in microseconds						      */
+/*					  Range: (0 --> 59000000UL) at 72 MHz core clock	      	  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: SERV_Timeout_t* Copy_pTimeout								  */
+/*					  Brief: Timeout object to be started					      */
+/*					  Range: Any pointer to SERV_Timeout_t					      */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : void		  	        	      		        			  */
+/*--------------------------------------------------------------------------------*/
+/* @Description     : Starts a non-blocking timeout on DWT cycle counter so that  */
+/*					  callers can poll SERV_IsTimeoutExpired instead of blocking  */
+/*--------------------------------------------------------------------------------*/
+void SERV_StartTimeout_us(SERV_Timeout_t* Copy_pTimeout , uint32_t Copy_Time);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name 	: IsTimeoutExpired								        	  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in) 		: const SERV_Timeout_t* Copy_pTimeout						  */
+/*					  Brief: Timeout object started by SERV_StartTimeout_us	      */
+/*					  Range: Any pointer to SERV_Timeout_t					      */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout)	: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)		: None														  */
+/*--------------------------------------------------------------------------------*/
+/* @Return          : uint8_t (1 if timeout expired, 0 otherwise)				  */
 /*--------------------------------------------------------------------------------*/
-/* @Description     : Function to block the processor for specified delay in ms	  */
+/* @Description     : Checks if a started timeout has expired					  */
 /*--------------------------------------------------------------------------------*/
-uint32_t SERV_Delay_ms(uint32_t Copy_Time);
+uint8_t SERV_IsTimeoutExpired(const SERV_Timeout_t* Copy_pTimeout);
 
 #endif /* LIB_SERVICE_FUNCTIONS_H */
@@ -31,6 +31,8 @@ typedef unsigned short int 		uint16_t;
 typedef signed short int 		sint16_t;
 typedef unsigned long int 		uint32_t;
 typedef signed long int 		sint32_t;
+typedef unsigned long long int 	uint64_t;
+typedef signed long long int 	sint64_t;
 typedef float 					float32_t;
 typedef double 					float64_t;
 typedef long double 			float128_t;
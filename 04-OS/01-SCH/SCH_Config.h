@@ -0,0 +1,53 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*      			SWC          : SCH  			            */
+/*     			    Description	 : SCH Config                   */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*----------------------------------------------------------------------------------------------------------*/
+/*                                                                                                          */
+/*                      _____   _____  _    _     _____             __ _                                    */
+/*                     / ____| / ____|| |  | |   / ____|           / _(_)                                   */
+/*                    | (___  | |     | |__| |  | |     ___  _ __ | |_ _  __ _                              */
+/*                     \___ \ | |     |  __  |  | |    / _ \| '_ \|  _| |/ _` |                             */
+/*                     ____) || |____ | |  | |  | |___| (_) | | | | | | | (_| |                             */
+/*                    |_____/  \_____||_|  |_|   \_____\___/|_| |_|_| |_|\__, |                             */
+/*                                                                       __/  |                             */
+/*                                                                       |___/                              */
+/*                                                                                                          */
+/*----------------------------------------------------------------------------------------------------------*/
+
+#ifndef SCH_OS_CONFIG_H_
+#define SCH_OS_CONFIG_H_
+
+/*-------------------------------------------------------*/
+/* Set number of tasks in the static task table (task    */
+/* priority is its index in the table):                  */
+/*                                                       */
+/* Options	: - (1 --> 32)                               */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define SCH_MAX_TASKS  8U  /* Default: 8U */
+
+/*-------------------------------------------------------*/
+/* Set number of SysTick ticks per scheduler tick:       */
+/*                                                       */
+/* Options	: - (2 --> 0x01000000)                       */
+/*                                                       */
+/* Note     : 1000U is 1 ms at 8 MHz AHB with            */
+/*            AHB_DIV_BY_EIGHT SysTick clock source      */
+/*-------------------------------------------------------*/
+#define SCH_TICK_PERIOD  1000U  /* Default: 1000U */
+
+/*-------------------------------------------------------*/
+/* Set number of scheduler ticks of each CPU load        */
+/* measurement window:                                   */
+/*                                                       */
+/* Options	: - (1 --> 0xFFFFFFFF)                       */
+/*                                                       */
+/*-------------------------------------------------------*/
+#define SCH_LOAD_WINDOW  1000U  /* Default: 1000U */
+
+#endif /* SCH_OS_CONFIG_H_ */
@@ -0,0 +1,205 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*      			SWC          : SCH  			            */
+/*     			    Description	 : SCH Interface                */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*----------------------------------------------------------------------------------------------------------*/
+/*                                                                                                          */
+/*                _____   _____  _    _    _____       _             __                                     */
+/*               / ____| / ____|| |  | |  |_   _|     | |           / _|                                    */
+/*              | (___  | |     | |__| |    | |  _ __ | |_ ___ _ __| |_ __ _  ___ ___                       */
+/*               \___ \ | |     |  __  |    | | | '_ \| __/ _ \ '__|  _/ _` |/ __/ _ \                      */
+/*               ____) || |____ | |  | |   _| |_| | | | ||  __/ |  | || (_| | (_|  __/                      */
+/*              |_____/  \_____||_|  |_|  |_____|_| |_|\__\___|_|  |_| \__,_|\___\___|                      */
+/*                                                                                                          */
+/*----------------------------------------------------------------------------------------------------------*/
+
+#ifndef SCH_OS_INTERFACE_H_
+#define SCH_OS_INTERFACE_H_
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   NEW DATA TYPES                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Task Statistics Type */
+typedef struct
+{
+	uint32_t releases;					/* Number of times task was released */
+	uint32_t deadlineMisses;			/* Number of releases dropped (task still pending) or completed after deadline */
+	uint32_t lastExecutionTime;			/* Execution time of last run in SysTick ticks */
+	uint32_t maxExecutionTime;			/* Worst observed execution time in SysTick ticks */
+	uint16_t cpuLoad;					/* Share of CPU during last measurement window in per mille */
+}SCH_TaskStatistics_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  INTERFACE MACROS                                 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Task Period Options */
+#define SCH_EVENT_TASK				0U			/* Task released only through SCH_ActivateTask */
+
+/* Task Deadline Options */
+#define SCH_NO_DEADLINE				0U			/* Task has no completion deadline */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                FUNCTIONS PROTOTYPES                               */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Init                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Initializes scheduler through deleting all tasks, clearing     */
+/*                 their statistics and resetting scheduler time                  */
+/*--------------------------------------------------------------------------------*/
+void SCH_Init(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: CreateTask                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Priority                                          */
+/*				   Brief: Task priority which is also its id (0 is highest)       */
+/*				   Range: (0 --> SCH_MAX_TASKS - 1)                               */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_PeriodTicks                                      */
+/*				   Brief: Task period in scheduler ticks                          */
+/*				   Range: SCH_EVENT_TASK (released only by SCH_ActivateTask) or   */
+/*				          (1 --> 0xFFFFFFFF)                                      */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_OffsetTicks                                      */
+/*				   Brief: Scheduler ticks until first release of a periodic task  */
+/*				          (ignored for event tasks)                               */
+/*				   Range: (1 --> Copy_PeriodTicks)                                */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_DeadlineTicks                                    */
+/*				   Brief: Relative deadline from release to completion in         */
+/*				          scheduler ticks                                         */
+/*				   Range: SCH_NO_DEADLINE or (1 --> 0xFFFFFFFF)                   */
+/*				   -------------------------------------------------------------- */
+/*                 void (*Copy_pTaskFunction)(void)                               */
+/*				   Brief: Pointer to run-to-completion task body                  */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Creates a periodic or event-triggered task in the static task  */
+/*                 table. Returns BUSY_FUNC if priority is already used by        */
+/*                 another task                                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t SCH_CreateTask(uint8_t Copy_Priority , uint32_t Copy_PeriodTicks , uint32_t Copy_OffsetTicks , uint32_t Copy_DeadlineTicks , void (*Copy_pTaskFunction)(void));
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: DeleteTask                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Priority                                          */
+/*				   Brief: Priority (id) of task to be deleted                     */
+/*				   Range: (0 --> SCH_MAX_TASKS - 1)                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Deletes a task and drops its pending release (if any)          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t SCH_DeleteTask(uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ActivateTask                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Priority                                          */
+/*				   Brief: Priority (id) of task to be released                    */
+/*				   Range: (0 --> SCH_MAX_TASKS - 1)                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Releases a task (typically an event task) from thread or       */
+/*                 interrupt context. Returns BUSY_FUNC and counts a deadline     */
+/*                 miss if previous release of task has not started yet           */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t SCH_ActivateTask(uint8_t Copy_Priority);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Start                                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Sets PendSV (dispatcher) to lowest priority then starts        */
+/*                 SysTick free-running time base with SCH_TICK_PERIOD ticks per  */
+/*                 scheduler tick. Tasks then run from PendSV exception so thread */
+/*                 mode only has to idle (e.g. WFI)                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t SCH_Start(void);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetTaskStatistics                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Priority                                          */
+/*				   Brief: Priority (id) of task                                   */
+/*				   Range: (0 --> SCH_MAX_TASKS - 1)                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : SCH_TaskStatistics_t* Copy_pStatistics                         */
+/*				   Brief: Pointer to structure that will hold task statistics     */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets number of releases, deadline misses, last and worst       */
+/*                 execution times (in SysTick ticks) and CPU load of last        */
+/*                 measurement window of a task                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t SCH_GetTaskStatistics(uint8_t Copy_Priority , SCH_TaskStatistics_t* Copy_pStatistics);
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetCpuLoad                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint16_t* Copy_pCpuLoad                                        */
+/*				   Brief: Pointer to variable that will hold CPU load of all      */
+/*				          tasks during last measurement window in per mille       */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets total CPU load of all tasks measured over last            */
+/*                 SCH_LOAD_WINDOW scheduler ticks                                */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t SCH_GetCpuLoad(uint16_t* Copy_pCpuLoad);
+
+#endif /* SCH_OS_INTERFACE_H_ */
@@ -0,0 +1,73 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*      			SWC          : SCH  			            */
+/*     			    Description	 : SCH Private                  */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*----------------------------------------------------------------------------------------------------------*/
+/*                                                                                                          */
+/*                     _____   _____  _    _    _____      _            _                                   */
+/*                    / ____| / ____|| |  | |  |  __ \    (_)          | |                                  */
+/*                   | (___  | |     | |__| |  | |__) | __ ___   ____ _| |_ ___                             */
+/*                    \___ \ | |     |  __  |  |  ___/ '__| \ \ / / _` | __/ _ \                            */
+/*                    ____) || |____ | |  | |  | |   | |  | |\ V / (_| | ||  __/                            */
+/*                   |_____/  \_____||_|  |_|  |_|   |_|  |_| \_/ \__,_|\__\___|                            */
+/*                                                                                                          */
+/*----------------------------------------------------------------------------------------------------------*/
+
+#ifndef SCH_OS_PRIVATE_H_
+#define SCH_OS_PRIVATE_H_
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 PRIVATE DATA TYPES                                */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Scheduler Task Control Block Type */
+typedef struct
+{
+	void(*TaskFunc)(void);				/* Task body */
+	uint32_t Period;					/* Task period in scheduler ticks (0 for event task) */
+	uint32_t Countdown;					/* Scheduler ticks until next periodic release */
+	uint32_t Deadline;					/* Relative deadline in scheduler ticks (0 for none) */
+	uint32_t ReleaseTime;				/* Scheduler time of pending release */
+	uint32_t Releases;					/* Number of releases */
+	uint32_t DeadlineMisses;			/* Number of dropped releases and late completions */
+	uint32_t LastExecutionTime;			/* Execution time of last run in SysTick ticks */
+	uint32_t MaxExecutionTime;			/* Worst execution time in SysTick ticks */
+	uint32_t BusyTime;					/* Execution time accumulated in current load window */
+	uint16_t CpuLoad;					/* CPU load of last window in per mille */
+	uint8_t State;						/* Task state (deleted or created) */
+}SCH_Task_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Define Maximum Number of Tasks (one bit per task in ready bitmap) */
+#define SCH_TASKS_LIMIT				32U
+
+/* Define Task States */
+#define SCH_TASK_DELETED			0U
+#define SCH_TASK_CREATED			1U
+
+/* Define CPU Load Scale (per mille) */
+#define SCH_LOAD_SCALE				1000UL
+
+/* Critical section macros are Cortex-M3 specific, a host build (05-TEST) defines its own before this header */
+#ifndef SCH_ENTER_CRITICAL_SECTION
+
+/* Save PRIMASK then mask configurable interrupts (task table is shared with SysTick exception) */
+#define SCH_ENTER_CRITICAL_SECTION(Copy_PrimaskState)		__asm volatile("MRS %0, PRIMASK\n\tCPSID I" : "=r"(Copy_PrimaskState) : : "memory")
+
+/* Restore PRIMASK saved by SCH_ENTER_CRITICAL_SECTION */
+#define SCH_EXIT_CRITICAL_SECTION(Copy_PrimaskState)		__asm volatile("MSR PRIMASK, %0" : : "r"(Copy_PrimaskState) : "memory")
+
+#endif
+
+#endif /* SCH_OS_PRIVATE_H_ */
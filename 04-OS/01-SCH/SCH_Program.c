@@ -0,0 +1,576 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*      			SWC          : SCH  			            */
+/*     			    Description	 : SCH Program                  */
+/* 	   				Version      : V1.0                         */
+/****************************************************************/
+
+/*----------------------------------------------------------------------------------------------------------*/
+/*                                                                                                          */
+/*                _____   _____  _    _    _____                                                            */
+/*               / ____| / ____|| |  | |  |  __ \                                                           */
+/*              | (___  | |     | |__| |  | |__) | __ ___   __ _ _ __ __ _ _ __ ___                         */
+/*               \___ \ | |     |  __  |  |  ___/ '__/ _ \ / _` | '__/ _` | '_ ` _ \                        */
+/*               ____) || |____ | |  | |  | |   | | | (_) | (_| | | | (_| | | | | | |                       */
+/*              |_____/  \_____||_|  |_|  |_|   |_|  \___/ \__, |_|  \__,_|_| |_| |_|                       */
+/*                                                          __/ |                                           */
+/*                                                         |___/                                            */
+/*                                                                                                          */
+/*----------------------------------------------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+#include "BIT_MATH.h"
+
+#include "STK_Interface.h"
+#include "SCB_Interface.h"
+
+#include "SCH_Private.h"
+#include "SCH_Config.h"
+#include "SCH_Interface.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            PRIVATE FUNCTIONS PROTOTYPES                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void SCH_TickHandler(void);
+static ERROR_STATUS_t SCH_ReleaseTask(uint8_t Copy_Priority);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static SCH_Task_t Global_Tasks[SCH_MAX_TASKS];			/* Static task table indexed by task priority */
+static volatile uint32_t Global_ReadyTasks = 0;			/* Bit per released task that has not started yet */
+static volatile uint32_t Global_SchedulerTime = 0;		/* Number of elapsed scheduler ticks */
+static uint32_t Global_LoadWindowTicks = 0;				/* Elapsed scheduler ticks of current load window */
+static uint16_t Global_CpuLoad = 0;						/* Total CPU load of last window in per mille */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Init                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Initializes scheduler through deleting all tasks, clearing     */
+/*                 their statistics and resetting scheduler time                  */
+/*--------------------------------------------------------------------------------*/
+void SCH_Init(void)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_Iterator;
+
+	/* Delete all tasks and clear their statistics */
+	for(Local_Iterator = 0 ; Local_Iterator < SCH_MAX_TASKS ; Local_Iterator++)
+	{
+		Global_Tasks[Local_Iterator].TaskFunc = NULL;
+		Global_Tasks[Local_Iterator].State = SCH_TASK_DELETED;
+		Global_Tasks[Local_Iterator].Releases = 0;
+		Global_Tasks[Local_Iterator].DeadlineMisses = 0;
+		Global_Tasks[Local_Iterator].LastExecutionTime = 0;
+		Global_Tasks[Local_Iterator].MaxExecutionTime = 0;
+		Global_Tasks[Local_Iterator].BusyTime = 0;
+		Global_Tasks[Local_Iterator].CpuLoad = 0;
+	}
+
+	/* Reset scheduler state */
+	Global_ReadyTasks = 0;
+	Global_SchedulerTime = 0;
+	Global_LoadWindowTicks = 0;
+	Global_CpuLoad = 0;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: CreateTask                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Priority                                          */
+/*				   Brief: Task priority which is also its id (0 is highest)       */
+/*				   Range: (0 --> SCH_MAX_TASKS - 1)                               */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_PeriodTicks                                      */
+/*				   Brief: Task period in scheduler ticks                          */
+/*				   Range: SCH_EVENT_TASK (released only by SCH_ActivateTask) or   */
+/*				          (1 --> 0xFFFFFFFF)                                      */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_OffsetTicks                                      */
+/*				   Brief: Scheduler ticks until first release of a periodic task  */
+/*				          (ignored for event tasks)                               */
+/*				   Range: (1 --> Copy_PeriodTicks)                                */
+/*				   -------------------------------------------------------------- */
+/*                 uint32_t Copy_DeadlineTicks                                    */
+/*				   Brief: Relative deadline from release to completion in         */
+/*				          scheduler ticks                                         */
+/*				   Range: SCH_NO_DEADLINE or (1 --> 0xFFFFFFFF)                   */
+/*				   -------------------------------------------------------------- */
+/*                 void (*Copy_pTaskFunction)(void)                               */
+/*				   Brief: Pointer to run-to-completion task body                  */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Creates a periodic or event-triggered task in the static task  */
+/*                 table. Returns BUSY_FUNC if priority is already used by        */
+/*                 another task                                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t SCH_CreateTask(uint8_t Copy_Priority , uint32_t Copy_PeriodTicks , uint32_t Copy_OffsetTicks , uint32_t Copy_DeadlineTicks , void (*Copy_pTaskFunction)(void))
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_PrimaskState;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pTaskFunction != NULL)
+	{
+		/* Check if passed priority and offset are valid or not */
+		if(Copy_Priority < SCH_MAX_TASKS && (Copy_PeriodTicks == SCH_EVENT_TASK || (Copy_OffsetTicks >= 1U && Copy_OffsetTicks <= Copy_PeriodTicks)))
+		{
+			/* Task table is shared with SysTick exception */
+			SCH_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+			/* Check if priority is already used or not */
+			if(Global_Tasks[Copy_Priority].State == SCH_TASK_DELETED)
+			{
+				/* Set task parameters */
+				Global_Tasks[Copy_Priority].TaskFunc = Copy_pTaskFunction;
+				Global_Tasks[Copy_Priority].Period = Copy_PeriodTicks;
+				Global_Tasks[Copy_Priority].Countdown = Copy_OffsetTicks;
+				Global_Tasks[Copy_Priority].Deadline = Copy_DeadlineTicks;
+
+				/* Clear task statistics */
+				Global_Tasks[Copy_Priority].Releases = 0;
+				Global_Tasks[Copy_Priority].DeadlineMisses = 0;
+				Global_Tasks[Copy_Priority].LastExecutionTime = 0;
+				Global_Tasks[Copy_Priority].MaxExecutionTime = 0;
+				Global_Tasks[Copy_Priority].BusyTime = 0;
+				Global_Tasks[Copy_Priority].CpuLoad = 0;
+
+				/* Task is created */
+				Global_Tasks[Copy_Priority].State = SCH_TASK_CREATED;
+			}
+			else
+			{
+				/* Priority is used by another task */
+				Local_Status = BUSY_FUNC;
+			}
+
+			/* Leave critical section */
+			SCH_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: DeleteTask                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Priority                                          */
+/*				   Brief: Priority (id) of task to be deleted                     */
+/*				   Range: (0 --> SCH_MAX_TASKS - 1)                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Deletes a task and drops its pending release (if any)          */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t SCH_DeleteTask(uint8_t Copy_Priority)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_PrimaskState;
+
+	/* Check if passed priority is valid or not */
+	if(Copy_Priority < SCH_MAX_TASKS)
+	{
+		/* Task table is shared with SysTick exception */
+		SCH_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+		/* Delete task and drop its pending release */
+		Global_Tasks[Copy_Priority].State = SCH_TASK_DELETED;
+		Global_ReadyTasks &= ~(1UL << Copy_Priority);
+
+		/* Leave critical section */
+		SCH_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ActivateTask                                                   */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Priority                                          */
+/*				   Brief: Priority (id) of task to be released                    */
+/*				   Range: (0 --> SCH_MAX_TASKS - 1)                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Releases a task (typically an event task) from thread or       */
+/*                 interrupt context. Returns BUSY_FUNC and counts a deadline     */
+/*                 miss if previous release of task has not started yet           */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t SCH_ActivateTask(uint8_t Copy_Priority)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_PrimaskState;
+
+	/* Check if passed priority is valid or not */
+	if(Copy_Priority < SCH_MAX_TASKS)
+	{
+		/* Task table is shared with SysTick exception */
+		SCH_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+		/* Check if task is created or not */
+		if(Global_Tasks[Copy_Priority].State == SCH_TASK_CREATED)
+		{
+			/* Release task then pend dispatcher */
+			Local_Status = SCH_ReleaseTask(Copy_Priority);
+			SCB_SetPendSVPendingFlag();
+		}
+		else
+		{
+			/* Task is not created */
+			Local_Status = RT_NOK;
+		}
+
+		/* Leave critical section */
+		SCH_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+	}
+	else
+	{
+		/* Function is not behaving as expected */
+		Local_Status = RT_NOK;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: Start                                                          */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Sets PendSV (dispatcher) to lowest priority then starts        */
+/*                 SysTick free-running time base with SCH_TICK_PERIOD ticks per  */
+/*                 scheduler tick. Tasks then run from PendSV exception so thread */
+/*                 mode only has to idle (e.g. WFI)                               */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t SCH_Start(void)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Dispatcher must not preempt any interrupt (tick included) */
+	SCB_SetPendSVPriority(SCB_LOWEST_PRIORITY);
+
+	/* Start free-running time base that drives scheduler ticks */
+	Local_Status = STK_StartTickTimer(SCH_TICK_PERIOD , SCH_TickHandler);
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetTaskStatistics                                              */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Priority                                          */
+/*				   Brief: Priority (id) of task                                   */
+/*				   Range: (0 --> SCH_MAX_TASKS - 1)                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : SCH_TaskStatistics_t* Copy_pStatistics                         */
+/*				   Brief: Pointer to structure that will hold task statistics     */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets number of releases, deadline misses, last and worst       */
+/*                 execution times (in SysTick ticks) and CPU load of last        */
+/*                 measurement window of a task                                   */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t SCH_GetTaskStatistics(uint8_t Copy_Priority , SCH_TaskStatistics_t* Copy_pStatistics)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_PrimaskState;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pStatistics != NULL)
+	{
+		/* Check if passed priority is valid or not */
+		if(Copy_Priority < SCH_MAX_TASKS)
+		{
+			/* Take a consistent snapshot of task statistics */
+			SCH_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+			Copy_pStatistics->releases = Global_Tasks[Copy_Priority].Releases;
+			Copy_pStatistics->deadlineMisses = Global_Tasks[Copy_Priority].DeadlineMisses;
+			Copy_pStatistics->lastExecutionTime = Global_Tasks[Copy_Priority].LastExecutionTime;
+			Copy_pStatistics->maxExecutionTime = Global_Tasks[Copy_Priority].MaxExecutionTime;
+			Copy_pStatistics->cpuLoad = Global_Tasks[Copy_Priority].CpuLoad;
+			SCH_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+		}
+		else
+		{
+			/* Function is not behaving as expected */
+			Local_Status = RT_NOK;
+		}
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: GetCpuLoad                                                     */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : uint16_t* Copy_pCpuLoad                                        */
+/*				   Brief: Pointer to variable that will hold CPU load of all      */
+/*				          tasks during last measurement window in per mille       */
+/*				   Range: None                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Gets total CPU load of all tasks measured over last            */
+/*                 SCH_LOAD_WINDOW scheduler ticks                                */
+/*--------------------------------------------------------------------------------*/
+ERROR_STATUS_t SCH_GetCpuLoad(uint16_t* Copy_pCpuLoad)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if passed pointer is NULL or not */
+	if(Copy_pCpuLoad != NULL)
+	{
+		/* Return total CPU load of last window */
+		*Copy_pCpuLoad = Global_CpuLoad;
+	}
+	else
+	{
+		/* Passed pointer is NULL pointer */
+		Local_Status = NULL_POINTER;
+	}
+
+	return Local_Status;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: TickHandler                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : void                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Called from SysTick exception on every scheduler tick.         */
+/*                 Releases due periodic tasks, closes CPU load measurement       */
+/*                 window and pends dispatcher if any task is ready               */
+/*--------------------------------------------------------------------------------*/
+static void SCH_TickHandler(void)
+{
+	/* Local Variables Definitions */
+	uint8_t Local_Iterator;
+	uint32_t Local_TotalBusyTime = 0;
+	uint32_t Local_PrimaskState;
+
+	/* Task table is also updated by dispatcher and other interrupts */
+	SCH_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+
+	/* Advance scheduler time */
+	Global_SchedulerTime++;
+
+	/* Release due periodic tasks */
+	for(Local_Iterator = 0 ; Local_Iterator < SCH_MAX_TASKS ; Local_Iterator++)
+	{
+		if(Global_Tasks[Local_Iterator].State == SCH_TASK_CREATED && Global_Tasks[Local_Iterator].Period != SCH_EVENT_TASK)
+		{
+			/* Count down to next release */
+			Global_Tasks[Local_Iterator].Countdown--;
+			if(Global_Tasks[Local_Iterator].Countdown == 0)
+			{
+				/* Reload countdown and release task */
+				Global_Tasks[Local_Iterator].Countdown = Global_Tasks[Local_Iterator].Period;
+				SCH_ReleaseTask(Local_Iterator);
+			}
+		}
+	}
+
+	/* Check if CPU load measurement window is over or not */
+	Global_LoadWindowTicks++;
+	if(Global_LoadWindowTicks >= SCH_LOAD_WINDOW)
+	{
+		/* Convert busy time of each task to per mille of window length */
+		for(Local_Iterator = 0 ; Local_Iterator < SCH_MAX_TASKS ; Local_Iterator++)
+		{
+			Global_Tasks[Local_Iterator].CpuLoad = (uint16_t)(((uint64_t)Global_Tasks[Local_Iterator].BusyTime * SCH_LOAD_SCALE) / ((uint64_t)SCH_LOAD_WINDOW * SCH_TICK_PERIOD));
+			Local_TotalBusyTime += Global_Tasks[Local_Iterator].BusyTime;
+			Global_Tasks[Local_Iterator].BusyTime = 0;
+		}
+
+		/* Get total CPU load then start new window */
+		Global_CpuLoad = (uint16_t)(((uint64_t)Local_TotalBusyTime * SCH_LOAD_SCALE) / ((uint64_t)SCH_LOAD_WINDOW * SCH_TICK_PERIOD));
+		Global_LoadWindowTicks = 0;
+	}
+
+	/* Pend dispatcher if any task is ready */
+	if(Global_ReadyTasks != 0)
+	{
+		SCB_SetPendSVPendingFlag();
+	}
+
+	/* Leave critical section */
+	SCH_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+}
+
+/*--------------------------------------------------------------------------------*/
+/* @Function Name: ReleaseTask                                                    */
+/*--------------------------------------------------------------------------------*/
+/* @Param(in)	 : uint8_t Copy_Priority                                          */
+/*				   Brief: Priority (id) of task to be released                    */
+/*				   Range: (0 --> SCH_MAX_TASKS - 1)                               */
+/*--------------------------------------------------------------------------------*/
+/* @Param(inout) : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Param(out)	 : None                                                           */
+/*--------------------------------------------------------------------------------*/
+/* @Return		 : ERROR_STATUS_t                                                 */
+/*--------------------------------------------------------------------------------*/
+/* @Description	 : Marks task as ready (must be called with interrupts masked).   */
+/*                 Returns BUSY_FUNC and counts a deadline miss if previous       */
+/*                 release has not started yet                                    */
+/*--------------------------------------------------------------------------------*/
+static ERROR_STATUS_t SCH_ReleaseTask(uint8_t Copy_Priority)
+{
+	/* Local Variables Definitions */
+	ERROR_STATUS_t Local_Status = RT_OK;
+
+	/* Check if previous release has started or not */
+	if(GET_BIT(Global_ReadyTasks,Copy_Priority) == 0)
+	{
+		/* Mark task as ready and record its release time */
+		Global_ReadyTasks |= (1UL << Copy_Priority);
+		Global_Tasks[Copy_Priority].ReleaseTime = Global_SchedulerTime;
+		Global_Tasks[Copy_Priority].Releases++;
+	}
+	else
+	{
+		/* Task overran its period, release is dropped */
+		Global_Tasks[Copy_Priority].DeadlineMisses++;
+		Local_Status = BUSY_FUNC;
+	}
+
+	return Local_Status;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 INTERRUPT HANDLERS                                */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Dispatcher: runs ready tasks to completion in priority order at lowest exception priority */
+void PendSV_Handler(void)
+{
+	/* Local Variables Definitions */
+	uint32_t Local_PrimaskState;
+	uint8_t Local_Priority;
+	uint64_t Local_StartTime;
+	uint64_t Local_EndTime;
+	uint32_t Local_ExecutionTime;
+	void(*Local_TaskFunc)(void);
+
+	/* Keep running tasks until no task is ready */
+	while(Global_ReadyTasks != 0)
+	{
+		/* Take highest priority ready task */
+		SCH_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+		for(Local_Priority = 0 ; GET_BIT(Global_ReadyTasks,Local_Priority) == 0 ; Local_Priority++);
+		Global_ReadyTasks &= ~(1UL << Local_Priority);
+		Local_TaskFunc = Global_Tasks[Local_Priority].TaskFunc;
+		SCH_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+
+		/* Run task to completion and measure its execution time */
+		STK_GetTimestamp(&Local_StartTime);
+		Local_TaskFunc();
+		STK_GetTimestamp(&Local_EndTime);
+		Local_ExecutionTime = (uint32_t)(Local_EndTime - Local_StartTime);
+
+		/* Update task statistics */
+		SCH_ENTER_CRITICAL_SECTION(Local_PrimaskState);
+		Global_Tasks[Local_Priority].LastExecutionTime = Local_ExecutionTime;
+		if(Local_ExecutionTime > Global_Tasks[Local_Priority].MaxExecutionTime)
+		{
+			Global_Tasks[Local_Priority].MaxExecutionTime = Local_ExecutionTime;
+		}
+		Global_Tasks[Local_Priority].BusyTime += Local_ExecutionTime;
+
+		/* Check if task completed after its deadline or not */
+		if(Global_Tasks[Local_Priority].Deadline != SCH_NO_DEADLINE && (Global_SchedulerTime - Global_Tasks[Local_Priority].ReleaseTime) > Global_Tasks[Local_Priority].Deadline)
+		{
+			Global_Tasks[Local_Priority].DeadlineMisses++;
+		}
+		SCH_EXIT_CRITICAL_SECTION(Local_PrimaskState);
+	}
+}
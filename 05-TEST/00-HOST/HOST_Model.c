@@ -0,0 +1,806 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : Host Register Model Program  */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <ucontext.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include "HOST_Model.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Host Page Granularity of Traps */
+#define HOST_PAGE_SIZE					0x1000U
+
+/* Trap Flag of x86 EFLAGS (single step) and Write Bit of Page Fault Error Code */
+#define HOST_EFLAGS_TRAP				0x100U
+#define HOST_FAULT_WRITE				0x2U
+
+/* Register Access */
+#define HOST_REGISTER(Address)			(*(volatile uint32_t*)(unsigned long)(Address))
+#define HOST_HALFWORD(Address)			(*(volatile uint16_t*)(unsigned long)(Address))
+
+/* FPEC Registers and Bits */
+#define HOST_FPEC_BASE					0x40022000U
+#define HOST_FPEC_KEYR					(HOST_FPEC_BASE + 0x04U)
+#define HOST_FPEC_SR					(HOST_FPEC_BASE + 0x0CU)
+#define HOST_FPEC_CR					(HOST_FPEC_BASE + 0x10U)
+#define HOST_FPEC_AR					(HOST_FPEC_BASE + 0x14U)
+#define HOST_FPEC_WRPR					(HOST_FPEC_BASE + 0x20U)
+#define HOST_FPEC_KEY1					0x45670123U
+#define HOST_FPEC_KEY2					0xCDEF89ABU
+#define HOST_CR_PG						(1U << 0)
+#define HOST_CR_PER						(1U << 1)
+#define HOST_CR_MER						(1U << 2)
+#define HOST_CR_STRT					(1U << 6)
+#define HOST_CR_LOCK					(1U << 7)
+#define HOST_CR_ERRIE					(1U << 10)
+#define HOST_CR_EOPIE					(1U << 12)
+#define HOST_SR_PGERR					(1U << 2)
+#define HOST_SR_WRPRTERR				(1U << 4)
+#define HOST_SR_EOP						(1U << 5)
+#define HOST_SR_W1C_MASK				(HOST_SR_PGERR | HOST_SR_WRPRTERR | HOST_SR_EOP)
+#define HOST_ERASED_HALFWORD			0xFFFFU
+#define HOST_WRPR_PAGES					4U				/* Pages protected by one WRPR bit */
+#define HOST_WRPR_NONE					0xFFFFFFFFU		/* Write protection option bytes not programmed */
+
+/* DMA Registers and Bits */
+#define HOST_DMA_BASE					0x40020000U
+#define HOST_DMA_ISR					(HOST_DMA_BASE + 0x00U)
+#define HOST_DMA_IFCR					(HOST_DMA_BASE + 0x04U)
+#define HOST_DMA_CHANNEL(Channel)		(HOST_DMA_BASE + 0x08U + ((Channel) * 0x14U))
+#define HOST_DMA_CHANNELS				7U
+#define HOST_DMA_CHANNEL_STRIDE			0x14U
+#define HOST_DMA_CCR_EN					(1U << 0)
+#define HOST_DMA_CCR_DIR				(1U << 4)
+#define HOST_DMA_CCR_PINC				(1U << 6)
+#define HOST_DMA_CCR_MINC				(1U << 7)
+#define HOST_DMA_CCR_MEM2MEM			(1U << 14)
+#define HOST_DMA_PSIZE(CCR)				(1U << (((CCR) >> 8) & 0x3U))
+#define HOST_DMA_MSIZE(CCR)				(1U << (((CCR) >> 10) & 0x3U))
+#define HOST_DMA_FLAGS_MASK				0xFU
+#define HOST_DMA_GIF_TC_HT				0x7U
+
+/* GPIO Ports */
+#define HOST_GPIO_BASE					0x40010800U
+#define HOST_GPIO_STRIDE				0x400U
+#define HOST_GPIO_ODR					0x0CU
+#define HOST_GPIO_BSRR					0x10U
+#define HOST_GPIO_BRR					0x14U
+
+/* DWT Cycle Counter */
+#define HOST_DWT_CTRL					0xE0001000U
+#define HOST_DWT_CYCCNT					0xE0001004U
+#define HOST_DWT_CYCCNTENA				(1U << 0)
+#define HOST_DEFAULT_CYCLES_PER_READ	8U
+
+/* NVIC Set/Clear Register Pairs and SCB Interrupt Control and State Register */
+#define HOST_NVIC_ISER					0xE000E100U
+#define HOST_NVIC_ICER					0xE000E180U
+#define HOST_NVIC_ISPR					0xE000E200U
+#define HOST_NVIC_ICPR					0xE000E280U
+#define HOST_NVIC_PAIR_OFFSET			0x80U
+#define HOST_NVIC_REGISTERS				3U
+#define HOST_SCB_ICSR					0xE000ED04U
+#define HOST_ICSR_PENDSTCLR				(1U << 25)
+#define HOST_ICSR_PENDSTSET				(1U << 26)
+#define HOST_ICSR_PENDSVCLR				(1U << 27)
+#define HOST_ICSR_PENDSVSET				(1U << 28)
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 PRIVATE DATA TYPES                                */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Trapped Region of Target Memory */
+typedef struct
+{
+	uint32_t Base;										/* First address (page aligned) */
+	uint32_t Size;										/* Size in bytes (pages) */
+	uint32_t Device;									/* HOST_DEVICE_xxx owning region */
+	int Protection;										/* Host protection while modelled */
+	void(*BeforeAccess)(uint32_t Copy_Address , uint8_t Copy_IsWrite);	/* Called before access is executed */
+	void(*AfterStore)(uint32_t Copy_Address , uint32_t Copy_OldWord);	/* Called after store is executed */
+}HOST_Region_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            PRIVATE FUNCTIONS PROTOTYPES                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void HOST_DmaStore(uint32_t Copy_Address , uint32_t Copy_OldWord);
+static void HOST_FpecStore(uint32_t Copy_Address , uint32_t Copy_OldWord);
+static void HOST_FlashBeforeStore(uint32_t Copy_Address , uint8_t Copy_IsWrite);
+static void HOST_FlashStore(uint32_t Copy_Address , uint32_t Copy_OldWord);
+static void HOST_GpioStore(uint32_t Copy_Address , uint32_t Copy_OldWord);
+static void HOST_DwtAccess(uint32_t Copy_Address , uint8_t Copy_IsWrite);
+static void HOST_NvicStore(uint32_t Copy_Address , uint32_t Copy_OldWord);
+static void HOST_ApplyProtection(uint32_t Copy_DeviceMask);
+static uint8_t HOST_CountFlashOperation(void);
+static uint8_t HOST_IsWriteProtected(uint32_t Copy_Address);
+static void HOST_PowerCut(void);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Trapped regions (DWT traps reads too, its counter moves as it is polled, NVIC page holds SysTick and SCB as well) */
+static const HOST_Region_t Global_Regions[] =
+{
+	{HOST_DMA_BASE   , HOST_PAGE_SIZE      , HOST_DEVICE_DMA   , PROT_READ , NULL                  , HOST_DmaStore  },
+	{HOST_FPEC_BASE  , HOST_PAGE_SIZE      , HOST_DEVICE_FLASH , PROT_READ , NULL                  , HOST_FpecStore },
+	{HOST_FLASH_BASE , HOST_FLASH_SIZE     , HOST_DEVICE_FLASH , PROT_READ , HOST_FlashBeforeStore , HOST_FlashStore},
+	{0x40010000U     , 2U * HOST_PAGE_SIZE , HOST_DEVICE_GPIO  , PROT_READ , NULL                  , HOST_GpioStore },
+	{0xE0001000U     , HOST_PAGE_SIZE      , HOST_DEVICE_DWT   , PROT_NONE , HOST_DwtAccess        , NULL           },
+	{0xE000E000U     , HOST_PAGE_SIZE      , HOST_DEVICE_NVIC  , PROT_READ , NULL                  , HOST_NvicStore },
+};
+#define HOST_REGIONS_NUMBER				(sizeof(Global_Regions) / sizeof(Global_Regions[0]))
+
+volatile HOST_Counters_t* HOST_pCounters = NULL;		/* Counters in memory shared with boot processes */
+volatile uint32_t HOST_Primask = 0;						/* PRIMASK set by modules inline assembly (see HOST_Port.h) */
+volatile uint32_t HOST_MainStackPointer = 0;				/* MSP loaded by modules inline assembly (see HOST_Port.h) */
+static uint32_t Global_ModelledDevices = 0;				/* Devices whose regions are trapped */
+static uint8_t Global_KeySequence = 0;					/* Number of FPEC keys written in order */
+static const HOST_Region_t* Global_pPendingRegion;		/* Region of access being single stepped */
+static uint32_t Global_PendingAddress;					/* Address of access being single stepped */
+static uint32_t Global_PendingOldWord;					/* Word at access address before the store */
+static void(*Global_GpioObserver)(uint8_t Copy_Port , uint32_t Copy_OldValue , uint32_t Copy_NewValue) = NULL;
+static void(*Global_WaitForInterruptHook)(void) = NULL;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 TRAP HANDLERS                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* First half of a trapped access: open all regions (side effects may touch other devices) then single step the access */
+static void HOST_FaultHandler(int Copy_Signal , siginfo_t* Copy_pInfo , void* Copy_pContext)
+{
+	ucontext_t* Local_pContext = (ucontext_t*)Copy_pContext;
+	unsigned long Local_Address = (unsigned long)Copy_pInfo->si_addr;
+	uint8_t Local_IsWrite = (Local_pContext->uc_mcontext.gregs[REG_ERR] & HOST_FAULT_WRITE) ? 1 : 0;
+	uint32_t Local_Index;
+
+	(void)Copy_Signal;
+
+	/* Find modelled region of the access */
+	Global_pPendingRegion = NULL;
+	for(Local_Index = 0 ; Local_Index < HOST_REGIONS_NUMBER ; Local_Index++)
+	{
+		if(((Global_Regions[Local_Index].Device & Global_ModelledDevices) != 0) &&
+		   (Local_Address >= Global_Regions[Local_Index].Base) &&
+		   (Local_Address < ((unsigned long)Global_Regions[Local_Index].Base + Global_Regions[Local_Index].Size)))
+		{
+			Global_pPendingRegion = &Global_Regions[Local_Index];
+		}
+	}
+
+	/* Access outside modelled regions is a real crash of the test */
+	if(Global_pPendingRegion == NULL)
+	{
+		signal(SIGSEGV , SIG_DFL);
+		return;
+	}
+
+	/* Let access through and remember what it changes */
+	HOST_ApplyProtection(0);
+	Global_PendingAddress = (uint32_t)Local_Address;
+	Global_PendingOldWord = HOST_REGISTER(Local_Address & ~0x3UL);
+
+	/* Run device action needed before the access (e.g. counter update, power cut) */
+	if(Global_pPendingRegion->BeforeAccess != NULL)
+	{
+		Global_pPendingRegion->BeforeAccess(Global_PendingAddress , Local_IsWrite);
+	}
+
+	/* Execute faulting instruction alone */
+	Local_pContext->uc_mcontext.gregs[REG_EFL] |= HOST_EFLAGS_TRAP;
+}
+
+/* Second half of a trapped access: apply side effect of the store then close regions again */
+static void HOST_StepHandler(int Copy_Signal , siginfo_t* Copy_pInfo , void* Copy_pContext)
+{
+	ucontext_t* Local_pContext = (ucontext_t*)Copy_pContext;
+
+	(void)Copy_Signal;
+	(void)Copy_pInfo;
+
+	/* Stop single stepping */
+	Local_pContext->uc_mcontext.gregs[REG_EFL] &= ~HOST_EFLAGS_TRAP;
+
+	/* Apply store side effect of the device */
+	if((Global_pPendingRegion != NULL) && (Global_pPendingRegion->AfterStore != NULL))
+	{
+		Global_pPendingRegion->AfterStore(Global_PendingAddress , Global_PendingOldWord);
+	}
+
+	/* Trap next accesses */
+	HOST_ApplyProtection(Global_ModelledDevices);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+void HOST_ModelInit(uint32_t Copy_DeviceMask)
+{
+	struct sigaction Local_Action;
+	void* Local_pCounters;
+
+	/* Map target memory at its real addresses (flash is shared so that it survives simulated boots) */
+	if((mmap((void*)(unsigned long)HOST_FLASH_BASE , HOST_FLASH_SIZE , PROT_READ | PROT_WRITE ,
+			 MAP_FIXED_NOREPLACE | MAP_SHARED | MAP_ANONYMOUS , -1 , 0) == MAP_FAILED) ||
+	   (mmap((void*)(unsigned long)HOST_SYSTEM_MEMORY_BASE , HOST_SYSTEM_MEMORY_SIZE , PROT_READ | PROT_WRITE ,
+			 MAP_FIXED_NOREPLACE | MAP_PRIVATE | MAP_ANONYMOUS , -1 , 0) == MAP_FAILED) ||
+	   (mmap((void*)(unsigned long)HOST_SRAM_BASE , HOST_SRAM_SIZE , PROT_READ | PROT_WRITE ,
+			 MAP_FIXED_NOREPLACE | MAP_PRIVATE | MAP_ANONYMOUS , -1 , 0) == MAP_FAILED) ||
+	   (mmap((void*)(unsigned long)HOST_PERIPHERALS_BASE , HOST_PERIPHERALS_SIZE , PROT_READ | PROT_WRITE ,
+			 MAP_FIXED_NOREPLACE | MAP_PRIVATE | MAP_ANONYMOUS , -1 , 0) == MAP_FAILED) ||
+	   (mmap((void*)(unsigned long)HOST_CORE_BASE , HOST_CORE_SIZE , PROT_READ | PROT_WRITE ,
+			 MAP_FIXED_NOREPLACE | MAP_PRIVATE | MAP_ANONYMOUS , -1 , 0) == MAP_FAILED))
+	{
+		perror("HOST_ModelInit: target memory map");
+		exit(EXIT_FAILURE);
+	}
+
+	/* Counters are shared with boot processes */
+	Local_pCounters = mmap(NULL , sizeof(HOST_Counters_t) , PROT_READ | PROT_WRITE , MAP_SHARED | MAP_ANONYMOUS , -1 , 0);
+	if(Local_pCounters == MAP_FAILED)
+	{
+		perror("HOST_ModelInit: counters");
+		exit(EXIT_FAILURE);
+	}
+	HOST_pCounters = (volatile HOST_Counters_t*)Local_pCounters;
+	HOST_pCounters->PowerCutCountdown = HOST_POWER_CUT_NEVER;
+	HOST_pCounters->CyclesPerRead = HOST_DEFAULT_CYCLES_PER_READ;
+
+	/* Flash and option bytes leave the factory erased */
+	memset((void*)(unsigned long)HOST_FLASH_BASE , 0xFF , HOST_FLASH_SIZE);
+	memset((void*)(unsigned long)HOST_SYSTEM_MEMORY_BASE , 0xFF , HOST_SYSTEM_MEMORY_SIZE);
+
+	/* Install trap handlers */
+	memset(&Local_Action , 0 , sizeof(Local_Action));
+	Local_Action.sa_flags = SA_SIGINFO;
+	Local_Action.sa_sigaction = HOST_FaultHandler;
+	sigaction(SIGSEGV , &Local_Action , NULL);
+	Local_Action.sa_sigaction = HOST_StepHandler;
+	sigaction(SIGTRAP , &Local_Action , NULL);
+
+	/* Registers at reset values then trap modelled devices */
+	HOST_ResetPeripherals();
+	HOST_SetModelledDevices(Copy_DeviceMask);
+}
+
+void HOST_SetModelledDevices(uint32_t Copy_DeviceMask)
+{
+	Global_ModelledDevices = Copy_DeviceMask;
+	HOST_ApplyProtection(Global_ModelledDevices);
+}
+
+void HOST_ResetPeripherals(void)
+{
+	HOST_ApplyProtection(0);
+
+	/* Peripherals and core registers reset to zero except FPEC lock (dropped pages read as zero, no copy on a boot) */
+	madvise((void*)(unsigned long)HOST_PERIPHERALS_BASE , HOST_PERIPHERALS_SIZE , MADV_DONTNEED);
+	madvise((void*)(unsigned long)HOST_CORE_BASE , HOST_CORE_SIZE , MADV_DONTNEED);
+	HOST_REGISTER(HOST_FPEC_CR) = HOST_CR_LOCK;
+	HOST_REGISTER(HOST_FPEC_WRPR) = HOST_WRPR_NONE;
+	Global_KeySequence = 0;
+	HOST_Primask = 0;
+	HOST_MainStackPointer = 0;
+
+	HOST_ApplyProtection(Global_ModelledDevices);
+}
+
+void HOST_FlashFill(uint32_t Copy_Address , const void* Copy_pData , uint32_t Copy_Size)
+{
+	HOST_ApplyProtection(0);
+	memcpy((void*)(unsigned long)Copy_Address , Copy_pData , Copy_Size);
+	HOST_ApplyProtection(Global_ModelledDevices);
+}
+
+void HOST_FlashErase(uint32_t Copy_Address , uint32_t Copy_Size)
+{
+	HOST_ApplyProtection(0);
+	memset((void*)(unsigned long)Copy_Address , 0xFF , Copy_Size);
+	HOST_ApplyProtection(Global_ModelledDevices);
+}
+
+void HOST_FlashWriteProtect(uint32_t Copy_Address , uint32_t Copy_Size)
+{
+	uint32_t Local_Page;
+
+	HOST_ApplyProtection(0);
+	for(Local_Page = Copy_Address & ~(HOST_FLASH_PAGE_SIZE - 1U) ; Local_Page < (Copy_Address + Copy_Size) ; Local_Page += HOST_FLASH_PAGE_SIZE)
+	{
+		HOST_REGISTER(HOST_FPEC_WRPR) &= ~(1U << ((Local_Page - HOST_FLASH_BASE) / (HOST_FLASH_PAGE_SIZE * HOST_WRPR_PAGES)));
+	}
+	HOST_ApplyProtection(Global_ModelledDevices);
+}
+
+void HOST_PowerCutAfter(uint32_t Copy_Operations)
+{
+	HOST_pCounters->PowerCutCountdown = Copy_Operations;
+}
+
+uint8_t HOST_Boot(void(*Copy_BootFunc)(void))
+{
+	uint8_t Local_Result = HOST_BOOT_CRASHED;
+	int Local_Status;
+	pid_t Local_Process;
+
+	/* Keep buffered output of parent out of the child */
+	fflush(stdout);
+
+	Local_Process = fork();
+	if(Local_Process == 0)
+	{
+		/* Fresh boot: RAM as left by parent (never ran modules), registers at reset values */
+		HOST_ResetPeripherals();
+		Copy_BootFunc();
+		fflush(stdout);
+		_exit(HOST_BOOT_COMPLETED);
+	}
+	else if(Local_Process > 0)
+	{
+		/* Wait for boot to end, power cut ends it with its own status */
+		waitpid(Local_Process , &Local_Status , 0);
+		if(WIFEXITED(Local_Status) &&
+		   ((WEXITSTATUS(Local_Status) == HOST_BOOT_COMPLETED) || (WEXITSTATUS(Local_Status) == HOST_BOOT_POWER_CUT)))
+		{
+			Local_Result = (uint8_t)WEXITSTATUS(Local_Status);
+		}
+	}
+	else
+	{
+		perror("HOST_Boot: fork");
+	}
+
+	/* Power cut is a one shot event */
+	HOST_pCounters->PowerCutCountdown = HOST_POWER_CUT_NEVER;
+
+	return Local_Result;
+}
+
+uint8_t HOST_FlashIrqPending(void)
+{
+	uint32_t Local_SR = HOST_REGISTER(HOST_FPEC_SR);
+	uint32_t Local_CR = HOST_REGISTER(HOST_FPEC_CR);
+
+	return ((((Local_SR & HOST_SR_EOP) != 0) && ((Local_CR & HOST_CR_EOPIE) != 0)) ||
+			(((Local_SR & (HOST_SR_PGERR | HOST_SR_WRPRTERR)) != 0) && ((Local_CR & HOST_CR_ERRIE) != 0))) ? 1 : 0;
+}
+
+void HOST_DmaRaiseFlags(uint8_t Copy_ChannelId , uint32_t Copy_Flags)
+{
+	HOST_ApplyProtection(0);
+	HOST_REGISTER(HOST_DMA_ISR) |= ((Copy_Flags | 1U) & HOST_DMA_FLAGS_MASK) << (Copy_ChannelId * 4U);
+	HOST_ApplyProtection(Global_ModelledDevices);
+}
+
+void HOST_SetGpioObserver(void(*Copy_Observer)(uint8_t Copy_Port , uint32_t Copy_OldValue , uint32_t Copy_NewValue))
+{
+	Global_GpioObserver = Copy_Observer;
+}
+
+void HOST_SetWaitForInterruptHook(void(*Copy_Hook)(void))
+{
+	Global_WaitForInterruptHook = Copy_Hook;
+}
+
+void HOST_WaitForInterrupt(void)
+{
+	/* Without a hook an interrupt is taken as already pending */
+	if(Global_WaitForInterruptHook != NULL)
+	{
+		Global_WaitForInterruptHook();
+	}
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  DEVICE MODELS                                    */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* DMA: IFCR clears ISR flags (CGIF clears whole channel nibble), enabling a MEM2MEM channel runs its transfer at once */
+static void HOST_DmaStore(uint32_t Copy_Address , uint32_t Copy_OldWord)
+{
+	uint32_t Local_Address = Copy_Address & ~0x3U;
+	uint32_t Local_Value = HOST_REGISTER(Local_Address);
+	uint32_t Local_Clear = 0;
+	uint32_t Local_Channel;
+	uint32_t Local_ChannelBase;
+	uint32_t Local_CCR;
+	uint32_t Local_Items;
+	uint32_t Local_Source;
+	uint32_t Local_Destination;
+	uint32_t Local_Item;
+
+	/* Count register traffic (channel registers one by one) */
+	HOST_pCounters->DmaStores++;
+	if((Local_Address >= HOST_DMA_CHANNEL(0)) && (Local_Address < HOST_DMA_CHANNEL(HOST_DMA_CHANNELS)))
+	{
+		HOST_pCounters->DmaChannelStores[((Local_Address - HOST_DMA_CHANNEL(0)) % HOST_DMA_CHANNEL_STRIDE) / 4U]++;
+	}
+
+	if(Local_Address == HOST_DMA_ISR)
+	{
+		/* Read only */
+		HOST_REGISTER(HOST_DMA_ISR) = Copy_OldWord;
+	}
+	else if(Local_Address == HOST_DMA_IFCR)
+	{
+		/* Build mask of cleared flags */
+		for(Local_Channel = 0 ; Local_Channel < HOST_DMA_CHANNELS ; Local_Channel++)
+		{
+			if(((Local_Value >> (Local_Channel * 4U)) & 1U) != 0)
+			{
+				Local_Clear |= HOST_DMA_FLAGS_MASK << (Local_Channel * 4U);
+			}
+		}
+		Local_Clear |= Local_Value;
+		HOST_REGISTER(HOST_DMA_ISR) &= ~Local_Clear;
+
+		/* Write only */
+		HOST_REGISTER(HOST_DMA_IFCR) = 0;
+	}
+	else if((Local_Address >= HOST_DMA_CHANNEL(0)) && (Local_Address < HOST_DMA_CHANNEL(HOST_DMA_CHANNELS)) &&
+			(((Local_Address - HOST_DMA_CHANNEL(0)) % HOST_DMA_CHANNEL_STRIDE) == 0))
+	{
+		Local_Channel = (Local_Address - HOST_DMA_CHANNEL(0)) / HOST_DMA_CHANNEL_STRIDE;
+		Local_ChannelBase = HOST_DMA_CHANNEL(Local_Channel);
+		Local_CCR = Local_Value;
+
+		/* Memory to memory transfer starts when channel gets enabled */
+		if(((Copy_OldWord & HOST_DMA_CCR_EN) == 0) && ((Local_CCR & HOST_DMA_CCR_EN) != 0) && ((Local_CCR & HOST_DMA_CCR_MEM2MEM) != 0))
+		{
+			Local_Items = HOST_REGISTER(Local_ChannelBase + 0x04U) & 0xFFFFU;
+			Local_Source = HOST_REGISTER(Local_ChannelBase + 0x08U);
+			Local_Destination = HOST_REGISTER(Local_ChannelBase + 0x0CU);
+
+			/* DIR set reads memory side (CMAR) and writes peripheral side (CPAR) */
+			for(Local_Item = 0 ; Local_Item < Local_Items ; Local_Item++)
+			{
+				uint32_t Local_PeripheralAddress = Local_Source + (((Local_CCR & HOST_DMA_CCR_PINC) != 0) ? (Local_Item * HOST_DMA_PSIZE(Local_CCR)) : 0);
+				uint32_t Local_MemoryAddress = Local_Destination + (((Local_CCR & HOST_DMA_CCR_MINC) != 0) ? (Local_Item * HOST_DMA_MSIZE(Local_CCR)) : 0);
+				uint32_t Local_Data;
+
+				if((Local_CCR & HOST_DMA_CCR_DIR) == 0)
+				{
+					memcpy(&Local_Data , (void*)(unsigned long)Local_PeripheralAddress , 4);
+					memcpy((void*)(unsigned long)Local_MemoryAddress , &Local_Data , HOST_DMA_MSIZE(Local_CCR));
+				}
+				else
+				{
+					memcpy(&Local_Data , (void*)(unsigned long)Local_MemoryAddress , 4);
+					memcpy((void*)(unsigned long)Local_PeripheralAddress , &Local_Data , HOST_DMA_PSIZE(Local_CCR));
+				}
+			}
+
+			/* Transfer done: counter reaches zero, global, complete and half flags are raised */
+			HOST_REGISTER(Local_ChannelBase + 0x04U) = 0;
+			HOST_REGISTER(HOST_DMA_ISR) |= HOST_DMA_GIF_TC_HT << (Local_Channel * 4U);
+			HOST_pCounters->DmaTransfers++;
+		}
+	}
+	else
+	{
+		/* Plain register */
+	}
+}
+
+/* FPEC: unlock sequence, W1C status flags, page/mass erase started by STRT */
+static void HOST_FpecStore(uint32_t Copy_Address , uint32_t Copy_OldWord)
+{
+	uint32_t Local_Address = Copy_Address & ~0x3U;
+	uint32_t Local_Value = HOST_REGISTER(Local_Address);
+	uint32_t Local_Page;
+
+	if(Local_Address == HOST_FPEC_KEYR)
+	{
+		/* Unlock needs KEY1 then KEY2, anything else restarts the sequence */
+		if((Global_KeySequence == 0) && (Local_Value == HOST_FPEC_KEY1))
+		{
+			Global_KeySequence = 1;
+		}
+		else if((Global_KeySequence == 1) && (Local_Value == HOST_FPEC_KEY2))
+		{
+			HOST_REGISTER(HOST_FPEC_CR) &= ~HOST_CR_LOCK;
+			Global_KeySequence = 0;
+		}
+		else
+		{
+			Global_KeySequence = 0;
+		}
+
+		/* Write only */
+		HOST_REGISTER(HOST_FPEC_KEYR) = 0;
+	}
+	else if(Local_Address == HOST_FPEC_SR)
+	{
+		/* Flags are cleared by writing one */
+		HOST_REGISTER(HOST_FPEC_SR) = Copy_OldWord & ~(Local_Value & HOST_SR_W1C_MASK);
+	}
+	else if(Local_Address == HOST_FPEC_CR)
+	{
+		/* Locked controller ignores writes */
+		if((Copy_OldWord & HOST_CR_LOCK) != 0)
+		{
+			HOST_REGISTER(HOST_FPEC_CR) = Copy_OldWord;
+		}
+		else if((Local_Value & HOST_CR_STRT) != 0)
+		{
+			/* Erase takes a flash operation, power cut in the middle leaves first half of the page erased */
+			if(HOST_CountFlashOperation() == 1)
+			{
+				Local_Page = HOST_REGISTER(HOST_FPEC_AR) & ~(HOST_FLASH_PAGE_SIZE - 1U);
+				if(((Local_Value & HOST_CR_PER) != 0) && (Local_Page >= HOST_FLASH_BASE) && (Local_Page < (HOST_FLASH_BASE + HOST_FLASH_SIZE)))
+				{
+					memset((void*)(unsigned long)Local_Page , 0xFF , HOST_FLASH_PAGE_SIZE / 2U);
+				}
+				HOST_PowerCut();
+			}
+
+			/* STRT clears itself when operation ends */
+			HOST_REGISTER(HOST_FPEC_CR) = Local_Value & ~HOST_CR_STRT;
+
+			if((Local_Value & HOST_CR_MER) != 0)
+			{
+				memset((void*)(unsigned long)HOST_FLASH_BASE , 0xFF , HOST_FLASH_SIZE);
+				HOST_pCounters->FlashErases += HOST_FLASH_SIZE / HOST_FLASH_PAGE_SIZE;
+				HOST_REGISTER(HOST_FPEC_SR) |= HOST_SR_EOP;
+			}
+			else if((Local_Value & HOST_CR_PER) != 0)
+			{
+				Local_Page = HOST_REGISTER(HOST_FPEC_AR) & ~(HOST_FLASH_PAGE_SIZE - 1U);
+				if(HOST_IsWriteProtected(Local_Page) == 1)
+				{
+					/* Protected page is left as it is, no end of operation */
+					HOST_REGISTER(HOST_FPEC_SR) |= HOST_SR_WRPRTERR;
+					HOST_pCounters->FlashErrors++;
+				}
+				else
+				{
+					if((Local_Page >= HOST_FLASH_BASE) && (Local_Page < (HOST_FLASH_BASE + HOST_FLASH_SIZE)))
+					{
+						memset((void*)(unsigned long)Local_Page , 0xFF , HOST_FLASH_PAGE_SIZE);
+						HOST_pCounters->FlashErases++;
+					}
+					HOST_REGISTER(HOST_FPEC_SR) |= HOST_SR_EOP;
+				}
+			}
+			else
+			{
+				/* Nothing selected */
+				HOST_REGISTER(HOST_FPEC_SR) |= HOST_SR_EOP;
+			}
+		}
+		else
+		{
+			/* Plain write */
+		}
+	}
+	else
+	{
+		/* Plain register */
+	}
+}
+
+/* Flash store: power may be cut before programming starts */
+static void HOST_FlashBeforeStore(uint32_t Copy_Address , uint8_t Copy_IsWrite)
+{
+	(void)Copy_Address;
+
+	if((Copy_IsWrite == 1) && (HOST_CountFlashOperation() == 1))
+	{
+		HOST_PowerCut();
+	}
+}
+
+/* Flash store: programs an erased halfword (or clears any halfword to 0x0000) when PG is set and FPEC is unlocked */
+static void HOST_FlashStore(uint32_t Copy_Address , uint32_t Copy_OldWord)
+{
+	uint32_t Local_Address = Copy_Address & ~0x1U;
+	uint16_t Local_OldValue = (uint16_t)(Copy_OldWord >> ((Local_Address & 0x2U) * 8U));
+	uint16_t Local_NewValue = HOST_HALFWORD(Local_Address);
+	uint32_t Local_CR = HOST_REGISTER(HOST_FPEC_CR);
+
+	if(HOST_IsWriteProtected(Local_Address) == 1)
+	{
+		/* Protected halfword keeps its content */
+		HOST_HALFWORD(Local_Address) = Local_OldValue;
+		HOST_REGISTER(HOST_FPEC_SR) |= HOST_SR_WRPRTERR;
+		HOST_pCounters->FlashErrors++;
+	}
+	else if(((Local_CR & HOST_CR_LOCK) != 0) || ((Local_CR & HOST_CR_PG) == 0) ||
+	   ((Local_OldValue != HOST_ERASED_HALFWORD) && (Local_NewValue != 0x0000U)))
+	{
+		/* Programming error, flash keeps its content */
+		HOST_HALFWORD(Local_Address) = Local_OldValue;
+		HOST_REGISTER(HOST_FPEC_SR) |= HOST_SR_PGERR;
+		HOST_pCounters->FlashErrors++;
+	}
+	else
+	{
+		/* Halfword programmed */
+		HOST_REGISTER(HOST_FPEC_SR) |= HOST_SR_EOP;
+		HOST_pCounters->FlashPrograms++;
+	}
+}
+
+/* GPIO: BSRR sets/resets (set wins), BRR resets, ODR is written, observer sees every change */
+static void HOST_GpioStore(uint32_t Copy_Address , uint32_t Copy_OldWord)
+{
+	uint32_t Local_Address = Copy_Address & ~0x3U;
+	uint32_t Local_Port;
+	uint32_t Local_Offset;
+	uint32_t Local_ODR;
+	uint32_t Local_OldODR;
+	uint32_t Local_Value;
+
+	if((Local_Address >= HOST_GPIO_BASE) && (Local_Address < (HOST_GPIO_BASE + (HOST_GPIO_PORTS * HOST_GPIO_STRIDE))))
+	{
+		Local_Port = (Local_Address - HOST_GPIO_BASE) / HOST_GPIO_STRIDE;
+		Local_Offset = (Local_Address - HOST_GPIO_BASE) % HOST_GPIO_STRIDE;
+		Local_ODR = HOST_GPIO_BASE + (Local_Port * HOST_GPIO_STRIDE) + HOST_GPIO_ODR;
+		Local_OldODR = HOST_REGISTER(Local_ODR);
+		Local_Value = HOST_REGISTER(Local_Address);
+
+		if(Local_Offset == HOST_GPIO_BSRR)
+		{
+			HOST_REGISTER(Local_ODR) = (Local_OldODR & ~(Local_Value >> 16)) | (Local_Value & 0xFFFFU);
+			HOST_REGISTER(Local_Address) = 0;
+		}
+		else if(Local_Offset == HOST_GPIO_BRR)
+		{
+			HOST_REGISTER(Local_ODR) = Local_OldODR & ~(Local_Value & 0xFFFFU);
+			HOST_REGISTER(Local_Address) = 0;
+		}
+		else if(Local_Offset == HOST_GPIO_ODR)
+		{
+			Local_OldODR = Copy_OldWord;
+		}
+		else
+		{
+			/* Configuration registers */
+			return;
+		}
+
+		/* Count bus store and report output change */
+		HOST_pCounters->GpioStores[Local_Port]++;
+		if(Global_GpioObserver != NULL)
+		{
+			Global_GpioObserver((uint8_t)Local_Port , Local_OldODR , HOST_REGISTER(Local_ODR));
+		}
+	}
+}
+
+/* DWT: enabled cycle counter moves forward every time it is read (time passes while it is polled) */
+static void HOST_DwtAccess(uint32_t Copy_Address , uint8_t Copy_IsWrite)
+{
+	if(((Copy_Address & ~0x3U) == HOST_DWT_CYCCNT) && (Copy_IsWrite == 0) &&
+	   ((HOST_REGISTER(HOST_DWT_CTRL) & HOST_DWT_CYCCNTENA) != 0))
+	{
+		HOST_REGISTER(HOST_DWT_CYCCNT) += HOST_pCounters->CyclesPerRead;
+	}
+}
+
+/* NVIC set/clear registers of a pair both read back the state, ICSR pending bits are set and cleared by their own bits */
+static void HOST_NvicStore(uint32_t Copy_Address , uint32_t Copy_OldWord)
+{
+	uint32_t Local_Address = Copy_Address & ~0x3U;
+	uint32_t Local_Stored = HOST_REGISTER(Local_Address);
+	uint32_t Local_State = Copy_OldWord;
+	uint32_t Local_SetAddress;
+
+	if(Local_Address == HOST_SCB_ICSR)
+	{
+		Local_State &= (HOST_ICSR_PENDSTSET | HOST_ICSR_PENDSVSET);
+		Local_State |= Local_Stored & (HOST_ICSR_PENDSTSET | HOST_ICSR_PENDSVSET);
+		Local_State &= ~((Local_Stored & HOST_ICSR_PENDSTCLR) ? HOST_ICSR_PENDSTSET : 0U);
+		Local_State &= ~((Local_Stored & HOST_ICSR_PENDSVCLR) ? HOST_ICSR_PENDSVSET : 0U);
+		HOST_REGISTER(HOST_SCB_ICSR) = Local_State;
+	}
+	else if((Local_Address >= HOST_NVIC_ISER) && (Local_Address < (HOST_NVIC_ICPR + (4U * HOST_NVIC_REGISTERS))) &&
+			(((Local_Address - HOST_NVIC_ISER) % HOST_NVIC_PAIR_OFFSET) < (4U * HOST_NVIC_REGISTERS)))
+	{
+		/* Set register of the pair is the one at lower offset (ISER/ICER, ISPR/ICPR) */
+		Local_SetAddress = (Local_Address < HOST_NVIC_ISPR) ? HOST_NVIC_ISER : HOST_NVIC_ISPR;
+		Local_SetAddress += (Local_Address - HOST_NVIC_ISER) % HOST_NVIC_PAIR_OFFSET;
+		if(Local_Address == Local_SetAddress)
+		{
+			Local_State |= Local_Stored;
+		}
+		else
+		{
+			Local_State &= ~Local_Stored;
+		}
+		HOST_REGISTER(Local_SetAddress) = Local_State;
+		HOST_REGISTER(Local_SetAddress + HOST_NVIC_PAIR_OFFSET) = Local_State;
+	}
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 PRIVATE FUNCTIONS                                 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Protects regions of passed devices and opens all others */
+static void HOST_ApplyProtection(uint32_t Copy_DeviceMask)
+{
+	uint32_t Local_Index;
+
+	for(Local_Index = 0 ; Local_Index < HOST_REGIONS_NUMBER ; Local_Index++)
+	{
+		mprotect((void*)(unsigned long)Global_Regions[Local_Index].Base , Global_Regions[Local_Index].Size ,
+				 ((Global_Regions[Local_Index].Device & Copy_DeviceMask) != 0) ? Global_Regions[Local_Index].Protection : (PROT_READ | PROT_WRITE));
+	}
+}
+
+/* Counts down to power cut, returns 1 if power is cut on this operation */
+static uint8_t HOST_CountFlashOperation(void)
+{
+	uint8_t Local_Cut = 0;
+
+	if(HOST_pCounters->PowerCutCountdown == 0)
+	{
+		Local_Cut = 1;
+	}
+	else if(HOST_pCounters->PowerCutCountdown != HOST_POWER_CUT_NEVER)
+	{
+		HOST_pCounters->PowerCutCountdown--;
+	}
+	else
+	{
+		/* Power cut disabled */
+	}
+
+	return Local_Cut;
+}
+
+/* Checks WRPR bit of the four pages group holding a flash address (bit cleared = protected) */
+static uint8_t HOST_IsWriteProtected(uint32_t Copy_Address)
+{
+	uint8_t Local_Protected = 0;
+
+	if((Copy_Address >= HOST_FLASH_BASE) && (Copy_Address < (HOST_FLASH_BASE + HOST_FLASH_SIZE)))
+	{
+		Local_Protected = ((HOST_REGISTER(HOST_FPEC_WRPR) & (1U << ((Copy_Address - HOST_FLASH_BASE) / (HOST_FLASH_PAGE_SIZE * HOST_WRPR_PAGES)))) == 0) ? 1 : 0;
+	}
+
+	return Local_Protected;
+}
+
+/* Ends the boot process the way a power loss does (RAM is lost, flash is kept) */
+static void HOST_PowerCut(void)
+{
+	fflush(stdout);
+	_exit(HOST_BOOT_POWER_CUT);
+}
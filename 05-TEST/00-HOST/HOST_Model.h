@@ -0,0 +1,128 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : Host Register Model Interface*/
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/* Register model of the target for host tests. The memory map of STM32F103 is       */
+/* mapped at its real addresses so that drivers run unmodified. Register pages of    */
+/* modelled devices are write protected: every store traps, is single stepped and    */
+/* its side effect is applied (W1C flags, BSRR to ODR, flash programming, ...).      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+#ifndef HOST_MODEL_H_
+#define HOST_MODEL_H_
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  INTERFACE MACROS                                 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Memory Map of Modelled Target */
+#define HOST_FLASH_BASE					0x08000000U
+#define HOST_FLASH_SIZE					0x00020000U		/* 128 pages of 1 KB (FPEC_PAGE_0 --> FPEC_PAGE_127) */
+#define HOST_FLASH_PAGE_SIZE			0x00000400U
+#define HOST_SYSTEM_MEMORY_BASE			0x1FFFF000U		/* Option bytes */
+#define HOST_SYSTEM_MEMORY_SIZE			0x00001000U
+#define HOST_SRAM_BASE					0x20000000U		/* DMA buffers must live below 4 GB */
+#define HOST_SRAM_SIZE					0x00010000U
+#define HOST_PERIPHERALS_BASE			0x40000000U
+#define HOST_PERIPHERALS_SIZE			0x00030000U
+#define HOST_CORE_BASE					0xE0000000U		/* DWT, SysTick, NVIC and SCB */
+#define HOST_CORE_SIZE					0x00100000U
+
+/* Devices Whose Register Side Effects Are Modelled */
+#define HOST_DEVICE_DMA					0x01U			/* ISR/IFCR flags, MEM2MEM transfers done at enable */
+#define HOST_DEVICE_FLASH				0x02U			/* FPEC unlock, program, page/mass erase, EOP/PGERR/WRPRTERR */
+#define HOST_DEVICE_GPIO				0x04U			/* BSRR/BRR/ODR stores of ports A --> E */
+#define HOST_DEVICE_DWT					0x08U			/* CYCCNT advances on every read */
+#define HOST_DEVICE_NVIC				0x10U			/* Enable/pending set-clear pairs, SysTick/PendSV pending bits */
+#define HOST_ALL_DEVICES				0x1FU
+
+/* DMA Channel Registers Counted Apart (index of HOST_Counters_t.DmaChannelStores) */
+#define HOST_DMA_CCR					0U
+#define HOST_DMA_CNDTR					1U
+#define HOST_DMA_CPAR					2U
+#define HOST_DMA_CMAR					3U
+#define HOST_DMA_CHANNEL_REGISTERS		4U
+
+/* GPIO Ports Seen by Observer */
+#define HOST_GPIO_PORTS					5U
+
+/* Result of a Simulated Boot */
+#define HOST_BOOT_COMPLETED				0U				/* Boot function returned */
+#define HOST_BOOT_POWER_CUT				254U			/* Power was cut on a flash operation */
+#define HOST_BOOT_CRASHED				255U			/* Boot process died */
+
+/* Power Cut Disabled */
+#define HOST_POWER_CUT_NEVER			0xFFFFFFFFU
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                           	     NEW DATA TYPES			               	         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Model Counters (shared between boots, survive a power cut) */
+typedef struct
+{
+	uint32_t FlashPrograms;				/* Programmed halfwords */
+	uint32_t FlashErases;				/* Erased pages (mass erase counts every page) */
+	uint32_t FlashErrors;				/* Programming errors raised (PGERR, WRPRTERR) */
+	uint32_t PowerCutCountdown;			/* Flash operations left before power is cut */
+	uint32_t GpioStores[HOST_GPIO_PORTS];	/* Stores to BSRR/BRR/ODR of each port */
+	uint32_t DmaStores;					/* Stores to DMA registers */
+	uint32_t DmaChannelStores[HOST_DMA_CHANNEL_REGISTERS];	/* Stores to CCR/CNDTR/CPAR/CMAR of any channel */
+	uint32_t DmaTransfers;				/* MEM2MEM transfers performed */
+	uint32_t CyclesPerRead;				/* Cycles added to CYCCNT on every read of it */
+}HOST_Counters_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                FUNCTIONS PROTOTYPES                               */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Counters of the model */
+extern volatile HOST_Counters_t* HOST_pCounters;
+
+/* Maps target memory (flash erased, registers at reset values) and models passed devices */
+void HOST_ModelInit(uint32_t Copy_DeviceMask);
+
+/* Selects modelled devices, others become plain memory (no trap cost, e.g. for benchmarks) */
+void HOST_SetModelledDevices(uint32_t Copy_DeviceMask);
+
+/* Resets peripheral registers to their reset values (flash and SRAM are kept) */
+void HOST_ResetPeripherals(void);
+
+/* Writes/erases flash behind the FPEC (test set up and corruption) */
+void HOST_FlashFill(uint32_t Copy_Address , const void* Copy_pData , uint32_t Copy_Size);
+void HOST_FlashErase(uint32_t Copy_Address , uint32_t Copy_Size);
+
+/* Write protects groups of four pages holding passed range (erase/program raise WRPRTERR until peripherals reset) */
+void HOST_FlashWriteProtect(uint32_t Copy_Address , uint32_t Copy_Size);
+
+/* Cuts power on flash operation number (Copy_Operations + 1) from now */
+void HOST_PowerCutAfter(uint32_t Copy_Operations);
+
+/* Runs function in a fresh process (RAM of modules is reset, flash is kept), returns HOST_BOOT_xxx */
+uint8_t HOST_Boot(void(*Copy_BootFunc)(void));
+
+/* Checks if FLASH IRQ would be pending (EOP or error flag with its interrupt enabled) */
+uint8_t HOST_FlashIrqPending(void);
+
+/* Raises flags nibble (bit 0 GIF is set as well) of a DMA channel */
+void HOST_DmaRaiseFlags(uint8_t Copy_ChannelId , uint32_t Copy_Flags);
+
+/* Observer called after every ODR change (port 0 = A) */
+void HOST_SetGpioObserver(void(*Copy_Observer)(uint8_t Copy_Port , uint32_t Copy_OldValue , uint32_t Copy_NewValue));
+
+/* Hook called by every sleep of a module (WFI), it moves modelled time and raises the wake-up interrupt */
+void HOST_SetWaitForInterruptHook(void(*Copy_Hook)(void));
+
+#endif /* HOST_MODEL_H_ */
@@ -0,0 +1,81 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : Host Port (Forced Include)   */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/* Included ahead of every translation unit of the host test build (gcc -include).   */
+/* It replaces what cannot be built for a Linux x86-64 host as is:                   */
+/* - STD_TYPES.h uses long for 32 bits types, which is 64 bits wide on the host      */
+/* - Cortex-M3 inline assembly (PRIMASK masking, MSP load) of the modules            */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+#ifndef HOST_PORT_H_
+#define HOST_PORT_H_
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                              STANDARD TYPES DEFINITION		           		     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Take guard of LIB STD_TYPES.h so that its target widths are replaced by host ones */
+#define LIB_STD_TYPES_H_
+
+typedef unsigned char 			uint8_t;
+typedef signed char 			sint8_t;
+typedef unsigned short int 		uint16_t;
+typedef signed short int 		sint16_t;
+typedef unsigned int 			uint32_t;
+typedef signed int 				sint32_t;
+typedef unsigned long long int 	uint64_t;
+typedef signed long long int 	sint64_t;
+typedef float 					float32_t;
+typedef double 					float64_t;
+typedef long double 			float128_t;
+
+/* Define NULL as 0 */
+#define NULL  					0U
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 CRITICAL SECTIONS		           		         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Tests raise interrupts by calling the handlers themselves, so masking has nothing to do */
+#define DMA_ENTER_CRITICAL_SECTION(Copy_PrimaskState)		((Copy_PrimaskState) = 0U)
+#define DMA_EXIT_CRITICAL_SECTION(Copy_PrimaskState)		((void)(Copy_PrimaskState))
+#define STK_ENTER_CRITICAL_SECTION(Copy_PrimaskState)		((Copy_PrimaskState) = 0U)
+#define STK_EXIT_CRITICAL_SECTION(Copy_PrimaskState)		((void)(Copy_PrimaskState))
+#define SCH_ENTER_CRITICAL_SECTION(Copy_PrimaskState)		((Copy_PrimaskState) = 0U)
+#define SCH_EXIT_CRITICAL_SECTION(Copy_PrimaskState)		((void)(Copy_PrimaskState))
+#define CLCD_ENTER_CRITICAL_SECTION(Copy_PrimaskState)		((Copy_PrimaskState) = 0U)
+#define CLCD_EXIT_CRITICAL_SECTION(Copy_PrimaskState)		((void)(Copy_PrimaskState))
+#define FPEC_ENTER_CRITICAL_SECTION(Copy_PrimaskState)		((Copy_PrimaskState) = 0U)
+#define FPEC_EXIT_CRITICAL_SECTION(Copy_PrimaskState)		((void)(Copy_PrimaskState))
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  CORE REGISTERS		           		             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Core registers loaded by a boot loader are kept by the model (HOST_Model.c) for tests to check */
+extern volatile uint32_t HOST_Primask;
+extern volatile uint32_t HOST_MainStackPointer;
+
+#define FWU_DISABLE_INTERRUPTS()							(HOST_Primask = 1U)
+#define FWU_ENABLE_INTERRUPTS()								(HOST_Primask = 0U)
+#define FWU_SET_MAIN_STACK_POINTER(Copy_StackPointer)		(HOST_MainStackPointer = (Copy_StackPointer))
+
+/* Sleep calls the hook a test set with HOST_SetWaitForInterruptHook (HOST_Model.h) to let time pass */
+extern void HOST_WaitForInterrupt(void);
+
+#define STK_WAIT_FOR_INTERRUPT()							HOST_WaitForInterrupt()
+
+#endif /* HOST_PORT_H_ */
@@ -0,0 +1,126 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : Host Test Program            */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+
+#include "HOST_Test.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                 PRIVATE DATA TYPES                                */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Check Results (shared with simulated boots) */
+typedef struct
+{
+	uint32_t Checks;				/* Number of checks done */
+	uint32_t Failures;				/* Number of failed checks */
+}HOST_Results_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static volatile HOST_Results_t* Global_pResults = NULL;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                             FUNCTIONS IMPLEMENTATIONS                             */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Results live in memory shared with processes forked later (first check happens before any boot) */
+static volatile HOST_Results_t* HOST_GetResults(void)
+{
+	void* Local_pMemory;
+
+	if(Global_pResults == NULL)
+	{
+		Local_pMemory = mmap(NULL , sizeof(HOST_Results_t) , PROT_READ | PROT_WRITE , MAP_SHARED | MAP_ANONYMOUS , -1 , 0);
+		if(Local_pMemory == MAP_FAILED)
+		{
+			perror("HOST_GetResults");
+			exit(EXIT_FAILURE);
+		}
+		Global_pResults = (volatile HOST_Results_t*)Local_pMemory;
+	}
+
+	return Global_pResults;
+}
+
+void HOST_Check(uint8_t Copy_Passed , const char* Copy_pText , const char* Copy_pFile , int Copy_Line)
+{
+	volatile HOST_Results_t* Local_pResults = HOST_GetResults();
+
+	Local_pResults->Checks++;
+	if(Copy_Passed == 0)
+	{
+		Local_pResults->Failures++;
+		printf("%s:%d: check failed: %s\n" , Copy_pFile , Copy_Line , Copy_pText);
+	}
+}
+
+void HOST_CheckEqual(uint64_t Copy_Actual , uint64_t Copy_Expected , const char* Copy_pText , const char* Copy_pFile , int Copy_Line)
+{
+	volatile HOST_Results_t* Local_pResults = HOST_GetResults();
+
+	Local_pResults->Checks++;
+	if(Copy_Actual != Copy_Expected)
+	{
+		Local_pResults->Failures++;
+		printf("%s:%d: check failed: %s is %llu (0x%llX), expected %llu (0x%llX)\n" , Copy_pFile , Copy_Line , Copy_pText ,
+			   Copy_Actual , Copy_Actual , Copy_Expected , Copy_Expected);
+	}
+}
+
+uint8_t HOST_IsBenchmarkRun(int Copy_ArgumentsCount , char** Copy_pArguments)
+{
+	/* Results are set up before any simulated boot may be forked */
+	(void)HOST_GetResults();
+
+	return ((Copy_ArgumentsCount > 1) && (strcmp(Copy_pArguments[1] , "bench") == 0)) ? 1 : 0;
+}
+
+int HOST_Summary(const char* Copy_pTestName)
+{
+	volatile HOST_Results_t* Local_pResults = HOST_GetResults();
+
+	printf("%s: %u checks, %u failed\n" , Copy_pTestName , Local_pResults->Checks , Local_pResults->Failures);
+
+	return (Local_pResults->Failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+uint64_t HOST_TimeNs(void)
+{
+	struct timespec Local_Time;
+
+	clock_gettime(CLOCK_MONOTONIC , &Local_Time);
+
+	return ((uint64_t)Local_Time.tv_sec * 1000000000ULL) + (uint64_t)Local_Time.tv_nsec;
+}
+
+void HOST_Report(const char* Copy_pName , uint64_t Copy_ElapsedNs , uint32_t Copy_Operations , uint64_t Copy_Bytes)
+{
+	printf("  %-44s %10.2f ns/op" , Copy_pName , (double)Copy_ElapsedNs / (double)Copy_Operations);
+	if(Copy_Bytes != 0)
+	{
+		printf("  %8.2f MB/s" , ((double)Copy_Bytes / (1024.0 * 1024.0)) / ((double)Copy_ElapsedNs / 1e9));
+	}
+	printf("\n");
+}
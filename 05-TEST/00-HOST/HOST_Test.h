@@ -0,0 +1,53 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : Host Test Interface          */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/* Checks and timing shared by host tests. Results are kept in shared memory so that */
+/* checks done inside simulated boots (HOST_Boot) are reported by the test process.  */
+/* A test binary runs its checks, or its benchmarks when started with "bench".       */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+#ifndef HOST_TEST_H_
+#define HOST_TEST_H_
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  INTERFACE MACROS                                 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Check a condition, failure is printed with its location and counted */
+#define HOST_CHECK(Condition)			HOST_Check(((Condition) ? 1U : 0U) , #Condition , __FILE__ , __LINE__)
+
+/* Check two unsigned values are equal, both are printed on failure */
+#define HOST_CHECK_EQUAL(Actual , Expected)	HOST_CheckEqual((uint64_t)(Actual) , (uint64_t)(Expected) , #Actual , __FILE__ , __LINE__)
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                FUNCTIONS PROTOTYPES                               */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Records result of one check */
+void HOST_Check(uint8_t Copy_Passed , const char* Copy_pText , const char* Copy_pFile , int Copy_Line);
+void HOST_CheckEqual(uint64_t Copy_Actual , uint64_t Copy_Expected , const char* Copy_pText , const char* Copy_pFile , int Copy_Line);
+
+/* Returns 1 if binary is started to run benchmarks */
+uint8_t HOST_IsBenchmarkRun(int Copy_ArgumentsCount , char** Copy_pArguments);
+
+/* Prints summary of all checks, returns process exit status */
+int HOST_Summary(const char* Copy_pTestName);
+
+/* Monotonic time in nanoseconds */
+uint64_t HOST_TimeNs(void);
+
+/* Prints one benchmark line: name, time per operation and optional throughput */
+void HOST_Report(const char* Copy_pName , uint64_t Copy_ElapsedNs , uint32_t Copy_Operations , uint64_t Copy_Bytes);
+
+#endif /* HOST_TEST_H_ */
@@ -0,0 +1,1126 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : CLCD Host Test               */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+
+#include "GPIO_Interface.h"
+
+#include "CLCD_Config.h"
+#include "CLCD_Interface.h"
+
+#include "HOST_Model.h"
+#include "HOST_Test.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Input and output data registers of a port (plain accesses of the modelled GPIO page) */
+#define TEST_GPIO_IDR(Port)				(*(volatile uint32_t*)(0x40010808UL + ((uint32_t)(Port) * 0x400UL)))
+#define TEST_GPIO_ODR(Port)				(*(volatile uint32_t*)(0x4001080CUL + ((uint32_t)(Port) * 0x400UL)))
+
+/* Cycle counter read by the driver timeouts */
+#define TEST_DWT_CYCCNT					(*(volatile uint32_t*)0xE0001004UL)
+
+/* HD44780 controller seen on the bus */
+#define TEST_DDRAM_SIZE					0x80U
+#define TEST_SECOND_LINE_ADDRESS		0x40U
+#define TEST_LINE_LENGTH				0x28U
+#define TEST_SET_DDRAM_ADDRESS			0x80U
+#define TEST_SET_CGRAM_ADDRESS			0x40U
+#define TEST_CGRAM_SIZE					0x40U
+#define TEST_CURSOR_SHIFT_LEFT			0x10U
+#define TEST_BUSY_FLAG					0x80U
+#define TEST_CLEAR_DISPLAY				0x01U
+#define TEST_RETURN_HOME_MASK			0xFEU
+#define TEST_RETURN_HOME				0x02U
+
+/* GPIO stores clocking one byte: RS, D7..D4, E pulse, D3..D0, E pulse (4-bit, RS on control port) */
+#define TEST_FOUR_BIT_STORES_PER_BYTE	7U
+#define TEST_FOUR_BIT_CTRL_STORES		5U
+#define TEST_FOUR_BIT_DATA_STORES		2U
+
+/* GPIO stores clocking one byte: RS with D7..D0, E pulse (8-bit, RS on data port) */
+#define TEST_EIGHT_BIT_STORES_PER_BYTE	3U
+
+/* Delays end after a few polls of the cycle counter */
+#define TEST_CYCLES_PER_READ			4096U
+
+/* Busy flag test: cycle counter moves slowly so that waits are counted in polls */
+#define TEST_BUSY_CYCLES_PER_READ		1U
+#define TEST_BUSY_READS					3U			/* Busy flag reads answered busy after each byte */
+#define TEST_TIMEOUT_BUSY_READS			0xFFFFFFFFUL		/* Controller that never gets ready */
+#define TEST_READ_ADDRESS				0x42U
+
+#define TEST_PANELS						2U
+#define TEST_PREEMPT_WRITES				8U			/* 8 numbers of 11 characters overflow the queue */
+#define TEST_PREEMPT_NUMBER				(-1234567890)
+#define TEST_DRAIN_CALLS				100000UL	/* Service calls a full queue must drain within */
+#define TEST_BENCH_FRAMES				2000U
+
+/* Custom characters: 8 CGRAM slots of 8 rows, 5 pixels each */
+#define TEST_GLYPH_SLOTS				8U
+#define TEST_GLYPH_ROWS					8U
+#define TEST_GLYPH_ROW_MASK				0x1FU
+
+/* Panel geometries laid out by the layout test */
+#define TEST_GEOMETRIES					3U
+#define TEST_MAX_ROWS					4U
+#define TEST_MAX_CELLS					80U
+#define TEST_LONG_WORD_TEXT				"Hi supercalifragilisticexpialidocious ok"
+#define TEST_LONG_LINE_TEXT				"0123456789012345678901234567890123456789X"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  PRIVATE TYPES                                    */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Controller model of one panel, fed by E falling edges of its handle pins */
+typedef struct
+{
+	const CLCD_Handle_t* pHandle;
+	uint8_t DDRam[TEST_DDRAM_SIZE];
+	uint8_t CGRam[TEST_CGRAM_SIZE];
+	uint8_t AddressCounter;
+	uint8_t CGRamAccess;
+	uint8_t HighNibble;
+	uint8_t NibblePending;
+	uint8_t ReadByte;						/* Byte driven on data pins by a read (4-bit mode: two E pulses) */
+	uint8_t ReadNibblePending;
+	uint32_t BusyReads;						/* Busy flag reads still answered busy */
+	uint32_t FlagReads;						/* Busy flag and address counter reads */
+	uint32_t Instructions;
+	uint32_t Characters;
+}TEST_Panel_t;
+
+/* Panel geometry with its DDRAM row addresses and the rows texts are expected to be laid out in */
+typedef struct
+{
+	uint8_t Rows;
+	uint8_t Columns;
+	uint8_t RowAddress[TEST_MAX_ROWS];
+	uint8_t WrapInstructions;				/* Address instructions of a string filling every cell */
+	const char* WordRows[TEST_MAX_ROWS];	/* TEST_LONG_WORD_TEXT in whole panel box, word wrap */
+	const char* CharRows[TEST_MAX_ROWS];	/* TEST_LONG_WORD_TEXT in whole panel box, character wrap */
+	const char* AppendRows[2];				/* TEST_LONG_LINE_TEXT appended to a two rows box */
+}TEST_Geometry_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* 2x20 panel in 4-bit mode: data on port B, RS and E on port A (pins of CLCD_Config.h) */
+static CLCD_Handle_t Global_FourBitHandle = {GPIO_PORT_B , GPIO_PORT_A , GPIO_PIN_11 , GPIO_PIN_0 , GPIO_PIN_8 ,
+											 {GPIO_PIN_0 , GPIO_PIN_1 , GPIO_PIN_2 , GPIO_PIN_3 , GPIO_PIN_15 , GPIO_PIN_14 , GPIO_PIN_13 , GPIO_PIN_12} ,
+											 CLCD_FOUR_BIT_MODE , CLCD_WAIT_TIMED , 2U , 20U , 0};
+
+/* 4x20 panel in 8-bit mode with all pins on port C */
+static CLCD_Handle_t Global_EightBitHandle = {GPIO_PORT_C , GPIO_PORT_C , GPIO_PIN_8 , GPIO_PIN_10 , GPIO_PIN_9 ,
+											  {GPIO_PIN_0 , GPIO_PIN_1 , GPIO_PIN_2 , GPIO_PIN_3 , GPIO_PIN_4 , GPIO_PIN_5 , GPIO_PIN_6 , GPIO_PIN_7} ,
+											  CLCD_EIGHT_BIT_MODE , CLCD_WAIT_TIMED , 4U , 20U , 0};
+
+static TEST_Panel_t Global_Panels[TEST_PANELS];
+
+/* Busy flag reads answered busy after each byte a controller executes */
+static uint32_t Global_BusyReads;
+
+/* 16x2, 20x4 and 40x2 panels: rows 2 and 3 of a 4-row panel continue rows 0 and 1 in DDRAM */
+static const TEST_Geometry_t Global_Geometries[TEST_GEOMETRIES] =
+{
+	{2U , 16U , {0x00U , 0x40U} , 2U ,
+	 {"sticexpialidocio" , "us ok"} ,
+	 {"ilisticexpialido" , "cious ok"} ,
+	 {"6789012345678901" , "23456789X"}} ,
+	{4U , 20U , {0x00U , 0x40U , 0x14U , 0x54U} , 3U ,
+	 {"Hi" , "supercalifragilistic" , "expialidocious ok" , ""} ,
+	 {"Hi supercalifragilis" , "ticexpialidocious ok" , "" , ""} ,
+	 {"01234567890123456789" , "X"}} ,
+	{2U , 40U , {0x00U , 0x40U} , 0U ,
+	 {TEST_LONG_WORD_TEXT , ""} ,
+	 {TEST_LONG_WORD_TEXT , ""} ,
+	 {"0123456789012345678901234567890123456789" , "X"}}
+};
+
+/* Numbers written by a context that preempts the CLCD engine and statuses it got */
+static uint8_t Global_PreemptArmed;
+static uint8_t Global_PreemptWriteCount = TEST_PREEMPT_WRITES;
+static uint8_t Global_PreemptWrites;
+static ERROR_STATUS_t Global_PreemptStatus[TEST_PREEMPT_WRITES];
+
+/* Glyph requested by preempting context once queue is full, its status and queue depths around it */
+static const uint8_t* Global_pPreemptGlyph;
+static ERROR_STATUS_t Global_PreemptGlyphStatus;
+static uint16_t Global_PreemptDepthBefore;
+static uint16_t Global_PreemptDepthAfter;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  CONTROLLER MODEL                                 */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Moves address counter past a DDRAM character (end of a line goes on to the other one) */
+static void TEST_PanelNextAddress(TEST_Panel_t* Copy_pPanel)
+{
+	Copy_pPanel->AddressCounter++;
+	if(Copy_pPanel->AddressCounter == TEST_LINE_LENGTH)
+	{
+		Copy_pPanel->AddressCounter = TEST_SECOND_LINE_ADDRESS;
+	}
+	else if(Copy_pPanel->AddressCounter == (TEST_SECOND_LINE_ADDRESS + TEST_LINE_LENGTH))
+	{
+		Copy_pPanel->AddressCounter = 0;
+	}
+}
+
+/* Executes one byte latched by controller, which is then busy for a number of flag reads */
+static void TEST_PanelExecute(TEST_Panel_t* Copy_pPanel , uint8_t Copy_Byte , uint8_t Copy_RegisterSelect)
+{
+	Copy_pPanel->BusyReads = Global_BusyReads;
+
+	if(Copy_RegisterSelect == 1 && Copy_pPanel->CGRamAccess == 1)
+	{
+		/* Write CGRAM row then move address counter */
+		Copy_pPanel->CGRam[Copy_pPanel->AddressCounter] = Copy_Byte;
+		Copy_pPanel->AddressCounter = (Copy_pPanel->AddressCounter + 1U) & (TEST_CGRAM_SIZE - 1U);
+		Copy_pPanel->Characters++;
+	}
+	else if(Copy_RegisterSelect == 1)
+	{
+		/* Write DDRAM then move address counter */
+		Copy_pPanel->DDRam[Copy_pPanel->AddressCounter] = Copy_Byte;
+		TEST_PanelNextAddress(Copy_pPanel);
+		Copy_pPanel->Characters++;
+	}
+	else
+	{
+		if((Copy_Byte & TEST_SET_DDRAM_ADDRESS) != 0)
+		{
+			Copy_pPanel->AddressCounter = Copy_Byte & (TEST_DDRAM_SIZE - 1U);
+			Copy_pPanel->CGRamAccess = 0;
+		}
+		else if((Copy_Byte & TEST_SET_CGRAM_ADDRESS) != 0)
+		{
+			Copy_pPanel->AddressCounter = Copy_Byte & (TEST_CGRAM_SIZE - 1U);
+			Copy_pPanel->CGRamAccess = 1;
+		}
+		else if(Copy_Byte == TEST_CLEAR_DISPLAY)
+		{
+			memset(Copy_pPanel->DDRam , ' ' , TEST_DDRAM_SIZE);
+			Copy_pPanel->AddressCounter = 0;
+			Copy_pPanel->CGRamAccess = 0;
+		}
+		else if((Copy_Byte & TEST_RETURN_HOME_MASK) == TEST_RETURN_HOME)
+		{
+			Copy_pPanel->AddressCounter = 0;
+			Copy_pPanel->CGRamAccess = 0;
+		}
+		Copy_pPanel->Instructions++;
+	}
+}
+
+/* Byte a read cycle gets: busy flag with address counter, or DDRAM character (address counter moves on) */
+static uint8_t TEST_PanelRead(TEST_Panel_t* Copy_pPanel , uint8_t Copy_RegisterSelect)
+{
+	uint8_t Local_Byte;
+
+	if(Copy_RegisterSelect == 0)
+	{
+		Local_Byte = Copy_pPanel->AddressCounter;
+		if(Copy_pPanel->BusyReads != 0)
+		{
+			Local_Byte |= TEST_BUSY_FLAG;
+			Copy_pPanel->BusyReads--;
+		}
+		Copy_pPanel->FlagReads++;
+	}
+	else
+	{
+		Local_Byte = Copy_pPanel->DDRam[Copy_pPanel->AddressCounter];
+		TEST_PanelNextAddress(Copy_pPanel);
+	}
+
+	return Local_Byte;
+}
+
+/* Drives bits of passed value on data pins (from passed pin of the map) of panel to the input register */
+static void TEST_PanelDrive(const TEST_Panel_t* Copy_pPanel , uint8_t Copy_Value , uint8_t Copy_FirstPin , uint8_t Copy_Bits)
+{
+	const CLCD_Handle_t* Local_pHandle = Copy_pPanel->pHandle;
+	uint32_t Local_Input = TEST_GPIO_IDR(Local_pHandle->dataPort);
+	uint8_t Local_Bit;
+
+	for(Local_Bit = 0 ; Local_Bit < Copy_Bits ; Local_Bit++)
+	{
+		Local_Input &= ~(1UL << Local_pHandle->dataPins[Copy_FirstPin + Local_Bit]);
+		Local_Input |= (uint32_t)((Copy_Value >> Local_Bit) & 1U) << Local_pHandle->dataPins[Copy_FirstPin + Local_Bit];
+	}
+	TEST_GPIO_IDR(Local_pHandle->dataPort) = Local_Input;
+}
+
+/* GPIO observer: with RW low E falling edge latches data pins into controller of the panel owning E, */
+/* with RW high E rising edge makes controller drive data pins                                          */
+static void TEST_BusObserver(uint8_t Copy_Port , uint32_t Copy_OldValue , uint32_t Copy_NewValue)
+{
+	TEST_Panel_t* Local_pPanel;
+	const CLCD_Handle_t* Local_pHandle;
+	uint32_t Local_Data;
+	uint8_t Local_Value;
+	uint8_t Local_Bit;
+	uint8_t Local_Counter;
+
+	/* Preempt engine while it clocks a byte: queue can only be drained by engine itself */
+	if(Global_PreemptArmed == 1)
+	{
+		Global_PreemptArmed = 0;
+		for(Global_PreemptWrites = 0 ; Global_PreemptWrites < Global_PreemptWriteCount ; Global_PreemptWrites++)
+		{
+			Global_PreemptStatus[Global_PreemptWrites] = CLCD_HandleWriteNumber(&Global_FourBitHandle , TEST_PREEMPT_NUMBER);
+		}
+		if(Global_pPreemptGlyph != NULL)
+		{
+			CLCD_HandleGetQueueDepth(&Global_FourBitHandle , &Global_PreemptDepthBefore);
+			Global_PreemptGlyphStatus = CLCD_HandleRequestGlyph(&Global_FourBitHandle , Global_pPreemptGlyph , &Local_Value);
+			CLCD_HandleGetQueueDepth(&Global_FourBitHandle , &Global_PreemptDepthAfter);
+		}
+	}
+
+	for(Local_Counter = 0 ; Local_Counter < TEST_PANELS ; Local_Counter++)
+	{
+		Local_pPanel = &Global_Panels[Local_Counter];
+		Local_pHandle = Local_pPanel->pHandle;
+		if(Local_pHandle == NULL || Copy_Port != Local_pHandle->ctrlPort)
+		{
+			continue;
+		}
+
+		/* Read cycle: controller drives byte (4-bit mode: high nibble then low nibble) on E rising edge */
+		if(((Copy_NewValue >> Local_pHandle->rwPin) & 1U) != 0)
+		{
+			if(((Copy_OldValue >> Local_pHandle->ePin) & 1U) == 0 && ((Copy_NewValue >> Local_pHandle->ePin) & 1U) != 0)
+			{
+				if(Local_pHandle->mode == CLCD_EIGHT_BIT_MODE)
+				{
+					TEST_PanelDrive(Local_pPanel , TEST_PanelRead(Local_pPanel , (uint8_t)((Copy_NewValue >> Local_pHandle->rsPin) & 1U)) , 0 , 8U);
+				}
+				else if(Local_pPanel->ReadNibblePending == 0)
+				{
+					Local_pPanel->ReadByte = TEST_PanelRead(Local_pPanel , (uint8_t)((Copy_NewValue >> Local_pHandle->rsPin) & 1U));
+					TEST_PanelDrive(Local_pPanel , (uint8_t)(Local_pPanel->ReadByte >> 4) , 4U , 4U);
+					Local_pPanel->ReadNibblePending = 1;
+				}
+				else
+				{
+					TEST_PanelDrive(Local_pPanel , Local_pPanel->ReadByte , 4U , 4U);
+					Local_pPanel->ReadNibblePending = 0;
+				}
+			}
+			continue;
+		}
+
+		/* Write cycle: controller latches data pins on E falling edge */
+		if(((Copy_OldValue >> Local_pHandle->ePin) & 1U) == 0 || ((Copy_NewValue >> Local_pHandle->ePin) & 1U) != 0)
+		{
+			continue;
+		}
+
+		/* Get D7..D4 (4-bit mode) or D7..D0 from data pins */
+		Local_Value = 0;
+		Local_Data = TEST_GPIO_ODR(Local_pHandle->dataPort);
+		if(Local_pHandle->mode == CLCD_FOUR_BIT_MODE)
+		{
+			for(Local_Bit = 0 ; Local_Bit < 4U ; Local_Bit++)
+			{
+				Local_Value |= (uint8_t)(((Local_Data >> Local_pHandle->dataPins[Local_Bit + 4U]) & 1U) << Local_Bit);
+			}
+
+			/* Controller latches a byte every second nibble */
+			if(Local_pPanel->NibblePending == 0)
+			{
+				Local_pPanel->HighNibble = Local_Value;
+				Local_pPanel->NibblePending = 1;
+				continue;
+			}
+			Local_Value |= (uint8_t)(Local_pPanel->HighNibble << 4);
+			Local_pPanel->NibblePending = 0;
+		}
+		else
+		{
+			for(Local_Bit = 0 ; Local_Bit < 8U ; Local_Bit++)
+			{
+				Local_Value |= (uint8_t)(((Local_Data >> Local_pHandle->dataPins[Local_Bit]) & 1U) << Local_Bit);
+			}
+		}
+
+		TEST_PanelExecute(Local_pPanel , Local_Value , (uint8_t)((TEST_GPIO_ODR(Local_pHandle->ctrlPort) >> Local_pHandle->rsPin) & 1U));
+	}
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     HELPERS                                       */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Checks that panel shows the rows passed (each padded with blanks to panel width) */
+static void TEST_CheckPanelShows(const TEST_Panel_t* Copy_pPanel , const char* const* Copy_pRows)
+{
+	const CLCD_Handle_t* Local_pHandle = Copy_pPanel->pHandle;
+	uint8_t Local_Row;
+	uint8_t Local_Column;
+	uint8_t Local_Address;
+	uint8_t Local_Expected;
+	uint8_t Local_Mismatches = 0;
+
+	for(Local_Row = 0 ; Local_Row < Local_pHandle->rows ; Local_Row++)
+	{
+		for(Local_Column = 0 ; Local_Column < Local_pHandle->columns ; Local_Column++)
+		{
+			Local_Expected = (Local_Column < strlen(Copy_pRows[Local_Row])) ? (uint8_t)Copy_pRows[Local_Row][Local_Column] : ' ';
+			Local_Address = ((Local_Row & 1U) * TEST_SECOND_LINE_ADDRESS) + ((Local_Row >> 1) * Local_pHandle->columns) + Local_Column;
+			Local_Mismatches += (Copy_pPanel->DDRam[Local_Address] != Local_Expected);
+		}
+	}
+	HOST_CHECK_EQUAL(Local_Mismatches , 0);
+}
+
+/* Refreshes frame to the panel and returns the number of bytes its controller latched */
+static uint32_t TEST_RefreshFrame(const CLCD_Handle_t* Copy_pHandle , TEST_Panel_t* Copy_pPanel)
+{
+	uint32_t Local_Bytes = Copy_pPanel->Instructions + Copy_pPanel->Characters;
+
+	HOST_CHECK_EQUAL(CLCD_HandleFrameRefresh(Copy_pHandle) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleFlush(Copy_pHandle) , RT_OK);
+	HOST_CHECK_EQUAL(Copy_pPanel->NibblePending , 0);
+
+	return (Copy_pPanel->Instructions + Copy_pPanel->Characters) - Local_Bytes;
+}
+
+/* Bitmap of numbered test glyph (unused high bits set, the driver must drop them) */
+static void TEST_MakeGlyph(uint8_t Copy_Index , uint8_t* Copy_pGlyph)
+{
+	uint8_t Local_Row;
+
+	for(Local_Row = 0 ; Local_Row < TEST_GLYPH_ROWS ; Local_Row++)
+	{
+		Copy_pGlyph[Local_Row] = (uint8_t)(0xE0U | ((Copy_Index + (Local_Row * 5U)) & TEST_GLYPH_ROW_MASK));
+	}
+}
+
+/* Checks that CGRAM slot of panel holds numbered test glyph */
+static void TEST_CheckPanelGlyph(const TEST_Panel_t* Copy_pPanel , uint8_t Copy_Slot , uint8_t Copy_Index)
+{
+	uint8_t Local_Glyph[TEST_GLYPH_ROWS];
+	uint8_t Local_Row;
+	uint8_t Local_Mismatches = 0;
+
+	TEST_MakeGlyph(Copy_Index , Local_Glyph);
+	for(Local_Row = 0 ; Local_Row < TEST_GLYPH_ROWS ; Local_Row++)
+	{
+		Local_Mismatches += (Copy_pPanel->CGRam[(Copy_Slot * TEST_GLYPH_ROWS) + Local_Row] != (Local_Glyph[Local_Row] & TEST_GLYPH_ROW_MASK));
+	}
+	HOST_CHECK_EQUAL(Local_Mismatches , 0);
+}
+
+/* Requests numbered test glyph, flushes its load and returns its slot */
+static uint8_t TEST_RequestGlyph(const CLCD_Handle_t* Copy_pHandle , uint8_t Copy_Index , ERROR_STATUS_t Copy_Expected)
+{
+	uint8_t Local_Glyph[TEST_GLYPH_ROWS];
+	uint8_t Local_Slot = TEST_GLYPH_SLOTS;
+
+	TEST_MakeGlyph(Copy_Index , Local_Glyph);
+	HOST_CHECK_EQUAL(CLCD_HandleRequestGlyph(Copy_pHandle , Local_Glyph , &Local_Slot) , Copy_Expected);
+	HOST_CHECK_EQUAL(CLCD_HandleFlush(Copy_pHandle) , RT_OK);
+
+	return Local_Slot;
+}
+
+/* Total GPIO stores of all ports */
+static uint32_t TEST_GpioStores(void)
+{
+	uint32_t Local_Stores = 0;
+	uint8_t Local_Port;
+
+	for(Local_Port = 0 ; Local_Port < HOST_GPIO_PORTS ; Local_Port++)
+	{
+		Local_Stores += HOST_pCounters->GpioStores[Local_Port];
+	}
+
+	return Local_Stores;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                      TESTS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Both panels are brought up and cleared through the bus */
+static void TEST_Init(void)
+{
+	memset(Global_Panels , 0xFF , sizeof(Global_Panels));
+	Global_Panels[0].pHandle = &Global_FourBitHandle;
+	Global_Panels[0].NibblePending = 0;
+	Global_Panels[0].Instructions = 0;
+	Global_Panels[0].Characters = 0;
+	Global_Panels[0].CGRamAccess = 0;
+	Global_Panels[0].ReadNibblePending = 0;
+	Global_Panels[0].BusyReads = 0;
+	Global_Panels[0].FlagReads = 0;
+	Global_Panels[1].pHandle = &Global_EightBitHandle;
+	Global_Panels[1].NibblePending = 0;
+	Global_Panels[1].Instructions = 0;
+	Global_Panels[1].Characters = 0;
+	Global_Panels[1].CGRamAccess = 0;
+	Global_Panels[1].ReadNibblePending = 0;
+	Global_Panels[1].BusyReads = 0;
+	Global_Panels[1].FlagReads = 0;
+
+	HOST_CHECK_EQUAL(CLCD_HandleInit(&Global_FourBitHandle) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleInit(&Global_EightBitHandle) , RT_OK);
+
+	/* Function set, display on, clear and entry mode instructions are latched */
+	HOST_CHECK_EQUAL(Global_Panels[0].Instructions , 4);
+	HOST_CHECK_EQUAL(Global_Panels[1].Instructions , 4);
+	HOST_CHECK_EQUAL(Global_Panels[0].Characters , 0);
+	HOST_CHECK_EQUAL(Global_Panels[1].Characters , 0);
+	HOST_CHECK_EQUAL(Global_Panels[0].DDRam[0] , ' ');
+	HOST_CHECK_EQUAL(Global_Panels[1].DDRam[TEST_DDRAM_SIZE - 1U] , ' ');
+}
+
+/* Bus stores per refreshed frame of a 4-bit panel follow the changed cells only */
+static void TEST_FourBitFrameStores(void)
+{
+	const CLCD_Handle_t* Local_pHandle = &Global_FourBitHandle;
+	TEST_Panel_t* Local_pPanel = &Global_Panels[0];
+	const char* Local_Rows[2];
+	uint32_t Local_CtrlStores;
+	uint32_t Local_DataStores;
+	uint32_t Local_Bytes;
+
+	/* Full frame: every cell plus at most one address instruction per row */
+	HOST_CHECK_EQUAL(CLCD_HandleFrameWriteString(Local_pHandle , 0 , 0 , (const uint8_t*)"Temp  23.5 C  Fan 2") , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleFrameWriteString(Local_pHandle , 1 , 0 , (const uint8_t*)"12:00:00   Mode AUTO") , RT_OK);
+	Local_CtrlStores = HOST_pCounters->GpioStores[GPIO_PORT_A];
+	Local_DataStores = HOST_pCounters->GpioStores[GPIO_PORT_B];
+	Local_Bytes = TEST_RefreshFrame(Local_pHandle , Local_pPanel);
+	Local_Rows[0] = "Temp  23.5 C  Fan 2";
+	Local_Rows[1] = "12:00:00   Mode AUTO";
+	TEST_CheckPanelShows(Local_pPanel , Local_Rows);
+	HOST_CHECK(Local_Bytes >= 40U && Local_Bytes <= 42U);
+	HOST_CHECK_EQUAL(HOST_pCounters->GpioStores[GPIO_PORT_A] - Local_CtrlStores , Local_Bytes * TEST_FOUR_BIT_CTRL_STORES);
+	HOST_CHECK_EQUAL(HOST_pCounters->GpioStores[GPIO_PORT_B] - Local_DataStores , Local_Bytes * TEST_FOUR_BIT_DATA_STORES);
+
+	/* Unchanged frame: no bus traffic at all */
+	Local_CtrlStores = TEST_GpioStores();
+	HOST_CHECK_EQUAL(TEST_RefreshFrame(Local_pHandle , Local_pPanel) , 0);
+	HOST_CHECK_EQUAL(TEST_GpioStores() - Local_CtrlStores , 0);
+
+	/* Both seconds digits change: one address instruction and two characters */
+	HOST_CHECK_EQUAL(CLCD_HandleFrameWriteString(Local_pHandle , 1 , 6 , (const uint8_t*)"17") , RT_OK);
+	Local_CtrlStores = TEST_GpioStores();
+	HOST_CHECK_EQUAL(TEST_RefreshFrame(Local_pHandle , Local_pPanel) , 3);
+	HOST_CHECK_EQUAL(TEST_GpioStores() - Local_CtrlStores , 3U * TEST_FOUR_BIT_STORES_PER_BYTE);
+
+	/* Cell right after last sent one: address counter is already there */
+	HOST_CHECK_EQUAL(CLCD_HandleFrameWriteCharacter(Local_pHandle , 1 , 8 , '!') , RT_OK);
+	Local_CtrlStores = TEST_GpioStores();
+	HOST_CHECK_EQUAL(TEST_RefreshFrame(Local_pHandle , Local_pPanel) , 1);
+	HOST_CHECK_EQUAL(TEST_GpioStores() - Local_CtrlStores , TEST_FOUR_BIT_STORES_PER_BYTE);
+
+	/* Two separate changes on both rows: two runs of one cell */
+	HOST_CHECK_EQUAL(CLCD_HandleFrameWriteCharacter(Local_pHandle , 0 , 18 , '3') , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleFrameWriteCharacter(Local_pHandle , 1 , 0 , '2') , RT_OK);
+	Local_CtrlStores = TEST_GpioStores();
+	HOST_CHECK_EQUAL(TEST_RefreshFrame(Local_pHandle , Local_pPanel) , 4);
+	HOST_CHECK_EQUAL(TEST_GpioStores() - Local_CtrlStores , 4U * TEST_FOUR_BIT_STORES_PER_BYTE);
+	Local_Rows[0] = "Temp  23.5 C  Fan 3";
+	Local_Rows[1] = "22:00:17!  Mode AUTO";
+	TEST_CheckPanelShows(Local_pPanel , Local_Rows);
+
+	/* Other panel never saw a byte */
+	HOST_CHECK_EQUAL(Global_Panels[1].Characters , 0);
+}
+
+/* Number written while engine is preempted stops at first digit that does not fit the queue */
+static void TEST_WriteNumberPreempted(void)
+{
+	const CLCD_Handle_t* Local_pHandle = &Global_FourBitHandle;
+	uint16_t Local_Depth = 0;
+	uint8_t Local_Write;
+
+	/* Number written from task context is latched in full */
+	HOST_CHECK_EQUAL(CLCD_HandleMoveCursor(Local_pHandle , 0 , 0) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleWriteNumber(Local_pHandle , TEST_PREEMPT_NUMBER) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleFlush(Local_pHandle) , RT_OK);
+	HOST_CHECK_EQUAL(memcmp(Global_Panels[0].DDRam , "-1234567890" , 11) , 0);
+
+	/* Preempting context fills queue: write that overflows it fails and later ones fail at once */
+	HOST_CHECK_EQUAL(CLCD_HandleWriteCharacter(Local_pHandle , '>') , RT_OK);
+	Global_PreemptWrites = 0;
+	Global_PreemptArmed = 1;
+	HOST_CHECK_EQUAL(CLCD_HandleService(Local_pHandle) , RT_OK);
+	HOST_CHECK_EQUAL(Global_PreemptWrites , TEST_PREEMPT_WRITES);
+	for(Local_Write = 0 ; Local_Write < TEST_PREEMPT_WRITES ; Local_Write++)
+	{
+		HOST_CHECK_EQUAL(Global_PreemptStatus[Local_Write] , (Local_Write < (CLCD_QUEUE_SIZE / 11U)) ? RT_OK : BUSY_FUNC);
+	}
+
+	/* Failed write queued digits up to full queue only, then engine went on with its burst */
+	HOST_CHECK_EQUAL(CLCD_HandleGetQueueDepth(Local_pHandle , &Local_Depth) , RT_OK);
+	HOST_CHECK_EQUAL(Local_Depth , CLCD_QUEUE_SIZE - CLCD_SERVICE_BURST);
+	HOST_CHECK_EQUAL(CLCD_HandleFlush(Local_pHandle) , RT_OK);
+
+	/* Redraw frame over the numbers */
+	HOST_CHECK_EQUAL(CLCD_HandleFrameInvalidate(Local_pHandle) , RT_OK);
+	HOST_CHECK(TEST_RefreshFrame(Local_pHandle , &Global_Panels[0]) >= 40U);
+}
+
+/* Queued characters of a full queue reached panel in order, starting at DDRAM address 0 */
+static void TEST_CheckQueuedCharacters(const TEST_Panel_t* Copy_pPanel , uint16_t Copy_Count)
+{
+	TEST_Panel_t Local_Cursor;
+	uint16_t Local_Counter;
+
+	Local_Cursor.AddressCounter = 0;
+	for(Local_Counter = 0 ; Local_Counter < Copy_Count ; Local_Counter++)
+	{
+		HOST_CHECK_EQUAL(Copy_pPanel->DDRam[Local_Cursor.AddressCounter] , 'A' + (Local_Counter % 26U));
+		TEST_PanelNextAddress(&Local_Cursor);
+	}
+}
+
+/* Service never waits for controller: full queue drains in order over calls, overflow is rejected or flushed */
+static void TEST_QueueDrain(void)
+{
+	const CLCD_Handle_t* Local_pHandle = &Global_FourBitHandle;
+	TEST_Panel_t* Local_pPanel = &Global_Panels[0];
+	uint32_t Local_Characters;
+	uint32_t Local_Calls = 0;
+	uint32_t Local_Burst = 0;
+	uint16_t Local_Depth = 0;
+	uint16_t Local_Counter;
+
+	/* Execution time of a byte spans many service calls */
+	HOST_CHECK_EQUAL(CLCD_HandleMoveCursor(Local_pHandle , 0 , 0) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleFlush(Local_pHandle) , RT_OK);
+	HOST_pCounters->CyclesPerRead = TEST_BUSY_CYCLES_PER_READ;
+
+	/* Queue is filled without touching the bus */
+	Local_Characters = Local_pPanel->Characters;
+	for(Local_Counter = 0 ; Local_Counter < CLCD_QUEUE_SIZE ; Local_Counter++)
+	{
+		HOST_CHECK_EQUAL(CLCD_HandleWriteCharacter(Local_pHandle , (uint8_t)('A' + (Local_Counter % 26U))) , RT_OK);
+	}
+	HOST_CHECK_EQUAL(CLCD_HandleGetQueueDepth(Local_pHandle , &Local_Depth) , RT_OK);
+	HOST_CHECK_EQUAL(Local_Depth , CLCD_QUEUE_SIZE);
+	HOST_CHECK_EQUAL(Local_pPanel->Characters , Local_Characters);
+
+	/* Write from a context preempting engine finds queue full and is rejected, engine stops once controller is busy */
+	Global_PreemptWriteCount = 1;
+	Global_PreemptArmed = 1;
+	HOST_CHECK_EQUAL(CLCD_HandleService(Local_pHandle) , RT_OK);
+	Global_PreemptWriteCount = TEST_PREEMPT_WRITES;
+	HOST_CHECK_EQUAL(Global_PreemptStatus[0] , BUSY_FUNC);
+	HOST_CHECK_EQUAL(Local_pPanel->Characters - Local_Characters , 1);
+	HOST_CHECK_EQUAL(CLCD_HandleGetQueueDepth(Local_pHandle , &Local_Depth) , RT_OK);
+	HOST_CHECK_EQUAL(Local_Depth , CLCD_QUEUE_SIZE - 1U);
+
+	/* Remaining bytes go out over later calls, a burst at most per call */
+	while(Local_Depth != 0 && Local_Calls < TEST_DRAIN_CALLS)
+	{
+		Local_Characters = Local_pPanel->Characters;
+		CLCD_HandleService(Local_pHandle);
+		if(Local_pPanel->Characters - Local_Characters > Local_Burst)
+		{
+			Local_Burst = Local_pPanel->Characters - Local_Characters;
+		}
+		CLCD_HandleGetQueueDepth(Local_pHandle , &Local_Depth);
+		Local_Calls++;
+	}
+	HOST_CHECK_EQUAL(Local_Depth , 0);
+	HOST_CHECK(Local_Burst >= 1U && Local_Burst <= CLCD_SERVICE_BURST);
+	HOST_CHECK(Local_Calls >= CLCD_QUEUE_SIZE - 1U);
+	TEST_CheckQueuedCharacters(Local_pPanel , CLCD_QUEUE_SIZE);
+
+	/* Write overflowing queue from task context makes room in place, flush sends the rest */
+	HOST_CHECK_EQUAL(CLCD_HandleMoveCursor(Local_pHandle , 0 , 0) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleFlush(Local_pHandle) , RT_OK);
+	Local_Characters = Local_pPanel->Characters;
+	for(Local_Counter = 0 ; Local_Counter <= CLCD_QUEUE_SIZE ; Local_Counter++)
+	{
+		HOST_CHECK_EQUAL(CLCD_HandleWriteCharacter(Local_pHandle , (uint8_t)('A' + (Local_Counter % 26U))) , RT_OK);
+	}
+	HOST_CHECK_EQUAL(CLCD_HandleFlush(Local_pHandle) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleGetQueueDepth(Local_pHandle , &Local_Depth) , RT_OK);
+	HOST_CHECK_EQUAL(Local_Depth , 0);
+	HOST_CHECK_EQUAL(Local_pPanel->Characters - Local_Characters , CLCD_QUEUE_SIZE + 1U);
+	TEST_CheckQueuedCharacters(Local_pPanel , CLCD_QUEUE_SIZE + 1U);
+
+	/* Redraw frame over the characters */
+	HOST_pCounters->CyclesPerRead = TEST_CYCLES_PER_READ;
+	HOST_CHECK_EQUAL(CLCD_HandleFrameInvalidate(Local_pHandle) , RT_OK);
+	TEST_RefreshFrame(Local_pHandle , Local_pPanel);
+}
+
+/* Glyph cache: hits cost no bus byte, misses load free then least recently used off-screen slots */
+static void TEST_GlyphCache(void)
+{
+	const CLCD_Handle_t* Local_pHandle = &Global_FourBitHandle;
+	TEST_Panel_t* Local_pPanel = &Global_Panels[0];
+	uint8_t Local_Glyph;
+	uint8_t Local_Slot;
+	uint32_t Local_Bytes;
+	uint32_t Local_Hits = 0;
+	uint32_t Local_Misses = 0;
+
+	HOST_CHECK_EQUAL(CLCD_HandleResetGlyphCache(Local_pHandle) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleFrameClear(Local_pHandle) , RT_OK);
+	TEST_RefreshFrame(Local_pHandle , Local_pPanel);
+
+	/* Miss: glyph goes to first free slot, then address counter is back at cursor cell */
+	HOST_CHECK_EQUAL(CLCD_HandleMoveCursor(Local_pHandle , 1 , 3) , RT_OK);
+	Local_Bytes = Local_pPanel->Instructions + Local_pPanel->Characters;
+	HOST_CHECK_EQUAL(TEST_RequestGlyph(Local_pHandle , 0 , RT_OK) , 0);
+	HOST_CHECK_EQUAL((Local_pPanel->Instructions + Local_pPanel->Characters) - Local_Bytes , 1U + 1U + TEST_GLYPH_ROWS + 1U);
+	TEST_CheckPanelGlyph(Local_pPanel , 0 , 0);
+	HOST_CHECK_EQUAL(Local_pPanel->CGRamAccess , 0);
+	HOST_CHECK_EQUAL(Local_pPanel->AddressCounter , TEST_SECOND_LINE_ADDRESS + 3U);
+	HOST_CHECK_EQUAL(CLCD_HandleWriteCharacter(Local_pHandle , 0) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleFlush(Local_pHandle) , RT_OK);
+	HOST_CHECK_EQUAL(Local_pPanel->DDRam[TEST_SECOND_LINE_ADDRESS + 3U] , 0);
+
+	/* Hit: same slot, nothing sent */
+	Local_Bytes = Local_pPanel->Instructions + Local_pPanel->Characters;
+	HOST_CHECK_EQUAL(TEST_RequestGlyph(Local_pHandle , 0 , RT_OK) , 0);
+	HOST_CHECK_EQUAL((Local_pPanel->Instructions + Local_pPanel->Characters) - Local_Bytes , 0);
+
+	/* Remaining free slots are taken in order */
+	for(Local_Glyph = 1 ; Local_Glyph < TEST_GLYPH_SLOTS ; Local_Glyph++)
+	{
+		HOST_CHECK_EQUAL(TEST_RequestGlyph(Local_pHandle , Local_Glyph , RT_OK) , Local_Glyph);
+		TEST_CheckPanelGlyph(Local_pPanel , Local_Glyph , Local_Glyph);
+	}
+	HOST_CHECK_EQUAL(CLCD_HandleGetGlyphStatistics(Local_pHandle , &Local_Hits , &Local_Misses) , RT_OK);
+	HOST_CHECK_EQUAL(Local_Hits , 1);
+	HOST_CHECK_EQUAL(Local_Misses , TEST_GLYPH_SLOTS);
+
+	/* LRU eviction: glyph 0 is used again, so glyph 1 is the oldest and its slot is reloaded */
+	HOST_CHECK_EQUAL(TEST_RequestGlyph(Local_pHandle , 0 , RT_OK) , 0);
+	HOST_CHECK_EQUAL(TEST_RequestGlyph(Local_pHandle , 8 , RT_OK) , 1);
+	TEST_CheckPanelGlyph(Local_pPanel , 1 , 8);
+	TEST_CheckPanelGlyph(Local_pPanel , 0 , 0);
+	HOST_CHECK_EQUAL(TEST_RequestGlyph(Local_pHandle , 1 , RT_OK) , 2);
+
+	/* Oldest glyph shown in framebuffer (mirror code 8 + slot) is kept, next oldest is evicted */
+	HOST_CHECK_EQUAL(CLCD_HandleFrameWriteCharacter(Local_pHandle , 0 , 0 , TEST_GLYPH_SLOTS + 3U) , RT_OK);
+	HOST_CHECK_EQUAL(TEST_RequestGlyph(Local_pHandle , 9 , RT_OK) , 4);
+	TEST_CheckPanelGlyph(Local_pPanel , 3 , 3);
+
+	/* Kept after refresh too (sent frame shows it) */
+	TEST_RefreshFrame(Local_pHandle , Local_pPanel);
+	HOST_CHECK_EQUAL(Local_pPanel->DDRam[0] , TEST_GLYPH_SLOTS + 3U);
+	HOST_CHECK_EQUAL(TEST_RequestGlyph(Local_pHandle , 10 , RT_OK) , 5);
+	TEST_CheckPanelGlyph(Local_pPanel , 3 , 3);
+
+	/* Every slot on screen: request fails and no slot is touched */
+	for(Local_Slot = 0 ; Local_Slot < TEST_GLYPH_SLOTS ; Local_Slot++)
+	{
+		HOST_CHECK_EQUAL(CLCD_HandleFrameWriteCharacter(Local_pHandle , 0 , Local_Slot , Local_Slot) , RT_OK);
+	}
+	Local_Bytes = Local_pPanel->Instructions + Local_pPanel->Characters;
+	TEST_RequestGlyph(Local_pHandle , 11 , RT_NOK);
+	HOST_CHECK_EQUAL((Local_pPanel->Instructions + Local_pPanel->Characters) - Local_Bytes , 0);
+	HOST_CHECK_EQUAL(TEST_RequestGlyph(Local_pHandle , 9 , RT_OK) , 4);
+
+	/* Glyphs leave the screen */
+	HOST_CHECK_EQUAL(CLCD_HandleFrameClear(Local_pHandle) , RT_OK);
+	TEST_RefreshFrame(Local_pHandle , Local_pPanel);
+}
+
+/* Glyph load after cursor became unknown leaves address counter at first cell, where the driver writes next */
+static void TEST_GlyphCursorRestore(void)
+{
+	const CLCD_Handle_t* Local_pHandle = &Global_FourBitHandle;
+	TEST_Panel_t* Local_pPanel = &Global_Panels[0];
+	uint8_t Local_Slot;
+
+	HOST_CHECK_EQUAL(CLCD_HandleResetGlyphCache(Local_pHandle) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleMoveCursor(Local_pHandle , 0 , 5) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleSendCommand(Local_pHandle , TEST_CURSOR_SHIFT_LEFT) , RT_OK);
+	Local_Slot = TEST_RequestGlyph(Local_pHandle , 0 , RT_OK);
+	TEST_CheckPanelGlyph(Local_pPanel , Local_Slot , 0);
+	HOST_CHECK_EQUAL(Local_pPanel->CGRamAccess , 0);
+	HOST_CHECK_EQUAL(Local_pPanel->AddressCounter , 0);
+
+	/* String continues from the cell the driver now knows, not from CGRAM */
+	HOST_CHECK_EQUAL(CLCD_HandleWriteString(Local_pHandle , (uint8_t*)"ab") , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleFlush(Local_pHandle) , RT_OK);
+	HOST_CHECK_EQUAL(memcmp(Local_pPanel->DDRam , "ab" , 2) , 0);
+	TEST_CheckPanelGlyph(Local_pPanel , Local_Slot , 0);
+}
+
+/* Glyph requested by a context that preempts engine with too little queue room queues nothing and loads later */
+static void TEST_GlyphLoadPreempted(void)
+{
+	const CLCD_Handle_t* Local_pHandle = &Global_FourBitHandle;
+	TEST_Panel_t* Local_pPanel = &Global_Panels[0];
+	uint8_t Local_Glyph[TEST_GLYPH_ROWS];
+
+	HOST_CHECK_EQUAL(CLCD_HandleResetGlyphCache(Local_pHandle) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleMoveCursor(Local_pHandle , 0 , 0) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleWriteCharacter(Local_pHandle , '>') , RT_OK);
+	TEST_MakeGlyph(12 , Local_Glyph);
+	Global_pPreemptGlyph = Local_Glyph;
+	Global_PreemptWriteCount = CLCD_QUEUE_SIZE / 11U;
+	Global_PreemptArmed = 1;
+	HOST_CHECK_EQUAL(CLCD_HandleService(Local_pHandle) , RT_OK);
+	Global_PreemptWriteCount = TEST_PREEMPT_WRITES;
+	Global_pPreemptGlyph = NULL;
+
+	/* Queue had room for part of the load only: none of it is queued */
+	HOST_CHECK_EQUAL(Global_PreemptGlyphStatus , BUSY_FUNC);
+	HOST_CHECK(Global_PreemptDepthBefore > (CLCD_QUEUE_SIZE - (TEST_GLYPH_ROWS + 2U)) && Global_PreemptDepthBefore < CLCD_QUEUE_SIZE);
+	HOST_CHECK_EQUAL(Global_PreemptDepthAfter , Global_PreemptDepthBefore);
+	HOST_CHECK_EQUAL(CLCD_HandleFlush(Local_pHandle) , RT_OK);
+	HOST_CHECK_EQUAL(Local_pPanel->CGRamAccess , 0);
+
+	/* Slot was not recorded: next request is a miss that loads the glyph */
+	HOST_CHECK_EQUAL(TEST_RequestGlyph(Local_pHandle , 12 , RT_OK) , 0);
+	TEST_CheckPanelGlyph(Local_pPanel , 0 , 12);
+	HOST_CHECK_EQUAL(Local_pPanel->CGRamAccess , 0);
+
+	/* Redraw frame over the numbers */
+	HOST_CHECK_EQUAL(CLCD_HandleFrameInvalidate(Local_pHandle) , RT_OK);
+	TEST_RefreshFrame(Local_pHandle , Local_pPanel);
+}
+
+/* Strings, cursor moves and text boxes on 16x2, 20x4 and 40x2 panels */
+static void TEST_Layouts(void)
+{
+	CLCD_Handle_t* Local_pHandle = &Global_EightBitHandle;
+	TEST_Panel_t* Local_pPanel = &Global_Panels[1];
+	const TEST_Geometry_t* Local_pGeometry;
+	CLCD_TextBox_t Local_Box;
+	const char* Local_Rows[TEST_MAX_ROWS];
+	char Local_Expected[2][TEST_MAX_CELLS / 2U + 1U];
+	uint8_t Local_Text[TEST_MAX_CELLS + 1U];
+	uint8_t Local_Geometry;
+	uint8_t Local_Row;
+	uint8_t Local_Cell;
+	uint32_t Local_Instructions;
+
+	for(Local_Geometry = 0 ; Local_Geometry < TEST_GEOMETRIES ; Local_Geometry++)
+	{
+		Local_pGeometry = &Global_Geometries[Local_Geometry];
+		Local_pHandle->rows = Local_pGeometry->Rows;
+		Local_pHandle->columns = Local_pGeometry->Columns;
+		HOST_CHECK_EQUAL(CLCD_HandleInit(Local_pHandle) , RT_OK);
+
+		/* String filling every cell: address instructions only where address counter does not run on by itself */
+		for(Local_Cell = 0 ; Local_Cell < (Local_pGeometry->Rows * Local_pGeometry->Columns) ; Local_Cell++)
+		{
+			Local_Text[Local_Cell] = (uint8_t)('A' + (Local_Cell % 26U));
+		}
+		Local_Text[Local_Cell] = '\0';
+		Local_Instructions = Local_pPanel->Instructions;
+		HOST_CHECK_EQUAL(CLCD_HandleMoveCursor(Local_pHandle , 0 , 0) , RT_OK);
+		HOST_CHECK_EQUAL(CLCD_HandleWriteString(Local_pHandle , Local_Text) , RT_OK);
+		HOST_CHECK_EQUAL(CLCD_HandleFlush(Local_pHandle) , RT_OK);
+		HOST_CHECK_EQUAL(Local_pPanel->Instructions - Local_Instructions , Local_pGeometry->WrapInstructions);
+		HOST_CHECK_EQUAL(Local_pPanel->AddressCounter , 0);
+		for(Local_Row = 0 ; Local_Row < Local_pGeometry->Rows ; Local_Row++)
+		{
+			HOST_CHECK_EQUAL(Local_pPanel->DDRam[Local_pGeometry->RowAddress[Local_Row]] , Local_Text[Local_Row * Local_pGeometry->Columns]);
+			Local_Rows[Local_Row] = (const char*)&Local_Text[Local_Row * Local_pGeometry->Columns];
+		}
+		TEST_CheckPanelShows(Local_pPanel , Local_Rows);
+
+		/* Cursor moves: an address instruction only if address counter is elsewhere */
+		Local_Instructions = Local_pPanel->Instructions;
+		HOST_CHECK_EQUAL(CLCD_HandleMoveCursor(Local_pHandle , 0 , 0) , RT_OK);
+		HOST_CHECK_EQUAL(CLCD_HandleMoveCursor(Local_pHandle , Local_pGeometry->Rows - 1U , 1) , RT_OK);
+		HOST_CHECK_EQUAL(CLCD_HandleWriteCharacter(Local_pHandle , '*') , RT_OK);
+		HOST_CHECK_EQUAL(CLCD_HandleMoveCursor(Local_pHandle , Local_pGeometry->Rows - 1U , 2) , RT_OK);
+		HOST_CHECK_EQUAL(CLCD_HandleMoveCursor(Local_pHandle , Local_pGeometry->Rows , 0) , RT_NOK);
+		HOST_CHECK_EQUAL(CLCD_HandleMoveCursor(Local_pHandle , 0 , Local_pGeometry->Columns) , RT_NOK);
+		HOST_CHECK_EQUAL(CLCD_HandleFlush(Local_pHandle) , RT_OK);
+		HOST_CHECK_EQUAL(Local_pPanel->Instructions - Local_Instructions , 1);
+		HOST_CHECK_EQUAL(Local_pPanel->DDRam[Local_pGeometry->RowAddress[Local_pGeometry->Rows - 1U] + 1U] , '*');
+		HOST_CHECK_EQUAL(Local_pPanel->AddressCounter , Local_pGeometry->RowAddress[Local_pGeometry->Rows - 1U] + 2U);
+
+		/* Text box over whole panel: word wrap breaks long word at width, last lines are shown */
+		Local_Box.firstRow = 0;
+		Local_Box.lastRow = Local_pGeometry->Rows - 1U;
+		Local_Box.alignment = CLCD_ALIGN_LEFT;
+		Local_Box.wrapMode = CLCD_WRAP_WORD;
+		HOST_CHECK_EQUAL(CLCD_HandleFrameWriteText(Local_pHandle , &Local_Box , (const uint8_t*)TEST_LONG_WORD_TEXT) , RT_OK);
+		TEST_RefreshFrame(Local_pHandle , Local_pPanel);
+		TEST_CheckPanelShows(Local_pPanel , Local_pGeometry->WordRows);
+		Local_Box.wrapMode = CLCD_WRAP_CHARACTER;
+		HOST_CHECK_EQUAL(CLCD_HandleFrameWriteText(Local_pHandle , &Local_Box , (const uint8_t*)TEST_LONG_WORD_TEXT) , RT_OK);
+		TEST_RefreshFrame(Local_pHandle , Local_pPanel);
+		TEST_CheckPanelShows(Local_pPanel , Local_pGeometry->CharRows);
+
+		/* One row box: text is clipped to its last line, aligned, and rows around box are kept */
+		HOST_CHECK_EQUAL(CLCD_HandleFrameClear(Local_pHandle) , RT_OK);
+		HOST_CHECK_EQUAL(CLCD_HandleFrameWriteString(Local_pHandle , Local_pGeometry->Rows - 1U , 0 , (const uint8_t*)"KEEP") , RT_OK);
+		Local_Box.firstRow = Local_pGeometry->Rows - 2U;
+		Local_Box.lastRow = Local_pGeometry->Rows - 2U;
+		Local_Box.alignment = CLCD_ALIGN_RIGHT;
+		Local_Box.wrapMode = CLCD_WRAP_WORD;
+		HOST_CHECK_EQUAL(CLCD_HandleFrameWriteText(Local_pHandle , &Local_Box , (const uint8_t*)"first line\nsecond") , RT_OK);
+		TEST_RefreshFrame(Local_pHandle , Local_pPanel);
+		snprintf(Local_Expected[0] , sizeof(Local_Expected[0]) , "%*s" , Local_pGeometry->Columns , "second");
+		for(Local_Row = 0 ; Local_Row < Local_pGeometry->Rows ; Local_Row++)
+		{
+			Local_Rows[Local_Row] = "";
+		}
+		Local_Rows[Local_pGeometry->Rows - 2U] = Local_Expected[0];
+		Local_Rows[Local_pGeometry->Rows - 1U] = "KEEP";
+		TEST_CheckPanelShows(Local_pPanel , Local_Rows);
+		Local_Box.alignment = CLCD_ALIGN_CENTER;
+		HOST_CHECK_EQUAL(CLCD_HandleFrameWriteText(Local_pHandle , &Local_Box , (const uint8_t*)"mid") , RT_OK);
+		TEST_RefreshFrame(Local_pHandle , Local_pPanel);
+		snprintf(Local_Expected[0] , sizeof(Local_Expected[0]) , "%*s" , ((Local_pGeometry->Columns - 3U) >> 1) + 3U , "mid");
+		TEST_CheckPanelShows(Local_pPanel , Local_Rows);
+		Local_Box.lastRow = Local_pGeometry->Rows;
+		HOST_CHECK_EQUAL(CLCD_HandleFrameWriteText(Local_pHandle , &Local_Box , (const uint8_t*)"out") , RT_NOK);
+		HOST_CHECK_EQUAL(CLCD_HandleFrameAppendText(Local_pHandle , &Local_Box , (const uint8_t*)"out") , RT_NOK);
+
+		/* Two rows box appended like a terminal, rows around box are kept */
+		HOST_CHECK_EQUAL(CLCD_HandleFrameClear(Local_pHandle) , RT_OK);
+		HOST_CHECK_EQUAL(CLCD_HandleFrameWriteString(Local_pHandle , 0 , 0 , (const uint8_t*)"TOP") , RT_OK);
+		HOST_CHECK_EQUAL(CLCD_HandleFrameWriteString(Local_pHandle , Local_pGeometry->Rows - 1U , 0 , (const uint8_t*)"KEEP") , RT_OK);
+		Local_Box.firstRow = (Local_pGeometry->Rows == 2U) ? 0U : 1U;
+		Local_Box.lastRow = Local_Box.firstRow + 1U;
+		Local_Box.alignment = CLCD_ALIGN_LEFT;
+		Local_Box.wrapMode = CLCD_WRAP_CHARACTER;
+		HOST_CHECK_EQUAL(CLCD_HandleFrameAppendText(Local_pHandle , &Local_Box , (const uint8_t*)"one") , RT_OK);
+		HOST_CHECK_EQUAL(CLCD_HandleFrameAppendText(Local_pHandle , &Local_Box , (const uint8_t*)"two\nthree") , RT_OK);
+		TEST_RefreshFrame(Local_pHandle , Local_pPanel);
+		Local_Rows[0] = "TOP";
+		Local_Rows[Local_pGeometry->Rows - 1U] = "KEEP";
+		Local_Rows[Local_Box.firstRow] = "two";
+		Local_Rows[Local_Box.lastRow] = "three";
+		TEST_CheckPanelShows(Local_pPanel , Local_Rows);
+		HOST_CHECK_EQUAL(CLCD_HandleFrameAppendText(Local_pHandle , &Local_Box , (const uint8_t*)TEST_LONG_LINE_TEXT) , RT_OK);
+		TEST_RefreshFrame(Local_pHandle , Local_pPanel);
+		Local_Rows[Local_Box.firstRow] = Local_pGeometry->AppendRows[0];
+		Local_Rows[Local_Box.lastRow] = Local_pGeometry->AppendRows[1];
+		TEST_CheckPanelShows(Local_pPanel , Local_Rows);
+	}
+
+	/* Back to 4x20 panel of the other tests */
+	Local_pHandle->rows = 4U;
+	Local_pHandle->columns = 20U;
+	HOST_CHECK_EQUAL(CLCD_HandleInit(Local_pHandle) , RT_OK);
+}
+
+/* Cycle counter polls spent clearing panel then writing a string */
+static uint32_t TEST_ClearAndWrite(const CLCD_Handle_t* Copy_pHandle)
+{
+	uint32_t Local_Start = TEST_DWT_CYCCNT;
+
+	HOST_CHECK_EQUAL(CLCD_HandleSendCommand(Copy_pHandle , TEST_CLEAR_DISPLAY) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleWriteString(Copy_pHandle , (uint8_t*)"Busy flag") , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleFlush(Copy_pHandle) , RT_OK);
+
+	return (TEST_DWT_CYCCNT - Local_Start) / TEST_BUSY_CYCLES_PER_READ;
+}
+
+/* Busy flag read back ends instruction waits early, execution time stays the upper bound */
+static void TEST_BusyFlag(void)
+{
+	CLCD_Handle_t* Local_pHandle = &Global_EightBitHandle;
+	TEST_Panel_t* Local_pPanel = &Global_Panels[1];
+	uint32_t Local_TimedPolls;
+	uint32_t Local_FlagPolls;
+	uint32_t Local_FlagReads;
+	uint8_t Local_Data[9];
+
+	HOST_pCounters->CyclesPerRead = TEST_BUSY_CYCLES_PER_READ;
+	Global_BusyReads = TEST_BUSY_READS;
+
+	/* Timed wait: whole execution time of every instruction, controller is never read */
+	Local_TimedPolls = TEST_ClearAndWrite(Local_pHandle);
+	HOST_CHECK_EQUAL(Local_pPanel->FlagReads , 0);
+	HOST_CHECK_EQUAL(memcmp(Local_pPanel->DDRam , "Busy flag" , 9) , 0);
+
+	/* Busy flag wait: each wait ends once controller is ready */
+	Local_pHandle->waitMode = CLCD_WAIT_BUSY_FLAG;
+	HOST_CHECK_EQUAL(CLCD_HandleInit(Local_pHandle) , RT_OK);
+	Local_FlagReads = Local_pPanel->FlagReads;
+	Local_FlagPolls = TEST_ClearAndWrite(Local_pHandle);
+	HOST_CHECK_EQUAL(memcmp(Local_pPanel->DDRam , "Busy flag" , 9) , 0);
+	HOST_CHECK(Local_pPanel->FlagReads - Local_FlagReads >= 10U * (TEST_BUSY_READS + 1U));
+	HOST_CHECK_EQUAL(Local_pPanel->BusyReads , 0);
+	HOST_CHECK(Local_FlagPolls * 4U < Local_TimedPolls);
+
+	/* Controller that never gets ready: wait ends with execution time */
+	Global_BusyReads = TEST_TIMEOUT_BUSY_READS;
+	HOST_CHECK(TEST_ClearAndWrite(Local_pHandle) >= Local_TimedPolls);
+	HOST_CHECK_EQUAL(memcmp(Local_pPanel->DDRam , "Busy flag" , 9) , 0);
+	Global_BusyReads = TEST_BUSY_READS;
+
+	/* DDRAM read back through data pins, cursor is put back where it was */
+	HOST_CHECK_EQUAL(CLCD_HandleMoveCursor(Local_pHandle , 1 , 2) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleWriteString(Local_pHandle , (uint8_t*)"Read me") , RT_OK);
+	memset(Local_Data , 0 , sizeof(Local_Data));
+	HOST_CHECK_EQUAL(CLCD_HandleReadDDRam(Local_pHandle , TEST_READ_ADDRESS , Local_Data , 7) , RT_OK);
+	HOST_CHECK_EQUAL(memcmp(Local_Data , "Read me" , 7) , 0);
+	HOST_CHECK_EQUAL(CLCD_HandleReadDDRam(Local_pHandle , 0 , Local_Data , 9) , RT_OK);
+	HOST_CHECK_EQUAL(memcmp(Local_Data , "Busy flag" , 9) , 0);
+	HOST_CHECK_EQUAL(Local_pPanel->AddressCounter , TEST_READ_ADDRESS + 7U);
+	HOST_CHECK_EQUAL(CLCD_HandleWriteCharacter(Local_pHandle , '!') , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleFlush(Local_pHandle) , RT_OK);
+	HOST_CHECK_EQUAL(Local_pPanel->DDRam[TEST_READ_ADDRESS + 7U] , '!');
+	HOST_CHECK_EQUAL(CLCD_HandleReadDDRam(Local_pHandle , TEST_DDRAM_SIZE - 1U , Local_Data , 2) , OUT_OF_RANGE);
+	HOST_CHECK_EQUAL(CLCD_HandleReadDDRam(Local_pHandle , 0 , NULL , 1) , NULL_POINTER);
+	HOST_CHECK_EQUAL(CLCD_HandleReadDDRam(&Global_FourBitHandle , 0 , Local_Data , 1) , RT_NOK);
+
+	/* Written bytes still reach the panel after bus was turned to reads */
+	HOST_CHECK_EQUAL(CLCD_HandleMoveCursor(Local_pHandle , 0 , 0) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleWriteString(Local_pHandle , (uint8_t*)"Written") , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleFlush(Local_pHandle) , RT_OK);
+	HOST_CHECK_EQUAL(memcmp(Local_pPanel->DDRam , "Written" , 7) , 0);
+
+	/* Back to timed 4x20 panel of the other tests */
+	Global_BusyReads = 0;
+	HOST_pCounters->CyclesPerRead = TEST_CYCLES_PER_READ;
+	Local_pHandle->waitMode = CLCD_WAIT_TIMED;
+	HOST_CHECK_EQUAL(CLCD_HandleInit(Local_pHandle) , RT_OK);
+}
+
+/* 8-bit panel sharing port for RS and data clocks a byte in three stores */
+static void TEST_EightBitFrameStores(void)
+{
+	const CLCD_Handle_t* Local_pHandle = &Global_EightBitHandle;
+	TEST_Panel_t* Local_pPanel = &Global_Panels[1];
+	const char* Local_Rows[4] = {"Row zero" , "" , "Row two (DDRAM 0x14)" , "Row three"};
+	uint32_t Local_Stores;
+	uint32_t Local_Bytes;
+
+	HOST_CHECK_EQUAL(CLCD_HandleFrameWriteString(Local_pHandle , 0 , 0 , (const uint8_t*)Local_Rows[0]) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleFrameWriteString(Local_pHandle , 2 , 0 , (const uint8_t*)Local_Rows[2]) , RT_OK);
+	HOST_CHECK_EQUAL(CLCD_HandleFrameWriteString(Local_pHandle , 3 , 0 , (const uint8_t*)Local_Rows[3]) , RT_OK);
+	Local_Stores = HOST_pCounters->GpioStores[GPIO_PORT_C];
+	Local_Bytes = TEST_RefreshFrame(Local_pHandle , Local_pPanel);
+	TEST_CheckPanelShows(Local_pPanel , Local_Rows);
+	HOST_CHECK(Local_Bytes >= 80U && Local_Bytes <= 84U);
+	HOST_CHECK_EQUAL(HOST_pCounters->GpioStores[GPIO_PORT_C] - Local_Stores , Local_Bytes * TEST_EIGHT_BIT_STORES_PER_BYTE);
+
+	/* Blank row written with blanks again: nothing to send */
+	HOST_CHECK_EQUAL(CLCD_HandleFrameWriteString(Local_pHandle , 1 , 0 , (const uint8_t*)"    ") , RT_OK);
+	HOST_CHECK_EQUAL(TEST_RefreshFrame(Local_pHandle , Local_pPanel) , 0);
+
+	/* Invalidated frame is redrawn in full */
+	HOST_CHECK_EQUAL(CLCD_HandleFrameInvalidate(Local_pHandle) , RT_OK);
+	Local_Stores = HOST_pCounters->GpioStores[GPIO_PORT_C];
+	Local_Bytes = TEST_RefreshFrame(Local_pHandle , Local_pPanel);
+	HOST_CHECK(Local_Bytes >= 80U && Local_Bytes <= 84U);
+	HOST_CHECK_EQUAL(HOST_pCounters->GpioStores[GPIO_PORT_C] - Local_Stores , Local_Bytes * TEST_EIGHT_BIT_STORES_PER_BYTE);
+	TEST_CheckPanelShows(Local_pPanel , Local_Rows);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    BENCHMARKS                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Frames refreshed per second with GPIO as plain memory (cycle counter still moves) */
+static void BENCH_FrameRefresh(void)
+{
+	CLCD_Handle_t* Local_pHandle = &Global_FourBitHandle;
+	uint8_t Local_Text[4];
+	uint64_t Local_Start;
+	uint32_t Local_Frame;
+
+	HOST_CHECK_EQUAL(CLCD_HandleInit(Local_pHandle) , RT_OK);
+	HOST_SetModelledDevices(HOST_DEVICE_DWT);
+
+	/* Full redraw of every cell */
+	Local_Start = HOST_TimeNs();
+	for(Local_Frame = 0 ; Local_Frame < TEST_BENCH_FRAMES ; Local_Frame++)
+	{
+		CLCD_HandleFrameInvalidate(Local_pHandle);
+		CLCD_HandleFrameRefresh(Local_pHandle);
+		CLCD_HandleFlush(Local_pHandle);
+	}
+	HOST_Report("CLCD full frame refresh (2x20)" , HOST_TimeNs() - Local_Start , TEST_BENCH_FRAMES , 0);
+
+	/* Three changed cells per frame (clock seconds) */
+	Local_Start = HOST_TimeNs();
+	for(Local_Frame = 0 ; Local_Frame < TEST_BENCH_FRAMES ; Local_Frame++)
+	{
+		snprintf((char*)Local_Text , sizeof(Local_Text) , "%02u" , (unsigned)(Local_Frame % 60U));
+		CLCD_HandleFrameWriteString(Local_pHandle , 1 , 6 , Local_Text);
+		CLCD_HandleFrameRefresh(Local_pHandle);
+		CLCD_HandleFlush(Local_pHandle);
+	}
+	HOST_Report("CLCD partial frame refresh (2 cells)" , HOST_TimeNs() - Local_Start , TEST_BENCH_FRAMES , 0);
+
+	/* Unchanged frame: comparison only */
+	Local_Start = HOST_TimeNs();
+	for(Local_Frame = 0 ; Local_Frame < TEST_BENCH_FRAMES ; Local_Frame++)
+	{
+		CLCD_HandleFrameRefresh(Local_pHandle);
+	}
+	HOST_Report("CLCD unchanged frame refresh" , HOST_TimeNs() - Local_Start , TEST_BENCH_FRAMES , 0);
+
+	HOST_SetModelledDevices(HOST_ALL_DEVICES);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                       MAIN                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+int main(int argc , char** argv)
+{
+	uint8_t Local_Benchmark = HOST_IsBenchmarkRun(argc , argv);
+
+	HOST_ModelInit(HOST_DEVICE_GPIO | HOST_DEVICE_DWT);
+	HOST_pCounters->CyclesPerRead = TEST_CYCLES_PER_READ;
+
+	if(Local_Benchmark == 1)
+	{
+		BENCH_FrameRefresh();
+	}
+	else
+	{
+		HOST_SetGpioObserver(TEST_BusObserver);
+		TEST_Init();
+		TEST_FourBitFrameStores();
+		TEST_EightBitFrameStores();
+		TEST_Layouts();
+		TEST_BusyFlag();
+		TEST_WriteNumberPreempted();
+		TEST_QueueDrain();
+		TEST_GlyphCache();
+		TEST_GlyphCursorRestore();
+		TEST_GlyphLoadPreempted();
+		HOST_SetGpioObserver(NULL);
+	}
+
+	return HOST_Summary("CLCD");
+}
@@ -0,0 +1,789 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : DMA Host Test                */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+
+#include "DMA_Private.h"
+#include "DMA_Config.h"
+#include "DMA_Interface.h"
+
+#include "HOST_Model.h"
+#include "HOST_Test.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#define TEST_FLAG(Channel,Flag)			(1UL << (((Channel) * DMA_CHANNEL_FLAGS_WIDTH) + (Flag)))
+#define TEST_BENCH_ITERATIONS			1000000U
+#define TEST_QUEUE_LENGTH				16U
+#define TEST_TIMESTAMP_STEP				3U
+#define TEST_MEMORY_SIZE				70000U		/* More than one DMA block of byte items */
+#define TEST_MEMORY_GUARD				8U
+#define TEST_MEMORY_FILL				0xA5U
+#define TEST_ALL_CHANNELS_POOL_MASK		0x7FU
+#define TEST_STREAM_LENGTH				8U			/* Two halves of four halfword items */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static volatile uint32_t Global_CompleteCalls;
+static volatile uint32_t Global_HalfCalls;
+static volatile uint32_t Global_ErrorCalls;
+static volatile uint8_t Global_RaiseAgain;
+static uint32_t Global_Timestamp;
+
+/* Memory side sources and peripheral side destinations of queued memory to memory transfers */
+static uint8_t Global_QueueSource[DMA_TRANSFER_QUEUE_DEPTH + 1][TEST_QUEUE_LENGTH];
+static uint8_t Global_QueueDestination[DMA_TRANSFER_QUEUE_DEPTH + 1][TEST_QUEUE_LENGTH];
+
+/* Memory engine buffers with guard bytes on both ends of the destination */
+static uint8_t Global_MemorySource[TEST_MEMORY_SIZE + TEST_MEMORY_GUARD];
+static uint8_t Global_MemoryDestination[TEST_MEMORY_SIZE + (2 * TEST_MEMORY_GUARD)];
+static volatile uint32_t Global_JobNotifications;
+static volatile ERROR_STATUS_t Global_JobStatus;
+
+/* Stream buffer of halfword items and spans handed to the consumer */
+static uint16_t Global_StreamBuffer[TEST_STREAM_LENGTH];
+static uint16_t Global_StreamPeripheral;
+static void* Global_pStreamBlock;
+static uint16_t Global_StreamBlockLength;
+static volatile uint32_t Global_StreamBlocks;
+static volatile uint32_t Global_StreamRaiseFlags;
+
+void DMA1_Channel3_IRQHandler(void);
+void DMA1_Channel5_IRQHandler(void);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    CALLBACKS                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void TEST_CompleteCallback(void)
+{
+	Global_CompleteCalls++;
+
+	/* Same event raised again while callback runs must stay pending */
+	if(Global_RaiseAgain == 1)
+	{
+		Global_RaiseAgain = 0;
+		HOST_DmaRaiseFlags(DMA_CH3 , 1U << DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG);
+	}
+}
+
+static void TEST_HalfCallback(void)
+{
+	Global_HalfCalls++;
+}
+
+static void TEST_ErrorCallback(void)
+{
+	Global_ErrorCalls++;
+}
+
+static void TEST_JobCallback(ERROR_STATUS_t Copy_JobStatus)
+{
+	Global_JobNotifications++;
+	Global_JobStatus = Copy_JobStatus;
+}
+
+static void TEST_StreamConsumer(void* Copy_pBlock , uint16_t Copy_BlockLength)
+{
+	Global_pStreamBlock = Copy_pBlock;
+	Global_StreamBlockLength = Copy_BlockLength;
+	Global_StreamBlocks++;
+
+	/* DMA completes the other half while consumer is still reading this one */
+	if(Global_StreamRaiseFlags != 0)
+	{
+		HOST_DmaRaiseFlags(DMA_CH5 , Global_StreamRaiseFlags);
+		Global_StreamRaiseFlags = 0;
+	}
+}
+
+/* Time base that moves a fixed step on every read */
+static uint32_t TEST_Timestamp(void)
+{
+	Global_Timestamp += TEST_TIMESTAMP_STEP;
+	return Global_Timestamp;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     HELPERS                                       */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Channel 3 set up for queued memory to memory byte transfers (DIR reads memory side) */
+static void TEST_QueueChannelInit(void)
+{
+	DMA_ChannelConfig_t Local_Config =
+	{
+		DMA_TRANSFER_COMPLETE_INTERRUPT_ENABLE , DMA_HALF_TRANSFER_INTERRUPT_DISABLE , DMA_TRANSFER_ERROR_INTERRUPT_ENABLE ,
+		DMA_READ_FROM_MEMORY , DMA_CIRCULAR_MODE_DISABLE , DMA_PERIPHERAL_INCREMENT_MODE_ENABLE , DMA_MEMORY_INCREMENT_MODE_ENABLE ,
+		DMA_PERIPHERAL_SIZE_8_BITS , DMA_MEMORY_SIZE_8_BITS , DMA_CHANNEL_PRIORITY_HIGH , DMA_MEM_TO_MEM_MODE_ENABLE , 1
+	};
+	uint32_t Local_Slot;
+	uint32_t Local_Byte;
+
+	HOST_CHECK_EQUAL(DMA_ChannelInit(DMA_CH3 , &Local_Config) , RT_OK);
+
+	for(Local_Slot = 0 ; Local_Slot <= DMA_TRANSFER_QUEUE_DEPTH ; Local_Slot++)
+	{
+		for(Local_Byte = 0 ; Local_Byte < TEST_QUEUE_LENGTH ; Local_Byte++)
+		{
+			Global_QueueSource[Local_Slot][Local_Byte] = (uint8_t)((Local_Slot << 4) | Local_Byte);
+		}
+	}
+	memset(Global_QueueDestination , 0 , sizeof(Global_QueueDestination));
+}
+
+/* Snapshot of CCR/CNDTR/CPAR/CMAR store counters */
+static void TEST_ChannelStoresSnapshot(uint32_t* Copy_pStores)
+{
+	uint32_t Local_Register;
+
+	for(Local_Register = 0 ; Local_Register < HOST_DMA_CHANNEL_REGISTERS ; Local_Register++)
+	{
+		Copy_pStores[Local_Register] = HOST_pCounters->DmaChannelStores[Local_Register];
+	}
+}
+
+/* Descriptor copying source slot into destination slot */
+static DMA_TransferDescriptor_t TEST_QueueDescriptor(uint32_t Copy_Slot)
+{
+	DMA_TransferDescriptor_t Local_Descriptor =
+	{
+		(uint32_t*)Global_QueueDestination[Copy_Slot] , (uint32_t*)Global_QueueSource[Copy_Slot] , TEST_QUEUE_LENGTH ,
+		DMA_PERIPHERAL_SIZE_8_BITS , DMA_MEMORY_SIZE_8_BITS , DMA_PERIPHERAL_INCREMENT_MODE_ENABLE , DMA_MEMORY_INCREMENT_MODE_ENABLE
+	};
+
+	return Local_Descriptor;
+}
+
+/* Checks if slot was transferred */
+static uint8_t TEST_QueueSlotDone(uint32_t Copy_Slot)
+{
+	return (uint8_t)(memcmp(Global_QueueDestination[Copy_Slot] , Global_QueueSource[Copy_Slot] , TEST_QUEUE_LENGTH) == 0);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                      TESTS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Shared IRQ core: one ISR read, one IFCR store, callbacks of latched flags only */
+static void TEST_IrqDispatch(void)
+{
+	uint32_t Local_Stores;
+
+	HOST_CHECK_EQUAL(DMA_RegisterTransferCompleteCallback(DMA_CH3 , TEST_CompleteCallback) , RT_OK);
+	HOST_CHECK_EQUAL(DMA_RegisterHalfTransferCallback(DMA_CH3 , TEST_HalfCallback) , RT_OK);
+	HOST_CHECK_EQUAL(DMA_RegisterTransferErrorCallback(DMA_CH3 , TEST_ErrorCallback) , RT_OK);
+
+	/* Complete and half flags of channel 3, flags of channel 4 must not be touched */
+	HOST_DmaRaiseFlags(DMA_CH3 , (1U << DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG) | (1U << DMA_HALF_TRANSFER_INTERRUPT_FLAG));
+	HOST_DmaRaiseFlags(DMA_CH4 , 1U << DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG);
+	Local_Stores = HOST_pCounters->DmaStores;
+	DMA1_Channel3_IRQHandler();
+
+	HOST_CHECK_EQUAL(Global_CompleteCalls , 1);
+	HOST_CHECK_EQUAL(Global_HalfCalls , 1);
+	HOST_CHECK_EQUAL(Global_ErrorCalls , 0);
+	HOST_CHECK_EQUAL(HOST_pCounters->DmaStores - Local_Stores , 1);
+	HOST_CHECK_EQUAL(DMA->ISR & (DMA_CHANNEL_FLAGS_MASK << (DMA_CH3 * DMA_CHANNEL_FLAGS_WIDTH)) , 0);
+	HOST_CHECK(DMA->ISR & TEST_FLAG(DMA_CH4 , DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG));
+
+	/* Error flag only */
+	HOST_DmaRaiseFlags(DMA_CH3 , 1U << DMA_TRANSFER_ERROR_INTERRUPT_FLAG);
+	DMA1_Channel3_IRQHandler();
+	HOST_CHECK_EQUAL(Global_CompleteCalls , 1);
+	HOST_CHECK_EQUAL(Global_ErrorCalls , 1);
+
+	/* Event raised again from inside callback is kept for next IRQ */
+	Global_RaiseAgain = 1;
+	HOST_DmaRaiseFlags(DMA_CH3 , 1U << DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG);
+	DMA1_Channel3_IRQHandler();
+	HOST_CHECK_EQUAL(Global_CompleteCalls , 2);
+	HOST_CHECK(DMA->ISR & TEST_FLAG(DMA_CH3 , DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG));
+	DMA1_Channel3_IRQHandler();
+	HOST_CHECK_EQUAL(Global_CompleteCalls , 3);
+	HOST_CHECK_EQUAL(DMA->ISR & (DMA_CHANNEL_FLAGS_MASK << (DMA_CH3 * DMA_CHANNEL_FLAGS_WIDTH)) , 0);
+
+	/* Clean up for following tests */
+	DMA->IFCR = 0x0FFFFFFFUL;
+	DMA_RegisterTransferCompleteCallback(DMA_CH3 , NULL);
+	DMA_RegisterHalfTransferCallback(DMA_CH3 , NULL);
+	DMA_RegisterTransferErrorCallback(DMA_CH3 , NULL);
+}
+
+/* Compiled configuration: validated once, applied with one CCR store (plus EN clear) and one CNDTR store, cache hit skips CCR */
+static void TEST_CompiledConfig(void)
+{
+	DMA_ChannelConfig_t Local_Config =
+	{
+		DMA_TRANSFER_COMPLETE_INTERRUPT_ENABLE , DMA_HALF_TRANSFER_INTERRUPT_DISABLE , DMA_TRANSFER_ERROR_INTERRUPT_ENABLE ,
+		DMA_READ_FROM_PERIPHERAL , DMA_CIRCULAR_MODE_DISABLE , DMA_PERIPHERAL_INCREMENT_MODE_DISABLE , DMA_MEMORY_INCREMENT_MODE_ENABLE ,
+		DMA_PERIPHERAL_SIZE_16_BITS , DMA_MEMORY_SIZE_16_BITS , DMA_CHANNEL_PRIORITY_HIGH , DMA_MEM_TO_MEM_MODE_DISABLE , 64
+	};
+	DMA_ChannelCompiledConfig_t Local_Compiled;
+	DMA_ChannelCompiledConfig_t Local_Other;
+	DMA_ChannelUtilization_t Local_Utilization;
+	uint32_t Local_Before[HOST_DMA_CHANNEL_REGISTERS];
+	uint32_t Local_Stores;
+
+	/* Compiling touches no register and matches the constant image macro */
+	TEST_ChannelStoresSnapshot(Local_Before);
+	Local_Stores = HOST_pCounters->DmaStores;
+	HOST_CHECK_EQUAL(DMA_ChannelConfigCompile(&Local_Config , &Local_Compiled) , RT_OK);
+	HOST_CHECK_EQUAL(HOST_pCounters->DmaStores - Local_Stores , 0);
+	HOST_CHECK_EQUAL(Local_Compiled.channelControlImage ,
+					 DMA_CHANNEL_CONFIG_IMAGE(DMA_TRANSFER_COMPLETE_INTERRUPT_ENABLE , DMA_HALF_TRANSFER_INTERRUPT_DISABLE , DMA_TRANSFER_ERROR_INTERRUPT_ENABLE ,
+											  DMA_READ_FROM_PERIPHERAL , DMA_CIRCULAR_MODE_DISABLE , DMA_PERIPHERAL_INCREMENT_MODE_DISABLE , DMA_MEMORY_INCREMENT_MODE_ENABLE ,
+											  DMA_PERIPHERAL_SIZE_16_BITS , DMA_MEMORY_SIZE_16_BITS , DMA_CHANNEL_PRIORITY_HIGH , DMA_MEM_TO_MEM_MODE_DISABLE));
+	HOST_CHECK_EQUAL(Local_Compiled.channelBlockLength , 64);
+
+	/* Invalid configuration leaves output untouched */
+	Local_Other = Local_Compiled;
+	Local_Config.peripheralSize = 3;
+	HOST_CHECK_EQUAL(DMA_ChannelConfigCompile(&Local_Config , &Local_Other) , OUT_OF_RANGE);
+	HOST_CHECK_EQUAL(Local_Other.channelControlImage , Local_Compiled.channelControlImage);
+	Local_Config.peripheralSize = DMA_PERIPHERAL_SIZE_16_BITS;
+
+	/* First apply on channel 6: EN clear plus image on CCR, block length on CNDTR, addresses untouched */
+	TEST_ChannelStoresSnapshot(Local_Before);
+	HOST_CHECK_EQUAL(DMA_ChannelApplyCompiledConfig(DMA_CH6 , &Local_Compiled) , RT_OK);
+	HOST_CHECK_EQUAL(HOST_pCounters->DmaChannelStores[HOST_DMA_CCR] - Local_Before[HOST_DMA_CCR] , 2);
+	HOST_CHECK_EQUAL(HOST_pCounters->DmaChannelStores[HOST_DMA_CNDTR] - Local_Before[HOST_DMA_CNDTR] , 1);
+	HOST_CHECK_EQUAL(HOST_pCounters->DmaChannelStores[HOST_DMA_CPAR] - Local_Before[HOST_DMA_CPAR] , 0);
+	HOST_CHECK_EQUAL(HOST_pCounters->DmaChannelStores[HOST_DMA_CMAR] - Local_Before[HOST_DMA_CMAR] , 0);
+	HOST_CHECK_EQUAL(DMA->Channel[DMA_CH6].CCR , Local_Compiled.channelControlImage);
+	HOST_CHECK_EQUAL(DMA->Channel[DMA_CH6].CNDTR , 64);
+
+	/* Same image again: only EN clear reaches CCR, CNDTR is re-armed */
+	TEST_ChannelStoresSnapshot(Local_Before);
+	HOST_CHECK_EQUAL(DMA_ChannelInit(DMA_CH6 , &Local_Config) , RT_OK);
+	HOST_CHECK_EQUAL(HOST_pCounters->DmaChannelStores[HOST_DMA_CCR] - Local_Before[HOST_DMA_CCR] , 1);
+	HOST_CHECK_EQUAL(HOST_pCounters->DmaChannelStores[HOST_DMA_CNDTR] - Local_Before[HOST_DMA_CNDTR] , 1);
+	DMA_GetChannelUtilization(DMA_CH6 , &Local_Utilization);
+	HOST_CHECK_EQUAL(Local_Utilization.configurationsSkipped , 1);
+
+	/* Switching profile costs the same two CCR stores, an image with EN set never enables the channel */
+	Local_Other.channelControlImage = Local_Compiled.channelControlImage | (1U << CCR_CIRC) | (1U << CCR_EN);
+	Local_Other.channelBlockLength = 8;
+	TEST_ChannelStoresSnapshot(Local_Before);
+	HOST_CHECK_EQUAL(DMA_ChannelApplyCompiledConfig(DMA_CH6 , &Local_Other) , RT_OK);
+	HOST_CHECK_EQUAL(HOST_pCounters->DmaChannelStores[HOST_DMA_CCR] - Local_Before[HOST_DMA_CCR] , 2);
+	HOST_CHECK_EQUAL(HOST_pCounters->DmaChannelStores[HOST_DMA_CNDTR] - Local_Before[HOST_DMA_CNDTR] , 1);
+	HOST_CHECK_EQUAL(DMA->Channel[DMA_CH6].CCR , Local_Compiled.channelControlImage | (1U << CCR_CIRC));
+
+	/* Register changed behind the cache is rewritten */
+	DMA->Channel[DMA_CH6].CCR = 0;
+	TEST_ChannelStoresSnapshot(Local_Before);
+	HOST_CHECK_EQUAL(DMA_ChannelApplyCompiledConfig(DMA_CH6 , &Local_Other) , RT_OK);
+	HOST_CHECK_EQUAL(HOST_pCounters->DmaChannelStores[HOST_DMA_CCR] - Local_Before[HOST_DMA_CCR] , 2);
+	HOST_CHECK_EQUAL(DMA->Channel[DMA_CH6].CCR , Local_Compiled.channelControlImage | (1U << CCR_CIRC));
+}
+
+/* Stream: HT hands first half, TC second half, both at once or a half completed under the consumer are overruns */
+static void TEST_StreamDelivery(void)
+{
+	DMA_ChannelConfig_t Local_Config =
+	{
+		DMA_TRANSFER_COMPLETE_INTERRUPT_DISABLE , DMA_HALF_TRANSFER_INTERRUPT_DISABLE , DMA_TRANSFER_ERROR_INTERRUPT_DISABLE ,
+		DMA_READ_FROM_PERIPHERAL , DMA_CIRCULAR_MODE_DISABLE , DMA_PERIPHERAL_INCREMENT_MODE_DISABLE , DMA_MEMORY_INCREMENT_MODE_ENABLE ,
+		DMA_PERIPHERAL_SIZE_16_BITS , DMA_MEMORY_SIZE_16_BITS , DMA_CHANNEL_PRIORITY_HIGH , DMA_MEM_TO_MEM_MODE_DISABLE , 1
+	};
+	DMA_StreamStatistics_t Local_Statistics;
+	uint16_t* Local_pFirstHalf = &Global_StreamBuffer[0];
+	uint16_t* Local_pSecondHalf = &Global_StreamBuffer[TEST_STREAM_LENGTH / 2U];
+
+	HOST_CHECK_EQUAL(DMA_ChannelInit(DMA_CH5 , &Local_Config) , RT_OK);
+
+	/* Argument checks, nothing to stop before a stream starts */
+	HOST_CHECK_EQUAL(DMA_StreamStart(DMA_CH5 , NULL , Global_StreamBuffer , TEST_STREAM_LENGTH , TEST_StreamConsumer) , NULL_POINTER);
+	HOST_CHECK_EQUAL(DMA_StreamStop(DMA_CH7 + 1U) , OUT_OF_RANGE);
+	HOST_CHECK_EQUAL(DMA_StreamStop(DMA_CH5) , RT_NOK);
+	HOST_CHECK_EQUAL(DMA_StreamStart(DMA_CH5 , (uint32_t*)&Global_StreamPeripheral , Global_StreamBuffer , TEST_STREAM_LENGTH - 1U , TEST_StreamConsumer) , OUT_OF_RANGE);
+
+	/* Stream forces circular mode and its three interrupts, buffer is programmed whole */
+	HOST_CHECK_EQUAL(DMA_StreamStart(DMA_CH5 , (uint32_t*)&Global_StreamPeripheral , Global_StreamBuffer , TEST_STREAM_LENGTH , TEST_StreamConsumer) , RT_OK);
+	HOST_CHECK_EQUAL(DMA->Channel[DMA_CH5].CCR & ((1U << CCR_EN) | (1U << CCR_CIRC) | (1U << CCR_TCIE) | (1U << CCR_HTIE) | (1U << CCR_TEIE)) ,
+					 (1U << CCR_EN) | (1U << CCR_CIRC) | (1U << CCR_TCIE) | (1U << CCR_HTIE) | (1U << CCR_TEIE));
+	HOST_CHECK_EQUAL(DMA->Channel[DMA_CH5].CNDTR , TEST_STREAM_LENGTH);
+	HOST_CHECK_EQUAL(DMA->Channel[DMA_CH5].CMAR , (uint32_t)(unsigned long)Global_StreamBuffer);
+
+	/* Half transfer: first half, length in items */
+	HOST_DmaRaiseFlags(DMA_CH5 , 1U << DMA_HALF_TRANSFER_INTERRUPT_FLAG);
+	DMA1_Channel5_IRQHandler();
+	HOST_CHECK_EQUAL(Global_StreamBlocks , 1);
+	HOST_CHECK(Global_pStreamBlock == (void*)Local_pFirstHalf);
+	HOST_CHECK_EQUAL(Global_StreamBlockLength , TEST_STREAM_LENGTH / 2U);
+
+	/* Transfer complete: second half starts one half of items (not bytes) further */
+	HOST_DmaRaiseFlags(DMA_CH5 , 1U << DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG);
+	DMA1_Channel5_IRQHandler();
+	HOST_CHECK_EQUAL(Global_StreamBlocks , 2);
+	HOST_CHECK(Global_pStreamBlock == (void*)Local_pSecondHalf);
+	DMA_GetStreamStatistics(DMA_CH5 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.blocksDelivered , 2);
+	HOST_CHECK_EQUAL(Local_Statistics.itemsDelivered , TEST_STREAM_LENGTH);
+	HOST_CHECK_EQUAL(Local_Statistics.overruns , 0);
+
+	/* Both flags latched while DMA is back in first half: one overrun, only stable second half is handed */
+	DMA->Channel[DMA_CH5].CNDTR = TEST_STREAM_LENGTH - 1U;
+	HOST_DmaRaiseFlags(DMA_CH5 , (1U << DMA_HALF_TRANSFER_INTERRUPT_FLAG) | (1U << DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG));
+	DMA1_Channel5_IRQHandler();
+	HOST_CHECK_EQUAL(Global_StreamBlocks , 3);
+	HOST_CHECK(Global_pStreamBlock == (void*)Local_pSecondHalf);
+	DMA_GetStreamStatistics(DMA_CH5 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.overruns , 1);
+
+	/* Both flags latched while DMA is in second half: first half is the stable one */
+	DMA->Channel[DMA_CH5].CNDTR = 1U;
+	HOST_DmaRaiseFlags(DMA_CH5 , (1U << DMA_HALF_TRANSFER_INTERRUPT_FLAG) | (1U << DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG));
+	DMA1_Channel5_IRQHandler();
+	HOST_CHECK_EQUAL(Global_StreamBlocks , 4);
+	HOST_CHECK(Global_pStreamBlock == (void*)Local_pFirstHalf);
+	DMA_GetStreamStatistics(DMA_CH5 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.overruns , 2);
+
+	/* Other half completed while consumer reads first half: DMA wrapped into it, overrun is counted and flag stays pending */
+	Global_StreamRaiseFlags = 1U << DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG;
+	HOST_DmaRaiseFlags(DMA_CH5 , 1U << DMA_HALF_TRANSFER_INTERRUPT_FLAG);
+	DMA1_Channel5_IRQHandler();
+	DMA_GetStreamStatistics(DMA_CH5 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.overruns , 3);
+	HOST_CHECK(DMA->ISR & TEST_FLAG(DMA_CH5 , DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG));
+	DMA1_Channel5_IRQHandler();
+	HOST_CHECK_EQUAL(Global_StreamBlocks , 6);
+	HOST_CHECK(Global_pStreamBlock == (void*)Local_pSecondHalf);
+	DMA_GetStreamStatistics(DMA_CH5 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.blocksDelivered , 6);
+	HOST_CHECK_EQUAL(Local_Statistics.itemsDelivered , 6U * (TEST_STREAM_LENGTH / 2U));
+	HOST_CHECK_EQUAL(Local_Statistics.overruns , 3);
+
+	/* Transfer error ends the stream, later flags hand nothing */
+	HOST_DmaRaiseFlags(DMA_CH5 , 1U << DMA_TRANSFER_ERROR_INTERRUPT_FLAG);
+	DMA1_Channel5_IRQHandler();
+	HOST_DmaRaiseFlags(DMA_CH5 , 1U << DMA_HALF_TRANSFER_INTERRUPT_FLAG);
+	DMA1_Channel5_IRQHandler();
+	HOST_CHECK_EQUAL(Global_StreamBlocks , 6);
+	DMA_GetStreamStatistics(DMA_CH5 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.transferErrors , 1);
+	HOST_CHECK_EQUAL(DMA_StreamStop(DMA_CH5) , RT_NOK);
+
+	/* Restart resets counters, stop disables channel once */
+	HOST_CHECK_EQUAL(DMA_StreamStart(DMA_CH5 , (uint32_t*)&Global_StreamPeripheral , Global_StreamBuffer , TEST_STREAM_LENGTH , TEST_StreamConsumer) , RT_OK);
+	DMA_GetStreamStatistics(DMA_CH5 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.blocksDelivered , 0);
+	HOST_CHECK_EQUAL(Local_Statistics.overruns , 0);
+	HOST_CHECK_EQUAL(DMA_StreamStop(DMA_CH5) , RT_OK);
+	HOST_CHECK_EQUAL(DMA->Channel[DMA_CH5].CCR & (1U << CCR_EN) , 0);
+	HOST_CHECK_EQUAL(DMA_StreamStop(DMA_CH5) , RT_NOK);
+}
+
+/* Scatter-gather queue: first transfer starts at once, next ones are chained from TC IRQ */
+static void TEST_QueueChaining(void)
+{
+	DMA_TransferDescriptor_t Local_Descriptor;
+	DMA_QueueStatistics_t Local_Statistics;
+	uint32_t Local_Slot;
+
+	TEST_QueueChannelInit();
+	DMA_RegisterTimestampFunc(TEST_Timestamp);
+
+	/* Argument checks */
+	Local_Descriptor = TEST_QueueDescriptor(0);
+	HOST_CHECK_EQUAL(DMA_QueueTransfer(DMA_CH3 , NULL) , NULL_POINTER);
+	HOST_CHECK_EQUAL(DMA_QueueTransfer(DMA_CH7 + 1 , &Local_Descriptor) , OUT_OF_RANGE);
+	Local_Descriptor.length = 0;
+	HOST_CHECK_EQUAL(DMA_QueueTransfer(DMA_CH3 , &Local_Descriptor) , OUT_OF_RANGE);
+
+	/* Three transfers: only the head runs before any IRQ */
+	for(Local_Slot = 0 ; Local_Slot < 3 ; Local_Slot++)
+	{
+		Local_Descriptor = TEST_QueueDescriptor(Local_Slot);
+		HOST_CHECK_EQUAL(DMA_QueueTransfer(DMA_CH3 , &Local_Descriptor) , RT_OK);
+	}
+	HOST_CHECK(TEST_QueueSlotDone(0));
+	HOST_CHECK(!TEST_QueueSlotDone(1));
+	DMA_GetQueueStatistics(DMA_CH3 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.currentDepth , 3);
+	HOST_CHECK_EQUAL(Local_Statistics.maxDepth , 3);
+
+	/* Every TC IRQ retires head and starts next one back to back */
+	DMA1_Channel3_IRQHandler();
+	HOST_CHECK(TEST_QueueSlotDone(1));
+	HOST_CHECK(!TEST_QueueSlotDone(2));
+	DMA_GetQueueStatistics(DMA_CH3 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.transfersCompleted , 1);
+	HOST_CHECK_EQUAL(Local_Statistics.lastGapLatency , TEST_TIMESTAMP_STEP);
+
+	DMA1_Channel3_IRQHandler();
+	DMA1_Channel3_IRQHandler();
+	HOST_CHECK(TEST_QueueSlotDone(2));
+	DMA_GetQueueStatistics(DMA_CH3 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.currentDepth , 0);
+	HOST_CHECK_EQUAL(Local_Statistics.transfersCompleted , 3);
+	HOST_CHECK_EQUAL(Local_Statistics.maxGapLatency , TEST_TIMESTAMP_STEP);
+	HOST_CHECK_EQUAL(HOST_pCounters->DmaTransfers , 3);
+
+	/* Idle channel ignores a spurious IRQ */
+	DMA1_Channel3_IRQHandler();
+	DMA_GetQueueStatistics(DMA_CH3 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.transfersCompleted , 3);
+
+	/* Transfer error retires head as well and is counted apart */
+	Local_Descriptor = TEST_QueueDescriptor(3);
+	HOST_CHECK_EQUAL(DMA_QueueTransfer(DMA_CH3 , &Local_Descriptor) , RT_OK);
+	HOST_DmaRaiseFlags(DMA_CH3 , 1U << DMA_TRANSFER_ERROR_INTERRUPT_FLAG);
+	DMA1_Channel3_IRQHandler();
+	DMA_GetQueueStatistics(DMA_CH3 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.currentDepth , 0);
+	HOST_CHECK_EQUAL(Local_Statistics.transferErrors , 1);
+	HOST_CHECK_EQUAL(Local_Statistics.transfersCompleted , 3);
+
+	DMA_RegisterTimestampFunc(NULL);
+}
+
+/* Full queue refuses descriptors, flush aborts channel and drops them */
+static void TEST_QueueFullAndFlush(void)
+{
+	DMA_TransferDescriptor_t Local_Descriptor;
+	DMA_QueueStatistics_t Local_Statistics;
+	uint32_t Local_Slot;
+
+	TEST_QueueChannelInit();
+
+	/* No IRQ is served so head stays in the queue */
+	for(Local_Slot = 0 ; Local_Slot < DMA_TRANSFER_QUEUE_DEPTH ; Local_Slot++)
+	{
+		Local_Descriptor = TEST_QueueDescriptor(Local_Slot);
+		HOST_CHECK_EQUAL(DMA_QueueTransfer(DMA_CH3 , &Local_Descriptor) , RT_OK);
+	}
+	Local_Descriptor = TEST_QueueDescriptor(DMA_TRANSFER_QUEUE_DEPTH);
+	HOST_CHECK_EQUAL(DMA_QueueTransfer(DMA_CH3 , &Local_Descriptor) , BUSY_FUNC);
+	DMA_GetQueueStatistics(DMA_CH3 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.currentDepth , DMA_TRANSFER_QUEUE_DEPTH);
+
+	/* Flush disables channel and clears its pending flags */
+	HOST_CHECK_EQUAL(DMA_QueueFlush(DMA_CH3) , RT_OK);
+	HOST_CHECK_EQUAL(DMA->Channel[DMA_CH3].CCR & (1U << CCR_EN) , 0);
+	HOST_CHECK_EQUAL(DMA->ISR & (DMA_CHANNEL_FLAGS_MASK << (DMA_CH3 * DMA_CHANNEL_FLAGS_WIDTH)) , 0);
+	DMA_GetQueueStatistics(DMA_CH3 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.currentDepth , 0);
+	HOST_CHECK(!TEST_QueueSlotDone(1));
+
+	/* Queue restarts from idle */
+	HOST_CHECK_EQUAL(DMA_QueueTransfer(DMA_CH3 , &Local_Descriptor) , RT_OK);
+	HOST_CHECK(TEST_QueueSlotDone(DMA_TRANSFER_QUEUE_DEPTH));
+	DMA1_Channel3_IRQHandler();
+	DMA_GetQueueStatistics(DMA_CH3 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.currentDepth , 0);
+}
+
+/* Checks destination holds expected bytes at offset and guard bytes around them are untouched */
+static uint8_t TEST_MemoryResult(uint32_t Copy_Offset , const uint8_t* Copy_pExpected , uint8_t Copy_Value , uint32_t Copy_Size)
+{
+	uint8_t Local_Result = 1;
+	uint32_t Local_Index;
+
+	for(Local_Index = 0 ; Local_Index < (TEST_MEMORY_SIZE + (2 * TEST_MEMORY_GUARD)) && Local_Result == 1 ; Local_Index++)
+	{
+		if(Local_Index < Copy_Offset || Local_Index >= (Copy_Offset + Copy_Size))
+		{
+			Local_Result = (uint8_t)(Global_MemoryDestination[Local_Index] == TEST_MEMORY_FILL);
+		}
+		else if(Copy_pExpected != NULL)
+		{
+			Local_Result = (uint8_t)(Global_MemoryDestination[Local_Index] == Copy_pExpected[Local_Index - Copy_Offset]);
+		}
+		else
+		{
+			Local_Result = (uint8_t)(Global_MemoryDestination[Local_Index] == Copy_Value);
+		}
+	}
+
+	return Local_Result;
+}
+
+/* Memcpy/Memset: every size class (CPU only, CPU head/tail + DMA body, several DMA blocks) and relative alignment */
+static void TEST_MemoryEngine(void)
+{
+	static const uint32_t Local_Sizes[] = {0 , 1 , 3 , 31 , 32 , 33 , 35 , 64 , 101 , 1024 , 4097};
+	uint32_t Local_SizeIndex;
+	uint32_t Local_SourceOffset;
+	uint32_t Local_DestinationOffset;
+	uint32_t Local_Size;
+	uint32_t Local_Index;
+	uint32_t Local_Transfers;
+	uint8_t Local_Passed = 1;
+
+	for(Local_Index = 0 ; Local_Index < sizeof(Global_MemorySource) ; Local_Index++)
+	{
+		Global_MemorySource[Local_Index] = (uint8_t)((Local_Index * 7U) + (Local_Index >> 8));
+	}
+
+	HOST_CHECK_EQUAL(DMA_Memcpy(0 , Global_MemoryDestination , Global_MemorySource , 64) , OUT_OF_RANGE);
+	HOST_CHECK_EQUAL(DMA_Memcpy(TEST_ALL_CHANNELS_POOL_MASK , NULL , Global_MemorySource , 64) , NULL_POINTER);
+
+	for(Local_SizeIndex = 0 ; Local_SizeIndex < (sizeof(Local_Sizes) / sizeof(Local_Sizes[0])) ; Local_SizeIndex++)
+	{
+		Local_Size = Local_Sizes[Local_SizeIndex];
+		for(Local_SourceOffset = 0 ; Local_SourceOffset < 4 ; Local_SourceOffset++)
+		{
+			for(Local_DestinationOffset = TEST_MEMORY_GUARD ; Local_DestinationOffset < (TEST_MEMORY_GUARD + 4) ; Local_DestinationOffset++)
+			{
+				memset(Global_MemoryDestination , TEST_MEMORY_FILL , sizeof(Global_MemoryDestination));
+				Local_Passed &= (uint8_t)(DMA_Memcpy(TEST_ALL_CHANNELS_POOL_MASK , &Global_MemoryDestination[Local_DestinationOffset] ,
+													 &Global_MemorySource[Local_SourceOffset] , Local_Size) == RT_OK);
+				Local_Passed &= TEST_MemoryResult(Local_DestinationOffset , &Global_MemorySource[Local_SourceOffset] , 0 , Local_Size);
+
+				memset(Global_MemoryDestination , TEST_MEMORY_FILL , sizeof(Global_MemoryDestination));
+				Local_Passed &= (uint8_t)(DMA_Memset(TEST_ALL_CHANNELS_POOL_MASK , &Global_MemoryDestination[Local_DestinationOffset] ,
+													 (uint8_t)Local_Size , Local_Size) == RT_OK);
+				Local_Passed &= TEST_MemoryResult(Local_DestinationOffset , NULL , (uint8_t)Local_Size , Local_Size);
+			}
+		}
+	}
+	HOST_CHECK(Local_Passed);
+
+	/* Byte items only (source and destination one byte apart): job is split into DMA blocks of 65535 items */
+	memset(Global_MemoryDestination , TEST_MEMORY_FILL , sizeof(Global_MemoryDestination));
+	Local_Transfers = HOST_pCounters->DmaTransfers;
+	HOST_CHECK_EQUAL(DMA_Memcpy(TEST_ALL_CHANNELS_POOL_MASK , &Global_MemoryDestination[TEST_MEMORY_GUARD] , &Global_MemorySource[1] , TEST_MEMORY_SIZE) , RT_OK);
+	HOST_CHECK(TEST_MemoryResult(TEST_MEMORY_GUARD , &Global_MemorySource[1] , 0 , TEST_MEMORY_SIZE));
+	HOST_CHECK_EQUAL(HOST_pCounters->DmaTransfers - Local_Transfers , 2);
+}
+
+/* Channel running an asynchronous memory job is not handed to (nor stopped by) queue or stream users */
+static void TEST_MemoryJobOwnership(void)
+{
+	DMA_TransferDescriptor_t Local_Descriptor = TEST_QueueDescriptor(0);
+	DMA_QueueStatistics_t Local_Statistics;
+
+	Global_JobNotifications = 0;
+	memset(Global_MemoryDestination , TEST_MEMORY_FILL , sizeof(Global_MemoryDestination));
+	HOST_CHECK_EQUAL(DMA_MemcpyAsync(DMA_CH3_POOL_MASK , &Global_MemoryDestination[TEST_MEMORY_GUARD] , Global_MemorySource , 256 , TEST_JobCallback) , RT_OK);
+
+	/* Job owns channel 3 until its completion IRQ */
+	HOST_CHECK_EQUAL(DMA_QueueTransfer(DMA_CH3 , &Local_Descriptor) , BUSY_FUNC);
+	HOST_CHECK_EQUAL(DMA_StreamStart(DMA_CH3 , (uint32_t*)Global_QueueSource , Global_QueueDestination , TEST_QUEUE_LENGTH , TEST_StreamConsumer) , BUSY_FUNC);
+	HOST_CHECK_EQUAL(DMA_MemcpyAsync(DMA_CH3_POOL_MASK , Global_MemoryDestination , Global_MemorySource , 256 , TEST_JobCallback) , BUSY_FUNC);
+	HOST_CHECK_EQUAL(DMA_StreamStop(DMA_CH3) , RT_NOK);
+	HOST_CHECK_EQUAL(DMA->Channel[DMA_CH3].CCR & (1U << CCR_EN) , 1U << CCR_EN);
+	DMA_GetQueueStatistics(DMA_CH3 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.currentDepth , 0);
+
+	DMA1_Channel3_IRQHandler();
+	HOST_CHECK_EQUAL(Global_JobNotifications , 1);
+	HOST_CHECK_EQUAL(Global_JobStatus , RT_OK);
+	HOST_CHECK(TEST_MemoryResult(TEST_MEMORY_GUARD , Global_MemorySource , 0 , 256));
+
+	/* Channel is free again */
+	TEST_QueueChannelInit();
+	HOST_CHECK_EQUAL(DMA_QueueTransfer(DMA_CH3 , &Local_Descriptor) , RT_OK);
+	DMA1_Channel3_IRQHandler();
+
+	/* And a queue owns it against memory jobs and streams */
+	HOST_CHECK_EQUAL(DMA_QueueTransfer(DMA_CH3 , &Local_Descriptor) , RT_OK);
+	HOST_CHECK_EQUAL(DMA_MemcpyAsync(DMA_CH3_POOL_MASK , Global_MemoryDestination , Global_MemorySource , 256 , TEST_JobCallback) , BUSY_FUNC);
+	HOST_CHECK_EQUAL(DMA_StreamStart(DMA_CH3 , (uint32_t*)Global_QueueSource , Global_QueueDestination , TEST_QUEUE_LENGTH , TEST_StreamConsumer) , BUSY_FUNC);
+	HOST_CHECK_EQUAL(DMA_StreamStop(DMA_CH3) , RT_NOK);
+	HOST_CHECK_EQUAL(DMA->Channel[DMA_CH3].CCR & (1U << CCR_EN) , 1U << CCR_EN);
+	DMA1_Channel3_IRQHandler();
+	DMA_GetQueueStatistics(DMA_CH3 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.currentDepth , 0);
+}
+
+/* Allocator does not hand out channels owned by memory jobs, queues or streams */
+static void TEST_AllocatorOwnership(void)
+{
+	DMA_TransferDescriptor_t Local_Descriptor = TEST_QueueDescriptor(0);
+	uint8_t Local_ChannelId;
+
+	/* Memory job owns channel 3 */
+	HOST_CHECK_EQUAL(DMA_MemcpyAsync(DMA_CH3_POOL_MASK , Global_MemoryDestination , Global_MemorySource , 256 , TEST_JobCallback) , RT_OK);
+	HOST_CHECK_EQUAL(DMA_AllocateChannel(DMA_REQUEST_SPI1_TX , &Local_ChannelId) , BUSY_FUNC);
+	DMA1_Channel3_IRQHandler();
+
+	/* Queue owns channel 3 until drained */
+	TEST_QueueChannelInit();
+	HOST_CHECK_EQUAL(DMA_QueueTransfer(DMA_CH3 , &Local_Descriptor) , RT_OK);
+	HOST_CHECK_EQUAL(DMA_AllocateChannel(DMA_REQUEST_SPI1_TX , &Local_ChannelId) , BUSY_FUNC);
+	DMA1_Channel3_IRQHandler();
+
+	/* Stream owns channel 3 until stopped */
+	HOST_CHECK_EQUAL(DMA_StreamStart(DMA_CH3 , (uint32_t*)Global_QueueSource , Global_QueueDestination , TEST_QUEUE_LENGTH , TEST_StreamConsumer) , RT_OK);
+	HOST_CHECK_EQUAL(DMA_AllocateChannel(DMA_REQUEST_SPI1_TX , &Local_ChannelId) , BUSY_FUNC);
+	HOST_CHECK_EQUAL(DMA_StreamStop(DMA_CH3) , RT_OK);
+
+	/* Channel is free again */
+	HOST_CHECK_EQUAL(DMA_AllocateChannel(DMA_REQUEST_SPI1_TX , &Local_ChannelId) , RT_OK);
+	HOST_CHECK_EQUAL(Local_ChannelId , DMA_CH3);
+	HOST_CHECK_EQUAL(DMA_FreeChannel(DMA_CH3) , RT_OK);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    BENCHMARKS                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Cost of one dispatch on plain memory (registers untrapped, IFCR store has no effect so flags stay raised) */
+static void BENCH_IrqDispatch(const char* Copy_pName , uint32_t Copy_Flags)
+{
+	uint64_t Local_Start;
+	uint32_t Local_Iteration;
+
+	DMA->ISR = Copy_Flags << (DMA_CH3 * DMA_CHANNEL_FLAGS_WIDTH);
+	Local_Start = HOST_TimeNs();
+	for(Local_Iteration = 0 ; Local_Iteration < TEST_BENCH_ITERATIONS ; Local_Iteration++)
+	{
+		DMA1_Channel3_IRQHandler();
+	}
+	HOST_Report(Copy_pName , HOST_TimeNs() - Local_Start , TEST_BENCH_ITERATIONS , 0);
+	DMA->ISR = 0;
+}
+
+static void BENCH_Dispatch(void)
+{
+	printf("DMA IRQ dispatch (host time per IRQ, 1 ISR load + 1 IFCR store each):\n");
+
+	HOST_SetModelledDevices(0);
+	DMA_RegisterTransferCompleteCallback(DMA_CH3 , TEST_HalfCallback);
+	DMA_RegisterHalfTransferCallback(DMA_CH3 , TEST_HalfCallback);
+	DMA_RegisterTransferErrorCallback(DMA_CH3 , TEST_HalfCallback);
+
+	BENCH_IrqDispatch("spurious (no flag)" , 0);
+	BENCH_IrqDispatch("transfer complete" , (1U << DMA_GLOBAL_INTERRUPT_FLAG) | (1U << DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG));
+	BENCH_IrqDispatch("complete + half + error" , DMA_CHANNEL_FLAGS_MASK);
+
+	DMA_RegisterTransferCompleteCallback(DMA_CH3 , NULL);
+	DMA_RegisterHalfTransferCallback(DMA_CH3 , NULL);
+	DMA_RegisterTransferErrorCallback(DMA_CH3 , NULL);
+	HOST_SetModelledDevices(HOST_DEVICE_DMA);
+}
+
+/* Cost of chaining: QueueTransfer plus the TC IRQ that loads the next descriptor */
+static void BENCH_QueueChaining(void)
+{
+	DMA_TransferDescriptor_t Local_Descriptor = TEST_QueueDescriptor(0);
+	uint64_t Local_Start;
+	uint32_t Local_Round;
+	uint32_t Local_Slot;
+
+	TEST_QueueChannelInit();
+	HOST_SetModelledDevices(0);
+
+	/* TC flag stays raised on plain memory so every IRQ retires one descriptor */
+	DMA->ISR = ((1U << DMA_GLOBAL_INTERRUPT_FLAG) | (1U << DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG)) << (DMA_CH3 * DMA_CHANNEL_FLAGS_WIDTH);
+	Local_Start = HOST_TimeNs();
+	for(Local_Round = 0 ; Local_Round < (TEST_BENCH_ITERATIONS / DMA_TRANSFER_QUEUE_DEPTH) ; Local_Round++)
+	{
+		for(Local_Slot = 0 ; Local_Slot < DMA_TRANSFER_QUEUE_DEPTH ; Local_Slot++)
+		{
+			DMA_QueueTransfer(DMA_CH3 , &Local_Descriptor);
+		}
+		for(Local_Slot = 0 ; Local_Slot < DMA_TRANSFER_QUEUE_DEPTH ; Local_Slot++)
+		{
+			DMA1_Channel3_IRQHandler();
+		}
+	}
+	HOST_Report("queue + chain per transfer" , HOST_TimeNs() - Local_Start , Local_Round * DMA_TRANSFER_QUEUE_DEPTH , 0);
+
+	DMA->ISR = 0;
+	DMA_QueueFlush(DMA_CH3);
+	HOST_SetModelledDevices(HOST_DEVICE_DMA);
+}
+
+/* CPU time spent to move a block: asynchronous job (submit + completion IRQ, bus does the copy) against CPU copy */
+static void BENCH_MemoryEngine(void)
+{
+	static const uint32_t Local_Sizes[] = {32 , 256 , 4096 , 65536};
+	char Local_Name[48];
+	uint64_t Local_Start;
+	uint32_t Local_SizeIndex;
+	uint32_t Local_Iteration;
+	uint32_t Local_Iterations;
+
+	printf("DMA memory engine (CPU time per block, bytes moved per CPU second):\n");
+
+	HOST_SetModelledDevices(0);
+	for(Local_SizeIndex = 0 ; Local_SizeIndex < (sizeof(Local_Sizes) / sizeof(Local_Sizes[0])) ; Local_SizeIndex++)
+	{
+		Local_Iterations = (TEST_BENCH_ITERATIONS * 16U) / Local_Sizes[Local_SizeIndex];
+
+		/* TC stays raised on plain memory: completion IRQ ends the job at once */
+		DMA->ISR = ((1U << DMA_GLOBAL_INTERRUPT_FLAG) | (1U << DMA_TRANSFER_COMPLETE_INTERRUPT_FLAG)) << (DMA_CH3 * DMA_CHANNEL_FLAGS_WIDTH);
+		Local_Start = HOST_TimeNs();
+		for(Local_Iteration = 0 ; Local_Iteration < Local_Iterations ; Local_Iteration++)
+		{
+			DMA_MemcpyAsync(DMA_CH3_POOL_MASK , &Global_MemoryDestination[TEST_MEMORY_GUARD] , Global_MemorySource , Local_Sizes[Local_SizeIndex] , TEST_JobCallback);
+			DMA1_Channel3_IRQHandler();
+		}
+		snprintf(Local_Name , sizeof(Local_Name) , "MemcpyAsync %5u bytes" , Local_Sizes[Local_SizeIndex]);
+		HOST_Report(Local_Name , HOST_TimeNs() - Local_Start , Local_Iterations , (uint64_t)Local_Iterations * Local_Sizes[Local_SizeIndex]);
+		DMA->ISR = 0;
+
+		Local_Start = HOST_TimeNs();
+		for(Local_Iteration = 0 ; Local_Iteration < Local_Iterations ; Local_Iteration++)
+		{
+			memcpy(&Global_MemoryDestination[TEST_MEMORY_GUARD] , Global_MemorySource , Local_Sizes[Local_SizeIndex]);
+			__asm__ volatile("" ::: "memory");
+		}
+		snprintf(Local_Name , sizeof(Local_Name) , "CPU memcpy  %5u bytes" , Local_Sizes[Local_SizeIndex]);
+		HOST_Report(Local_Name , HOST_TimeNs() - Local_Start , Local_Iterations , (uint64_t)Local_Iterations * Local_Sizes[Local_SizeIndex]);
+	}
+	HOST_SetModelledDevices(HOST_DEVICE_DMA);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                      MAIN                                         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+int main(int argc , char** argv)
+{
+	uint8_t Local_Benchmark = HOST_IsBenchmarkRun(argc , argv);
+
+	HOST_ModelInit(HOST_DEVICE_DMA);
+
+	if(Local_Benchmark == 1)
+	{
+		BENCH_Dispatch();
+		BENCH_QueueChaining();
+		BENCH_MemoryEngine();
+	}
+	else
+	{
+		TEST_IrqDispatch();
+		TEST_CompiledConfig();
+		TEST_StreamDelivery();
+		TEST_QueueChaining();
+		TEST_QueueFullAndFlush();
+		TEST_MemoryEngine();
+		TEST_MemoryJobOwnership();
+		TEST_AllocatorOwnership();
+	}
+
+	return HOST_Summary("DMA");
+}
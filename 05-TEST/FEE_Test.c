@@ -0,0 +1,387 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : FEE Host Test                */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+
+#include "FPEC_Interface.h"
+
+#include "FEE_Config.h"
+#include "FEE_Interface.h"
+
+#include "HOST_Model.h"
+#include "HOST_Test.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#define TEST_AREA_ADDRESS				(FPEC_FLASH_FIRST_ADDRESS + (FEE_FIRST_PAGE * FPEC_PAGE_SIZE))
+#define TEST_AREA_SIZE					(FEE_PAGES_NUMBER * FPEC_PAGE_SIZE)
+
+/* Workload: enough records to go around the pages ring (and collect every page) more than once */
+#define TEST_KEYS						12U
+#define TEST_STEPS						1600U
+#define TEST_CHUNK_STEPS				4U			/* Steps run by one boot (replayed up to every power cut) */
+#define TEST_CHUNKS						(TEST_STEPS / TEST_CHUNK_STEPS)
+#define TEST_RECOVERY_VALUE				0x5A5A0000UL
+
+#define TEST_BENCH_WRITES				20000U
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  PRIVATE TYPES                                    */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* What the application knows it committed (shared with boot processes, survives power cut) */
+typedef struct
+{
+	uint32_t Values[FEE_MAX_KEYS];
+	uint8_t Valid[FEE_MAX_KEYS];
+	uint8_t PendingActive;					/* A write/delete was started and has not returned yet */
+	uint8_t PendingDelete;
+	uint16_t PendingKey;
+	uint32_t PendingValue;
+	uint32_t Chunk;							/* Chunk of workload steps run by next boot */
+	uint32_t RecoveryOperations;			/* Flash operations done by last mount after a power cut */
+}TEST_Log_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static volatile TEST_Log_t* Global_pLog;
+
+/* Store area and application log at start of every chunk, and flash operations of the chunk */
+static uint8_t Global_ChunkArea[TEST_CHUNKS][TEST_AREA_SIZE];
+static TEST_Log_t Global_ChunkLog[TEST_CHUNKS];
+static uint32_t Global_ChunkOperations[TEST_CHUNKS];
+
+/* Store area left by a power cut */
+static uint8_t Global_CutArea[TEST_AREA_SIZE];
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     HELPERS                                       */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Flash operations done so far (programmed or rejected halfwords and erased pages) */
+static uint32_t TEST_FlashOperations(void)
+{
+	return HOST_pCounters->FlashPrograms + HOST_pCounters->FlashErrors + HOST_pCounters->FlashErases;
+}
+
+/* Runs one workload step: writes of changing values, rewrites of the same value and deletes */
+static void TEST_Step(uint32_t Copy_Step)
+{
+	uint16_t Local_Key = (uint16_t)(((Copy_Step * 7U) + (Copy_Step / 5U)) % TEST_KEYS);
+	uint8_t Local_Delete = ((Copy_Step % 17U) == 16U);
+	uint32_t Local_Value = Copy_Step * 2654435761UL;
+	ERROR_STATUS_t Local_Status;
+
+	/* Same value again costs no record */
+	if(((Copy_Step % 11U) == 10U) && (Global_pLog->Valid[Local_Key] == 1))
+	{
+		Local_Value = Global_pLog->Values[Local_Key];
+	}
+
+	/* Record operation before it starts, power may be cut inside it */
+	Global_pLog->PendingKey = Local_Key;
+	Global_pLog->PendingDelete = Local_Delete;
+	Global_pLog->PendingValue = Local_Value;
+	Global_pLog->PendingActive = 1;
+
+	if(Local_Delete == 1)
+	{
+		Local_Status = FEE_Delete(Local_Key);
+		Global_pLog->Valid[Local_Key] = 0;
+	}
+	else
+	{
+		Local_Status = FEE_Write(Local_Key , Local_Value);
+		Global_pLog->Values[Local_Key] = Local_Value;
+		Global_pLog->Valid[Local_Key] = 1;
+	}
+	Global_pLog->PendingActive = 0;
+
+	HOST_CHECK_EQUAL(Local_Status , RT_OK);
+}
+
+/* Checks that the store holds what the log says, pending operation may or may not have landed */
+static void TEST_CheckCommitted(void)
+{
+	uint32_t Local_Value;
+	uint16_t Local_Key;
+	uint8_t Local_Valid;
+	uint8_t Local_Matches;
+
+	for(Local_Key = 0 ; Local_Key < FEE_MAX_KEYS ; Local_Key++)
+	{
+		Local_Valid = (FEE_Read(Local_Key , &Local_Value) == RT_OK);
+		Local_Matches = (Local_Valid == Global_pLog->Valid[Local_Key]) &&
+						((Local_Valid == 0) || (Local_Value == Global_pLog->Values[Local_Key]));
+
+		/* Interrupted operation: old state is fine as well as new one */
+		if((Local_Matches == 0) && (Global_pLog->PendingActive == 1) && (Global_pLog->PendingKey == Local_Key))
+		{
+			Local_Matches = (Global_pLog->PendingDelete == 1) ? (Local_Valid == 0) :
+							((Local_Valid == 1) && (Local_Value == Global_pLog->PendingValue));
+		}
+
+		if(Local_Matches == 0)
+		{
+			printf("FEE key %u: read %s 0x%08X\n" , Local_Key , Local_Valid ? "value" : "nothing" , Local_Valid ? Local_Value : 0U);
+		}
+		HOST_CHECK(Local_Matches == 1);
+	}
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  BOOT FUNCTIONS                                   */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Mounts store then runs steps of one chunk of workload */
+static void BOOT_Chunk(void)
+{
+	uint32_t Local_Step;
+
+	HOST_CHECK_EQUAL(FEE_Init() , RT_OK);
+	for(Local_Step = Global_pLog->Chunk * TEST_CHUNK_STEPS ; Local_Step < ((Global_pLog->Chunk + 1U) * TEST_CHUNK_STEPS) ; Local_Step++)
+	{
+		TEST_Step(Local_Step);
+	}
+}
+
+/* Mounts store after power cut, checks committed values then stores a new value */
+static void BOOT_Recover(void)
+{
+	uint32_t Local_Value = 0;
+	uint16_t Local_Key = Global_pLog->PendingKey;
+	uint32_t Local_Operations = TEST_FlashOperations();
+
+	HOST_CHECK_EQUAL(FEE_Init() , RT_OK);
+	Global_pLog->RecoveryOperations = TEST_FlashOperations() - Local_Operations;
+	TEST_CheckCommitted();
+
+	/* Store is usable again: interrupted key takes a new value that reads back */
+	HOST_CHECK_EQUAL(FEE_Write(Local_Key , TEST_RECOVERY_VALUE | Local_Key) , RT_OK);
+	HOST_CHECK_EQUAL(FEE_Read(Local_Key , &Local_Value) , RT_OK);
+	HOST_CHECK_EQUAL(Local_Value , TEST_RECOVERY_VALUE | Local_Key);
+}
+
+/* Mounts store after power cut only (recovery itself may be cut) */
+static void BOOT_Mount(void)
+{
+	HOST_CHECK_EQUAL(FEE_Init() , RT_OK);
+	TEST_CheckCommitted();
+}
+
+/* Blank area, arguments and persistence of values over a reboot */
+static void BOOT_Basics(void)
+{
+	uint32_t Local_Value = 0;
+
+	HOST_CHECK_EQUAL(FEE_Read(0 , &Local_Value) , RT_NOK);
+	HOST_CHECK_EQUAL(FEE_Write(0 , 1) , RT_NOK);
+	HOST_CHECK_EQUAL(FEE_Init() , RT_OK);
+	HOST_CHECK_EQUAL(FEE_Read(0 , &Local_Value) , RT_NOK);
+	HOST_CHECK_EQUAL(FEE_Read(0 , NULL) , NULL_POINTER);
+	HOST_CHECK_EQUAL(FEE_Write(FEE_MAX_KEYS , 1) , RT_NOK);
+	HOST_CHECK_EQUAL(FEE_Delete(FEE_MAX_KEYS) , RT_NOK);
+
+	HOST_CHECK_EQUAL(FEE_Write(3 , 0x12345678UL) , RT_OK);
+	HOST_CHECK_EQUAL(FEE_Write(4 , 0xFFFFFFFFUL) , RT_OK);
+	HOST_CHECK_EQUAL(FEE_Write(5 , 7) , RT_OK);
+	HOST_CHECK_EQUAL(FEE_Delete(5) , RT_OK);
+	HOST_CHECK_EQUAL(FEE_Read(3 , &Local_Value) , RT_OK);
+	HOST_CHECK_EQUAL(Local_Value , 0x12345678UL);
+	HOST_CHECK_EQUAL(FEE_Read(5 , &Local_Value) , RT_NOK);
+}
+
+static void BOOT_BasicsAgain(void)
+{
+	uint32_t Local_Value = 0;
+	uint32_t Local_Operations = TEST_FlashOperations();
+
+	HOST_CHECK_EQUAL(FEE_Init() , RT_OK);
+	HOST_CHECK_EQUAL(FEE_Read(3 , &Local_Value) , RT_OK);
+	HOST_CHECK_EQUAL(Local_Value , 0x12345678UL);
+	HOST_CHECK_EQUAL(FEE_Read(4 , &Local_Value) , RT_OK);
+	HOST_CHECK_EQUAL(Local_Value , 0xFFFFFFFFUL);
+	HOST_CHECK_EQUAL(FEE_Read(5 , &Local_Value) , RT_NOK);
+
+	/* Mounting a clean store and writing values it holds cost no flash operation */
+	HOST_CHECK_EQUAL(FEE_Write(3 , 0x12345678UL) , RT_OK);
+	HOST_CHECK_EQUAL(FEE_Delete(5) , RT_OK);
+	HOST_CHECK_EQUAL(TEST_FlashOperations() - Local_Operations , 0);
+}
+
+/* Writes of rotating keys for the benchmark */
+static void BOOT_Bench(void)
+{
+	uint64_t Local_Start;
+	uint32_t Local_Write;
+
+	FEE_Init();
+	Local_Start = HOST_TimeNs();
+	for(Local_Write = 0 ; Local_Write < TEST_BENCH_WRITES ; Local_Write++)
+	{
+		FEE_Write((uint16_t)(Local_Write % FEE_MAX_KEYS) , Local_Write);
+	}
+	HOST_Report("FEE_Write (with garbage collection)" , HOST_TimeNs() - Local_Start , TEST_BENCH_WRITES , 0);
+
+	Local_Start = HOST_TimeNs();
+	for(Local_Write = 0 ; Local_Write < 100U ; Local_Write++)
+	{
+		FEE_Init();
+	}
+	HOST_Report("FEE_Init (full pages ring)" , HOST_TimeNs() - Local_Start , 100U , 0);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                      TESTS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+static void TEST_Basics(void)
+{
+	HOST_FlashErase(TEST_AREA_ADDRESS , TEST_AREA_SIZE);
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_Basics) , HOST_BOOT_COMPLETED);
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_BasicsAgain) , HOST_BOOT_COMPLETED);
+}
+
+/* Area left by an earlier user (not a store) is wiped when store is mounted */
+static void TEST_GarbageArea(void)
+{
+	static const uint8_t Local_Garbage[] = {0x00 , 0x11 , 0x22 , 0x33 , 0x44 , 0x55 , 0x66 , 0x77};
+
+	HOST_FlashErase(TEST_AREA_ADDRESS , TEST_AREA_SIZE);
+	HOST_FlashFill(TEST_AREA_ADDRESS + FPEC_PAGE_SIZE + 40U , Local_Garbage , sizeof(Local_Garbage));
+	memset((void*)Global_pLog , 0 , sizeof(TEST_Log_t));
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_Recover) , HOST_BOOT_COMPLETED);
+}
+
+/* Runs workload chunk by chunk without power cuts, keeping the area at start of every chunk */
+static void TEST_Reference(void)
+{
+	uint32_t Local_Chunk;
+	uint32_t Local_Operations;
+
+	HOST_FlashErase(TEST_AREA_ADDRESS , TEST_AREA_SIZE);
+	memset((void*)Global_pLog , 0 , sizeof(TEST_Log_t));
+
+	for(Local_Chunk = 0 ; Local_Chunk < TEST_CHUNKS ; Local_Chunk++)
+	{
+		memcpy(Global_ChunkArea[Local_Chunk] , (const void*)TEST_AREA_ADDRESS , TEST_AREA_SIZE);
+		Global_pLog->Chunk = Local_Chunk;
+		memcpy(&Global_ChunkLog[Local_Chunk] , (const void*)Global_pLog , sizeof(TEST_Log_t));
+
+		Local_Operations = TEST_FlashOperations();
+		HOST_CHECK_EQUAL(HOST_Boot(BOOT_Chunk) , HOST_BOOT_COMPLETED);
+		Global_ChunkOperations[Local_Chunk] = TEST_FlashOperations() - Local_Operations;
+	}
+
+	/* Whole ring was collected more than once */
+	HOST_CHECK(HOST_pCounters->FlashErases > (2U * FEE_PAGES_NUMBER));
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_Mount) , HOST_BOOT_COMPLETED);
+}
+
+/* Power cut at every flash operation of the workload, then at every operation of the recovery */
+static void TEST_PowerCuts(void)
+{
+	uint32_t Local_Chunk;
+	uint32_t Local_Cut;
+	uint32_t Local_RecoveryCut;
+	uint32_t Local_RecoveryOperations;
+	uint32_t Local_Cuts = 0;
+	uint32_t Local_RecoveryCuts = 0;
+	TEST_Log_t Local_CutLog;
+
+	for(Local_Chunk = 0 ; Local_Chunk < TEST_CHUNKS ; Local_Chunk++)
+	{
+		for(Local_Cut = 0 ; Local_Cut < Global_ChunkOperations[Local_Chunk] ; Local_Cut++)
+		{
+			/* Replay chunk from its start and cut power on one of its flash operations */
+			HOST_FlashFill(TEST_AREA_ADDRESS , Global_ChunkArea[Local_Chunk] , TEST_AREA_SIZE);
+			memcpy((void*)Global_pLog , &Global_ChunkLog[Local_Chunk] , sizeof(TEST_Log_t));
+			HOST_PowerCutAfter(Local_Cut);
+			HOST_CHECK_EQUAL(HOST_Boot(BOOT_Chunk) , HOST_BOOT_POWER_CUT);
+			memcpy(Global_CutArea , (const void*)TEST_AREA_ADDRESS , TEST_AREA_SIZE);
+			memcpy(&Local_CutLog , (const void*)Global_pLog , sizeof(TEST_Log_t));
+			Local_Cuts++;
+
+			/* Mount after power cut recovers last committed values and takes new ones */
+			HOST_CHECK_EQUAL(HOST_Boot(BOOT_Recover) , HOST_BOOT_COMPLETED);
+			Local_RecoveryOperations = Global_pLog->RecoveryOperations;
+
+			/* Power cut again on every flash operation of the recovery itself */
+			for(Local_RecoveryCut = 0 ; Local_RecoveryCut < Local_RecoveryOperations ; Local_RecoveryCut++)
+			{
+				HOST_FlashFill(TEST_AREA_ADDRESS , Global_CutArea , TEST_AREA_SIZE);
+				memcpy((void*)Global_pLog , &Local_CutLog , sizeof(TEST_Log_t));
+				HOST_PowerCutAfter(Local_RecoveryCut);
+				HOST_CHECK_EQUAL(HOST_Boot(BOOT_Mount) , HOST_BOOT_POWER_CUT);
+				HOST_CHECK_EQUAL(HOST_Boot(BOOT_Recover) , HOST_BOOT_COMPLETED);
+				Local_RecoveryCuts++;
+			}
+		}
+	}
+
+	printf("FEE power cuts: %u in workload, %u in recovery\n" , Local_Cuts , Local_RecoveryCuts);
+	HOST_CHECK(Local_RecoveryCuts != 0);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                       MAIN                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+int main(int argc , char** argv)
+{
+	uint8_t Local_Benchmark = HOST_IsBenchmarkRun(argc , argv);
+
+	HOST_ModelInit(HOST_DEVICE_FLASH);
+
+	/* Application log lives across boots */
+	Global_pLog = mmap(NULL , sizeof(TEST_Log_t) , PROT_READ | PROT_WRITE , MAP_SHARED | MAP_ANONYMOUS , -1 , 0);
+	if(Global_pLog == MAP_FAILED)
+	{
+		perror("FEE_Test: log");
+		return 1;
+	}
+
+	if(Local_Benchmark == 1)
+	{
+		HOST_FlashErase(TEST_AREA_ADDRESS , TEST_AREA_SIZE);
+		HOST_Boot(BOOT_Bench);
+	}
+	else
+	{
+		TEST_Basics();
+		TEST_GarbageArea();
+		TEST_Reference();
+		TEST_PowerCuts();
+	}
+
+	return HOST_Summary("FEE");
+}
@@ -0,0 +1,405 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : FORMAT_FUNCTIONS Host Test   */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+
+#include "FORMAT_FUNCTIONS.h"
+
+#include "HOST_Model.h"
+#include "HOST_Test.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#define TEST_UINT32_MAX					0xFFFFFFFFUL
+#define TEST_INT32_MAX					0x7FFFFFFFL
+#define TEST_INT32_MIN					(-TEST_INT32_MAX - 1L)
+
+/* Both ends of uint32_t range are swept value by value (reciprocal of 100 is least exact at the top) */
+#define TEST_SWEEP_LENGTH				(1UL << 22)
+#define TEST_RANDOM_VALUES				2000000UL
+#define TEST_NEIGHBOURS					3U			/* Values checked on each side of a boundary */
+#define TEST_BUFFER_GUARD				0xEEU
+#define TEST_FIELD_BUFFER_SIZE			32U
+
+#define TEST_BENCH_ITERATIONS			10000000UL
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static uint32_t Global_RandomState = 0x2545F491UL;
+static volatile uint32_t Global_Sink;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     HELPERS                                       */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* xorshift32, same sequence on every run */
+static uint32_t TEST_Random(void)
+{
+	Global_RandomState ^= Global_RandomState << 13;
+	Global_RandomState ^= Global_RandomState >> 17;
+	Global_RandomState ^= Global_RandomState << 5;
+	return Global_RandomState;
+}
+
+/* Compares formatted text, its length and the byte after the terminator with reference text */
+static uint32_t TEST_Compare(const uint8_t* Copy_pBuffer , uint8_t Copy_Length , uint32_t Copy_BufferSize , const char* Copy_pExpected , const char* Copy_pWhat)
+{
+	uint32_t Local_Failed = (strcmp((const char*)Copy_pBuffer , Copy_pExpected) != 0) || (Copy_Length != strlen(Copy_pExpected));
+
+	/* Nothing is written past the terminator inside the documented buffer size */
+	if((strlen(Copy_pExpected) + 1U) < Copy_BufferSize)
+	{
+		Local_Failed |= (Copy_pBuffer[strlen(Copy_pExpected) + 1U] != TEST_BUFFER_GUARD);
+	}
+
+	if(Local_Failed != 0)
+	{
+		printf("%s: got \"%s\" (%u), expected \"%s\"\n" , Copy_pWhat , Copy_pBuffer , Copy_Length , Copy_pExpected);
+	}
+
+	return Local_Failed;
+}
+
+/* Returns 1 if FMT_Unsigned disagrees with printf */
+static uint32_t TEST_Unsigned(uint32_t Copy_Value)
+{
+	uint8_t Local_Buffer[FMT_DECIMAL_BUFFER_SIZE];
+	char Local_Expected[FMT_DECIMAL_BUFFER_SIZE];
+	uint8_t Local_Length = 0;
+
+	memset(Local_Buffer , TEST_BUFFER_GUARD , sizeof(Local_Buffer));
+	snprintf(Local_Expected , sizeof(Local_Expected) , "%u" , Copy_Value);
+	return (FMT_Unsigned(Copy_Value , Local_Buffer , &Local_Length) != RT_OK) ||
+		   TEST_Compare(Local_Buffer , Local_Length , sizeof(Local_Buffer) , Local_Expected , "FMT_Unsigned");
+}
+
+/* Returns 1 if FMT_Signed disagrees with printf */
+static uint32_t TEST_Signed(sint32_t Copy_Value)
+{
+	uint8_t Local_Buffer[FMT_DECIMAL_BUFFER_SIZE];
+	char Local_Expected[FMT_DECIMAL_BUFFER_SIZE];
+	uint8_t Local_Length = 0;
+
+	memset(Local_Buffer , TEST_BUFFER_GUARD , sizeof(Local_Buffer));
+	snprintf(Local_Expected , sizeof(Local_Expected) , "%d" , Copy_Value);
+	return (FMT_Signed(Copy_Value , Local_Buffer , &Local_Length) != RT_OK) ||
+		   TEST_Compare(Local_Buffer , Local_Length , sizeof(Local_Buffer) , Local_Expected , "FMT_Signed");
+}
+
+/* Returns 1 if FMT_Hex disagrees with printf for every minimum number of digits and both cases */
+static uint32_t TEST_Hex(uint32_t Copy_Value)
+{
+	uint8_t Local_Buffer[FMT_HEX_BUFFER_SIZE];
+	char Local_Expected[FMT_HEX_BUFFER_SIZE];
+	uint8_t Local_Length = 0;
+	uint8_t Local_MinDigits;
+	uint32_t Local_Failed = 0;
+
+	for(Local_MinDigits = 1 ; Local_MinDigits <= FMT_MAX_HEX_DIGITS ; Local_MinDigits++)
+	{
+		memset(Local_Buffer , TEST_BUFFER_GUARD , sizeof(Local_Buffer));
+		snprintf(Local_Expected , sizeof(Local_Expected) , "%0*X" , Local_MinDigits , Copy_Value);
+		Local_Failed |= (FMT_Hex(Copy_Value , Local_MinDigits , FMT_HEX_UPPER_CASE , Local_Buffer , &Local_Length) != RT_OK) ||
+						TEST_Compare(Local_Buffer , Local_Length , sizeof(Local_Buffer) , Local_Expected , "FMT_Hex");
+
+		memset(Local_Buffer , TEST_BUFFER_GUARD , sizeof(Local_Buffer));
+		snprintf(Local_Expected , sizeof(Local_Expected) , "%0*x" , Local_MinDigits , Copy_Value);
+		Local_Failed |= (FMT_Hex(Copy_Value , Local_MinDigits , FMT_HEX_LOWER_CASE , Local_Buffer , &Local_Length) != RT_OK) ||
+						TEST_Compare(Local_Buffer , Local_Length , sizeof(Local_Buffer) , Local_Expected , "FMT_Hex");
+	}
+
+	return Local_Failed;
+}
+
+/* Returns 1 if FMT_FixedPoint disagrees with integer part and zero padded fraction printed apart */
+static uint32_t TEST_FixedPoint(sint32_t Copy_Value)
+{
+	uint8_t Local_Buffer[FMT_FIXED_POINT_BUFFER_SIZE];
+	char Local_Expected[TEST_FIELD_BUFFER_SIZE];
+	uint8_t Local_Length = 0;
+	uint8_t Local_Digits;
+	uint32_t Local_Failed = 0;
+	uint64_t Local_Magnitude = (Copy_Value < 0) ? (uint64_t)(-(sint64_t)Copy_Value) : (uint64_t)Copy_Value;
+	uint64_t Local_Scale = 1;
+
+	for(Local_Digits = 0 ; Local_Digits <= FMT_MAX_FRACTION_DIGITS ; Local_Digits++)
+	{
+		if(Local_Digits == 0)
+		{
+			snprintf(Local_Expected , sizeof(Local_Expected) , "%d" , Copy_Value);
+		}
+		else
+		{
+			snprintf(Local_Expected , sizeof(Local_Expected) , "%s%llu.%0*llu" , (Copy_Value < 0) ? "-" : "" ,
+					 Local_Magnitude / Local_Scale , Local_Digits , Local_Magnitude % Local_Scale);
+		}
+
+		memset(Local_Buffer , TEST_BUFFER_GUARD , sizeof(Local_Buffer));
+		Local_Failed |= (FMT_FixedPoint(Copy_Value , Local_Digits , Local_Buffer , &Local_Length) != RT_OK) ||
+						TEST_Compare(Local_Buffer , Local_Length , sizeof(Local_Buffer) , Local_Expected , "FMT_FixedPoint");
+		Local_Scale *= 10U;
+	}
+
+	return Local_Failed;
+}
+
+/* Runs every conversion on a value and its neighbours, returns number of failures */
+static uint32_t TEST_AroundValue(uint32_t Copy_Value)
+{
+	uint32_t Local_Failures = 0;
+	uint32_t Local_Value;
+	sint32_t Local_Offset;
+
+	for(Local_Offset = -(sint32_t)TEST_NEIGHBOURS ; Local_Offset <= (sint32_t)TEST_NEIGHBOURS ; Local_Offset++)
+	{
+		Local_Value = Copy_Value + (uint32_t)Local_Offset;
+		Local_Failures += TEST_Unsigned(Local_Value);
+		Local_Failures += TEST_Signed((sint32_t)Local_Value);
+		Local_Failures += TEST_Signed((sint32_t)(0U - Local_Value));
+		Local_Failures += TEST_Hex(Local_Value);
+		Local_Failures += TEST_FixedPoint((sint32_t)Local_Value);
+		Local_Failures += TEST_FixedPoint((sint32_t)(0U - Local_Value));
+	}
+
+	return Local_Failures;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                      TESTS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* 0, +-1, INT32_MIN/MAX, UINT32_MAX and 10^n +- 1 (digit count changes) with their neighbours */
+static void TEST_Boundaries(void)
+{
+	uint32_t Local_Failures = 0;
+	uint64_t Local_Power;
+	uint32_t Local_Bit;
+
+	Local_Failures += TEST_AroundValue(0);
+	Local_Failures += TEST_AroundValue((uint32_t)TEST_INT32_MAX);
+	Local_Failures += TEST_AroundValue(TEST_UINT32_MAX);
+
+	/* INT32_MIN: magnitude has no positive sint32_t */
+	Local_Failures += TEST_Signed(TEST_INT32_MIN);
+	Local_Failures += TEST_Signed(TEST_INT32_MIN + 1L);
+	Local_Failures += TEST_FixedPoint(TEST_INT32_MIN);
+	Local_Failures += TEST_FixedPoint(TEST_INT32_MIN + 1L);
+
+	/* Powers of ten up to 10^9 (decimal digit count changes) and a few multiples of them */
+	for(Local_Power = 1 ; Local_Power <= 1000000000ULL ; Local_Power *= 10U)
+	{
+		Local_Failures += TEST_AroundValue((uint32_t)Local_Power);
+		Local_Failures += TEST_AroundValue((uint32_t)(Local_Power * 2U));
+		Local_Failures += TEST_AroundValue((uint32_t)(Local_Power * 4U));
+	}
+
+	/* Powers of two (nibble count changes in hex) */
+	for(Local_Bit = 0 ; Local_Bit < 32U ; Local_Bit++)
+	{
+		Local_Failures += TEST_AroundValue(1UL << Local_Bit);
+	}
+
+	HOST_CHECK_EQUAL(Local_Failures , 0);
+}
+
+/* Every value at both ends of uint32_t range, then random values */
+static void TEST_Sweeps(void)
+{
+	uint32_t Local_Failures = 0;
+	uint32_t Local_Value;
+	uint32_t Local_Counter;
+
+	for(Local_Value = 0 ; Local_Value < TEST_SWEEP_LENGTH ; Local_Value++)
+	{
+		Local_Failures += TEST_Unsigned(Local_Value);
+		Local_Failures += TEST_Unsigned(TEST_UINT32_MAX - Local_Value);
+	}
+	HOST_CHECK_EQUAL(Local_Failures , 0);
+
+	/* Signed sweep across zero and both ends */
+	for(Local_Value = 0 ; Local_Value < TEST_SWEEP_LENGTH ; Local_Value++)
+	{
+		Local_Failures += TEST_Signed((sint32_t)(Local_Value - (TEST_SWEEP_LENGTH / 2U)));
+		Local_Failures += TEST_Signed((sint32_t)(0x80000000UL + Local_Value));
+		Local_Failures += TEST_Signed((sint32_t)(0x7FFFFFFFUL - Local_Value));
+	}
+	HOST_CHECK_EQUAL(Local_Failures , 0);
+
+	for(Local_Counter = 0 ; Local_Counter < TEST_RANDOM_VALUES ; Local_Counter++)
+	{
+		Local_Value = TEST_Random();
+		Local_Failures += TEST_Unsigned(Local_Value);
+		Local_Failures += TEST_Signed((sint32_t)Local_Value);
+
+		/* Short values are common in real use, test them as often as long ones */
+		Local_Value >>= (Local_Value & 0x1FU);
+		Local_Failures += TEST_Unsigned(Local_Value);
+		if((Local_Counter & 0xFU) == 0)
+		{
+			Local_Failures += TEST_Hex(Local_Value);
+			Local_Failures += TEST_FixedPoint((sint32_t)TEST_Random());
+		}
+	}
+	HOST_CHECK_EQUAL(Local_Failures , 0);
+}
+
+/* NULL pointers and out of range arguments are rejected, optional length may be NULL */
+static void TEST_Arguments(void)
+{
+	uint8_t Local_Buffer[TEST_FIELD_BUFFER_SIZE];
+
+	HOST_CHECK_EQUAL(FMT_Unsigned(1 , NULL , NULL) , NULL_POINTER);
+	HOST_CHECK_EQUAL(FMT_Signed(1 , NULL , NULL) , NULL_POINTER);
+	HOST_CHECK_EQUAL(FMT_Hex(1 , 1 , FMT_HEX_UPPER_CASE , NULL , NULL) , NULL_POINTER);
+	HOST_CHECK_EQUAL(FMT_FixedPoint(1 , 1 , NULL , NULL) , NULL_POINTER);
+	HOST_CHECK_EQUAL(FMT_Field(NULL , 4 , FMT_ALIGN_LEFT , ' ' , Local_Buffer , NULL) , NULL_POINTER);
+	HOST_CHECK_EQUAL(FMT_Field((const uint8_t*)"1" , 4 , FMT_ALIGN_LEFT , ' ' , NULL , NULL) , NULL_POINTER);
+
+	HOST_CHECK_EQUAL(FMT_Hex(1 , 0 , FMT_HEX_UPPER_CASE , Local_Buffer , NULL) , OUT_OF_RANGE);
+	HOST_CHECK_EQUAL(FMT_Hex(1 , FMT_MAX_HEX_DIGITS + 1U , FMT_HEX_UPPER_CASE , Local_Buffer , NULL) , OUT_OF_RANGE);
+	HOST_CHECK_EQUAL(FMT_Hex(1 , 1 , FMT_HEX_LOWER_CASE + 1U , Local_Buffer , NULL) , OUT_OF_RANGE);
+	HOST_CHECK_EQUAL(FMT_FixedPoint(1 , FMT_MAX_FRACTION_DIGITS + 1U , Local_Buffer , NULL) , OUT_OF_RANGE);
+	HOST_CHECK_EQUAL(FMT_Field((const uint8_t*)"1" , 4 , FMT_ALIGN_CENTER + 1U , ' ' , Local_Buffer , NULL) , OUT_OF_RANGE);
+
+	HOST_CHECK_EQUAL(FMT_Signed(-42 , Local_Buffer , NULL) , RT_OK);
+	HOST_CHECK_EQUAL(strcmp((const char*)Local_Buffer , "-42") , 0);
+}
+
+/* Field padding, sign kept before zero padding and formatting in place */
+static void TEST_Field(void)
+{
+	uint8_t Local_Buffer[TEST_FIELD_BUFFER_SIZE];
+	uint8_t Local_Length = 0;
+
+	HOST_CHECK_EQUAL(FMT_Field((const uint8_t*)"ab" , 6 , FMT_ALIGN_LEFT , '.' , Local_Buffer , &Local_Length) , RT_OK);
+	HOST_CHECK_EQUAL(strcmp((const char*)Local_Buffer , "ab....") , 0);
+	HOST_CHECK_EQUAL(Local_Length , 6);
+	HOST_CHECK_EQUAL(FMT_Field((const uint8_t*)"ab" , 6 , FMT_ALIGN_RIGHT , '.' , Local_Buffer , &Local_Length) , RT_OK);
+	HOST_CHECK_EQUAL(strcmp((const char*)Local_Buffer , "....ab") , 0);
+	HOST_CHECK_EQUAL(FMT_Field((const uint8_t*)"ab" , 5 , FMT_ALIGN_CENTER , '.' , Local_Buffer , &Local_Length) , RT_OK);
+	HOST_CHECK_EQUAL(strcmp((const char*)Local_Buffer , ".ab..") , 0);
+
+	/* Text longer than field is kept, empty text gives padding only */
+	HOST_CHECK_EQUAL(FMT_Field((const uint8_t*)"abcdef" , 3 , FMT_ALIGN_RIGHT , ' ' , Local_Buffer , &Local_Length) , RT_OK);
+	HOST_CHECK_EQUAL(strcmp((const char*)Local_Buffer , "abcdef") , 0);
+	HOST_CHECK_EQUAL(Local_Length , 6);
+	HOST_CHECK_EQUAL(FMT_Field((const uint8_t*)"" , 3 , FMT_ALIGN_CENTER , '-' , Local_Buffer , &Local_Length) , RT_OK);
+	HOST_CHECK_EQUAL(strcmp((const char*)Local_Buffer , "---") , 0);
+
+	/* Negative number zero padded in place: -0042, INT32_MIN zero padded */
+	FMT_Signed(-42 , Local_Buffer , NULL);
+	HOST_CHECK_EQUAL(FMT_Field(Local_Buffer , 5 , FMT_ALIGN_RIGHT , '0' , Local_Buffer , &Local_Length) , RT_OK);
+	HOST_CHECK_EQUAL(strcmp((const char*)Local_Buffer , "-0042") , 0);
+	FMT_Signed(TEST_INT32_MIN , Local_Buffer , NULL);
+	HOST_CHECK_EQUAL(FMT_Field(Local_Buffer , 14 , FMT_ALIGN_RIGHT , '0' , Local_Buffer , &Local_Length) , RT_OK);
+	HOST_CHECK_EQUAL(strcmp((const char*)Local_Buffer , "-0002147483648") , 0);
+	HOST_CHECK_EQUAL(Local_Length , 14);
+
+	/* Zero padding after text does not move sign */
+	HOST_CHECK_EQUAL(FMT_Field((const uint8_t*)"-7" , 4 , FMT_ALIGN_LEFT , '0' , Local_Buffer , &Local_Length) , RT_OK);
+	HOST_CHECK_EQUAL(strcmp((const char*)Local_Buffer , "-700") , 0);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    BENCHMARKS                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Conversions per second against printf of the host C library */
+static void BENCH_Format(void)
+{
+	uint8_t Local_Buffer[FMT_FIXED_POINT_BUFFER_SIZE];
+	uint8_t Local_Length = 0;
+	uint64_t Local_Start;
+	uint32_t Local_Counter;
+	uint32_t Local_Value;
+
+	/* Full range values: ten digits most of the time */
+	Local_Start = HOST_TimeNs();
+	for(Local_Counter = 0 , Local_Value = 0 ; Local_Counter < TEST_BENCH_ITERATIONS ; Local_Counter++ , Local_Value += 2654435761UL)
+	{
+		FMT_Unsigned(Local_Value , Local_Buffer , &Local_Length);
+		Global_Sink += Local_Length;
+	}
+	HOST_Report("FMT_Unsigned (full range)" , HOST_TimeNs() - Local_Start , TEST_BENCH_ITERATIONS , 0);
+
+	Local_Start = HOST_TimeNs();
+	for(Local_Counter = 0 , Local_Value = 0 ; Local_Counter < TEST_BENCH_ITERATIONS ; Local_Counter++ , Local_Value += 2654435761UL)
+	{
+		Global_Sink += (uint32_t)snprintf((char*)Local_Buffer , sizeof(Local_Buffer) , "%u" , Local_Value);
+	}
+	HOST_Report("snprintf %u (full range)" , HOST_TimeNs() - Local_Start , TEST_BENCH_ITERATIONS , 0);
+
+	/* Display sized values (0 --> 9999) */
+	Local_Start = HOST_TimeNs();
+	for(Local_Counter = 0 ; Local_Counter < TEST_BENCH_ITERATIONS ; Local_Counter++)
+	{
+		FMT_Signed((sint32_t)(Local_Counter % 10000U) - 5000 , Local_Buffer , &Local_Length);
+		Global_Sink += Local_Length;
+	}
+	HOST_Report("FMT_Signed (-5000 --> 4999)" , HOST_TimeNs() - Local_Start , TEST_BENCH_ITERATIONS , 0);
+
+	Local_Start = HOST_TimeNs();
+	for(Local_Counter = 0 , Local_Value = 0 ; Local_Counter < TEST_BENCH_ITERATIONS ; Local_Counter++ , Local_Value += 2654435761UL)
+	{
+		FMT_Hex(Local_Value , 1 , FMT_HEX_UPPER_CASE , Local_Buffer , &Local_Length);
+		Global_Sink += Local_Length;
+	}
+	HOST_Report("FMT_Hex" , HOST_TimeNs() - Local_Start , TEST_BENCH_ITERATIONS , 0);
+
+	Local_Start = HOST_TimeNs();
+	for(Local_Counter = 0 , Local_Value = 0 ; Local_Counter < TEST_BENCH_ITERATIONS ; Local_Counter++ , Local_Value += 2654435761UL)
+	{
+		FMT_FixedPoint((sint32_t)Local_Value , 2 , Local_Buffer , &Local_Length);
+		Global_Sink += Local_Length;
+	}
+	HOST_Report("FMT_FixedPoint (2 fraction digits)" , HOST_TimeNs() - Local_Start , TEST_BENCH_ITERATIONS , 0);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                       MAIN                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+int main(int argc , char** argv)
+{
+	uint8_t Local_Benchmark = HOST_IsBenchmarkRun(argc , argv);
+
+	if(Local_Benchmark == 1)
+	{
+		BENCH_Format();
+	}
+	else
+	{
+		TEST_Arguments();
+		TEST_Boundaries();
+		TEST_Sweeps();
+		TEST_Field();
+	}
+
+	return HOST_Summary("FORMAT");
+}
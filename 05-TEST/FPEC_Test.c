@@ -0,0 +1,295 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : FPEC Host Test               */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+
+#include "FPEC_Interface.h"
+
+#include "HOST_Model.h"
+#include "HOST_Test.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Flash status register and its error flags (PGERR, WRPRTERR) */
+#define TEST_FPEC_SR					(*(volatile uint32_t*)0x4002200CUL)
+#define TEST_SR_ERRORS					((1UL << 2) | (1UL << 4))
+
+/* Pages used by the test: first group of four is write protected, second is not */
+#define TEST_PROTECTED_PAGE				FPEC_PAGE_100
+#define TEST_FREE_PAGE					FPEC_PAGE_104
+#define TEST_PAGE_ADDRESS(Page)			(HOST_FLASH_BASE + ((uint32_t)(Page) * HOST_FLASH_PAGE_SIZE))
+#define TEST_PATTERN					0xA5U
+
+#define TEST_JOB_HALFWORDS				8U
+#define TEST_MAX_IRQS					64U			/* Bound of FLASH IRQs serviced for one queue */
+
+#define TEST_BENCH_ITERATIONS			1000000UL
+#define TEST_BENCH_HALFWORDS			64U
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Results notified by asynchronous jobs in order */
+static FPEC_JobResult_t Global_JobResults[TEST_MAX_IRQS];
+static uint32_t Global_JobResultsCount;
+
+void FLASH_IRQHandler(void);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    CALLBACKS                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+static void TEST_JobNotification(const FPEC_JobResult_t* Copy_pResult)
+{
+	if(Global_JobResultsCount < TEST_MAX_IRQS)
+	{
+		Global_JobResults[Global_JobResultsCount] = *Copy_pResult;
+		Global_JobResultsCount++;
+	}
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     HELPERS                                       */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Fills pages with a pattern behind the FPEC */
+static void TEST_FillPages(uint8_t Copy_FirstPage , uint8_t Copy_Pages)
+{
+	static uint8_t Local_Pattern[HOST_FLASH_PAGE_SIZE];
+	uint8_t Local_Page;
+
+	memset(Local_Pattern , TEST_PATTERN , sizeof(Local_Pattern));
+	for(Local_Page = 0 ; Local_Page < Copy_Pages ; Local_Page++)
+	{
+		HOST_FlashFill(TEST_PAGE_ADDRESS(Copy_FirstPage + Local_Page) , Local_Pattern , HOST_FLASH_PAGE_SIZE);
+	}
+}
+
+/* Checks every byte of a page holds a value */
+static uint8_t TEST_PageHolds(uint8_t Copy_Page , uint8_t Copy_Value)
+{
+	const volatile uint8_t* Local_pPage = (const volatile uint8_t*)(unsigned long)TEST_PAGE_ADDRESS(Copy_Page);
+	uint8_t Local_Holds = 1;
+	uint32_t Local_Counter;
+
+	for(Local_Counter = 0 ; Local_Counter < HOST_FLASH_PAGE_SIZE ; Local_Counter++)
+	{
+		if(Local_pPage[Local_Counter] != Copy_Value)
+		{
+			Local_Holds = 0;
+		}
+	}
+
+	return Local_Holds;
+}
+
+/* Page erases counted by the driver */
+static uint32_t TEST_EraseCount(void)
+{
+	uint32_t Local_EraseCount = 0;
+	uint32_t Local_ProgramCount;
+	uint32_t Local_SkipCount;
+
+	FPEC_GetWriteStatistics(&Local_EraseCount , &Local_ProgramCount , &Local_SkipCount);
+
+	return Local_EraseCount;
+}
+
+/* Services FLASH IRQ the way NVIC would while it is pending, returns number of serviced IRQs */
+static uint32_t TEST_ServiceFlashIrq(void)
+{
+	uint32_t Local_Irqs = 0;
+
+	while((HOST_FlashIrqPending() == 1) && (Local_Irqs < TEST_MAX_IRQS))
+	{
+		FLASH_IRQHandler();
+		Local_Irqs++;
+	}
+
+	return Local_Irqs;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                      TESTS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Page erase: range, session, erase count and error flags */
+static void TEST_PageErase(void)
+{
+	uint32_t Local_Before;
+
+	TEST_FillPages(TEST_PROTECTED_PAGE , 8U);
+	HOST_FlashWriteProtect(TEST_PAGE_ADDRESS(TEST_PROTECTED_PAGE) , HOST_FLASH_PAGE_SIZE);
+
+	/* Outside a session and out of range */
+	HOST_CHECK_EQUAL(FPEC_FlashPageErase(TEST_FREE_PAGE) , RT_NOK);
+	HOST_CHECK(TEST_PageHolds(TEST_FREE_PAGE , TEST_PATTERN));
+	HOST_CHECK_EQUAL(FPEC_BeginSession() , RT_OK);
+	HOST_CHECK_EQUAL(FPEC_FlashPageErase(FPEC_PAGE_127 + 1U) , RT_NOK);
+
+	/* Erase of a free page */
+	Local_Before = TEST_EraseCount();
+	HOST_CHECK_EQUAL(FPEC_FlashPageErase(TEST_FREE_PAGE) , RT_OK);
+	HOST_CHECK(TEST_PageHolds(TEST_FREE_PAGE , 0xFFU));
+	HOST_CHECK_EQUAL(TEST_EraseCount() , Local_Before + 1U);
+
+	/* Erase of a protected page fails, leaves the page and clears the error flag for next operations */
+	HOST_CHECK_EQUAL(FPEC_FlashPageErase(TEST_PROTECTED_PAGE) , RT_NOK);
+	HOST_CHECK(TEST_PageHolds(TEST_PROTECTED_PAGE , TEST_PATTERN));
+	HOST_CHECK_EQUAL(TEST_FPEC_SR & TEST_SR_ERRORS , 0);
+	HOST_CHECK_EQUAL(TEST_EraseCount() , Local_Before + 1U);
+	HOST_CHECK_EQUAL(FPEC_FlashPageErase(TEST_FREE_PAGE + 1U) , RT_OK);
+	HOST_CHECK(TEST_PageHolds(TEST_FREE_PAGE + 1U , 0xFFU));
+
+	/* Bank erase stops at the first page that fails */
+	HOST_CHECK_EQUAL(FPEC_EraseBankArea(TEST_PROTECTED_PAGE + 2U , 4U) , RT_NOK);
+	HOST_CHECK(TEST_PageHolds(TEST_PROTECTED_PAGE + 2U , TEST_PATTERN));
+	HOST_CHECK(TEST_PageHolds(TEST_FREE_PAGE + 2U , TEST_PATTERN));
+
+	/* Staged page can't be committed over a protected page */
+	HOST_CHECK_EQUAL(FPEC_BufferWrite(TEST_PAGE_ADDRESS(TEST_PROTECTED_PAGE) , (const uint16_t*)"\x00\x00" , 1) , RT_OK);
+	HOST_CHECK_EQUAL(FPEC_BufferFlush() , RT_NOK);
+	HOST_CHECK(TEST_PageHolds(TEST_PROTECTED_PAGE , TEST_PATTERN));
+	FPEC_BufferDiscard();
+
+	HOST_CHECK_EQUAL(FPEC_EndSession() , RT_OK);
+	HOST_ResetPeripherals();
+}
+
+/* Asynchronous jobs advance on FLASH IRQ (end of operation or error) and leave no IRQ pending */
+static void TEST_AsyncJobs(void)
+{
+	static const uint16_t Local_Data[TEST_JOB_HALFWORDS] = {0x0123U , 0x4567U , 0x89ABU , 0xCDEFU , 0xFFFFU , 0x0000U , 0x5AA5U , 0xA55AU};
+	FPEC_Job_t Local_Job = {0};
+	FPEC_JobResult_t Local_LastResult;
+	uint8_t Local_JobIds[4];
+	uint8_t Local_Pending;
+
+	TEST_FillPages(TEST_PROTECTED_PAGE , 8U);
+	HOST_FlashWriteProtect(TEST_PAGE_ADDRESS(TEST_PROTECTED_PAGE) , HOST_FLASH_PAGE_SIZE);
+	Global_JobResultsCount = 0;
+	HOST_CHECK_EQUAL(FPEC_BeginSession() , RT_OK);
+
+	/* Erase, program then verify a free page, erase a protected page */
+	Local_Job.notificationFunc = TEST_JobNotification;
+	Local_Job.jobType = FPEC_JOB_PAGE_ERASE;
+	Local_Job.pageNumber = TEST_FREE_PAGE;
+	HOST_CHECK_EQUAL(FPEC_SubmitJob(&Local_Job , &Local_JobIds[0]) , RT_OK);
+	HOST_CHECK_EQUAL(HOST_FlashIrqPending() , 1);
+	Local_Job.jobType = FPEC_JOB_PROGRAM;
+	Local_Job.address = TEST_PAGE_ADDRESS(TEST_FREE_PAGE);
+	Local_Job.pData = Local_Data;
+	Local_Job.length = TEST_JOB_HALFWORDS;
+	HOST_CHECK_EQUAL(FPEC_SubmitJob(&Local_Job , &Local_JobIds[1]) , RT_OK);
+	Local_Job.jobType = FPEC_JOB_VERIFY;
+	HOST_CHECK_EQUAL(FPEC_SubmitJob(&Local_Job , &Local_JobIds[2]) , RT_OK);
+	Local_Job.jobType = FPEC_JOB_PAGE_ERASE;
+	Local_Job.pageNumber = TEST_PROTECTED_PAGE;
+	HOST_CHECK_EQUAL(FPEC_SubmitJob(&Local_Job , &Local_JobIds[3]) , RT_OK);
+
+	/* One IRQ for the erase, one per programmed halfword (0xFFFF is skipped), one for the failing erase */
+	HOST_CHECK_EQUAL(TEST_ServiceFlashIrq() , 1U + (TEST_JOB_HALFWORDS - 1U) + 1U);
+	HOST_CHECK_EQUAL(HOST_FlashIrqPending() , 0);
+	HOST_CHECK_EQUAL(Global_JobResultsCount , 4U);
+	HOST_CHECK_EQUAL(Global_JobResults[0].jobId , Local_JobIds[0]);
+	HOST_CHECK_EQUAL(Global_JobResults[0].status , RT_OK);
+	HOST_CHECK_EQUAL(Global_JobResults[1].jobId , Local_JobIds[1]);
+	HOST_CHECK_EQUAL(Global_JobResults[1].status , RT_OK);
+	HOST_CHECK_EQUAL(Global_JobResults[2].jobId , Local_JobIds[2]);
+	HOST_CHECK_EQUAL(Global_JobResults[2].status , RT_OK);
+	HOST_CHECK_EQUAL(Global_JobResults[3].jobId , Local_JobIds[3]);
+	HOST_CHECK_EQUAL(Global_JobResults[3].status , RT_NOK);
+	HOST_CHECK_EQUAL(Global_JobResults[3].errorFlags , FPEC_JOB_ERROR_WRITE_PROTECTION);
+	HOST_CHECK_EQUAL(Global_JobResults[3].failAddress , TEST_PAGE_ADDRESS(TEST_PROTECTED_PAGE));
+	HOST_CHECK_EQUAL(memcmp((const void*)(unsigned long)TEST_PAGE_ADDRESS(TEST_FREE_PAGE) , Local_Data , sizeof(Local_Data)) , 0);
+	HOST_CHECK(TEST_PageHolds(TEST_PROTECTED_PAGE , TEST_PATTERN));
+
+	/* Queue is released, synchronous operations run again */
+	HOST_CHECK_EQUAL(FPEC_GetJobStatus(&Local_Pending , &Local_LastResult) , RT_OK);
+	HOST_CHECK_EQUAL(Local_Pending , 0);
+	HOST_CHECK_EQUAL(Local_LastResult.jobId , Local_JobIds[3]);
+	HOST_CHECK_EQUAL(FPEC_FlashPageErase(TEST_FREE_PAGE) , RT_OK);
+	HOST_CHECK_EQUAL(HOST_FlashIrqPending() , 0);
+
+	HOST_CHECK_EQUAL(FPEC_EndSession() , RT_OK);
+	HOST_ResetPeripherals();
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    BENCHMARKS                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Staging of halfword runs inside one page (no flash operation) */
+static void BENCH_BufferWrite(void)
+{
+	static uint16_t Local_Data[TEST_BENCH_HALFWORDS];
+	uint32_t Local_Iteration;
+	uint64_t Local_Start;
+
+	memset(Local_Data , 0x5A , sizeof(Local_Data));
+	FPEC_BeginSession();
+
+	Local_Start = HOST_TimeNs();
+	for(Local_Iteration = 0 ; Local_Iteration < TEST_BENCH_ITERATIONS ; Local_Iteration++)
+	{
+		FPEC_BufferWrite(TEST_PAGE_ADDRESS(TEST_FREE_PAGE) + ((Local_Iteration * sizeof(Local_Data)) % HOST_FLASH_PAGE_SIZE) ,
+						 Local_Data , TEST_BENCH_HALFWORDS);
+	}
+	HOST_Report("FPEC_BufferWrite (64 halfwords)" , HOST_TimeNs() - Local_Start , TEST_BENCH_ITERATIONS ,
+				(uint64_t)TEST_BENCH_ITERATIONS * sizeof(Local_Data));
+
+	FPEC_BufferDiscard();
+	FPEC_EndSession();
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                       MAIN                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+int main(int argc , char** argv)
+{
+	uint8_t Local_Benchmark = HOST_IsBenchmarkRun(argc , argv);
+
+	HOST_ModelInit(HOST_DEVICE_FLASH);
+
+	if(Local_Benchmark == 1)
+	{
+		BENCH_BufferWrite();
+	}
+	else
+	{
+		TEST_PageErase();
+		TEST_AsyncJobs();
+	}
+
+	return HOST_Summary("FPEC");
+}
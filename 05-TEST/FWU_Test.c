@@ -0,0 +1,429 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : FWU Host Test                */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+
+#include "FPEC_Interface.h"
+#include "NVIC_Interface.h"
+#include "SCB_Interface.h"
+#include "STK_Interface.h"
+
+#include "FWU_Config.h"
+#include "FWU_Interface.h"
+
+#include "HOST_Model.h"
+#include "HOST_Test.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#define TEST_SLOT_ADDRESS(Page)			(FPEC_FLASH_FIRST_ADDRESS + ((uint32_t)(Page) * FPEC_PAGE_SIZE))
+#define TEST_IMAGE_ADDRESS(Page)		(TEST_SLOT_ADDRESS(Page) + FPEC_PAGE_SIZE)
+
+/* Images: vector table (stack pointer, reset handler) then version, rest is pseudo random */
+#define TEST_STACK_POINTER				0x20004000UL
+#define TEST_IMAGE_SIZE					1100U		/* Two chunks, last one partial */
+#define TEST_RECEIVE_BURST				100U		/* Bytes handed by one receive interrupt */
+
+/* Core registers checked at image entry */
+#define TEST_REGISTER(Address)			(*(volatile uint32_t*)(unsigned long)(Address))
+#define TEST_STK_CTRL					0xE000E010U
+#define TEST_NVIC_ISER(Index)			(0xE000E100U + (4U * (Index)))
+#define TEST_NVIC_ISPR(Index)			(0xE000E200U + (4U * (Index)))
+#define TEST_SCB_ICSR					0xE000ED04U
+#define TEST_SCB_VTOR					0xE000ED08U
+#define TEST_ICSR_PENDSTSET				(1UL << 26)
+#define TEST_ICSR_PENDSVSET				(1UL << 28)
+#define TEST_STK_TICKS					72000U
+
+#define TEST_BENCH_UPDATES				20U
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  PRIVATE TYPES                                    */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* What boots saw (shared with boot processes, survives power cut) */
+typedef struct
+{
+	uint32_t UpdateVersion;					/* Image streamed by BOOT_Update */
+	uint32_t UpdateSize;
+	uint32_t UpdateCrc;
+	ERROR_STATUS_t FinishStatus;			/* Status of FWU_FinishUpdate */
+	uint8_t Entered;						/* Image reset handler was called */
+	uint32_t EnteredVersion;				/* Version read through relocated vector table */
+	uint32_t EnteredPrimask;
+	uint32_t EnteredStackPointer;
+	uint32_t EnteredVtor;
+	uint32_t EnteredEnabled;				/* NVIC enabled and pending interrupts, SysTick and ICSR left to image */
+	uint32_t EnteredPending;
+	uint32_t EnteredStkCtrl;
+	uint32_t EnteredIcsr;
+	ERROR_STATUS_t BootStatus;				/* Status of FWU_BootActiveImage when it returns */
+}TEST_Log_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static volatile TEST_Log_t* Global_pLog;
+
+/* Image streamed by next update */
+static uint8_t Global_Image[FWU_SLOT_IMAGE_SIZE];
+
+/* Flash before the update whose steps are cut */
+static uint8_t Global_Flash[HOST_FLASH_SIZE];
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     HELPERS                                       */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Flash operations done so far (programmed or rejected halfwords and erased pages) */
+static uint32_t TEST_FlashOperations(void)
+{
+	return HOST_pCounters->FlashPrograms + HOST_pCounters->FlashErrors + HOST_pCounters->FlashErases;
+}
+
+/* Bitwise CRC-32 (IEEE 802.3) as reference of the module nibble table */
+static uint32_t TEST_Crc32(const uint8_t* Copy_pData , uint32_t Copy_Size)
+{
+	uint32_t Local_Crc = 0xFFFFFFFFUL;
+	uint32_t Local_Byte;
+	uint8_t Local_Bit;
+
+	for(Local_Byte = 0 ; Local_Byte < Copy_Size ; Local_Byte++)
+	{
+		Local_Crc ^= Copy_pData[Local_Byte];
+		for(Local_Bit = 0 ; Local_Bit < 8U ; Local_Bit++)
+		{
+			Local_Crc = (Local_Crc >> 1) ^ ((Local_Crc & 1U) ? 0xEDB88320UL : 0U);
+		}
+	}
+
+	return Local_Crc ^ 0xFFFFFFFFUL;
+}
+
+/* Image reset handler: records what the boot loader handed over */
+static void TEST_ImageEntry(void)
+{
+	uint32_t Local_Vtor = TEST_REGISTER(TEST_SCB_VTOR);
+
+	Global_pLog->Entered = 1;
+	Global_pLog->EnteredVersion = TEST_REGISTER(Local_Vtor + 8U);
+	Global_pLog->EnteredPrimask = HOST_Primask;
+	Global_pLog->EnteredStackPointer = HOST_MainStackPointer;
+	Global_pLog->EnteredVtor = Local_Vtor;
+	Global_pLog->EnteredEnabled = TEST_REGISTER(TEST_NVIC_ISER(0)) | TEST_REGISTER(TEST_NVIC_ISER(1));
+	Global_pLog->EnteredPending = TEST_REGISTER(TEST_NVIC_ISPR(0)) | TEST_REGISTER(TEST_NVIC_ISPR(1));
+	Global_pLog->EnteredStkCtrl = TEST_REGISTER(TEST_STK_CTRL);
+	Global_pLog->EnteredIcsr = TEST_REGISTER(TEST_SCB_ICSR);
+}
+
+static void TEST_TickCallback(void)
+{
+}
+
+/* Builds an image of a version and sets it up as the next update */
+static void TEST_MakeImage(uint32_t Copy_Version , uint32_t Copy_Size)
+{
+	uint32_t Local_Seed = Copy_Version * 2654435761UL;
+	uint32_t Local_Byte;
+
+	for(Local_Byte = 0 ; Local_Byte < Copy_Size ; Local_Byte++)
+	{
+		Local_Seed = (Local_Seed * 1103515245UL) + 12345UL;
+		Global_Image[Local_Byte] = (uint8_t)(Local_Seed >> 16);
+	}
+	((uint32_t*)Global_Image)[0] = TEST_STACK_POINTER;
+	((uint32_t*)Global_Image)[1] = (uint32_t)(unsigned long)TEST_ImageEntry;
+	((uint32_t*)Global_Image)[2] = Copy_Version;
+
+	Global_pLog->UpdateVersion = Copy_Version;
+	Global_pLog->UpdateSize = Copy_Size;
+	Global_pLog->UpdateCrc = TEST_Crc32(Global_Image , Copy_Size);
+}
+
+/* Checks image a boot entered and the core state it was handed */
+static void TEST_CheckEntered(uint32_t Copy_Version , uint8_t Copy_SlotPage)
+{
+	HOST_CHECK_EQUAL(Global_pLog->Entered , 1);
+	HOST_CHECK_EQUAL(Global_pLog->EnteredVersion , Copy_Version);
+	HOST_CHECK_EQUAL(Global_pLog->EnteredVtor , TEST_IMAGE_ADDRESS(Copy_SlotPage));
+	HOST_CHECK_EQUAL(Global_pLog->EnteredStackPointer , TEST_STACK_POINTER);
+	HOST_CHECK_EQUAL(Global_pLog->EnteredPrimask , 0);
+	HOST_CHECK_EQUAL(Global_pLog->EnteredEnabled , 0);
+	HOST_CHECK_EQUAL(Global_pLog->EnteredPending , 0);
+	HOST_CHECK_EQUAL(Global_pLog->EnteredStkCtrl , 0);
+	HOST_CHECK_EQUAL(Global_pLog->EnteredIcsr & (TEST_ICSR_PENDSTSET | TEST_ICSR_PENDSVSET) , 0);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  BOOT FUNCTIONS                                   */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Streams image in receive bursts, programming chunks when both buffers are full, then commits it */
+static void BOOT_Update(void)
+{
+	uint32_t Local_Sent = 0;
+	uint16_t Local_Length;
+	uint16_t Local_Accepted;
+	ERROR_STATUS_t Local_Status;
+
+	Global_pLog->FinishStatus = RT_NOK;
+	HOST_CHECK_EQUAL(FWU_BeginUpdate(Global_pLog->UpdateVersion , Global_pLog->UpdateSize , Global_pLog->UpdateCrc) , RT_OK);
+
+	while(Local_Sent < Global_pLog->UpdateSize)
+	{
+		Local_Length = (uint16_t)(((Global_pLog->UpdateSize - Local_Sent) < TEST_RECEIVE_BURST) ?
+								  (Global_pLog->UpdateSize - Local_Sent) : TEST_RECEIVE_BURST);
+		Local_Status = FWU_WriteChunk(&Global_Image[Local_Sent] , Local_Length , &Local_Accepted);
+		Local_Sent += Local_Accepted;
+
+		/* Both buffers wait: main loop programs one */
+		if(Local_Status == BUSY_FUNC)
+		{
+			HOST_CHECK_EQUAL(FWU_Service() , RT_OK);
+		}
+		else
+		{
+			HOST_CHECK_EQUAL(Local_Status , RT_OK);
+		}
+	}
+
+	do
+	{
+		HOST_CHECK_EQUAL(FWU_Service() , RT_OK);
+		Local_Status = FWU_FinishUpdate();
+	}while(Local_Status == BUSY_FUNC);
+
+	Global_pLog->FinishStatus = Local_Status;
+}
+
+/* Boot loader with interrupts of its own still armed boots the active image */
+static void BOOT_Start(void)
+{
+	Global_pLog->Entered = 0;
+
+	STK_Init();
+	HOST_CHECK_EQUAL(STK_SetPeriodicInterval(TEST_STK_TICKS , TEST_TickCallback) , RT_OK);
+	HOST_CHECK_EQUAL(NVIC_EnableVectorInterrupt(NVIC_USART1) , RT_OK);
+	HOST_CHECK_EQUAL(NVIC_EnableVectorInterrupt(NVIC_EXTI0) , RT_OK);
+	HOST_CHECK_EQUAL(NVIC_SetVectorInterruptPendingFlag(NVIC_DMA2_Channel4_5) , RT_OK);
+	TEST_REGISTER(TEST_SCB_ICSR) = TEST_ICSR_PENDSTSET;
+	SCB_SetPendSVPendingFlag();
+
+	Global_pLog->BootStatus = FWU_BootActiveImage();
+}
+
+/* Arguments and calls out of sequence on blank slots */
+static void BOOT_Arguments(void)
+{
+	uint8_t Local_Slot;
+	uint32_t Local_Version;
+	uint32_t Local_Operations;
+	uint16_t Local_Accepted;
+
+	HOST_CHECK_EQUAL(FWU_GetActiveSlot(NULL , &Local_Version) , NULL_POINTER);
+	HOST_CHECK_EQUAL(FWU_GetActiveSlot(&Local_Slot , NULL) , NULL_POINTER);
+	HOST_CHECK_EQUAL(FWU_GetActiveSlot(&Local_Slot , &Local_Version) , RT_NOK);
+	HOST_CHECK_EQUAL(FWU_WriteChunk(Global_Image , 1 , &Local_Accepted) , RT_NOK);
+	HOST_CHECK_EQUAL(FWU_WriteChunk(NULL , 1 , &Local_Accepted) , NULL_POINTER);
+	HOST_CHECK_EQUAL(FWU_FinishUpdate() , RT_NOK);
+	HOST_CHECK_EQUAL(FWU_Service() , RT_OK);
+	HOST_CHECK_EQUAL(FWU_BeginUpdate(1 , 0 , 0) , RT_NOK);
+	HOST_CHECK_EQUAL(FWU_BeginUpdate(1 , FWU_SLOT_IMAGE_SIZE + 1U , 0) , RT_NOK);
+
+	/* Second update can't start while one is running */
+	HOST_CHECK_EQUAL(FWU_BeginUpdate(1 , 4 , 0) , RT_OK);
+	HOST_CHECK_EQUAL(FWU_BeginUpdate(1 , 4 , 0) , BUSY_FUNC);
+	HOST_CHECK_EQUAL(FWU_WriteChunk(Global_Image , 5 , &Local_Accepted) , RT_NOK);
+	HOST_CHECK_EQUAL(Local_Accepted , 4);
+	FWU_AbortUpdate();
+	HOST_CHECK_EQUAL(FWU_FinishUpdate() , RT_NOK);
+
+	/* Chunk received before abort is never programmed */
+	Local_Operations = TEST_FlashOperations();
+	HOST_CHECK_EQUAL(FWU_Service() , RT_OK);
+	HOST_CHECK_EQUAL(TEST_FlashOperations() , Local_Operations);
+}
+
+/* Streams image then checks committed status */
+static void BOOT_UpdateCommitted(void)
+{
+	BOOT_Update();
+	HOST_CHECK_EQUAL(Global_pLog->FinishStatus , RT_OK);
+}
+
+/* Same version as active image is not an upgrade */
+static void BOOT_Downgrade(void)
+{
+	HOST_CHECK_EQUAL(FWU_BeginUpdate(Global_pLog->UpdateVersion , Global_pLog->UpdateSize , Global_pLog->UpdateCrc) , RT_NOK);
+}
+
+/* Benchmark: full slot images streamed and committed back to back */
+static void BOOT_Bench(void)
+{
+	uint64_t Local_Start;
+	uint32_t Local_Update;
+
+	Local_Start = HOST_TimeNs();
+	for(Local_Update = 1 ; Local_Update <= TEST_BENCH_UPDATES ; Local_Update++)
+	{
+		Global_pLog->UpdateVersion = Local_Update;
+		((uint32_t*)Global_Image)[2] = Local_Update;
+		Global_pLog->UpdateCrc = TEST_Crc32(Global_Image , Global_pLog->UpdateSize);
+		BOOT_Update();
+	}
+	HOST_Report("FWU update (stream, program, CRC, commit)" , HOST_TimeNs() - Local_Start , TEST_BENCH_UPDATES ,
+				(uint64_t)TEST_BENCH_UPDATES * Global_pLog->UpdateSize);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                      TESTS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+static void TEST_Arguments(void)
+{
+	HOST_FlashErase(HOST_FLASH_BASE , HOST_FLASH_SIZE);
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_Arguments) , HOST_BOOT_COMPLETED);
+
+	/* No image: boot loader stays */
+	HOST_FlashErase(HOST_FLASH_BASE , HOST_FLASH_SIZE);
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_Start) , HOST_BOOT_COMPLETED);
+	HOST_CHECK_EQUAL(Global_pLog->Entered , 0);
+	HOST_CHECK_EQUAL(Global_pLog->BootStatus , RT_NOK);
+}
+
+/* First image goes to slot A, next ones alternate, rejected or corrupted images keep the active one */
+static void TEST_Updates(void)
+{
+	uint8_t Local_Corrupted;
+
+	HOST_FlashErase(HOST_FLASH_BASE , HOST_FLASH_SIZE);
+	TEST_MakeImage(1 , TEST_IMAGE_SIZE);
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_UpdateCommitted) , HOST_BOOT_COMPLETED);
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_Start) , HOST_BOOT_COMPLETED);
+	TEST_CheckEntered(1 , FWU_SLOT_A_FIRST_PAGE);
+
+	TEST_MakeImage(2 , FWU_SLOT_IMAGE_SIZE);
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_UpdateCommitted) , HOST_BOOT_COMPLETED);
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_Start) , HOST_BOOT_COMPLETED);
+	TEST_CheckEntered(2 , FWU_SLOT_B_FIRST_PAGE);
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_Downgrade) , HOST_BOOT_COMPLETED);
+
+	/* Image whose CRC doesn't match is never committed */
+	TEST_MakeImage(3 , TEST_IMAGE_SIZE);
+	Global_pLog->UpdateCrc ^= 1U;
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_Update) , HOST_BOOT_COMPLETED);
+	HOST_CHECK_EQUAL(Global_pLog->FinishStatus , RT_NOK);
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_Start) , HOST_BOOT_COMPLETED);
+	TEST_CheckEntered(2 , FWU_SLOT_B_FIRST_PAGE);
+
+	/* Committed image corrupted later: boot falls back to the other slot */
+	TEST_MakeImage(3 , TEST_IMAGE_SIZE);
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_UpdateCommitted) , HOST_BOOT_COMPLETED);
+	Local_Corrupted = (uint8_t)(Global_Image[TEST_IMAGE_SIZE - 1U] ^ 0x40U);
+	HOST_FlashFill(TEST_IMAGE_ADDRESS(FWU_SLOT_A_FIRST_PAGE) + TEST_IMAGE_SIZE - 1U , &Local_Corrupted , 1);
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_Start) , HOST_BOOT_COMPLETED);
+	TEST_CheckEntered(2 , FWU_SLOT_B_FIRST_PAGE);
+}
+
+/* Power cut at every flash operation of an update over the older image: old image boots, update can be run again */
+static void TEST_PowerCuts(void)
+{
+	uint32_t Local_Operations;
+	uint32_t Local_Cut;
+
+	/* Slot A holds version 1, slot B version 2 (active), version 3 replaces slot A */
+	HOST_FlashErase(HOST_FLASH_BASE , HOST_FLASH_SIZE);
+	TEST_MakeImage(1 , TEST_IMAGE_SIZE);
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_UpdateCommitted) , HOST_BOOT_COMPLETED);
+	TEST_MakeImage(2 , TEST_IMAGE_SIZE);
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_UpdateCommitted) , HOST_BOOT_COMPLETED);
+	memcpy(Global_Flash , (const void*)(unsigned long)HOST_FLASH_BASE , HOST_FLASH_SIZE);
+
+	TEST_MakeImage(3 , TEST_IMAGE_SIZE);
+	Local_Operations = TEST_FlashOperations();
+	HOST_CHECK_EQUAL(HOST_Boot(BOOT_UpdateCommitted) , HOST_BOOT_COMPLETED);
+	Local_Operations = TEST_FlashOperations() - Local_Operations;
+
+	/* Header page, both image pages and every halfword (header included) */
+	HOST_CHECK(Local_Operations > (3U + (TEST_IMAGE_SIZE / 2U)));
+
+	for(Local_Cut = 0 ; Local_Cut < Local_Operations ; Local_Cut++)
+	{
+		HOST_FlashFill(HOST_FLASH_BASE , Global_Flash , HOST_FLASH_SIZE);
+		HOST_PowerCutAfter(Local_Cut);
+		HOST_CHECK_EQUAL(HOST_Boot(BOOT_Update) , HOST_BOOT_POWER_CUT);
+
+		/* Magic number is the last halfword, update is never half committed */
+		HOST_CHECK_EQUAL(HOST_Boot(BOOT_Start) , HOST_BOOT_COMPLETED);
+		TEST_CheckEntered(2 , FWU_SLOT_B_FIRST_PAGE);
+
+		/* Update runs again over what the cut left */
+		HOST_CHECK_EQUAL(HOST_Boot(BOOT_UpdateCommitted) , HOST_BOOT_COMPLETED);
+		HOST_CHECK_EQUAL(HOST_Boot(BOOT_Start) , HOST_BOOT_COMPLETED);
+		TEST_CheckEntered(3 , FWU_SLOT_A_FIRST_PAGE);
+	}
+
+	printf("FWU power cuts: %u\n" , Local_Operations);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                       MAIN                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+int main(int argc , char** argv)
+{
+	uint8_t Local_Benchmark = HOST_IsBenchmarkRun(argc , argv);
+
+	HOST_ModelInit(HOST_DEVICE_FLASH | HOST_DEVICE_NVIC);
+
+	/* Boot log lives across boots */
+	Global_pLog = mmap(NULL , sizeof(TEST_Log_t) , PROT_READ | PROT_WRITE , MAP_SHARED | MAP_ANONYMOUS , -1 , 0);
+	if(Global_pLog == MAP_FAILED)
+	{
+		perror("FWU_Test: log");
+		return 1;
+	}
+
+	if(Local_Benchmark == 1)
+	{
+		HOST_FlashErase(HOST_FLASH_BASE , HOST_FLASH_SIZE);
+		TEST_MakeImage(0 , FWU_SLOT_IMAGE_SIZE);
+		HOST_Boot(BOOT_Bench);
+	}
+	else
+	{
+		TEST_Arguments();
+		TEST_Updates();
+		TEST_PowerCuts();
+	}
+
+	return HOST_Summary("FWU");
+}
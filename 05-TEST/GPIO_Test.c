@@ -0,0 +1,198 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : GPIO Host Test               */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include <stdio.h>
+
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+
+#include "GPIO_Interface.h"
+
+#include "HOST_Model.h"
+#include "HOST_Test.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#define TEST_PORTS						3U
+#define TEST_PINS						16U
+#define TEST_OTHER_PINS					0xA5A5UL			/* ODR pattern of the pins a macro must leave */
+
+#define TEST_BENCH_ITERATIONS			50000000UL
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static volatile uint32_t Global_Sink;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     HELPERS                                       */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Output data register (its address is checked against the checked API first) */
+static uint16_t TEST_PortValue(uint8_t Copy_Port)
+{
+	return (uint16_t)GPIO_ODR_REG(Copy_Port);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                      TESTS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Fast macros reach registers of the port used by the checked API */
+static void TEST_PortAddresses(void)
+{
+	uint8_t Local_Port;
+
+	for(Local_Port = GPIO_PORT_A ; Local_Port < TEST_PORTS ; Local_Port++)
+	{
+		GPIO_SetPortVal(Local_Port , (uint16_t)(0x1111U * (Local_Port + 1U)));
+		HOST_CHECK_EQUAL(GPIO_ODR_REG(Local_Port) , 0x1111U * (Local_Port + 1U));
+	}
+	HOST_CHECK_EQUAL(&GPIO_ODR_REG(GPIO_PORT_A) , (volatile uint32_t*)(GPIO_PORTA_BASE_ADDRESS + 0x0CUL));
+	HOST_CHECK_EQUAL(&GPIO_ODR_REG(GPIO_PORT_C) , (volatile uint32_t*)(GPIO_PORTC_BASE_ADDRESS + 0x0CUL));
+}
+
+/* Every macro on every pin: one bus store, only its pin changes, same result as the checked API */
+static void TEST_PinAccess(void)
+{
+	uint8_t Local_Port;
+	uint8_t Local_Pin;
+	uint8_t Local_Value;
+	uint32_t Local_Mask;
+	uint32_t Local_Stores;
+
+	for(Local_Port = GPIO_PORT_A ; Local_Port < TEST_PORTS ; Local_Port++)
+	{
+		for(Local_Pin = GPIO_PIN_0 ; Local_Pin < TEST_PINS ; Local_Pin++)
+		{
+			Local_Mask = 1UL << Local_Pin;
+			GPIO_SetPortVal(Local_Port , (uint16_t)(TEST_OTHER_PINS & ~Local_Mask));
+			Local_Stores = HOST_pCounters->GpioStores[Local_Port];
+
+			GPIO_FAST_SET_PIN(Local_Port , Local_Pin);
+			HOST_CHECK_EQUAL(TEST_PortValue(Local_Port) , TEST_OTHER_PINS | Local_Mask);
+			GPIO_FAST_RESET_PIN(Local_Port , Local_Pin);
+			HOST_CHECK_EQUAL(TEST_PortValue(Local_Port) , TEST_OTHER_PINS & ~Local_Mask);
+			GPIO_FAST_WRITE_PIN(Local_Port , Local_Pin , GPIO_PIN_HIGH);
+			HOST_CHECK_EQUAL(TEST_PortValue(Local_Port) , TEST_OTHER_PINS | Local_Mask);
+			GPIO_FAST_WRITE_PIN(Local_Port , Local_Pin , GPIO_PIN_LOW);
+			HOST_CHECK_EQUAL(TEST_PortValue(Local_Port) , TEST_OTHER_PINS & ~Local_Mask);
+			GPIO_FAST_TOGGLE_PIN(Local_Port , Local_Pin);
+			HOST_CHECK_EQUAL(TEST_PortValue(Local_Port) , TEST_OTHER_PINS | Local_Mask);
+			GPIO_FAST_TOGGLE_PIN(Local_Port , Local_Pin);
+			HOST_CHECK_EQUAL(TEST_PortValue(Local_Port) , TEST_OTHER_PINS & ~Local_Mask);
+			HOST_CHECK_EQUAL(HOST_pCounters->GpioStores[Local_Port] - Local_Stores , 6U);
+
+			/* Input register read by both ways */
+			GPIO_IDR_REG(Local_Port) = TEST_OTHER_PINS ^ Local_Mask;
+			GPIO_GetPinVal(Local_Port , Local_Pin , &Local_Value);
+			HOST_CHECK_EQUAL(GPIO_FAST_GET_PIN(Local_Port , Local_Pin) , Local_Value);
+			GPIO_IDR_REG(Local_Port) = TEST_OTHER_PINS;
+			GPIO_GetPinVal(Local_Port , Local_Pin , &Local_Value);
+			HOST_CHECK_EQUAL(GPIO_FAST_GET_PIN(Local_Port , Local_Pin) , Local_Value);
+		}
+	}
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    BENCHMARKS                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Fast macros against checked API (registers are plain memory, no trap cost) */
+static void BENCH_PinAccess(void)
+{
+	uint32_t Local_Iteration;
+	uint8_t Local_Value;
+	uint64_t Local_Start;
+
+	HOST_SetModelledDevices(0);
+
+	Local_Start = HOST_TimeNs();
+	for(Local_Iteration = 0 ; Local_Iteration < TEST_BENCH_ITERATIONS ; Local_Iteration++)
+	{
+		GPIO_SetPinVal(GPIO_PORT_B , GPIO_PIN_5 , (uint8_t)(Local_Iteration & 1U));
+	}
+	HOST_Report("GPIO_SetPinVal" , HOST_TimeNs() - Local_Start , TEST_BENCH_ITERATIONS , 0);
+
+	Local_Start = HOST_TimeNs();
+	for(Local_Iteration = 0 ; Local_Iteration < TEST_BENCH_ITERATIONS ; Local_Iteration++)
+	{
+		GPIO_FAST_WRITE_PIN(GPIO_PORT_B , GPIO_PIN_5 , (uint8_t)(Local_Iteration & 1U));
+	}
+	HOST_Report("GPIO_FAST_WRITE_PIN" , HOST_TimeNs() - Local_Start , TEST_BENCH_ITERATIONS , 0);
+
+	Local_Start = HOST_TimeNs();
+	for(Local_Iteration = 0 ; Local_Iteration < TEST_BENCH_ITERATIONS ; Local_Iteration++)
+	{
+		GPIO_TogglePinVal(GPIO_PORT_B , GPIO_PIN_5);
+	}
+	HOST_Report("GPIO_TogglePinVal" , HOST_TimeNs() - Local_Start , TEST_BENCH_ITERATIONS , 0);
+
+	Local_Start = HOST_TimeNs();
+	for(Local_Iteration = 0 ; Local_Iteration < TEST_BENCH_ITERATIONS ; Local_Iteration++)
+	{
+		GPIO_FAST_TOGGLE_PIN(GPIO_PORT_B , GPIO_PIN_5);
+	}
+	HOST_Report("GPIO_FAST_TOGGLE_PIN" , HOST_TimeNs() - Local_Start , TEST_BENCH_ITERATIONS , 0);
+
+	Local_Start = HOST_TimeNs();
+	for(Local_Iteration = 0 ; Local_Iteration < TEST_BENCH_ITERATIONS ; Local_Iteration++)
+	{
+		GPIO_GetPinVal(GPIO_PORT_B , GPIO_PIN_5 , &Local_Value);
+		Global_Sink += Local_Value;
+	}
+	HOST_Report("GPIO_GetPinVal" , HOST_TimeNs() - Local_Start , TEST_BENCH_ITERATIONS , 0);
+
+	Local_Start = HOST_TimeNs();
+	for(Local_Iteration = 0 ; Local_Iteration < TEST_BENCH_ITERATIONS ; Local_Iteration++)
+	{
+		Global_Sink += GPIO_FAST_GET_PIN(GPIO_PORT_B , GPIO_PIN_5);
+	}
+	HOST_Report("GPIO_FAST_GET_PIN" , HOST_TimeNs() - Local_Start , TEST_BENCH_ITERATIONS , 0);
+
+	HOST_SetModelledDevices(HOST_DEVICE_GPIO);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                       MAIN                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+int main(int argc , char** argv)
+{
+	uint8_t Local_Benchmark = HOST_IsBenchmarkRun(argc , argv);
+
+	HOST_ModelInit(HOST_DEVICE_GPIO);
+
+	if(Local_Benchmark == 1)
+	{
+		BENCH_PinAccess();
+	}
+	else
+	{
+		TEST_PortAddresses();
+		TEST_PinAccess();
+	}
+
+	return HOST_Summary("GPIO");
+}
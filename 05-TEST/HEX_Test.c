@@ -0,0 +1,588 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : Hex Parser Host Test         */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+
+#include "FPEC_Interface.h"
+#include "HEX_PARSER.h"
+
+#include "HOST_Model.h"
+#include "HOST_Test.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Memory written by parsed files: crosses a 64 KB boundary so extended linear address records change */
+#define TEST_WINDOW_BASE				0x0800F000UL
+#define TEST_WINDOW_SIZE				0x00002000UL
+#define TEST_SEGMENT_WINDOW_BASE		0x00012340UL		/* Reached through extended segment address records */
+#define TEST_FLASH_WINDOW_BASE			0x08004000UL		/* Written through FPEC_BufferWrite */
+#define TEST_ENTRY_ADDRESS				0x0800F131UL
+
+#define TEST_FILE_SIZE					(64UL * 1024UL)
+#define TEST_FILES						200U
+#define TEST_FUZZ_RUNS					20000U
+#define TEST_BENCH_FILE_SIZE			(4UL * 1024UL * 1024UL)
+#define TEST_BENCH_FRAGMENT				64U
+
+/* Record generation */
+#define TEST_MAX_RECORD_DATA			32U
+#define TEST_MAX_GAP					5U
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  PRIVATE TYPES                                    */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* One data record of a generated file */
+typedef struct
+{
+	uint32_t Address;
+	uint8_t Length;
+}TEST_Record_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static uint32_t Global_RandomState = 0x6C8E9CF5UL;
+
+/* Memory the generated file describes (undefined bytes are erased) and memory the parser wrote */
+static uint8_t Global_Expected[TEST_WINDOW_SIZE];
+static uint8_t Global_Written[TEST_WINDOW_SIZE];
+static uint32_t Global_WindowBase = TEST_WINDOW_BASE;
+static uint32_t Global_BadWrites;
+
+/* Generated file */
+static uint8_t Global_File[TEST_FILE_SIZE];
+static uint32_t Global_FileLength;
+static TEST_Record_t Global_Records[TEST_WINDOW_SIZE];
+
+static uint8_t Global_Mutated[TEST_FILE_SIZE + 16U];
+static uint8_t Global_BenchFile[TEST_BENCH_FILE_SIZE];
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     HELPERS                                       */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Xorshift32 pseudo random numbers, same sequence on every run */
+static uint32_t TEST_Random(void)
+{
+	Global_RandomState ^= Global_RandomState << 13;
+	Global_RandomState ^= Global_RandomState >> 17;
+	Global_RandomState ^= Global_RandomState << 5;
+	return Global_RandomState;
+}
+
+/* Write function model: halfword runs land in the window, anything else is counted as bad */
+static ERROR_STATUS_t TEST_Write(uint32_t Copy_Address , const uint16_t* Copy_pData , uint16_t Copy_Length)
+{
+	uint16_t Local_Counter;
+
+	if(((Copy_Address & 1UL) != 0) || (Copy_Length == 0) || (Copy_Length > (HEX_RUN_SIZE / 2U)) ||
+	   (Copy_Address < Global_WindowBase) || ((Copy_Address + (2UL * Copy_Length)) > (Global_WindowBase + TEST_WINDOW_SIZE)))
+	{
+		Global_BadWrites++;
+	}
+	else
+	{
+		for(Local_Counter = 0 ; Local_Counter < Copy_Length ; Local_Counter++)
+		{
+			Global_Written[Copy_Address - Global_WindowBase + (2U * Local_Counter)] = (uint8_t)Copy_pData[Local_Counter];
+			Global_Written[Copy_Address - Global_WindowBase + (2U * Local_Counter) + 1U] = (uint8_t)(Copy_pData[Local_Counter] >> 8);
+		}
+	}
+
+	return RT_OK;
+}
+
+/* Write function for fuzzing: any address is accepted, run shape is checked only */
+static ERROR_STATUS_t TEST_WriteAnywhere(uint32_t Copy_Address , const uint16_t* Copy_pData , uint16_t Copy_Length)
+{
+	(void)Copy_pData;
+
+	if(((Copy_Address & 1UL) != 0) || (Copy_Length == 0) || (Copy_Length > (HEX_RUN_SIZE / 2U)))
+	{
+		Global_BadWrites++;
+	}
+
+	return RT_OK;
+}
+
+static ERROR_STATUS_t TEST_WriteNothing(uint32_t Copy_Address , const uint16_t* Copy_pData , uint16_t Copy_Length)
+{
+	(void)Copy_Address;
+	(void)Copy_pData;
+	(void)Copy_Length;
+
+	return RT_OK;
+}
+
+static ERROR_STATUS_t TEST_WriteFails(uint32_t Copy_Address , const uint16_t* Copy_pData , uint16_t Copy_Length)
+{
+	(void)Copy_Address;
+	(void)Copy_pData;
+	(void)Copy_Length;
+
+	return BUSY_FUNC;
+}
+
+/* Appends one record (address is its 16 bits field), hex digits in upper or lower case */
+static uint32_t TEST_AppendRecord(uint8_t* Copy_pFile , uint32_t Copy_Length , uint8_t Copy_Type , uint16_t Copy_Address ,
+								  const uint8_t* Copy_pData , uint8_t Copy_DataLength , uint8_t Copy_LowerCase)
+{
+	uint8_t Local_Bytes[HEX_MAX_RECORD_BYTES];
+	uint8_t Local_Checksum = 0;
+	uint16_t Local_Counter;
+
+	Local_Bytes[0] = Copy_DataLength;
+	Local_Bytes[1] = (uint8_t)(Copy_Address >> 8);
+	Local_Bytes[2] = (uint8_t)Copy_Address;
+	Local_Bytes[3] = Copy_Type;
+	memcpy(&Local_Bytes[4] , Copy_pData , Copy_DataLength);
+	for(Local_Counter = 0 ; Local_Counter < (Copy_DataLength + 4U) ; Local_Counter++)
+	{
+		Local_Checksum = (uint8_t)(Local_Checksum + Local_Bytes[Local_Counter]);
+	}
+	Local_Bytes[Copy_DataLength + 4U] = (uint8_t)(0U - Local_Checksum);
+
+	Copy_pFile[Copy_Length++] = ':';
+	for(Local_Counter = 0 ; Local_Counter < (Copy_DataLength + HEX_RECORD_OVERHEAD) ; Local_Counter++)
+	{
+		Copy_Length += (uint32_t)sprintf((char*)&Copy_pFile[Copy_Length] , Copy_LowerCase ? "%02x" : "%02X" , Local_Bytes[Local_Counter]);
+	}
+	Copy_pFile[Copy_Length++] = '\r';
+	Copy_pFile[Copy_Length++] = '\n';
+
+	return Copy_Length;
+}
+
+/* Appends extended linear or segment address record giving base of an address */
+static uint32_t TEST_AppendBase(uint8_t* Copy_pFile , uint32_t Copy_Length , uint32_t Copy_Base , uint8_t Copy_Segment)
+{
+	uint8_t Local_Data[2];
+	uint32_t Local_Value = Copy_Segment ? (Copy_Base >> 4) : (Copy_Base >> 16);
+
+	Local_Data[0] = (uint8_t)(Local_Value >> 8);
+	Local_Data[1] = (uint8_t)Local_Value;
+
+	return TEST_AppendRecord(Copy_pFile , Copy_Length , Copy_Segment ? 0x02U : 0x04U , 0 , Local_Data , 2 , 0);
+}
+
+/* Generates memory content and a file describing it: random record lengths, gaps and odd edges, some neighbour records swapped */
+static void TEST_Generate(uint8_t Copy_Segment)
+{
+	uint32_t Local_Offset = 0;
+	uint32_t Local_Records = 0;
+	uint32_t Local_Counter;
+	uint32_t Local_Base = 0xFFFFFFFFUL;
+	uint32_t Local_RecordBase;
+	uint32_t Local_Address;
+	uint8_t Local_Length;
+	uint8_t Local_Entry[4];
+	TEST_Record_t Local_Swap;
+
+	memset(Global_Expected , 0xFF , TEST_WINDOW_SIZE);
+
+	/* Data records cover the window with gaps, none crosses a 64 KB boundary */
+	Local_Offset = TEST_Random() % 3U;
+	while(Local_Offset < TEST_WINDOW_SIZE)
+	{
+		Local_Length = (uint8_t)(1U + (TEST_Random() % TEST_MAX_RECORD_DATA));
+		Local_Address = Global_WindowBase + Local_Offset;
+		if(Local_Length > (TEST_WINDOW_SIZE - Local_Offset))
+		{
+			Local_Length = (uint8_t)(TEST_WINDOW_SIZE - Local_Offset);
+		}
+		if(((Local_Address & 0xFFFFUL) + Local_Length) > 0x10000UL)
+		{
+			Local_Length = (uint8_t)(0x10000UL - (Local_Address & 0xFFFFUL));
+		}
+
+		Global_Records[Local_Records].Address = Local_Address;
+		Global_Records[Local_Records].Length = Local_Length;
+		Local_Records++;
+		for(Local_Counter = 0 ; Local_Counter < Local_Length ; Local_Counter++)
+		{
+			Global_Expected[Local_Offset + Local_Counter] = (uint8_t)TEST_Random();
+		}
+
+		Local_Offset += Local_Length + (((TEST_Random() % 3U) == 0) ? (TEST_Random() % (TEST_MAX_GAP + 1U)) : 0U);
+	}
+
+	/* Out of order neighbours (two records sharing a halfword may arrive in any order) */
+	for(Local_Counter = 0 ; (Local_Counter + 1U) < Local_Records ; Local_Counter++)
+	{
+		if((TEST_Random() % 4U) == 0)
+		{
+			Local_Swap = Global_Records[Local_Counter];
+			Global_Records[Local_Counter] = Global_Records[Local_Counter + 1U];
+			Global_Records[Local_Counter + 1U] = Local_Swap;
+			Local_Counter++;
+		}
+	}
+
+	/* Base address record whenever 16 bits address field doesn't reach a record */
+	Global_FileLength = 0;
+	for(Local_Counter = 0 ; Local_Counter < Local_Records ; Local_Counter++)
+	{
+		Local_Address = Global_Records[Local_Counter].Address;
+		Local_RecordBase = Copy_Segment ? (Global_WindowBase & ~0xFUL) : (Local_Address & 0xFFFF0000UL);
+		if(Local_RecordBase != Local_Base)
+		{
+			Global_FileLength = TEST_AppendBase(Global_File , Global_FileLength , Local_RecordBase , Copy_Segment);
+			Local_Base = Local_RecordBase;
+		}
+		Global_FileLength = TEST_AppendRecord(Global_File , Global_FileLength , 0x00U , (uint16_t)(Local_Address - Local_Base) ,
+											  &Global_Expected[Local_Address - Global_WindowBase] , Global_Records[Local_Counter].Length ,
+											  (uint8_t)(TEST_Random() & 1U));
+	}
+
+	/* Start linear address then end of file */
+	Local_Entry[0] = (uint8_t)(TEST_ENTRY_ADDRESS >> 24);
+	Local_Entry[1] = (uint8_t)(TEST_ENTRY_ADDRESS >> 16);
+	Local_Entry[2] = (uint8_t)(TEST_ENTRY_ADDRESS >> 8);
+	Local_Entry[3] = (uint8_t)TEST_ENTRY_ADDRESS;
+	Global_FileLength = TEST_AppendRecord(Global_File , Global_FileLength , 0x05U , 0 , Local_Entry , 4 , 0);
+	Global_FileLength = TEST_AppendRecord(Global_File , Global_FileLength , 0x01U , 0 , NULL , 0 , 0);
+}
+
+/* Feeds a file in fragments of random sizes (0 = whole file at once), returns first failing status */
+static ERROR_STATUS_t TEST_FeedFragments(HEX_Parser_t* Copy_pParser , const uint8_t* Copy_pFile , uint32_t Copy_Length , uint32_t Copy_MaxFragment)
+{
+	ERROR_STATUS_t Local_Status = RT_OK;
+	uint32_t Local_Offset = 0;
+	uint32_t Local_Fragment;
+
+	while((Local_Status == RT_OK) && (Local_Offset < Copy_Length))
+	{
+		Local_Fragment = (Copy_MaxFragment == 0) ? Copy_Length : (1U + (TEST_Random() % Copy_MaxFragment));
+		if(Local_Fragment > (Copy_Length - Local_Offset))
+		{
+			Local_Fragment = Copy_Length - Local_Offset;
+		}
+		Local_Status = HEX_Feed(Copy_pParser , &Copy_pFile[Local_Offset] , Local_Fragment);
+		Local_Offset += Local_Fragment;
+	}
+
+	return Local_Status;
+}
+
+/* Parses a single text, returns status of feed */
+static ERROR_STATUS_t TEST_ParseText(HEX_Parser_t* Copy_pParser , const char* Copy_pText)
+{
+	HEX_Init(Copy_pParser , TEST_Write);
+	return HEX_Feed(Copy_pParser , (const uint8_t*)Copy_pText , (uint32_t)strlen(Copy_pText));
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                      TESTS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+static void TEST_Arguments(void)
+{
+	HEX_Parser_t Local_Parser;
+	uint32_t Local_Entry = 0;
+
+	HOST_CHECK_EQUAL(HEX_Init(NULL , TEST_Write) , NULL_POINTER);
+	HOST_CHECK_EQUAL(HEX_Init(&Local_Parser , NULL) , NULL_POINTER);
+	HOST_CHECK_EQUAL(HEX_Init(&Local_Parser , TEST_Write) , RT_OK);
+	HOST_CHECK_EQUAL(HEX_Feed(NULL , (const uint8_t*)":" , 1) , NULL_POINTER);
+	HOST_CHECK_EQUAL(HEX_Feed(&Local_Parser , NULL , 1) , NULL_POINTER);
+	HOST_CHECK_EQUAL(HEX_Finish(NULL , &Local_Entry) , NULL_POINTER);
+	HOST_CHECK_EQUAL(HEX_Finish(&Local_Parser , &Local_Entry) , RT_NOK);
+
+	/* Empty file with end of file only: no entry address */
+	HOST_CHECK_EQUAL(TEST_ParseText(&Local_Parser , ":00000001FF\r\n") , RT_OK);
+	HOST_CHECK_EQUAL(HEX_Finish(&Local_Parser , &Local_Entry) , RT_OK);
+	HOST_CHECK_EQUAL(Local_Entry , HEX_NO_ENTRY_ADDRESS);
+	HOST_CHECK_EQUAL(HEX_Finish(&Local_Parser , NULL) , RT_OK);
+}
+
+/* Malformed records fail the parser until it is initialized again */
+static void TEST_Malformed(void)
+{
+	static const char* const Local_Bad[] =
+	{
+		":0100000000FE\n",							/* Bad checksum */
+		":00000001FE\n",							/* Bad checksum of end of file */
+		":0100000G00FF\n",							/* Non hex digit */
+		"x:00000001FF\n",							/* Garbage between records */
+		":0100000100FE\n",							/* End of file with data */
+		":0100000200FD\n",							/* Extended segment address of 1 byte */
+		":03000004000000F9\n",						/* Extended linear address of 3 bytes */
+		":020000030000FB\n",						/* Start segment address of 2 bytes */
+		":020000050000F9\n",						/* Start linear address of 2 bytes */
+		":00000006FA\n",							/* Unknown record type */
+		":00000001FF\n:00000001FF\n",				/* Record after end of file */
+		":00000001FF\nx",							/* Garbage after end of file */
+		":02000004:0800F2\n",						/* Record mark inside a record */
+	};
+	HEX_Parser_t Local_Parser;
+	uint32_t Local_Index;
+
+	for(Local_Index = 0 ; Local_Index < (sizeof(Local_Bad) / sizeof(Local_Bad[0])) ; Local_Index++)
+	{
+		if(TEST_ParseText(&Local_Parser , Local_Bad[Local_Index]) != RT_NOK)
+		{
+			printf("HEX accepted malformed text %u\n" , Local_Index);
+			HOST_CHECK(0);
+		}
+		HOST_CHECK_EQUAL(HEX_Feed(&Local_Parser , (const uint8_t*)":00000001FF\n" , 12) , RT_NOK);
+		HOST_CHECK_EQUAL(HEX_Finish(&Local_Parser , NULL) , RT_NOK);
+	}
+
+	/* Truncated file never finishes */
+	HOST_CHECK_EQUAL(TEST_ParseText(&Local_Parser , ":0400000001020304F2\n:000000") , RT_OK);
+	HOST_CHECK_EQUAL(HEX_Finish(&Local_Parser , NULL) , RT_NOK);
+
+	/* Failing write function status is returned and fails the parser */
+	HEX_Init(&Local_Parser , TEST_WriteFails);
+	HOST_CHECK_EQUAL(HEX_Feed(&Local_Parser , (const uint8_t*)":0400000001020304F2\n:00000001FF\n" , 32) , BUSY_FUNC);
+	HOST_CHECK_EQUAL(HEX_Finish(&Local_Parser , NULL) , RT_NOK);
+}
+
+/* Records filling the two bytes of a halfword apart from each other (odd edges, reverse order, other records between) */
+static void TEST_SharedHalfwords(void)
+{
+	static const uint8_t Local_Data[] = {0x11U , 0x22U , 0x33U , 0x44U , 0x55U , 0x66U , 0x77U};
+	HEX_Parser_t Local_Parser;
+	uint32_t Local_Length = 0;
+	uint32_t Local_Offset = 0x08010000UL - TEST_WINDOW_BASE;
+
+	Global_WindowBase = TEST_WINDOW_BASE;
+	memset(Global_Written , 0xFF , TEST_WINDOW_SIZE);
+	Global_BadWrites = 0;
+
+	/* Low byte of 0x08010000, a record elsewhere then its high byte. High byte of 0x08010010 before its low byte */
+	Local_Length = TEST_AppendBase(Global_File , Local_Length , 0x08010000UL , 0);
+	Local_Length = TEST_AppendRecord(Global_File , Local_Length , 0x00U , 0x0000U , &Local_Data[0] , 1 , 0);
+	Local_Length = TEST_AppendRecord(Global_File , Local_Length , 0x00U , 0x0004U , &Local_Data[1] , 2 , 0);
+	Local_Length = TEST_AppendRecord(Global_File , Local_Length , 0x00U , 0x0001U , &Local_Data[3] , 1 , 0);
+	Local_Length = TEST_AppendRecord(Global_File , Local_Length , 0x00U , 0x0011U , &Local_Data[4] , 2 , 0);
+	Local_Length = TEST_AppendRecord(Global_File , Local_Length , 0x00U , 0x0010U , &Local_Data[6] , 1 , 0);
+	Local_Length = TEST_AppendRecord(Global_File , Local_Length , 0x01U , 0 , NULL , 0 , 0);
+
+	HEX_Init(&Local_Parser , TEST_Write);
+	HOST_CHECK_EQUAL(HEX_Feed(&Local_Parser , Global_File , Local_Length) , RT_OK);
+	HOST_CHECK_EQUAL(HEX_Finish(&Local_Parser , NULL) , RT_OK);
+	HOST_CHECK_EQUAL(Global_BadWrites , 0);
+
+	HOST_CHECK_EQUAL(Global_Written[Local_Offset + 0x00U] , 0x11U);
+	HOST_CHECK_EQUAL(Global_Written[Local_Offset + 0x01U] , 0x44U);
+	HOST_CHECK_EQUAL(Global_Written[Local_Offset + 0x02U] , 0xFFU);
+	HOST_CHECK_EQUAL(Global_Written[Local_Offset + 0x04U] , 0x22U);
+	HOST_CHECK_EQUAL(Global_Written[Local_Offset + 0x05U] , 0x33U);
+	HOST_CHECK_EQUAL(Global_Written[Local_Offset + 0x10U] , 0x77U);
+	HOST_CHECK_EQUAL(Global_Written[Local_Offset + 0x11U] , 0x55U);
+	HOST_CHECK_EQUAL(Global_Written[Local_Offset + 0x12U] , 0x66U);
+	HOST_CHECK_EQUAL(Global_Written[Local_Offset + 0x13U] , 0xFFU);
+}
+
+/* Generated files parsed whole and in random fragments match the memory they describe */
+static void TEST_Files(uint8_t Copy_Segment)
+{
+	HEX_Parser_t Local_Parser;
+	uint32_t Local_File;
+	uint32_t Local_Entry;
+	uint32_t Local_Mismatches = 0;
+	uint32_t Local_Fragments[] = {0U , 1U , 7U , 64U};
+	uint32_t Local_Way;
+
+	Global_WindowBase = Copy_Segment ? TEST_SEGMENT_WINDOW_BASE : TEST_WINDOW_BASE;
+
+	for(Local_File = 0 ; Local_File < TEST_FILES ; Local_File++)
+	{
+		TEST_Generate(Copy_Segment);
+
+		for(Local_Way = 0 ; Local_Way < (sizeof(Local_Fragments) / sizeof(Local_Fragments[0])) ; Local_Way++)
+		{
+			memset(Global_Written , 0xFF , TEST_WINDOW_SIZE);
+			Global_BadWrites = 0;
+			Local_Entry = 0;
+
+			HEX_Init(&Local_Parser , TEST_Write);
+			HOST_CHECK_EQUAL(TEST_FeedFragments(&Local_Parser , Global_File , Global_FileLength , Local_Fragments[Local_Way]) , RT_OK);
+			HOST_CHECK_EQUAL(HEX_Finish(&Local_Parser , &Local_Entry) , RT_OK);
+			HOST_CHECK_EQUAL(Local_Entry , TEST_ENTRY_ADDRESS);
+			HOST_CHECK_EQUAL(Global_BadWrites , 0);
+			Local_Mismatches += (memcmp(Global_Written , Global_Expected , TEST_WINDOW_SIZE) != 0);
+		}
+	}
+
+	HOST_CHECK_EQUAL(Local_Mismatches , 0);
+}
+
+/* Random corruption of valid files (flips, inserted and dropped characters) never writes out of shape */
+static void TEST_Fuzz(void)
+{
+	HEX_Parser_t Local_Parser;
+	uint32_t Local_Run;
+	uint32_t Local_Length;
+	uint32_t Local_Mutation;
+	uint32_t Local_Position;
+	uint32_t Local_Accepted = 0;
+	ERROR_STATUS_t Local_Status;
+
+	Global_WindowBase = TEST_WINDOW_BASE;
+	Global_BadWrites = 0;
+
+	for(Local_Run = 0 ; Local_Run < TEST_FUZZ_RUNS ; Local_Run++)
+	{
+		/* New small file every few runs */
+		if((Local_Run % 64U) == 0)
+		{
+			TEST_Generate(0);
+		}
+
+		/* Mutate a part of the file starting at a random record */
+		Local_Position = TEST_Random() % (Global_FileLength - 2048U);
+		while(Global_File[Local_Position] != ':')
+		{
+			Local_Position++;
+		}
+		Local_Length = 1024U;
+		memcpy(Global_Mutated , &Global_File[Local_Position] , Local_Length);
+		for(Local_Mutation = 1U + (TEST_Random() % 4U) ; Local_Mutation > 0 ; Local_Mutation--)
+		{
+			Local_Position = TEST_Random() % Local_Length;
+			switch(TEST_Random() % 4U)
+			{
+				case 0:  Global_Mutated[Local_Position] ^= (uint8_t)(1U << (TEST_Random() % 8U)); break;
+				case 1:  Global_Mutated[Local_Position] = (uint8_t)TEST_Random(); break;
+				case 2:
+					memmove(&Global_Mutated[Local_Position + 1U] , &Global_Mutated[Local_Position] , Local_Length - Local_Position);
+					Global_Mutated[Local_Position] = "0123456789ABCDEF:\n"[TEST_Random() % 18U];
+					Local_Length++;
+					break;
+				default:
+					memmove(&Global_Mutated[Local_Position] , &Global_Mutated[Local_Position + 1U] , Local_Length - Local_Position - 1U);
+					Local_Length--;
+			}
+		}
+
+		/* Part holds no base address record so records may land anywhere */
+		HEX_Init(&Local_Parser , TEST_WriteAnywhere);
+		Local_Status = TEST_FeedFragments(&Local_Parser , Global_Mutated , Local_Length , 37U);
+		HOST_CHECK((Local_Status == RT_OK) || (Local_Status == RT_NOK));
+		if(Local_Status == RT_OK)
+		{
+			Local_Accepted++;
+		}
+		else
+		{
+			HOST_CHECK_EQUAL(HEX_Feed(&Local_Parser , (const uint8_t*)"\n" , 1) , RT_NOK);
+		}
+	}
+
+	HOST_CHECK_EQUAL(Global_BadWrites , 0);
+	printf("HEX fuzz: %u runs, %u accepted\n" , TEST_FUZZ_RUNS , Local_Accepted);
+}
+
+/* Parsed file written through FPEC staging buffer lands in flash */
+static void TEST_Flash(void)
+{
+	HEX_Parser_t Local_Parser;
+
+	Global_WindowBase = TEST_FLASH_WINDOW_BASE;
+	TEST_Generate(0);
+	HOST_FlashErase(TEST_FLASH_WINDOW_BASE , TEST_WINDOW_SIZE);
+
+	HOST_CHECK_EQUAL(FPEC_BeginSession() , RT_OK);
+	HOST_CHECK_EQUAL(HEX_Init(&Local_Parser , FPEC_BufferWrite) , RT_OK);
+	HOST_CHECK_EQUAL(TEST_FeedFragments(&Local_Parser , Global_File , Global_FileLength , 100U) , RT_OK);
+	HOST_CHECK_EQUAL(HEX_Finish(&Local_Parser , NULL) , RT_OK);
+	HOST_CHECK_EQUAL(FPEC_BufferFlush() , RT_OK);
+	HOST_CHECK_EQUAL(FPEC_EndSession() , RT_OK);
+
+	HOST_CHECK_EQUAL(memcmp((const void*)(unsigned long)TEST_FLASH_WINDOW_BASE , Global_Expected , TEST_WINDOW_SIZE) , 0);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    BENCHMARKS                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Parsing throughput of a large file fed in receive sized fragments (write function does nothing) */
+static void BENCH_Parse(void)
+{
+	HEX_Parser_t Local_Parser;
+	uint32_t Local_Length = 0;
+	uint32_t Local_Offset;
+	uint32_t Local_Address = 0;
+	uint8_t Local_Data[16];
+	uint8_t Local_Counter;
+	uint64_t Local_Start;
+
+	/* 16 bytes records like most linkers produce */
+	Local_Length = TEST_AppendBase(Global_BenchFile , Local_Length , 0x08000000UL , 0);
+	while((Local_Length + 64U) < TEST_BENCH_FILE_SIZE)
+	{
+		for(Local_Counter = 0 ; Local_Counter < sizeof(Local_Data) ; Local_Counter++)
+		{
+			Local_Data[Local_Counter] = (uint8_t)TEST_Random();
+		}
+		Local_Length = TEST_AppendRecord(Global_BenchFile , Local_Length , 0x00U , (uint16_t)Local_Address , Local_Data , sizeof(Local_Data) , 0);
+		Local_Address += sizeof(Local_Data);
+	}
+
+	HEX_Init(&Local_Parser , TEST_WriteNothing);
+	Local_Start = HOST_TimeNs();
+	for(Local_Offset = 0 ; (Local_Offset + TEST_BENCH_FRAGMENT) <= Local_Length ; Local_Offset += TEST_BENCH_FRAGMENT)
+	{
+		HEX_Feed(&Local_Parser , &Global_BenchFile[Local_Offset] , TEST_BENCH_FRAGMENT);
+	}
+	HOST_Report("HEX_Feed (64 characters fragments)" , HOST_TimeNs() - Local_Start , Local_Offset / TEST_BENCH_FRAGMENT , Local_Offset);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                       MAIN                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+int main(int argc , char** argv)
+{
+	uint8_t Local_Benchmark = HOST_IsBenchmarkRun(argc , argv);
+
+	HOST_ModelInit(HOST_DEVICE_FLASH);
+
+	if(Local_Benchmark == 1)
+	{
+		BENCH_Parse();
+	}
+	else
+	{
+		TEST_Arguments();
+		TEST_Malformed();
+		TEST_SharedHalfwords();
+		TEST_Files(0);
+		TEST_Files(1);
+		TEST_Fuzz();
+		TEST_Flash();
+	}
+
+	return HOST_Summary("HEX");
+}
@@ -0,0 +1,380 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : SCH Host Test                */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+
+#include "SCH_Config.h"
+#include "SCH_Interface.h"
+
+#include "HOST_Model.h"
+#include "HOST_Test.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* SysTick and SCB registers the simulation drives (plain memory on the host) */
+#define TEST_STK_LOAD					(*(volatile uint32_t*)0xE000E014UL)
+#define TEST_STK_VAL					(*(volatile uint32_t*)0xE000E018UL)
+#define TEST_SCB_ICSR					(*(volatile uint32_t*)0xE000ED04UL)
+#define TEST_SCB_SHPR3					(*(volatile uint32_t*)0xE000ED20UL)
+#define TEST_ICSR_PENDSVSET				(1UL << 28)
+
+#define TEST_RUN_LOG_LENGTH				64U
+#define TEST_BUSY_TICKS					250U		/* SysTick ticks spent by loaded task on every run */
+#define TEST_BENCH_TICKS				1000000U
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Order of task runs (priority) and scheduler tick of each run */
+static uint8_t Global_RunLog[TEST_RUN_LOG_LENGTH];
+static uint32_t Global_RunTick[TEST_RUN_LOG_LENGTH];
+static uint32_t Global_Runs;
+static uint32_t Global_Tick;					/* Scheduler ticks simulated */
+static uint32_t Global_Dispatches;				/* PendSV exceptions taken */
+
+void SysTick_Handler(void);
+void PendSV_Handler(void);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     HELPERS                                       */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Takes PendSV if it is pending (lowest priority: only after every other handler returned) */
+static void TEST_TakePendSV(void)
+{
+	if((TEST_SCB_ICSR & TEST_ICSR_PENDSVSET) != 0)
+	{
+		TEST_SCB_ICSR = 0;
+		Global_Dispatches++;
+		PendSV_Handler();
+	}
+}
+
+/* One scheduler tick: SysTick reloads, its exception runs, then dispatcher tail-chains if pended */
+static void TEST_Tick(uint8_t Copy_Dispatch)
+{
+	TEST_STK_VAL = TEST_STK_LOAD;
+	Global_Tick++;
+	SysTick_Handler();
+	if(Copy_Dispatch == 1)
+	{
+		TEST_TakePendSV();
+	}
+}
+
+static void TEST_LogRun(uint8_t Copy_Priority)
+{
+	if(Global_Runs < TEST_RUN_LOG_LENGTH)
+	{
+		Global_RunLog[Global_Runs] = Copy_Priority;
+		Global_RunTick[Global_Runs] = Global_Tick;
+	}
+	Global_Runs++;
+}
+
+static void TEST_ResetLog(void)
+{
+	memset(Global_RunLog , 0xFF , sizeof(Global_RunLog));
+	memset(Global_RunTick , 0 , sizeof(Global_RunTick));
+	Global_Runs = 0;
+}
+
+/* Fresh scheduler and time base */
+static void TEST_Restart(void)
+{
+	SCH_Init();
+	HOST_CHECK_EQUAL(SCH_Start() , RT_OK);
+	TEST_SCB_ICSR = 0;
+	Global_Tick = 0;
+	Global_Dispatches = 0;
+	TEST_ResetLog();
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   TASK BODIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+static void TEST_Task0(void) { TEST_LogRun(0); }
+static void TEST_Task3(void) { TEST_LogRun(3); }
+static void TEST_Task5(void) { TEST_LogRun(5); }
+
+/* Releases highest priority event task from inside a running task (no preemption: it runs right after) */
+static void TEST_Task6(void)
+{
+	TEST_LogRun(6);
+	SCH_ActivateTask(1);
+	TEST_LogRun(6);
+}
+
+static void TEST_Task1(void) { TEST_LogRun(1); }
+
+/* Spends a fixed number of SysTick ticks (timer counts down) */
+static void TEST_BusyTask(void)
+{
+	TEST_LogRun(2);
+	TEST_STK_VAL -= TEST_BUSY_TICKS;
+}
+
+static void TEST_EmptyTask(void)
+{
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                      TESTS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+static void TEST_Arguments(void)
+{
+	SCH_TaskStatistics_t Local_Statistics;
+	uint16_t Local_CpuLoad;
+
+	TEST_Restart();
+
+	/* PendSV is set to lowest priority */
+	HOST_CHECK_EQUAL((TEST_SCB_SHPR3 >> 20) & 0xFU , 15U);
+
+	HOST_CHECK_EQUAL(SCH_CreateTask(0 , 10 , 1 , SCH_NO_DEADLINE , NULL) , NULL_POINTER);
+	HOST_CHECK_EQUAL(SCH_CreateTask(SCH_MAX_TASKS , 10 , 1 , SCH_NO_DEADLINE , TEST_Task0) , RT_NOK);
+	HOST_CHECK_EQUAL(SCH_CreateTask(0 , 10 , 0 , SCH_NO_DEADLINE , TEST_Task0) , RT_NOK);
+	HOST_CHECK_EQUAL(SCH_CreateTask(0 , 10 , 11 , SCH_NO_DEADLINE , TEST_Task0) , RT_NOK);
+	HOST_CHECK_EQUAL(SCH_CreateTask(0 , 10 , 10 , SCH_NO_DEADLINE , TEST_Task0) , RT_OK);
+	HOST_CHECK_EQUAL(SCH_CreateTask(0 , 10 , 10 , SCH_NO_DEADLINE , TEST_Task3) , BUSY_FUNC);
+	HOST_CHECK_EQUAL(SCH_ActivateTask(4) , RT_NOK);
+	HOST_CHECK_EQUAL(SCH_ActivateTask(SCH_MAX_TASKS) , RT_NOK);
+	HOST_CHECK_EQUAL(SCH_DeleteTask(SCH_MAX_TASKS) , RT_NOK);
+	HOST_CHECK_EQUAL(SCH_GetTaskStatistics(0 , NULL) , NULL_POINTER);
+	HOST_CHECK_EQUAL(SCH_GetTaskStatistics(SCH_MAX_TASKS , &Local_Statistics) , RT_NOK);
+	HOST_CHECK_EQUAL(SCH_GetCpuLoad(NULL) , NULL_POINTER);
+	HOST_CHECK_EQUAL(SCH_GetCpuLoad(&Local_CpuLoad) , RT_OK);
+}
+
+/* Periodic releases follow offset and period, ready tasks run highest priority first from one PendSV */
+static void TEST_PeriodicDispatch(void)
+{
+	uint32_t Local_Tick;
+
+	TEST_Restart();
+	HOST_CHECK_EQUAL(SCH_CreateTask(5 , 4 , 1 , SCH_NO_DEADLINE , TEST_Task5) , RT_OK);
+	HOST_CHECK_EQUAL(SCH_CreateTask(3 , 2 , 1 , SCH_NO_DEADLINE , TEST_Task3) , RT_OK);
+	HOST_CHECK_EQUAL(SCH_CreateTask(0 , 4 , 3 , SCH_NO_DEADLINE , TEST_Task0) , RT_OK);
+
+	for(Local_Tick = 0 ; Local_Tick < 8 ; Local_Tick++)
+	{
+		TEST_Tick(1);
+	}
+
+	/* Tick 1: 3,5 | tick 3: 0,3 | tick 5: 3,5 | tick 7: 0,3 */
+	HOST_CHECK_EQUAL(Global_Runs , 8);
+	HOST_CHECK_EQUAL(Global_RunLog[0] , 3);
+	HOST_CHECK_EQUAL(Global_RunLog[1] , 5);
+	HOST_CHECK_EQUAL(Global_RunTick[1] , 1);
+	HOST_CHECK_EQUAL(Global_RunLog[2] , 0);
+	HOST_CHECK_EQUAL(Global_RunLog[3] , 3);
+	HOST_CHECK_EQUAL(Global_RunTick[3] , 3);
+	HOST_CHECK_EQUAL(Global_RunLog[4] , 3);
+	HOST_CHECK_EQUAL(Global_RunLog[5] , 5);
+	HOST_CHECK_EQUAL(Global_RunTick[5] , 5);
+	HOST_CHECK_EQUAL(Global_RunLog[6] , 0);
+	HOST_CHECK_EQUAL(Global_RunLog[7] , 3);
+
+	/* Dispatcher is pended only on ticks with a release */
+	HOST_CHECK_EQUAL(Global_Dispatches , 4);
+}
+
+/* Event task released from a task runs after it (run to completion), in the same PendSV */
+static void TEST_EventTasks(void)
+{
+	SCH_TaskStatistics_t Local_Statistics;
+
+	TEST_Restart();
+	HOST_CHECK_EQUAL(SCH_CreateTask(1 , SCH_EVENT_TASK , 0 , SCH_NO_DEADLINE , TEST_Task1) , RT_OK);
+	HOST_CHECK_EQUAL(SCH_CreateTask(6 , SCH_EVENT_TASK , 0 , SCH_NO_DEADLINE , TEST_Task6) , RT_OK);
+
+	/* Event tasks are never released by ticks */
+	TEST_Tick(1);
+	HOST_CHECK_EQUAL(Global_Runs , 0);
+
+	/* Release from "interrupt" context, second release before dispatch is dropped */
+	HOST_CHECK_EQUAL(SCH_ActivateTask(6) , RT_OK);
+	HOST_CHECK_EQUAL(SCH_ActivateTask(6) , BUSY_FUNC);
+	TEST_TakePendSV();
+	HOST_CHECK_EQUAL(Global_Runs , 3);
+	HOST_CHECK_EQUAL(Global_RunLog[0] , 6);
+	HOST_CHECK_EQUAL(Global_RunLog[1] , 6);
+	HOST_CHECK_EQUAL(Global_RunLog[2] , 1);
+	HOST_CHECK_EQUAL(Global_Dispatches , 1);
+
+	/* PendSV pended again by the nested release finds nothing left */
+	TEST_TakePendSV();
+	HOST_CHECK_EQUAL(Global_Runs , 3);
+
+	SCH_GetTaskStatistics(6 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.releases , 1);
+	HOST_CHECK_EQUAL(Local_Statistics.deadlineMisses , 1);
+
+	/* Deleted task drops its pending release */
+	HOST_CHECK_EQUAL(SCH_ActivateTask(1) , RT_OK);
+	HOST_CHECK_EQUAL(SCH_DeleteTask(1) , RT_OK);
+	TEST_TakePendSV();
+	HOST_CHECK_EQUAL(Global_Runs , 3);
+	HOST_CHECK_EQUAL(SCH_ActivateTask(1) , RT_NOK);
+}
+
+/* Release dropped while task is still pending, completion later than deadline counted as a miss */
+static void TEST_DeadlineMisses(void)
+{
+	SCH_TaskStatistics_t Local_Statistics;
+
+	TEST_Restart();
+	HOST_CHECK_EQUAL(SCH_CreateTask(0 , 1 , 1 , SCH_NO_DEADLINE , TEST_Task0) , RT_OK);
+	HOST_CHECK_EQUAL(SCH_CreateTask(3 , 10 , 1 , 1 , TEST_Task3) , RT_OK);
+
+	/* Dispatcher is held off for three ticks (e.g. long interrupt) */
+	TEST_Tick(0);
+	TEST_Tick(0);
+	TEST_Tick(0);
+	TEST_TakePendSV();
+
+	/* Task 0 released once, next two releases dropped, task 3 completed two ticks after release with one tick deadline */
+	HOST_CHECK_EQUAL(Global_Runs , 2);
+	SCH_GetTaskStatistics(0 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.releases , 1);
+	HOST_CHECK_EQUAL(Local_Statistics.deadlineMisses , 2);
+	SCH_GetTaskStatistics(3 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.releases , 1);
+	HOST_CHECK_EQUAL(Local_Statistics.deadlineMisses , 1);
+
+	/* Dispatched in time: no miss */
+	TEST_Tick(1);
+	SCH_GetTaskStatistics(0 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.releases , 2);
+	HOST_CHECK_EQUAL(Local_Statistics.deadlineMisses , 2);
+}
+
+/* Execution time in SysTick ticks and CPU load over one measurement window */
+static void TEST_ExecutionTimeAndLoad(void)
+{
+	SCH_TaskStatistics_t Local_Statistics;
+	uint16_t Local_CpuLoad;
+	uint32_t Local_Tick;
+
+	TEST_Restart();
+	HOST_CHECK_EQUAL(SCH_CreateTask(2 , 1 , 1 , SCH_NO_DEADLINE , TEST_BusyTask) , RT_OK);
+	HOST_CHECK_EQUAL(SCH_CreateTask(7 , 2 , 2 , SCH_NO_DEADLINE , TEST_EmptyTask) , RT_OK);
+
+	for(Local_Tick = 0 ; Local_Tick < SCH_LOAD_WINDOW ; Local_Tick++)
+	{
+		TEST_Tick(1);
+	}
+
+	SCH_GetTaskStatistics(2 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.releases , SCH_LOAD_WINDOW);
+	HOST_CHECK_EQUAL(Local_Statistics.lastExecutionTime , TEST_BUSY_TICKS);
+	HOST_CHECK_EQUAL(Local_Statistics.maxExecutionTime , TEST_BUSY_TICKS);
+
+	/* Window closes on its last tick, before that tick's runs: one run less than the window */
+	HOST_CHECK_EQUAL(Local_Statistics.cpuLoad , ((SCH_LOAD_WINDOW - 1U) * TEST_BUSY_TICKS * 1000UL) / (SCH_LOAD_WINDOW * SCH_TICK_PERIOD));
+	SCH_GetTaskStatistics(7 , &Local_Statistics);
+	HOST_CHECK_EQUAL(Local_Statistics.releases , SCH_LOAD_WINDOW / 2U);
+	HOST_CHECK_EQUAL(Local_Statistics.maxExecutionTime , 0);
+	HOST_CHECK_EQUAL(Local_Statistics.cpuLoad , 0);
+	SCH_GetCpuLoad(&Local_CpuLoad);
+	HOST_CHECK_EQUAL(Local_CpuLoad , ((SCH_LOAD_WINDOW - 1U) * TEST_BUSY_TICKS * 1000UL) / (SCH_LOAD_WINDOW * SCH_TICK_PERIOD));
+
+	/* Full window of runs */
+	for(Local_Tick = 0 ; Local_Tick < SCH_LOAD_WINDOW ; Local_Tick++)
+	{
+		TEST_Tick(1);
+	}
+	SCH_GetCpuLoad(&Local_CpuLoad);
+	HOST_CHECK_EQUAL(Local_CpuLoad , (TEST_BUSY_TICKS * 1000UL) / SCH_TICK_PERIOD);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    BENCHMARKS                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Scheduler overhead per tick: SysTick with releases plus PendSV dispatch of empty tasks */
+static void BENCH_Dispatch(void)
+{
+	uint8_t Local_Priority;
+	uint32_t Local_Tick;
+	uint64_t Local_Start;
+	char Local_Name[48];
+
+	printf("SCH dispatch (host time per scheduler tick):\n");
+
+	TEST_Restart();
+	Local_Start = HOST_TimeNs();
+	for(Local_Tick = 0 ; Local_Tick < TEST_BENCH_TICKS ; Local_Tick++)
+	{
+		TEST_Tick(1);
+	}
+	HOST_Report("no task" , HOST_TimeNs() - Local_Start , TEST_BENCH_TICKS , 0);
+
+	for(Local_Priority = 0 ; Local_Priority < SCH_MAX_TASKS ; Local_Priority++)
+	{
+		SCH_CreateTask(Local_Priority , 1 , 1 , SCH_NO_DEADLINE , TEST_EmptyTask);
+	}
+	Local_Start = HOST_TimeNs();
+	for(Local_Tick = 0 ; Local_Tick < TEST_BENCH_TICKS ; Local_Tick++)
+	{
+		TEST_Tick(1);
+	}
+	snprintf(Local_Name , sizeof(Local_Name) , "%u tasks released every tick" , SCH_MAX_TASKS);
+	HOST_Report(Local_Name , HOST_TimeNs() - Local_Start , TEST_BENCH_TICKS , 0);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                      MAIN                                         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+int main(int argc , char** argv)
+{
+	uint8_t Local_Benchmark = HOST_IsBenchmarkRun(argc , argv);
+
+	HOST_ModelInit(0);
+
+	if(Local_Benchmark == 1)
+	{
+		BENCH_Dispatch();
+	}
+	else
+	{
+		TEST_Arguments();
+		TEST_PeriodicDispatch();
+		TEST_EventTasks();
+		TEST_DeadlineMisses();
+		TEST_ExecutionTimeAndLoad();
+	}
+
+	return HOST_Summary("SCH");
+}
@@ -0,0 +1,197 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : SERVICE_FUNCTIONS Host Test  */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include <stdio.h>
+
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+
+#include "SERVICE_FUNCTIONS.h"
+#include "RCC_Interface.h"
+
+#include "HOST_Model.h"
+#include "HOST_Test.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Debug and clock registers (plain memory except CYCCNT, which moves on every read) */
+#define TEST_DEMCR						(*(volatile uint32_t*)0xE000EDFCUL)
+#define TEST_DWT_CTRL					(*(volatile uint32_t*)0xE0001000UL)
+#define TEST_DWT_CYCCNT					(*(volatile uint32_t*)0xE0001004UL)
+#define TEST_RCC_CR						(*(volatile uint32_t*)0x40021000UL)
+#define TEST_RCC_CFGR					(*(volatile uint32_t*)0x40021004UL)
+#define TEST_DEMCR_TRCENA				(1UL << 24)
+#define TEST_DWT_CYCCNTENA				(1UL << 0)
+#define TEST_RCC_HSERDY					(1UL << 17)
+#define TEST_RCC_SWS_HSE				(1UL << 2)
+
+#define TEST_CYCLES_PER_READ			8U
+#define TEST_SLACK_CYCLES				(4U * TEST_CYCLES_PER_READ)		/* Reads around a wait besides its polls */
+#define TEST_COUNTER_START				0x12345678UL
+#define TEST_COUNTER_NEAR_WRAP			0xFFFFFF00UL
+#define TEST_DELAY_US					100U
+#define TEST_DELAY_MS					2U
+#define TEST_TIMEOUT_US					50U
+#define TEST_CLOCKS						5U
+#define TEST_FAST_CLOCK					72000000UL
+#define TEST_HSE_CLOCK					8000000UL
+#define TEST_HZ_PER_MHZ					1000000UL
+#define TEST_MICROSECONDS_PER_MS		1000U
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                  PRIVATE TYPES                                    */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Core clock passed to SERV_DelayInit and cycles one microsecond is scaled to */
+typedef struct
+{
+	uint32_t Frequency;
+	uint32_t CyclesPerMicrosecond;
+}TEST_Clock_t;
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Fractions of a MHz round up so delays are never shorter, slowest clocks keep one cycle per microsecond */
+static const TEST_Clock_t Global_Clocks[TEST_CLOCKS] =
+{
+	{8000000UL  , 8U } ,
+	{72000000UL , 72U} ,
+	{36000000UL , 36U} ,
+	{1000001UL  , 2U } ,
+	{500000UL   , 1U }
+};
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     HELPERS                                       */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Cycles a delay of passed length took */
+static uint32_t TEST_DelayCycles(uint32_t Copy_Time , uint8_t Copy_IsMilliseconds)
+{
+	uint32_t Local_Start = TEST_DWT_CYCCNT;
+
+	if(Copy_IsMilliseconds == 1)
+	{
+		SERV_Delay_ms(Copy_Time);
+	}
+	else
+	{
+		SERV_Delay_us(Copy_Time);
+	}
+
+	return TEST_DWT_CYCCNT - Local_Start;
+}
+
+/* Delay took its scaled cycles, plus the reads around it at most */
+static void TEST_CheckDelay(uint32_t Copy_Cycles , uint32_t Copy_Expected)
+{
+	HOST_CHECK(Copy_Cycles >= Copy_Expected);
+	HOST_CHECK(Copy_Cycles <= Copy_Expected + TEST_SLACK_CYCLES);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                      TESTS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Init starts a stopped counter without resetting it, running timeouts survive a second init */
+static void TEST_DelayInit(void)
+{
+	SERV_Timeout_t Local_Timeout;
+
+	TEST_DWT_CTRL = 0;
+	TEST_DEMCR = 0;
+	TEST_DWT_CYCCNT = TEST_COUNTER_START;
+	SERV_DelayInit(TEST_FAST_CLOCK);
+	HOST_CHECK_EQUAL(TEST_DWT_CTRL & TEST_DWT_CYCCNTENA , TEST_DWT_CYCCNTENA);
+	HOST_CHECK_EQUAL(TEST_DEMCR & TEST_DEMCR_TRCENA , TEST_DEMCR_TRCENA);
+	HOST_CHECK(TEST_DWT_CYCCNT - TEST_COUNTER_START <= TEST_SLACK_CYCLES);
+
+	SERV_StartTimeout_us(&Local_Timeout , TEST_TIMEOUT_US);
+	SERV_DelayInit(TEST_FAST_CLOCK);
+	HOST_CHECK_EQUAL(SERV_IsTimeoutExpired(&Local_Timeout) , 0);
+	SERV_Delay_us(TEST_TIMEOUT_US);
+	HOST_CHECK_EQUAL(SERV_IsTimeoutExpired(&Local_Timeout) , 1);
+}
+
+/* Delays and timeouts are scaled to core clock passed to init, also across counter wrap */
+static void TEST_DelayScaling(void)
+{
+	SERV_Timeout_t Local_Timeout;
+	uint32_t Local_Start;
+	uint8_t Local_Clock;
+
+	for(Local_Clock = 0 ; Local_Clock < TEST_CLOCKS ; Local_Clock++)
+	{
+		SERV_DelayInit(Global_Clocks[Local_Clock].Frequency);
+		TEST_CheckDelay(TEST_DelayCycles(TEST_DELAY_US , 0) , TEST_DELAY_US * Global_Clocks[Local_Clock].CyclesPerMicrosecond);
+		TEST_CheckDelay(TEST_DelayCycles(TEST_DELAY_MS , 1) , TEST_DELAY_MS * TEST_MICROSECONDS_PER_MS * Global_Clocks[Local_Clock].CyclesPerMicrosecond);
+
+		Local_Start = TEST_DWT_CYCCNT;
+		SERV_StartTimeout_us(&Local_Timeout , TEST_TIMEOUT_US);
+		while(SERV_IsTimeoutExpired(&Local_Timeout) == 0);
+		TEST_CheckDelay(TEST_DWT_CYCCNT - Local_Start , TEST_TIMEOUT_US * Global_Clocks[Local_Clock].CyclesPerMicrosecond);
+	}
+
+	SERV_DelayInit(TEST_FAST_CLOCK);
+	TEST_DWT_CYCCNT = TEST_COUNTER_NEAR_WRAP;
+	TEST_CheckDelay(TEST_DelayCycles(TEST_DELAY_US , 0) , TEST_DELAY_US * (TEST_FAST_CLOCK / TEST_HZ_PER_MHZ));
+	HOST_CHECK(TEST_DWT_CYCCNT < TEST_COUNTER_NEAR_WRAP);
+}
+
+/* Clock init scales delays to the AHB clock it switched to */
+static void TEST_RccInitScale(void)
+{
+	SERV_DelayInit(TEST_FAST_CLOCK);
+
+	/* HSE is ready and switch status follows switch at once */
+	TEST_RCC_CR = TEST_RCC_HSERDY;
+	TEST_RCC_CFGR = TEST_RCC_SWS_HSE;
+	RCC_Init();
+	TEST_CheckDelay(TEST_DelayCycles(TEST_DELAY_US , 0) , TEST_DELAY_US * (TEST_HSE_CLOCK / TEST_HZ_PER_MHZ));
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                       MAIN                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+int main(int argc , char** argv)
+{
+	uint8_t Local_Benchmark = HOST_IsBenchmarkRun(argc , argv);
+
+	HOST_ModelInit(HOST_DEVICE_DWT);
+	HOST_pCounters->CyclesPerRead = TEST_CYCLES_PER_READ;
+
+	/* Delays have nothing to benchmark: they take the cycles they are scaled to */
+	if(Local_Benchmark == 0)
+	{
+		TEST_DelayInit();
+		TEST_DelayScaling();
+		TEST_RccInitScale();
+	}
+
+	return HOST_Summary("SERVICE");
+}
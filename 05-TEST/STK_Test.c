@@ -0,0 +1,612 @@
+/****************************************************************/
+/* 					Author   	 : Mark Ehab                    */
+/* 					Date     	 : Oct 17, 2026              	*/
+/*            	    Description	 : STK Host Test                */
+/* 	        	    Version      : V1.0                         */
+/****************************************************************/
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     LIBRARIES                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+
+#include "STD_TYPES.h"
+#include "STD_ERRORS.h"
+
+#include "STK_Config.h"
+#include "STK_Interface.h"
+
+#include "HOST_Model.h"
+#include "HOST_Test.h"
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                   PRIVATE MACROS                                  */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+#define TEST_TICKS_PER_PERIOD			72000U		/* 1 ms at 72 MHz */
+#define TEST_HORIZON_BITS				22U			/* Random delays reach level 3 of the wheel (2^18 and more) */
+#define TEST_HORIZON					(1UL << TEST_HORIZON_BITS)
+#define TEST_TIME_SLOTS					(2UL * TEST_HORIZON)	/* Ring of expected expiries, pending ones are never farther than horizon */
+#define TEST_SLOT(Time)					((Time) & (TEST_TIME_SLOTS - 1UL))
+#define TEST_ONE_SHOT_TIMERS			20000U		/* One-shot timers started over a whole run */
+#define TEST_CANCEL_EVERY				7U			/* One expiry out of this number cancels a pending timer */
+#define TEST_DEADLINE_CHECK_EVERY		4099U		/* Periods between two checks of STK_GetPeriodsToNextTimer */
+#define TEST_PERIODIC_TIMERS			3U
+#define TEST_BENCH_PERIODS				4000000U
+
+/* SysTick and SCB registers (plain memory, VAL only moves when a test writes it) */
+#define TEST_STK_CTRL					(*(volatile uint32_t*)0xE000E010UL)
+#define TEST_STK_LOAD					(*(volatile uint32_t*)0xE000E014UL)
+#define TEST_STK_VAL					(*(volatile uint32_t*)0xE000E018UL)
+#define TEST_SCB_ICSR					(*(volatile uint32_t*)0xE000ED04UL)
+#define TEST_ENABLE						(1UL << 0)
+#define TEST_COUNTFLAG					(1UL << 16)
+#define TEST_PENDSTSET					(1UL << 26)
+#define TEST_PENDING_VALUE				(TEST_TICKS_PER_PERIOD - 5U)	/* VAL a few ticks after a reload */
+#define TEST_WIDE_PERIODS				60000U		/* Timestamps past 2^32 ticks */
+#define TEST_IDLE_DEADLINE				50U			/* Periods to the timer an idle sleep waits for */
+#define TEST_IDLE_EARLY_PERIODS			4U			/* Whole periods slept before an early wake-up */
+#define TEST_IDLE_LATE_TICKS			10U			/* Ticks from end of a sleep to wake-up */
+#define TEST_IDLE_EARLY_TICKS			5U			/* Ticks into a period of an early wake-up */
+#define TEST_IDLE_MAX_PERIODS			10U			/* Caller limit on suppressed periods */
+#define TEST_IDLE_COUNTER_PERIODS		((STK_MAX_VALUE + 1U) / TEST_TICKS_PER_PERIOD)	/* Periods one reload can hold */
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                            GLOBAL VARIABLES DEFINITIONS                           */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Number of outstanding one-shot timers expected to expire at each time (ring indexed by TEST_SLOT) */
+static uint8_t Global_ExpectedExpiries[TEST_TIME_SLOTS];
+
+/* Latest expiry of each pool timer started as one-shot (0 once it expired or got cancelled) */
+static uint32_t Global_TimerExpiry[STK_TIMERS_POOL_SIZE];
+
+static uint32_t Global_Now;						/* Periods served by the test */
+static uint32_t Global_Started;					/* One-shot timers started */
+static uint32_t Global_Fired;					/* One-shot timers fired */
+static uint32_t Global_Cancelled;				/* One-shot timers cancelled */
+static uint32_t Global_Unexpected;				/* Expiries at a time no timer was due */
+static uint32_t Global_LevelsUsed;				/* Bit per wheel level reached by a started delay */
+static uint64_t Global_RandomState = 0x9E3779B97F4A7C15ULL;
+
+/* Periodic timers: period, last expiry, worst deviation from period, number of expiries */
+static const uint32_t Global_PeriodicPeriods[TEST_PERIODIC_TIMERS] = {1U , 97U , 5000U};
+static uint32_t Global_PeriodicLast[TEST_PERIODIC_TIMERS];
+static uint32_t Global_PeriodicJitter[TEST_PERIODIC_TIMERS];
+static uint32_t Global_PeriodicCalls[TEST_PERIODIC_TIMERS];
+
+static volatile uint32_t Global_BenchCalls;
+
+/* Sleep model: ticks that pass on next WFI and counter state seen when it started */
+static uint32_t Global_SleepTicks;
+static uint32_t Global_SleepLoad;
+static uint32_t Global_SleepEnabled;
+static uint32_t Global_Sleeps;
+
+void SysTick_Handler(void);
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                     HELPERS                                       */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* xorshift64 */
+static uint32_t TEST_Random(void)
+{
+	Global_RandomState ^= Global_RandomState << 13;
+	Global_RandomState ^= Global_RandomState >> 7;
+	Global_RandomState ^= Global_RandomState << 17;
+
+	return (uint32_t)(Global_RandomState >> 32);
+}
+
+/* Delay spread evenly over powers of two so that every wheel level gets timers */
+static uint32_t TEST_RandomDelay(void)
+{
+	uint32_t Local_Bits = 1U + (TEST_Random() % TEST_HORIZON_BITS);
+
+	return 1U + (TEST_Random() & ((1UL << Local_Bits) - 1U));
+}
+
+static void TEST_OneShotCallback(void);
+
+/* Starts a random one-shot timer and records when it is due */
+static void TEST_StartOneShot(void)
+{
+	uint32_t Local_Delay = TEST_RandomDelay();
+	uint16_t Local_TimerId;
+	uint32_t Local_Level = 0;
+
+	if(STK_TimerStart(Local_Delay , STK_TIMER_ONE_SHOT , TEST_OneShotCallback , &Local_TimerId) == RT_OK)
+	{
+		Global_TimerExpiry[Local_TimerId] = Global_Now + Local_Delay;
+		Global_ExpectedExpiries[TEST_SLOT(Global_Now + Local_Delay)]++;
+		Global_Started++;
+
+		while(Local_Level < 3U && Local_Delay >= (1UL << ((Local_Level + 1U) * 6U)))
+		{
+			Local_Level++;
+		}
+		Global_LevelsUsed |= 1UL << Local_Level;
+	}
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    CALLBACKS                                      */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* One-shot expiry must match a timer due now, fired (or cancelled) one is replaced by a new random one */
+static void TEST_OneShotCallback(void)
+{
+	uint32_t Local_TimerId;
+
+	if(Global_ExpectedExpiries[TEST_SLOT(Global_Now)] != 0)
+	{
+		Global_ExpectedExpiries[TEST_SLOT(Global_Now)]--;
+	}
+	else
+	{
+		Global_Unexpected++;
+	}
+	Global_Fired++;
+
+	/* Forget one pool entry due now (the one that fired, entries due at the same time are alike) */
+	for(Local_TimerId = 0 ; Local_TimerId < STK_TIMERS_POOL_SIZE ; Local_TimerId++)
+	{
+		if(Global_TimerExpiry[Local_TimerId] == Global_Now)
+		{
+			Global_TimerExpiry[Local_TimerId] = 0;
+			break;
+		}
+	}
+
+	if(Global_Started < TEST_ONE_SHOT_TIMERS)
+	{
+		TEST_StartOneShot();
+	}
+
+	/* Cancel a random pending one-shot timer now and then (from callback context, as an application would) */
+	if((TEST_Random() % TEST_CANCEL_EVERY) == 0)
+	{
+		Local_TimerId = TEST_Random() % STK_TIMERS_POOL_SIZE;
+		if(Global_TimerExpiry[Local_TimerId] > Global_Now)
+		{
+			HOST_CHECK_EQUAL(STK_TimerCancel((uint16_t)Local_TimerId) , RT_OK);
+			Global_ExpectedExpiries[TEST_SLOT(Global_TimerExpiry[Local_TimerId])]--;
+			Global_TimerExpiry[Local_TimerId] = 0;
+			Global_Cancelled++;
+			if(Global_Started < TEST_ONE_SHOT_TIMERS)
+			{
+				TEST_StartOneShot();
+			}
+		}
+	}
+}
+
+/* Periodic expiry: distance to previous one must be the period exactly */
+static void TEST_PeriodicExpiry(uint32_t Copy_Index)
+{
+	uint32_t Local_Distance = Global_Now - Global_PeriodicLast[Copy_Index];
+	uint32_t Local_Deviation = (Local_Distance > Global_PeriodicPeriods[Copy_Index]) ? (Local_Distance - Global_PeriodicPeriods[Copy_Index]) :
+																					   (Global_PeriodicPeriods[Copy_Index] - Local_Distance);
+
+	if(Local_Deviation > Global_PeriodicJitter[Copy_Index])
+	{
+		Global_PeriodicJitter[Copy_Index] = Local_Deviation;
+	}
+	Global_PeriodicLast[Copy_Index] = Global_Now;
+	Global_PeriodicCalls[Copy_Index]++;
+}
+
+static void TEST_PeriodicCallback0(void) { TEST_PeriodicExpiry(0); }
+static void TEST_PeriodicCallback1(void) { TEST_PeriodicExpiry(1); }
+static void TEST_PeriodicCallback2(void) { TEST_PeriodicExpiry(2); }
+
+static void TEST_BenchCallback(void)
+{
+	Global_BenchCalls++;
+}
+
+/* Counter over time slept, its reload raises SysTick exception (held off by the sleeping caller) */
+static void TEST_SleepHook(void)
+{
+	uint32_t Local_Ticks = Global_SleepTicks;
+
+	Global_Sleeps++;
+	Global_SleepLoad = TEST_STK_LOAD;
+	Global_SleepEnabled = TEST_STK_CTRL & TEST_ENABLE;
+
+	/* Counter restarted by a VAL write loads LOAD on its first tick, taken as part of the restart */
+	if(TEST_STK_VAL == 0)
+	{
+		TEST_STK_VAL = TEST_STK_LOAD;
+	}
+
+	if(Local_Ticks <= TEST_STK_VAL)
+	{
+		TEST_STK_VAL -= Local_Ticks;
+	}
+	else
+	{
+		Local_Ticks -= TEST_STK_VAL + 1U;
+		TEST_STK_VAL = TEST_STK_LOAD - (Local_Ticks % (TEST_STK_LOAD + 1U));
+		TEST_STK_CTRL |= TEST_COUNTFLAG;
+		TEST_SCB_ICSR |= TEST_PENDSTSET;
+	}
+}
+
+/* Idle sleep from VAL over passed ticks, checks periods it counted and reload it slept with */
+static void TEST_Idle(uint32_t Copy_Value , uint32_t Copy_MaxPeriods , uint32_t Copy_Ticks , uint32_t Copy_SleepLoad , uint32_t Copy_SleptPeriods)
+{
+	uint32_t Local_SleptPeriods = 0xFFFFFFFFU;
+	uint32_t Local_Sleeps = Global_Sleeps;
+
+	TEST_STK_VAL = Copy_Value;
+	Global_SleepTicks = Copy_Ticks;
+	HOST_CHECK_EQUAL(STK_TicklessIdle(Copy_MaxPeriods , &Local_SleptPeriods) , RT_OK);
+	HOST_CHECK_EQUAL(Global_Sleeps - Local_Sleeps , 1U);
+	HOST_CHECK_EQUAL(Global_SleepEnabled , TEST_ENABLE);
+	HOST_CHECK_EQUAL(Global_SleepLoad , Copy_SleepLoad);
+	HOST_CHECK_EQUAL(Local_SleptPeriods , Copy_SleptPeriods);
+
+	/* Counter is back to whole periods */
+	HOST_CHECK_EQUAL(TEST_STK_LOAD , TEST_TICKS_PER_PERIOD - 1U);
+	HOST_CHECK_EQUAL(TEST_STK_CTRL & TEST_ENABLE , TEST_ENABLE);
+	TEST_STK_CTRL &= ~TEST_COUNTFLAG;
+}
+
+/* Pending SysTick exception runs once sleeping caller unmasks interrupts */
+static void TEST_PendingTick(void)
+{
+	HOST_CHECK_EQUAL(TEST_SCB_ICSR & TEST_PENDSTSET , TEST_PENDSTSET);
+	TEST_SCB_ICSR = 0;
+	SysTick_Handler();
+}
+
+/* Tick count matches periods slept and served so far */
+static void TEST_CheckTickCount(uint64_t Copy_Periods)
+{
+	uint64_t Local_TickCount = 0;
+
+	HOST_CHECK_EQUAL(STK_GetTickCount(&Local_TickCount) , RT_OK);
+	HOST_CHECK_EQUAL(Local_TickCount , Copy_Periods);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                      TESTS                                        */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Argument checks and timers refused before the time base runs */
+static void TEST_TimerArguments(void)
+{
+	uint16_t Local_TimerId;
+	uint32_t Local_Periods;
+
+	HOST_CHECK_EQUAL(STK_TimerStart(1 , STK_TIMER_ONE_SHOT , TEST_BenchCallback , &Local_TimerId) , RT_NOK);
+	HOST_CHECK_EQUAL(STK_StartTickTimer(TEST_TICKS_PER_PERIOD , NULL) , RT_OK);
+
+	HOST_CHECK_EQUAL(STK_TimerStart(1 , STK_TIMER_ONE_SHOT , NULL , &Local_TimerId) , NULL_POINTER);
+	HOST_CHECK_EQUAL(STK_TimerStart(0 , STK_TIMER_ONE_SHOT , TEST_BenchCallback , &Local_TimerId) , RT_NOK);
+	HOST_CHECK_EQUAL(STK_TimerStart(STK_TIMER_MAX_PERIODS + 1U , STK_TIMER_ONE_SHOT , TEST_BenchCallback , &Local_TimerId) , RT_NOK);
+	HOST_CHECK_EQUAL(STK_TimerCancel(STK_TIMERS_POOL_SIZE) , RT_NOK);
+	HOST_CHECK_EQUAL(STK_GetPeriodsToNextTimer(NULL) , NULL_POINTER);
+	HOST_CHECK_EQUAL(STK_GetPeriodsToNextTimer(&Local_Periods) , RT_OK);
+	HOST_CHECK_EQUAL(Local_Periods , STK_TIMER_NO_DEADLINE);
+
+	/* Cancelled timer can not be cancelled twice */
+	HOST_CHECK_EQUAL(STK_TimerStart(10 , STK_TIMER_ONE_SHOT , TEST_BenchCallback , &Local_TimerId) , RT_OK);
+	HOST_CHECK_EQUAL(STK_TimerCancel(Local_TimerId) , RT_OK);
+	HOST_CHECK_EQUAL(STK_TimerCancel(Local_TimerId) , RT_NOK);
+}
+
+/* Whole pool can be taken, one more timer is refused */
+static void TEST_TimerPoolExhaustion(void)
+{
+	uint16_t Local_TimerId;
+	uint32_t Local_Index;
+
+	HOST_CHECK_EQUAL(STK_StartTickTimer(TEST_TICKS_PER_PERIOD , NULL) , RT_OK);
+	for(Local_Index = 0 ; Local_Index < STK_TIMERS_POOL_SIZE ; Local_Index++)
+	{
+		HOST_CHECK_EQUAL(STK_TimerStart(1000 , STK_TIMER_ONE_SHOT , TEST_BenchCallback , &Local_TimerId) , RT_OK);
+	}
+	HOST_CHECK_EQUAL(STK_TimerStart(1000 , STK_TIMER_ONE_SHOT , TEST_BenchCallback , &Local_TimerId) , BUSY_FUNC);
+	HOST_CHECK_EQUAL(STK_TimerCancel(Local_TimerId) , RT_OK);
+	HOST_CHECK_EQUAL(STK_TimerStart(1000 , STK_TIMER_ONE_SHOT , TEST_BenchCallback , &Local_TimerId) , RT_OK);
+}
+
+/* Random one-shot timers on every level plus periodic timers: every expiry lands exactly on its period, none is lost */
+static void TEST_TimerWheelSimulation(void)
+{
+	uint16_t Local_TimerId;
+	uint32_t Local_Index;
+	uint32_t Local_Periods;
+	uint32_t Local_Distance;
+	uint32_t Local_EarlyExpiries = 0;
+	uint64_t Local_TickCount;
+	void(*Local_PeriodicCallbacks[TEST_PERIODIC_TIMERS])(void) = {TEST_PeriodicCallback0 , TEST_PeriodicCallback1 , TEST_PeriodicCallback2};
+
+	memset(Global_ExpectedExpiries , 0 , sizeof(Global_ExpectedExpiries));
+	memset(Global_TimerExpiry , 0 , sizeof(Global_TimerExpiry));
+	Global_Now = 0;
+
+	HOST_CHECK_EQUAL(STK_StartTickTimer(TEST_TICKS_PER_PERIOD , NULL) , RT_OK);
+
+	/* Periodic timers keep their first expiry as phase */
+	for(Local_Index = 0 ; Local_Index < TEST_PERIODIC_TIMERS ; Local_Index++)
+	{
+		HOST_CHECK_EQUAL(STK_TimerStart(Global_PeriodicPeriods[Local_Index] , Global_PeriodicPeriods[Local_Index] , Local_PeriodicCallbacks[Local_Index] , &Local_TimerId) , RT_OK);
+	}
+
+	/* Fill rest of the pool with one-shot timers, each one is replaced when it fires */
+	while(Global_Started < (STK_TIMERS_POOL_SIZE - TEST_PERIODIC_TIMERS))
+	{
+		TEST_StartOneShot();
+	}
+
+	/* Run until every one-shot timer fired or got cancelled */
+	while((Global_Fired + Global_Cancelled) < Global_Started)
+	{
+		/* Lower bound of next deadline: nothing may be due before it */
+		if((Global_Now % TEST_DEADLINE_CHECK_EVERY) == 0)
+		{
+			STK_GetPeriodsToNextTimer(&Local_Periods);
+			for(Local_Distance = 1 ; Local_Distance < Local_Periods && Local_Distance <= TEST_HORIZON ; Local_Distance++)
+			{
+				Local_EarlyExpiries += Global_ExpectedExpiries[TEST_SLOT(Global_Now + Local_Distance)];
+			}
+		}
+
+		/* One period passes */
+		Global_Now++;
+		SysTick_Handler();
+	}
+
+	/* Every wheel level got timers and every timer fired exactly once on its due period */
+	HOST_CHECK_EQUAL(Global_LevelsUsed , 0xF);
+	HOST_CHECK_EQUAL(Global_Started , TEST_ONE_SHOT_TIMERS);
+	HOST_CHECK(Global_Cancelled > 0);
+	HOST_CHECK_EQUAL(Global_Unexpected , 0);
+	HOST_CHECK_EQUAL(Global_Fired + Global_Cancelled , Global_Started);
+	HOST_CHECK_EQUAL(Local_EarlyExpiries , 0);
+	for(Local_Index = 0 ; Local_Index < TEST_TIME_SLOTS ; Local_Index++)
+	{
+		if(Global_ExpectedExpiries[Local_Index] != 0)
+		{
+			HOST_CHECK_EQUAL(Global_ExpectedExpiries[Local_Index] , 0);
+			break;
+		}
+	}
+
+	/* Periodic timers do not drift */
+	for(Local_Index = 0 ; Local_Index < TEST_PERIODIC_TIMERS ; Local_Index++)
+	{
+		HOST_CHECK_EQUAL(Global_PeriodicJitter[Local_Index] , 0);
+		HOST_CHECK_EQUAL(Global_PeriodicCalls[Local_Index] , Global_Now / Global_PeriodicPeriods[Local_Index]);
+	}
+
+	/* Time base counted every period */
+	HOST_CHECK_EQUAL(STK_GetTickCount(&Local_TickCount) , RT_OK);
+	HOST_CHECK_EQUAL(Local_TickCount , Global_Now);
+
+	printf("STK wheel: %u one-shot timers (%u cancelled) over %u periods\n" , Global_Started , Global_Cancelled , Global_Now);
+}
+
+/* Timestamp of VAL in current period, checked against periods counted so far */
+static uint64_t TEST_Timestamp(uint32_t Copy_Value , uint64_t Copy_Periods)
+{
+	uint64_t Local_Timestamp = 0;
+
+	TEST_STK_VAL = Copy_Value;
+	HOST_CHECK_EQUAL(STK_GetTimestamp(&Local_Timestamp) , RT_OK);
+	HOST_CHECK_EQUAL(Local_Timestamp , (Copy_Periods * TEST_TICKS_PER_PERIOD) + ((TEST_TICKS_PER_PERIOD - 1U) - Copy_Value));
+
+	return Local_Timestamp;
+}
+
+/* 64 bits timestamp is monotonic across reloads, also when a reload is pending but not counted yet */
+static void TEST_Timestamp64(void)
+{
+	uint64_t Local_Timestamp;
+	uint64_t Local_Previous;
+	uint32_t Local_Period;
+
+	STK_StopTimer();
+	HOST_CHECK_EQUAL(STK_GetTimestamp(&Local_Timestamp) , RT_NOK);
+	HOST_CHECK_EQUAL(STK_StartTickTimer(TEST_TICKS_PER_PERIOD , NULL) , RT_OK);
+	HOST_CHECK_EQUAL(STK_GetTimestamp(NULL) , NULL_POINTER);
+
+	/* Counter counts down: first tick of a period right after last tick of previous one */
+	TEST_SCB_ICSR = 0;
+	Local_Previous = TEST_Timestamp(TEST_TICKS_PER_PERIOD - 1U , 0);
+	HOST_CHECK_EQUAL(Local_Previous , 0);
+	for(Local_Period = 0 ; Local_Period < 3U ; Local_Period++)
+	{
+		HOST_CHECK(TEST_Timestamp(TEST_TICKS_PER_PERIOD / 2U , Local_Period) > Local_Previous);
+		Local_Previous = TEST_Timestamp(0 , Local_Period);
+		SysTick_Handler();
+		HOST_CHECK_EQUAL(TEST_Timestamp(TEST_TICKS_PER_PERIOD - 1U , Local_Period + 1U) , Local_Previous + 1U);
+	}
+
+	/* Reload happened while SysTick exception is held off: pending period is counted */
+	Local_Previous = TEST_Timestamp(0 , 3U);
+	TEST_SCB_ICSR = TEST_PENDSTSET;
+	Local_Timestamp = TEST_Timestamp(TEST_PENDING_VALUE , 4U);
+	HOST_CHECK(Local_Timestamp > Local_Previous);
+
+	/* Exception runs: same time once period is counted by it */
+	TEST_SCB_ICSR = 0;
+	SysTick_Handler();
+	HOST_CHECK_EQUAL(TEST_Timestamp(TEST_PENDING_VALUE , 4U) , Local_Timestamp);
+
+	/* Reading timestamp leaves COUNTFLAG to whoever else polls it */
+	TEST_STK_CTRL |= TEST_COUNTFLAG;
+	TEST_Timestamp(0 , 4U);
+	HOST_CHECK_EQUAL(TEST_STK_CTRL & TEST_COUNTFLAG , TEST_COUNTFLAG);
+
+	/* Ticks past 32 bits are kept */
+	for(Local_Period = 4U ; Local_Period < TEST_WIDE_PERIODS ; Local_Period++)
+	{
+		SysTick_Handler();
+	}
+	Local_Timestamp = TEST_Timestamp(TEST_TICKS_PER_PERIOD / 2U , TEST_WIDE_PERIODS);
+	HOST_CHECK(Local_Timestamp > 0xFFFFFFFFULL);
+}
+
+/* Tick is suppressed up to next deadline, timers still fire on their period after a full or an early wake-up */
+static void TEST_TicklessIdle(void)
+{
+	uint16_t Local_TimerId;
+	uint32_t Local_SleptPeriods;
+	uint32_t Local_Period;
+
+	STK_StopTimer();
+	HOST_CHECK_EQUAL(STK_TicklessIdle(TEST_IDLE_DEADLINE , &Local_SleptPeriods) , RT_NOK);
+	HOST_CHECK_EQUAL(STK_StartTickTimer(TEST_TICKS_PER_PERIOD , NULL) , RT_OK);
+	HOST_CHECK_EQUAL(STK_TicklessIdle(TEST_IDLE_DEADLINE , NULL) , NULL_POINTER);
+	HOST_SetWaitForInterruptHook(TEST_SleepHook);
+	TEST_SCB_ICSR = 0;
+	Global_BenchCalls = 0;
+
+	/* Full sleep from mid period: last period is left to SysTick exception, which fires the timer */
+	HOST_CHECK_EQUAL(STK_TimerStart(TEST_IDLE_DEADLINE , STK_TIMER_ONE_SHOT , TEST_BenchCallback , &Local_TimerId) , RT_OK);
+	TEST_Idle(TEST_TICKS_PER_PERIOD / 2U , STK_TIMER_NO_DEADLINE ,
+			  (TEST_TICKS_PER_PERIOD / 2U) + ((TEST_IDLE_DEADLINE - 1U) * TEST_TICKS_PER_PERIOD) + 1U + TEST_IDLE_LATE_TICKS ,
+			  (TEST_TICKS_PER_PERIOD / 2U) + ((TEST_IDLE_DEADLINE - 1U) * TEST_TICKS_PER_PERIOD) , TEST_IDLE_DEADLINE - 1U);
+	TEST_CheckTickCount(TEST_IDLE_DEADLINE - 1U);
+	HOST_CHECK_EQUAL(Global_BenchCalls , 0);
+	TEST_PendingTick();
+	HOST_CHECK_EQUAL(Global_BenchCalls , 1);
+	TEST_CheckTickCount(TEST_IDLE_DEADLINE);
+
+	/* Early wake-up a few ticks into a period: only whole periods are counted */
+	HOST_CHECK_EQUAL(STK_TimerStart(TEST_IDLE_DEADLINE , STK_TIMER_ONE_SHOT , TEST_BenchCallback , &Local_TimerId) , RT_OK);
+	TEST_Idle(TEST_TICKS_PER_PERIOD - 1U , STK_TIMER_NO_DEADLINE , (TEST_IDLE_EARLY_PERIODS * TEST_TICKS_PER_PERIOD) + TEST_IDLE_EARLY_TICKS ,
+			  (TEST_IDLE_DEADLINE * TEST_TICKS_PER_PERIOD) - 1U , TEST_IDLE_EARLY_PERIODS);
+	HOST_CHECK_EQUAL(TEST_SCB_ICSR & TEST_PENDSTSET , 0);
+	TEST_CheckTickCount(TEST_IDLE_DEADLINE + TEST_IDLE_EARLY_PERIODS);
+	for(Local_Period = TEST_IDLE_EARLY_PERIODS + 1U ; Local_Period < TEST_IDLE_DEADLINE ; Local_Period++)
+	{
+		SysTick_Handler();
+	}
+	HOST_CHECK_EQUAL(Global_BenchCalls , 1);
+	SysTick_Handler();
+	HOST_CHECK_EQUAL(Global_BenchCalls , 2);
+
+	/* Next deadline one period away, caller limit of one period or tick already pending: tick keeps running */
+	HOST_CHECK_EQUAL(STK_TimerStart(1 , STK_TIMER_ONE_SHOT , TEST_BenchCallback , &Local_TimerId) , RT_OK);
+	TEST_Idle(TEST_TICKS_PER_PERIOD / 2U , STK_TIMER_NO_DEADLINE , TEST_TICKS_PER_PERIOD , TEST_TICKS_PER_PERIOD - 1U , 0);
+	TEST_PendingTick();
+	HOST_CHECK_EQUAL(Global_BenchCalls , 3);
+	TEST_Idle(TEST_TICKS_PER_PERIOD / 2U , 1U , TEST_TICKS_PER_PERIOD , TEST_TICKS_PER_PERIOD - 1U , 0);
+	TEST_PendingTick();
+	TEST_SCB_ICSR = TEST_PENDSTSET;
+	TEST_Idle(TEST_TICKS_PER_PERIOD / 2U , STK_TIMER_NO_DEADLINE , 0 , TEST_TICKS_PER_PERIOD - 1U , 0);
+	TEST_PendingTick();
+	TEST_CheckTickCount((2U * TEST_IDLE_DEADLINE) + 3U);
+
+	/* Without deadline sleep is bounded by caller limit, then by counter width */
+	TEST_Idle(TEST_TICKS_PER_PERIOD - 1U , TEST_IDLE_MAX_PERIODS , TEST_IDLE_MAX_PERIODS * TEST_TICKS_PER_PERIOD ,
+			  (TEST_IDLE_MAX_PERIODS * TEST_TICKS_PER_PERIOD) - 1U , TEST_IDLE_MAX_PERIODS - 1U);
+	TEST_PendingTick();
+	TEST_Idle(TEST_TICKS_PER_PERIOD - 1U , STK_TIMER_NO_DEADLINE , TEST_IDLE_COUNTER_PERIODS * TEST_TICKS_PER_PERIOD ,
+			  (TEST_IDLE_COUNTER_PERIODS * TEST_TICKS_PER_PERIOD) - 1U , TEST_IDLE_COUNTER_PERIODS - 1U);
+	HOST_CHECK(Global_SleepLoad <= STK_MAX_VALUE);
+	TEST_PendingTick();
+	TEST_CheckTickCount((2U * TEST_IDLE_DEADLINE) + 3U + TEST_IDLE_MAX_PERIODS + TEST_IDLE_COUNTER_PERIODS);
+
+	HOST_SetWaitForInterruptHook(NULL);
+}
+
+/* Longest delay lands on level 3 and fires on time */
+static void TEST_TimerMaxDelay(void)
+{
+	uint16_t Local_TimerId;
+	uint32_t Local_Period;
+
+	Global_BenchCalls = 0;
+	HOST_CHECK_EQUAL(STK_StartTickTimer(TEST_TICKS_PER_PERIOD , NULL) , RT_OK);
+	HOST_CHECK_EQUAL(STK_TimerStart(STK_TIMER_MAX_PERIODS , STK_TIMER_ONE_SHOT , TEST_BenchCallback , &Local_TimerId) , RT_OK);
+	for(Local_Period = 1 ; Local_Period < STK_TIMER_MAX_PERIODS ; Local_Period++)
+	{
+		SysTick_Handler();
+	}
+	HOST_CHECK_EQUAL(Global_BenchCalls , 0);
+	SysTick_Handler();
+	HOST_CHECK_EQUAL(Global_BenchCalls , 1);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                    BENCHMARKS                                     */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+
+/* Cost of one SysTick period with an empty wheel and with a full pool spread over all levels */
+static void BENCH_TimerWheel(void)
+{
+	uint16_t Local_TimerId;
+	uint32_t Local_Index;
+	uint64_t Local_Start;
+
+	printf("STK timer wheel (host time per SysTick period):\n");
+
+	STK_StartTickTimer(TEST_TICKS_PER_PERIOD , NULL);
+	Local_Start = HOST_TimeNs();
+	for(Local_Index = 0 ; Local_Index < TEST_BENCH_PERIODS ; Local_Index++)
+	{
+		SysTick_Handler();
+	}
+	HOST_Report("empty wheel" , HOST_TimeNs() - Local_Start , TEST_BENCH_PERIODS , 0);
+
+	STK_StartTickTimer(TEST_TICKS_PER_PERIOD , NULL);
+	for(Local_Index = 0 ; Local_Index < STK_TIMERS_POOL_SIZE ; Local_Index++)
+	{
+		STK_TimerStart(TEST_RandomDelay() , TEST_RandomDelay() , TEST_BenchCallback , &Local_TimerId);
+	}
+	Local_Start = HOST_TimeNs();
+	for(Local_Index = 0 ; Local_Index < TEST_BENCH_PERIODS ; Local_Index++)
+	{
+		SysTick_Handler();
+	}
+	HOST_Report("full pool of periodic timers" , HOST_TimeNs() - Local_Start , TEST_BENCH_PERIODS , 0);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/*                                                                                   */
+/*                                      MAIN                                         */
+/*                                                                                   */
+/*-----------------------------------------------------------------------------------*/
+int main(int argc , char** argv)
+{
+	uint8_t Local_Benchmark = HOST_IsBenchmarkRun(argc , argv);
+
+	HOST_ModelInit(0);
+
+	if(Local_Benchmark == 1)
+	{
+		BENCH_TimerWheel();
+	}
+	else
+	{
+		TEST_TimerArguments();
+		TEST_TimerPoolExhaustion();
+		TEST_TimerWheelSimulation();
+		TEST_Timestamp64();
+		TEST_TicklessIdle();
+		TEST_TimerMaxDelay();
+	}
+
+	return HOST_Summary("STK");
+}